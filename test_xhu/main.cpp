@@ -34,16 +34,363 @@ void callback(CSOUND *csound,
     printf("Sound ended : %s - %s\n", channelName, value);
 }
 
+void benchmark_perform_modes(xhu_engine_t *engine)
+{
+    const xhu_u32_t blocks[] = { 1, 4, 16, 64 };
+    const xhu_u32_t block_settings = sizeof(blocks) / sizeof(blocks[0]);
+    xhu_render_stats_t stats;
+    
+    for (xhu_u32_t i = 0; i <= block_settings; ++i) {
+        bool buffer_mode = i == block_settings;
+        
+        xhu_set_perform_mode(engine, buffer_mode ? XHU_PERFORM_BUFFER : XHU_PERFORM_KSMPS, buffer_mode ? 1 : blocks[i]);
+        xhu_reset_render_stats(engine);
+        xhu_pause(2);
+        xhu_get_render_stats(engine, &stats);
+        
+        if (buffer_mode) {
+            printf("buffer mode: ");
+        } else {
+            printf("%2u blocks per wakeup: ", blocks[i]);
+        }
+        
+        printf("%llu wakeups, %.3f ms CPU per rendered second\n",
+               (unsigned long long)stats.wakeup_count,
+               stats.cpu_ms_per_rendered_second);
+    }
+}
+
+void benchmark_host_render(xhu_engine_t *engine)
+{
+    const xhu_u32_t frames_per_callback = 256;
+    const xhu_u32_t callbacks = 10 * xhu_get_sample_rate(engine) / frames_per_callback;
+    xhu_f32_t *buffer = (xhu_f32_t *)malloc(frames_per_callback * 2 * sizeof(xhu_f32_t));
+    xhu_render_stats_t stats;
+    
+    for (xhu_u32_t i = 0; i < callbacks; ++i) {
+        xhu_render(engine, buffer, frames_per_callback);
+    }
+    
+    xhu_get_render_stats(engine, &stats);
+    printf("%llu callbacks of %u frames, %.3f ms CPU per rendered second\n",
+           (unsigned long long)stats.wakeup_count,
+           frames_per_callback,
+           stats.cpu_ms_per_rendered_second);
+    free(buffer);
+}
+
+void benchmark_scheduled_events(xhu_engine_t *engine)
+{
+    const xhu_u32_t event_count = 200;
+    const xhu_u64_t spacing_ns = 10 * XHU_NS_PER_MS;
+    const xhu_u64_t lead_ns = 20 * XHU_NS_PER_MS;
+    xhu_audio_data_t parameters[3] = { 1, 0, 0.005 };
+    xhu_event_stats_t stats;
+    
+    for (xhu_u32_t i = 0; i < event_count; ++i) {
+        xhu_schedule_event_at_time(engine, xhu_time_now_ns() + lead_ns, 'i', parameters, 3);
+        xhu_sleep_ns(spacing_ns);
+    }
+    
+    xhu_sleep_ns(2 * lead_ns);
+    xhu_get_event_stats(engine, &stats);
+    printf("%llu events dispatched, %llu late (max %lld samples, mean %.1f samples), %llu dropped\n",
+           (unsigned long long)stats.dispatched_count,
+           (unsigned long long)stats.late_count,
+           (long long)stats.max_late_samples,
+           stats.mean_late_samples,
+           (unsigned long long)stats.dropped_count);
+    printf("%llu timed events, start error %.1f to %.1f us (mean %.1f us), jitter %.1f us\n",
+           (unsigned long long)stats.timed_count,
+           stats.min_timing_error_us,
+           stats.max_timing_error_us,
+           stats.mean_timing_error_us,
+           stats.max_timing_error_us - stats.min_timing_error_us);
+}
+
+void benchmark_event_batches(xhu_engine_t *engine)
+{
+    const xhu_u32_t batch_size = 40;
+    const xhu_u32_t batch_count = 100;
+    xhu_event_t events[batch_size];
+    xhu_s32_t results[batch_size];
+    
+    for (xhu_u32_t i = 0; i < batch_size; ++i) {
+        events[i].type = 'i';
+        events[i].parameter_count = 3;
+        events[i].parameters[0] = 1;
+        events[i].parameters[1] = 0;
+        events[i].parameters[2] = 0.001;
+    }
+    
+    xhu_u64_t start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t batch = 0; batch < batch_count; ++batch) {
+        for (xhu_u32_t i = 0; i < batch_size; ++i) {
+            xhu_send_score_event(engine, events[i].type, events[i].parameters, events[i].parameter_count);
+        }
+    }
+    
+    xhu_f64_t per_call_seconds = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_SECOND;
+    start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t batch = 0; batch < batch_count; ++batch) {
+        xhu_send_score_events(engine, events, batch_size, results);
+    }
+    
+    xhu_f64_t batched_seconds = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_SECOND;
+    
+    printf("per call: %.0f events/s, batches of %u: %.0f events/s\n",
+           batch_size * batch_count / per_call_seconds,
+           batch_size,
+           batch_size * batch_count / batched_seconds);
+}
+
+void benchmark_table_upload(xhu_engine_t *engine)
+{
+    const xhu_s32_t table = 50;
+    const xhu_u32_t size = 65536;
+    const xhu_u32_t partial_size = 4096;
+    xhu_audio_data_t *data = (xhu_audio_data_t *)malloc(size * sizeof(xhu_audio_data_t));
+    xhu_audio_data_t line[] = { table, 0, size, 7, 0, size, 0 };
+    xhu_future_t future;
+    
+    for (xhu_u32_t i = 0; i < size; ++i) {
+        data[i] = sin(2.0 * M_PI * i / size);
+    }
+    
+    xhu_audio_data_t *pfields = (xhu_audio_data_t *)malloc(sizeof(line));
+    memcpy(pfields, line, sizeof(line));
+    xhu_init_future(&future, NULL, NULL);
+    xhu_send_table_event_async(engine, pfields, sizeof(line) / sizeof(line[0]), &future);
+    xhu_wait_future(&future);
+    
+    // Per-element baseline on a bare instance, without the pause the old path also paid for
+    CSOUND *csound = csoundCreate(NULL);
+    csoundSetOption(csound, (char *)"-n");
+    csoundSetOption(csound, (char *)"-m0");
+    csoundCompileOrc(csound, "gitable ftgen 50, 0, 65536, 7, 0, 65536, 0\n");
+    csoundStart(csound);
+    
+    xhu_u64_t start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t i = 0; i < size; ++i) {
+        csoundTableSet(csound, table, i, data[i]);
+    }
+    
+    xhu_f64_t per_element_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    csoundDestroy(csound);
+    
+    start_ns = xhu_time_now_ns();
+    xhu_set_table_data(engine, table, data, size);
+    xhu_f64_t bulk_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    start_ns = xhu_time_now_ns();
+    xhu_set_table_range(engine, table, size - partial_size, data, partial_size);
+    xhu_f64_t partial_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    printf("%u values: csoundTableSet loop %.3f ms, bulk upload %.3f ms, %u value partial update %.3f ms\n",
+           size,
+           per_element_ms,
+           bulk_ms,
+           partial_size,
+           partial_ms);
+    free(data);
+}
+
+void count_table_load(xhu_s32_t number, xhu_table_state state, void *user_data)
+{
+    if (state == XHU_TABLE_READY) {
+        __atomic_add_fetch((xhu_u32_t *)user_data, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void benchmark_table_loads(xhu_engine_t *engine)
+{
+    const xhu_u32_t table_count = 200;
+    const xhu_u32_t size = 4096;
+    xhu_f32_t values[] = { 0.0f, 1.0f, 0.5f, 0.25f };
+    xhu_immediate_table_t table = { { 0, 0, size, 10 }, values, 4 };
+    xhu_table_load_t *loads[table_count];
+    xhu_u32_t ready_count = 0;
+    
+    // One creation after the other, as a bank used to load
+    xhu_u64_t start_ns = xhu_time_now_ns();
+    
+    // Each call stores the number it allocated, a zero asks for a new one
+    for (xhu_u32_t i = 0; i < table_count; ++i) {
+        table.base.number = 0;
+        xhu_create_immediate_table(engine, &table);
+    }
+    
+    xhu_f64_t sequential_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    start_ns = xhu_time_now_ns();
+    
+    // The synchronous loop left its last number in the table, every load allocates its own
+    for (xhu_u32_t i = 0; i < table_count; ++i) {
+        table.base.number = 0;
+        loads[i] = xhu_load_immediate_table(engine, &table, count_table_load, &ready_count);
+    }
+    
+    xhu_f64_t submit_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    for (xhu_u32_t i = 0; i < table_count; ++i) {
+        xhu_release_table_load(loads[i]);
+    }
+    
+    xhu_f64_t parallel_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    printf("%u tables: sequential %.3f ms, in flight %.3f ms (%.3f ms to submit), %u ready\n",
+           table_count,
+           sequential_ms,
+           parallel_ms,
+           submit_ms,
+           __atomic_load_n(&ready_count, __ATOMIC_RELAXED));
+}
+
+void benchmark_wavetables(xhu_engine_t *engine)
+{
+    const xhu_u32_t table_count = 512;
+    const xhu_u32_t size = 2048;
+    const xhu_u32_t harmonic_count = 64;
+    xhu_f32_t amplitudes[harmonic_count];
+    xhu_audio_data_t *samples = (xhu_audio_data_t *)malloc(size * sizeof(xhu_audio_data_t));
+    xhu_table_load_t *loads[table_count];
+    xhu_u32_t ready_count = 0;
+    
+    // Band-limited sawtooth, each table with a slightly different tilt
+    for (xhu_u32_t k = 0; k < harmonic_count; ++k) {
+        amplitudes[k] = 1.0f / (k + 1);
+    }
+    
+    xhu_u64_t start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t i = 0; i < table_count; ++i) {
+        xhu_gen_harmonics(samples, size, amplitudes, harmonic_count);
+        xhu_gen_normalize(samples, size);
+    }
+    
+    xhu_f64_t kernel_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t i = 0; i < table_count; ++i) {
+        amplitudes[harmonic_count - 1] = (xhu_f32_t)i / table_count;
+        xhu_immediate_table_t table = { { 0, 0, size, 10 }, amplitudes, harmonic_count };
+        loads[i] = xhu_load_immediate_table(engine, &table, count_table_load, &ready_count);
+    }
+    
+    for (xhu_u32_t i = 0; i < table_count; ++i) {
+        xhu_release_table_load(loads[i]);
+    }
+    
+    xhu_f64_t load_ms = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / XHU_NS_PER_MS;
+    
+    printf("%u wavetables of %u harmonics: %.3f ms in the kernels on one thread, %.3f ms loaded, %u ready\n",
+           table_count,
+           harmonic_count,
+           kernel_ms,
+           load_ms,
+           __atomic_load_n(&ready_count, __ATOMIC_RELAXED));
+    
+    free(samples);
+}
+
+void benchmark_channels(xhu_engine_t *engine)
+{
+    const xhu_u32_t channel_count = 256;
+    const xhu_u32_t rounds = 1000;
+    const xhu_channel_handle_t *handles[channel_count];
+    char names[channel_count][32];
+    
+    for (xhu_u32_t i = 0; i < channel_count; ++i) {
+        snprintf(names[i], sizeof(names[i]), "%u", i);
+        handles[i] = create_channel(engine, INPUT, ACTIVE, "bench", names[i]);
+        snprintf(names[i], sizeof(names[i]), "i.bench.%u", i);
+    }
+    
+    xhu_u64_t start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t round = 0; round < rounds; ++round) {
+        for (xhu_u32_t i = 0; i < channel_count; ++i) {
+            set_channel_value(engine, handles[i], (xhu_audio_data_t)round);
+        }
+    }
+    
+    xhu_f64_t handle_ns = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / (rounds * channel_count);
+    
+    start_ns = xhu_time_now_ns();
+    
+    for (xhu_u32_t round = 0; round < rounds; ++round) {
+        for (xhu_u32_t i = 0; i < channel_count; ++i) {
+            xhu_set_control_channel_value(engine, (xhu_audio_data_t)round, names[i]);
+        }
+    }
+    
+    xhu_f64_t name_ns = (xhu_f64_t)(xhu_time_now_ns() - start_ns) / (rounds * channel_count);
+    
+    printf("%u channels: %.1f ns per write through a handle, %.1f ns per write by name\n",
+           channel_count,
+           handle_ns,
+           name_ns);
+}
+
+typedef struct {
+    const char *flag;
+    xhu_output_mode output_mode;
+    void (*run)(xhu_engine_t *engine);
+} benchmark_t;
+
+static const benchmark_t benchmarks[] = {
+    { "--bench-perform", XHU_OUTPUT_REALTIME, benchmark_perform_modes },
+    { "--bench-events", XHU_OUTPUT_REALTIME, benchmark_scheduled_events },
+    { "--bench-batch", XHU_OUTPUT_REALTIME, benchmark_event_batches },
+    { "--bench-table-upload", XHU_OUTPUT_REALTIME, benchmark_table_upload },
+    { "--bench-table-load", XHU_OUTPUT_REALTIME, benchmark_table_loads },
+    { "--bench-wavetables", XHU_OUTPUT_REALTIME, benchmark_wavetables },
+    { "--bench-channels", XHU_OUTPUT_REALTIME, benchmark_channels },
+    { "--bench-host", XHU_OUTPUT_HOST, benchmark_host_render },
+};
+
+int run_benchmark(const benchmark_t *benchmark)
+{
+    xhu_log_level = XHU_LOG_LEVEL_ERROR;
+    
+    xhu_engine_options_t options;
+    xhu_get_default_engine_options(&options);
+    options.output_mode = benchmark->output_mode;
+    xhu_engine_t *engine = xhu_start(&options);
+    
+    if (engine == NULL) {
+        exit(EXIT_FAILURE);
+    }
+    
+    benchmark->run(engine);
+    xhu_destroy_engine(engine);
+    
+    return 0;
+}
+
 int main(int argc, const char * argv[])
 {
     atexit(on_exit);
     xhu_log_level = XHU_LOG_LEVEL_DEBUG;
     xhu_log_with_func_info = false;
-
-    if (!xhu_start(false))
+    
+    for (xhu_u32_t i = 0; argc > 1 && i < sizeof(benchmarks) / sizeof(benchmarks[0]); ++i)
+    {
+        if (strcmp(argv[1], benchmarks[i].flag) == 0)
+        {
+            return run_benchmark(&benchmarks[i]);
+        }
+    }
+    
+    xhu_engine_t *engine = xhu_start(NULL);
+    
+    if (engine == NULL)
     {
         XHU_LOG_FATAL("Xhu engine failed initialization")
-        xhu_stop();
         exit(EXIT_FAILURE);
     }
     else
@@ -59,20 +406,20 @@ int main(int argc, const char * argv[])
     
     xhu_pause(2);
 
-    xhu_set_output_channel_callback(callback);
-    xhu_set_control_channel_value(0.4f, "i.1.000000.pitch");
-    xhu_send_message("i1 0 4");
+    xhu_set_output_channel_callback(engine, callback);
+    xhu_set_control_channel_value(engine, 0.4f, "i.1.000000.pitch");
+    xhu_send_message(engine, "i1 0 4");
     xhu_pause(2);
     
     xhu_s32_t flags = CSOUND_OUTPUT_CHANNEL | CSOUND_CONTROL_CHANNEL;
-    xhu_audio_data_t *output_channel_pointer = xhu_get_channel_pointer("o.1.000000.pitch", flags);
+    xhu_audio_data_t *output_channel_pointer = xhu_get_channel_pointer(engine, "o.1.000000.pitch", flags);
     xhu_audio_data_t value = xhu_get_control_channel_value(output_channel_pointer);
     XHU_LOG_INFO("Received value %f from channel o.1.000000.pitch", value)
-    xhu_set_control_channel_value(0.3f, "i.1.000000.pitch");
+    xhu_set_control_channel_value(engine, 0.3f, "i.1.000000.pitch");
     
     xhu_pause(3);
     
-    xhu_stop();
+    xhu_destroy_engine(engine);
     
     return 0;
 }
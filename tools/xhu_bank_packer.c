@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ Packs sound files into one bank for xhu_open_bank.
+ 
+ Build: cc -std=gnu99 -Ixhu/inc -Iext/csound/release/inc tools/xhu_bank_packer.c -lsndfile -o xhu_bank_packer
+ Usage: xhu_bank_packer <bank> <sound file>...
+ 
+ Every file is decoded to interleaved xhu_audio_data_t and stored under its
+ name without directory and extension. Names must be unique in a bank.
+ */
+
+// Bank offsets go past 2 GB, fseeko takes a 64-bit off_t on every platform
+#define _FILE_OFFSET_BITS 64
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sndfile.h>
+#include "xhu_bank.h"
+
+#define XHU_PACKER_CHUNK_FRAMES (65536)
+
+// sf_readf_double decodes straight into xhu_audio_data_t buffers
+_Static_assert(sizeof(xhu_audio_data_t) == sizeof(double), "MYFLT must be double to decode with sf_readf_double");
+
+typedef struct {
+    const char *path;
+    xhu_bank_entry_t entry;
+} xhu_packer_input_t;
+
+static xhu_u64_t xhu_align(xhu_u64_t offset)
+{
+    return (offset + XHU_BANK_ALIGNMENT - 1) / XHU_BANK_ALIGNMENT * XHU_BANK_ALIGNMENT;
+}
+
+static int xhu_compare_inputs(const void *a, const void *b)
+{
+    return strncmp(((const xhu_packer_input_t *)a)->entry.name, ((const xhu_packer_input_t *)b)->entry.name, XHU_BANK_NAME_SIZE);
+}
+
+static bool xhu_read_input_info(xhu_packer_input_t *input)
+{
+    SF_INFO info;
+    memset(&info, 0, sizeof(info));
+    SNDFILE *file = sf_open(input->path, SFM_READ, &info);
+    
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s: %s\n", input->path, sf_strerror(NULL));
+        return false;
+    }
+    
+    sf_close(file);
+    
+    const char *name = strrchr(input->path, '/');
+    name = name != NULL ? name + 1 : input->path;
+    const char *extension = strrchr(name, '.');
+    size_t length = extension != NULL ? (size_t)(extension - name) : strlen(name);
+    
+    if (length >= XHU_BANK_NAME_SIZE) {
+        fprintf(stderr, "Name of %s is longer than %d characters\n", input->path, XHU_BANK_NAME_SIZE - 1);
+        return false;
+    }
+    
+    memset(input->entry.name, 0, XHU_BANK_NAME_SIZE);
+    memcpy(input->entry.name, name, length);
+    input->entry.frame_count = info.frames;
+    input->entry.channel_count = info.channels;
+    input->entry.sample_rate = info.samplerate;
+    
+    return true;
+}
+
+static bool xhu_write_input_samples(FILE *bank, xhu_packer_input_t *input, xhu_audio_data_t *buffer)
+{
+    SF_INFO info;
+    memset(&info, 0, sizeof(info));
+    SNDFILE *file = sf_open(input->path, SFM_READ, &info);
+    xhu_u64_t written = 0;
+    
+    if (file == NULL || fseeko(bank, (off_t)input->entry.offset, SEEK_SET) != 0) {
+        fprintf(stderr, "Could not pack %s\n", input->path);
+        
+        if (file != NULL) {
+            sf_close(file);
+        }
+        
+        return false;
+    }
+    
+    while (written < input->entry.frame_count) {
+        sf_count_t frames = sf_readf_double(file, buffer, XHU_PACKER_CHUNK_FRAMES);
+        
+        if (frames <= 0) {
+            break;
+        }
+        
+        if (fwrite(buffer, sizeof(xhu_audio_data_t) * info.channels, (size_t)frames, bank) != (size_t)frames) {
+            fprintf(stderr, "Could not write samples of %s\n", input->path);
+            sf_close(file);
+            
+            return false;
+        }
+        
+        written += frames;
+    }
+    
+    sf_close(file);
+    
+    // A file shorter than its header claims keeps the frames that could be read
+    input->entry.frame_count = written;
+    
+    return true;
+}
+
+int main(int argc, const char *argv[])
+{
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <bank> <sound file>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    xhu_u32_t input_count = argc - 2;
+    xhu_packer_input_t *inputs = (xhu_packer_input_t *)calloc(input_count, sizeof(xhu_packer_input_t));
+    xhu_u32_t max_channels = 1;
+    
+    if (inputs == NULL) {
+        return EXIT_FAILURE;
+    }
+    
+    for (xhu_u32_t i = 0; i < input_count; ++i) {
+        inputs[i].path = argv[i + 2];
+        
+        if (!xhu_read_input_info(&inputs[i])) {
+            return EXIT_FAILURE;
+        }
+        
+        if (inputs[i].entry.channel_count > max_channels) {
+            max_channels = inputs[i].entry.channel_count;
+        }
+    }
+    
+    // The runtime looks names up with a binary search
+    qsort(inputs, input_count, sizeof(xhu_packer_input_t), xhu_compare_inputs);
+    
+    for (xhu_u32_t i = 1; i < input_count; ++i) {
+        if (xhu_compare_inputs(&inputs[i - 1], &inputs[i]) == 0) {
+            fprintf(stderr, "%s and %s have the same name\n", inputs[i - 1].path, inputs[i].path);
+            return EXIT_FAILURE;
+        }
+    }
+    
+    xhu_bank_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = XHU_BANK_MAGIC;
+    header.version = XHU_BANK_VERSION;
+    header.entry_count = input_count;
+    header.sample_size = sizeof(xhu_audio_data_t);
+    header.index_offset = sizeof(xhu_bank_header_t);
+    
+    xhu_u64_t offset = header.index_offset + (xhu_u64_t)input_count * sizeof(xhu_bank_entry_t);
+    
+    for (xhu_u32_t i = 0; i < input_count; ++i) {
+        offset = xhu_align(offset);
+        inputs[i].entry.offset = offset;
+        offset += inputs[i].entry.frame_count * inputs[i].entry.channel_count * sizeof(xhu_audio_data_t);
+    }
+    
+    FILE *bank = fopen(argv[1], "wb");
+    xhu_audio_data_t *buffer = (xhu_audio_data_t *)malloc(XHU_PACKER_CHUNK_FRAMES * max_channels * sizeof(xhu_audio_data_t));
+    
+    if (bank == NULL || buffer == NULL) {
+        fprintf(stderr, "Could not create %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    
+    for (xhu_u32_t i = 0; i < input_count; ++i) {
+        if (!xhu_write_input_samples(bank, &inputs[i], buffer)) {
+            fclose(bank);
+            remove(argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+    
+    // Header and index go in last, once short files have their real frame counts
+    header.file_size = offset;
+    bool written = fseeko(bank, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, bank) == 1;
+    
+    for (xhu_u32_t i = 0; written && i < input_count; ++i) {
+        written = fwrite(&inputs[i].entry, sizeof(xhu_bank_entry_t), 1, bank) == 1;
+    }
+    
+    // Pads the last entry so the file is as long as the header says
+    written = written && fflush(bank) == 0 && ftruncate(fileno(bank), (off_t)offset) == 0;
+    
+    // A bank with a valid header but missing data must not be left behind
+    if (fclose(bank) != 0 || !written) {
+        fprintf(stderr, "Could not write %s\n", argv[1]);
+        remove(argv[1]);
+        return EXIT_FAILURE;
+    }
+    
+    printf("Packed %u sounds into %s, %llu bytes\n", input_count, argv[1], (unsigned long long)offset);
+    free(buffer);
+    free(inputs);
+    
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ Writes the samples of the built-in wavetables as C source.
+ 
+ Build: cc -std=gnu99 -Ixhu/inc -Iext/csound/release/inc tools/xhu_wavetable_generator.c xhu/src/xhu_gen.c -lm -o xhu_wavetable_generator
+ Usage: xhu_wavetable_generator xhu/src/xhu_wavetable_data.c
+ 
+ Run it again after changing the table set in xhu_wavetables.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "xhu_gen.h"
+#include "xhu_wavetables.h"
+#include "xhu_math_utilities.h"
+
+#define XHU_GENERATOR_VALUES_PER_LINE (4)
+
+xhu_s32_t xhu_log_level = XHU_LOG_LEVEL_ERROR;
+bool xhu_log_with_func_info = false;
+
+static const char *xhu_wavetable_names[] = {
+    NULL,
+    "sine",
+    "saw",
+    "square",
+    "triangle",
+    "hann",
+    "hamming",
+    "blackman"
+};
+
+// Amplitudes of the band-limited waveforms for GEN10
+static void xhu_get_harmonics(xhu_wavetable wavetable, xhu_f32_t *amplitudes)
+{
+    for (xhu_u32_t k = 1; k <= XHU_WAVETABLE_HARMONICS; ++k) {
+        xhu_f32_t amplitude = 0;
+        
+        switch (wavetable) {
+            case XHU_WAVETABLE_SINE:
+                amplitude = k == 1 ? 1 : 0;
+                break;
+            case XHU_WAVETABLE_SAW:
+                amplitude = 1.0f / k;
+                break;
+            case XHU_WAVETABLE_SQUARE:
+                amplitude = k % 2 == 1 ? 1.0f / k : 0;
+                break;
+            case XHU_WAVETABLE_TRIANGLE:
+                amplitude = k % 2 == 1 ? (k % 4 == 1 ? 1.0f : -1.0f) / (k * k) : 0;
+                break;
+            default:
+                break;
+        }
+        
+        amplitudes[k - 1] = amplitude;
+    }
+}
+
+static bool xhu_generate_wavetable(xhu_wavetable wavetable, xhu_audio_data_t *samples)
+{
+    xhu_f32_t amplitudes[XHU_WAVETABLE_HARMONICS];
+    
+    switch (wavetable) {
+        case XHU_WAVETABLE_HANN:
+            // Over one more point so the guard point closes the window
+            for (xhu_u32_t i = 0; i <= XHU_WAVETABLE_SIZE; ++i) {
+                samples[i] = xhu_hann_func(i, XHU_WAVETABLE_SIZE + 1);
+            }
+            return true;
+        case XHU_WAVETABLE_HAMMING:
+            xhu_gen_window(samples, XHU_WAVETABLE_SIZE, XHU_WINDOW_HAMMING);
+            break;
+        case XHU_WAVETABLE_BLACKMAN:
+            xhu_gen_window(samples, XHU_WAVETABLE_SIZE, XHU_WINDOW_BLACKMAN);
+            break;
+        default:
+            xhu_get_harmonics(wavetable, amplitudes);
+            
+            if (!xhu_gen_harmonics(samples, XHU_WAVETABLE_SIZE, amplitudes, XHU_WAVETABLE_HARMONICS)) {
+                return false;
+            }
+            
+            xhu_gen_normalize(samples, XHU_WAVETABLE_SIZE);
+            break;
+    }
+    
+    // Periodic tables wrap around at the guard point
+    samples[XHU_WAVETABLE_SIZE] = samples[0];
+    
+    return true;
+}
+
+int main(int argc, const char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <source file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    FILE *file = fopen(argv[1], "w");
+    xhu_audio_data_t samples[XHU_WAVETABLE_SIZE + 1];
+    
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    
+    fprintf(file, "/* Generated by tools/xhu_wavetable_generator.c, do not edit */\n\n");
+    fprintf(file, "#include \"xhu_wavetables.h\"\n\n");
+    fprintf(file, "const xhu_audio_data_t xhu_wavetable_data[XHU_WAVETABLE_LAST][XHU_WAVETABLE_SIZE + 1] = {\n");
+    
+    for (xhu_s32_t wavetable = XHU_WAVETABLE_SINE; wavetable <= XHU_WAVETABLE_LAST; ++wavetable) {
+        if (!xhu_generate_wavetable((xhu_wavetable)wavetable, samples)) {
+            fprintf(stderr, "Could not generate %s\n", xhu_wavetable_names[wavetable]);
+            fclose(file);
+            return EXIT_FAILURE;
+        }
+        
+        fprintf(file, "    /* %s */\n    {\n", xhu_wavetable_names[wavetable]);
+        
+        for (xhu_u32_t i = 0; i <= XHU_WAVETABLE_SIZE; ++i) {
+            bool line_start = i % XHU_GENERATOR_VALUES_PER_LINE == 0;
+            bool line_end = (i + 1) % XHU_GENERATOR_VALUES_PER_LINE == 0 || i == XHU_WAVETABLE_SIZE;
+            
+            fprintf(file, "%s%.17g%s", line_start ? "        " : " ", samples[i], line_end ? ",\n" : ",");
+        }
+        
+        fprintf(file, "    }%s\n", wavetable < XHU_WAVETABLE_LAST ? "," : "");
+    }
+    
+    fprintf(file, "};\n");
+    
+    if (fclose(file) != 0) {
+        fprintf(stderr, "Could not write %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    
+    return EXIT_SUCCESS;
+}
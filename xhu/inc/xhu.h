@@ -22,6 +22,10 @@
 
 #include "xhu_defs.h"
 #include "xhu_table.h"
+#include "xhu_gen.h"
+#include "xhu_wavetables.h"
+#include "xhu_bank.h"
+#include "xhu_cache.h"
 #include "xhu_sound.h"
 #include "xhu_channel.h"
 #include "xhu_debug.h"
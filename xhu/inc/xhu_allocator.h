@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_ALLOCATOR_H
+#define XHU_ALLOCATOR_H
+
+#include <stdbool.h>
+#include <pthread.h>
+#include "xhu_defs.h"
+
+/*
+ Table number handed out by an engine. The generation changes every time the
+ number is released, so a handle kept past xhu_free_table no longer
+ validates even once the number is reused. Generation 0 is never issued.
+ */
+typedef struct {
+    xhu_s32_t number;
+    xhu_u32_t generation;
+} xhu_table_handle_t;
+
+/*
+ Numbers Csound has seen are first to first + extent - 1; holes are the ones
+ among them not in use right now. Released numbers are reused before the
+ extent grows, so the ftable array only grows with the peak table count.
+ */
+typedef struct {
+    xhu_u32_t capacity;
+    xhu_u32_t in_use;
+    xhu_u32_t extent;
+    xhu_u32_t hole_count;
+    xhu_f64_t fragmentation;    /* hole_count / extent */
+} xhu_table_number_stats_t;
+
+/* Free list of numbers from first to first + capacity - 1, O(1) both ways */
+typedef struct {
+    pthread_mutex_t mutex;
+    xhu_s32_t first;
+    xhu_u32_t capacity;
+    xhu_u32_t *generations;
+    xhu_u32_t *next_free;
+    xhu_u32_t free_head;
+    xhu_u32_t extent;
+    xhu_u32_t in_use;
+} xhu_number_allocator_t;
+
+EXTERN_C bool xhu_number_allocator_init(xhu_number_allocator_t *allocator, xhu_s32_t first, xhu_u32_t capacity);
+EXTERN_C void xhu_number_allocator_destroy(xhu_number_allocator_t *allocator);
+/* Number 0 when every number is in use */
+EXTERN_C xhu_table_handle_t xhu_number_allocator_acquire(xhu_number_allocator_t *allocator);
+EXTERN_C bool xhu_number_allocator_release(xhu_number_allocator_t *allocator, xhu_table_handle_t handle);
+EXTERN_C bool xhu_number_allocator_is_valid(xhu_number_allocator_t *allocator, xhu_table_handle_t handle);
+/* True for numbers in the range of the allocator that it has not handed out */
+EXTERN_C bool xhu_number_allocator_is_reserved(xhu_number_allocator_t *allocator, xhu_s32_t number);
+EXTERN_C void xhu_number_allocator_get_stats(xhu_number_allocator_t *allocator, xhu_table_number_stats_t *stats);
+
+#endif // XHU_ALLOCATOR_H
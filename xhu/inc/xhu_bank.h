@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_BANK_H
+#define XHU_BANK_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+#include "xhu_table.h"
+
+/*
+ Sound bank written by tools/xhu_bank_packer.c. The file holds a header, an
+ index sorted by name and the PCM of every sound, already decoded to
+ interleaved xhu_audio_data_t and aligned to XHU_BANK_ALIGNMENT bytes, so the
+ runtime maps the file once and copies samples into tables without parsing
+ or converting anything. All fields are in host byte order.
+ */
+#define XHU_BANK_MAGIC (0x42554858u) /* "XHUB" */
+#define XHU_BANK_VERSION (1)
+#define XHU_BANK_ALIGNMENT (64)
+#define XHU_BANK_NAME_SIZE (56)
+
+typedef struct {
+    xhu_u32_t magic;
+    xhu_u32_t version;
+    xhu_u32_t entry_count;
+    xhu_u32_t sample_size;  /* sizeof(xhu_audio_data_t) of the packer */
+    xhu_u64_t index_offset;
+    xhu_u64_t file_size;
+} xhu_bank_header_t;
+
+typedef struct {
+    char name[XHU_BANK_NAME_SIZE];  /* file name without directory and extension */
+    xhu_u64_t offset;
+    xhu_u64_t frame_count;
+    xhu_u32_t channel_count;
+    xhu_u32_t sample_rate;
+} xhu_bank_entry_t;
+
+typedef struct xhu_bank_s xhu_bank_t;
+
+/* Maps a bank, a relative path being resolved against SSDIR */
+EXTERN_C xhu_bank_t *xhu_open_bank(const char *filename);
+EXTERN_C void xhu_close_bank(xhu_bank_t *bank);
+EXTERN_C xhu_u32_t xhu_get_bank_entry_count(const xhu_bank_t *bank);
+EXTERN_C const xhu_bank_entry_t *xhu_get_bank_entry(const xhu_bank_t *bank, xhu_u32_t index);
+EXTERN_C const xhu_bank_entry_t *xhu_find_bank_entry(const xhu_bank_t *bank, const char *name);
+/* Samples of an entry inside the mapping, no copy is made */
+EXTERN_C const xhu_audio_data_t *xhu_get_bank_samples(const xhu_bank_t *bank, const xhu_bank_entry_t *entry);
+/* Copies an entry into a new table; the bank must stay open until the load finished */
+EXTERN_C xhu_table_load_t *xhu_load_bank_table(xhu_engine_t *engine, const xhu_bank_t *bank, const xhu_bank_entry_t *entry, xhu_s32_t number, xhu_table_callback_t callback, void *user_data);
+
+#endif // XHU_BANK_H
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_CACHE_H
+#define XHU_CACHE_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+#include "xhu_table.h"
+#include "xhu_bank.h"
+
+#define XHU_CACHE_ASSET_ID_SIZE (64)
+
+/*
+ Tables of sample assets kept resident within a memory budget. An asset id is
+ a bank entry name when the cache has a bank, otherwise a sound file name.
+ Voices acquire an asset while they play it and release it when they stop;
+ assets nobody holds are deleted, least recently played first, once the
+ resident tables exceed the budget. Acquiring an evicted asset loads it again
+ through the async table loader.
+ 
+ Table numbers come from the engine allocator and go back to it once an
+ evicted table is deleted. The cache is used from one host thread, which
+ calls xhu_update_table_cache regularly, for example once per game frame.
+ */
+typedef struct xhu_table_cache_s xhu_table_cache_t;
+
+typedef struct {
+    xhu_u64_t budget_bytes;
+    xhu_u64_t resident_bytes;
+    xhu_u32_t resident_count;
+    xhu_u32_t loading_count;
+    xhu_u64_t hit_count;
+    xhu_u64_t miss_count;
+    xhu_u64_t eviction_count;
+} xhu_table_cache_stats_t;
+
+EXTERN_C xhu_table_cache_t *xhu_create_table_cache(xhu_engine_t *engine, const xhu_bank_t *bank, xhu_u32_t capacity, xhu_u64_t budget_bytes);
+/* Deletes every table of the cache, waiting for loads still in flight */
+EXTERN_C void xhu_destroy_table_cache(xhu_table_cache_t *cache);
+/* Table number of the asset, which may still be loading, or -1 when the cache is full */
+EXTERN_C xhu_s32_t xhu_acquire_cached_table(xhu_table_cache_t *cache, const char *asset_id);
+EXTERN_C void xhu_release_cached_table(xhu_table_cache_t *cache, const char *asset_id);
+EXTERN_C xhu_table_state xhu_get_cached_table_state(const xhu_table_cache_t *cache, const char *asset_id);
+/* Finishes loads and evictions and brings residency back under the budget */
+EXTERN_C void xhu_update_table_cache(xhu_table_cache_t *cache);
+EXTERN_C void xhu_set_table_cache_budget(xhu_table_cache_t *cache, xhu_u64_t budget_bytes);
+EXTERN_C void xhu_get_table_cache_stats(const xhu_table_cache_t *cache, xhu_table_cache_stats_t *stats);
+
+#endif // XHU_CACHE_H
@@ -23,8 +23,10 @@
 #include <stdbool.h>
 #include "xhu_defs.h"
 
-#define MAX_CHANNELS (100)
+#define MAX_CHANNELS (1024)
+#define CHANNEL_NAME_MAX_LENGTH (64)
 
+/* Slot of the channel in the registry of its engine and the hash of its name */
 typedef struct {
     xhu_u32_t map_index;
     xhu_u64_t hash;
@@ -42,19 +44,46 @@ typedef enum
     SUSPENDED
 } channel_state;
 
-EXTERN_C xhu_audio_data_t *xhu_get_channel_pointer(const char *name, xhu_s32_t flags);
+/*
+ Open-addressed map of channel names to Csound channel pointers, one per
+ engine. A name is hashed and looked up in Csound when it is registered;
+ after that, setting and getting through its handle is a read or write of the
+ channel memory. Registering is serialized, handles stay valid for the life
+ of the engine and lookups never lock.
+ */
+typedef struct xhu_channel_registry_s xhu_channel_registry_t;
+
+EXTERN_C xhu_audio_data_t *xhu_get_channel_pointer(xhu_engine_t *engine, const char *name, xhu_s32_t flags);
 EXTERN_C xhu_audio_data_t xhu_get_control_channel_value(xhu_audio_data_t *channel);
-EXTERN_C void xhu_set_control_channel_value(xhu_audio_data_t value, const char *name);
-EXTERN_C void xhu_create_channels(xhu_u32_t count);
+/*
+ Looks the name up in the registry, only the first write to a channel goes to
+ Csound. Names that do not fit in a full registry are set through Csound on
+ every write.
+ */
+EXTERN_C void xhu_set_control_channel_value(xhu_engine_t *engine, xhu_audio_data_t value, const char *name);
+EXTERN_C xhu_channel_registry_t *xhu_create_channel_registry(void);
+EXTERN_C void xhu_destroy_channel_registry(xhu_channel_registry_t *registry);
+/* Handle of the named channel, NULL when Csound refuses it or MAX_CHANNELS are registered */
+EXTERN_C const xhu_channel_handle_t *xhu_register_channel(xhu_engine_t *engine, const char *name, xhu_s32_t flags);
+/* Handle of a registered channel, NULL when the name was never registered */
+EXTERN_C const xhu_channel_handle_t *xhu_find_channel(xhu_engine_t *engine, const char *name);
+/* Channels are never unregistered, once MAX_CHANNELS are in use new names can not be registered */
+EXTERN_C bool xhu_is_channel_registry_full(xhu_engine_t *engine);
+/* Registers the output control channels "0" to "count - 1" */
+EXTERN_C void xhu_create_channels(xhu_engine_t *engine, xhu_u32_t count);
+/* Control channel named "i.<sound aggregate id>.<parameter>", or "o." for output */
 EXTERN_C const xhu_channel_handle_t *const create_channel(
+                                                         xhu_engine_t *engine,
                                                          channel_direction direction,
                                                          channel_state state,
                                                          const char *sound_aggregate_id,
                                                          const char *parameter_name
                                                          );
-EXTERN_C void xhu_suspend_channel(xhu_channel_handle_t handle);
-EXTERN_C channel_state get_channel_state(const xhu_channel_handle_t *const handle);
-EXTERN_C void set_channel_value(const xhu_channel_handle_t *const handle_pointer, xhu_audio_data_t value);
-EXTERN_C xhu_audio_data_t get_channel_value(const xhu_channel_handle_t *const handle);
+/* A suspended channel ignores set_channel_value until it is resumed */
+EXTERN_C void xhu_suspend_channel(xhu_engine_t *engine, xhu_channel_handle_t handle);
+EXTERN_C void xhu_resume_channel(xhu_engine_t *engine, xhu_channel_handle_t handle);
+EXTERN_C channel_state get_channel_state(xhu_engine_t *engine, const xhu_channel_handle_t *const handle);
+EXTERN_C void set_channel_value(xhu_engine_t *engine, const xhu_channel_handle_t *const handle_pointer, xhu_audio_data_t value);
+EXTERN_C xhu_audio_data_t get_channel_value(xhu_engine_t *engine, const xhu_channel_handle_t *const handle);
 
 #endif // XHU_CHANNEL_H
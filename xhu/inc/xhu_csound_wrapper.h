@@ -22,28 +22,290 @@
 
 #include <stdbool.h>
 #include "xhu_table.h"
+#include "xhu_time.h"
+#include "xhu_event.h"
+#include "xhu_worker.h"
+#include "xhu_stream.h"
+#include "xhu_channel.h"
+
+/*
+ * Invoked on the performance thread when a command completes, or on a worker
+ * thread for work done outside Csound; must not block. While the performance
+ * is paused, commands complete on the thread calling xhu_wait_future.
+ */
+typedef void (*xhu_future_callback_t)(xhu_future_t *future, void *user_data);
+
+/* Completion state of a command applied by the performance thread between k-cycles. */
+struct xhu_future_s {
+    xhu_s32_t done;
+    xhu_s32_t result;
+    xhu_audio_data_t value;
+    xhu_future_callback_t callback;
+    void *user_data;
+    xhu_engine_t *engine;   /* set when the command is submitted */
+    xhu_audio_data_t *data; /* table memory, for commands that return it */
+};
+
+/*
+ * Wall time spent in each startup step of an engine, in milliseconds. Creation
+ * includes loading the opcode plugin libraries; module initialization is
+ * csoundStart, which registers their opcodes and opens the audio device.
+ * Wavetables is the copy of the built-in tables into Csound. The first
+ * k-cycle is timed from performance thread creation and is 0 for host
+ * rendered engines.
+ */
+typedef struct {
+    xhu_f64_t env_setup_ms;
+    xhu_f64_t create_ms;
+    xhu_f64_t compile_ms;
+    xhu_f64_t module_init_ms;
+    xhu_f64_t wavetable_ms;
+    xhu_f64_t first_cycle_ms;
+    xhu_f64_t total_ms;
+} xhu_startup_stats_t;
+
+/* Durations of host-requested pauses of the performance thread, in milliseconds. */
+typedef struct {
+    xhu_u32_t pause_count;
+    xhu_u32_t blocked_acknowledge_count;
+    xhu_f64_t last_pause_time_ms;
+    xhu_f64_t total_pause_time_ms;
+    xhu_f64_t longest_pause_time_ms;
+    xhu_f64_t longest_acknowledge_time_ms;
+} xhu_pause_stats_t;
+
+typedef enum {
+    XHU_PERFORM_KSMPS,      /* blocks_per_wakeup calls to csoundPerformKsmps per loop iteration */
+    XHU_PERFORM_BUFFER      /* one csoundPerformBuffer call (-b samples) per loop iteration */
+} xhu_perform_mode;
+
+typedef enum {
+    XHU_OUTPUT_REALTIME,    /* output options of the .csd, usually the real-time audio device */
+    XHU_OUTPUT_FILE,        /* WAV file at output_path, rendered as fast as the CPU allows */
+    XHU_OUTPUT_MEMORY,      /* interleaved frames in output_buffer, rendered as fast as the CPU allows */
+    XHU_OUTPUT_HOST         /* no performance thread, the host audio callback pulls frames with xhu_render */
+} xhu_output_mode;
+
+typedef enum {
+    XHU_SCHED_DEFAULT,
+    XHU_SCHED_FIFO,
+    XHU_SCHED_RR
+} xhu_sched_policy;
+
+/* Bits returned by xhu_get_realtime_status for the options that took effect */
+#define XHU_REALTIME_PRIORITY (1 << 0)
+#define XHU_REALTIME_AFFINITY (1 << 1)
+#define XHU_REALTIME_MEMORY_LOCKED (1 << 2)
+#define XHU_REALTIME_STACK_PREFAULTED (1 << 3)
+
+typedef struct {
+    bool bundle;
+    xhu_perform_mode perform_mode;
+    xhu_u32_t blocks_per_wakeup;
+    xhu_u32_t buffer_size;  /* Csound -b option in sample frames, 0 keeps the .csd setting */
+    xhu_output_mode output_mode;
+    const char *output_path;
+    xhu_audio_data_t *output_buffer;
+    xhu_u64_t output_buffer_frames;
+    xhu_f32_t render_duration;  /* seconds rendered by the offline modes, 0 renders until stopped */
+    xhu_sched_policy sched_policy;
+    xhu_s32_t sched_priority;   /* clamped to the range of sched_policy */
+    xhu_s32_t cpu_affinity;     /* CPU to pin the performance thread to, -1 for no affinity */
+    bool lock_memory;           /* mlockall and pre-fault the performance thread stack */
+    const char *csd_path;       /* orchestra of this engine, NULL for Resources/csound/xhu.csd */
+    bool sample_accurate_events;    /* start scheduled events inside the k-cycle, Csound --sample-accurate */
+    xhu_u32_t worker_count;     /* threads decoding sample files off the performance thread */
+    xhu_s32_t first_dynamic_table;  /* tables from here on are numbered by xhu, keep orchestra tables below */
+    xhu_u32_t dynamic_table_count;
+} xhu_engine_options_t;
+
+/* Cost of the performance loop since the last reset. */
+typedef struct {
+    xhu_u64_t wakeup_count;
+    xhu_s64_t rendered_samples;
+    xhu_f64_t cpu_time_ms;
+    xhu_f64_t cpu_ms_per_rendered_second;
+} xhu_render_stats_t;
+
+#define XHU_CYCLE_HISTOGRAM_BUCKETS (16)
+#define XHU_CYCLE_HISTOGRAM_BUCKETS_PER_PERIOD (8)
+
+/*
+ * Render time of each k-cycle measured as performance thread CPU time.
+ * Histogram bucket i counts cycles that used i/8 to (i+1)/8 of the control
+ * period; the last bucket also collects everything slower. An overrun is a
+ * cycle that took longer than its control period.
+ */
+typedef struct {
+    xhu_u64_t cycle_count;
+    xhu_u64_t overrun_count;
+    xhu_s64_t last_overrun_sample;
+    xhu_f64_t control_period_us;
+    xhu_f64_t worst_cycle_us;
+    xhu_f64_t mean_cycle_us;
+    xhu_f64_t duty_cycle;
+    xhu_u64_t histogram[XHU_CYCLE_HISTOGRAM_BUCKETS];
+} xhu_cycle_stats_t;
+
+/*
+ * Timing of events queued with xhu_schedule_event. An event is late when it
+ * reaches the performance thread after the k-cycle containing its sample has
+ * started; it is then started at once and its lateness counts as jitter.
+ * Dropped events did not fit in the scheduler. For events queued with
+ * xhu_schedule_event_at_time the timing error is the audio clock time of the
+ * sample they started at minus the requested time, its spread is the jitter.
+ */
+typedef struct {
+    xhu_u64_t dispatched_count;
+    xhu_u64_t late_count;
+    xhu_u64_t dropped_count;
+    xhu_s64_t max_late_samples;
+    xhu_f64_t mean_late_samples;
+    xhu_u64_t timed_count;
+    xhu_f64_t min_timing_error_us;
+    xhu_f64_t max_timing_error_us;
+    xhu_f64_t mean_timing_error_us;
+} xhu_event_stats_t;
+
+/*
+ * Read-only view of ftable memory, seqlock style. Writes made through xhu
+ * change the version of the table, so xhu_end_table_view returns false when the
+ * view may have seen a partial update and the reads have to be retried.
+ * Deleting or replacing the table through xhu waits until open views are
+ * closed, and xhu_begin_table_view fails while such a change is pending.
+ * Writes by opcodes inside Csound are not versioned.
+ */
+typedef struct {
+    const xhu_audio_data_t *data;
+    xhu_s32_t length;
+    xhu_s32_t table;
+    xhu_u32_t version;
+} xhu_table_view_t;
 
 EXTERN_C void xhu_set_log_level(xhu_s32_t level);
-EXTERN_C bool xhu_start(bool bundle);
-EXTERN_C void xhu_stop(void);
-EXTERN_C xhu_audio_data_t *xhu_get_channel_pointer(const char *name, xhu_s32_t flags);
-EXTERN_C xhu_audio_data_t xhu_get_control_channel_value(xhu_audio_data_t *channel);
-EXTERN_C void xhu_set_control_channel_value(xhu_audio_data_t value, const char *name);
-EXTERN_C void xhu_send_message(const char* message);
-EXTERN_C void xhu_send_score_event(const char type, xhu_audio_data_t* parameters, xhu_s32_t numParameters);
-EXTERN_C const xhu_s32_t xhu_get_table_data(const xhu_s32_t tableNumber, xhu_audio_data_t* const data);
-EXTERN_C void xhu_set_table_data(const xhu_s32_t table, const xhu_audio_data_t *const data, xhu_u32_t data_count);
-EXTERN_C const xhu_f32_t xhu_get_table_val(const xhu_s32_t table, const xhu_s32_t index);
-EXTERN_C bool xhu_table_exists(const xhu_s32_t tableNumber);
-EXTERN_C void xhu_delete_table(const xhu_s32_t tableNumber);
-EXTERN_C const xhu_s32_t xhu_get_sample_rate(void);
-EXTERN_C const xhu_s32_t xhu_get_control_rate(void);
-EXTERN_C const xhu_s32_t xhu_get_control_size(void);
-EXTERN_C const xhu_f32_t xhu_get_control_period(void);
+EXTERN_C void xhu_get_default_engine_options(xhu_engine_options_t *options);
+EXTERN_C xhu_engine_t *xhu_start(const xhu_engine_options_t *options);
+EXTERN_C void xhu_stop(xhu_engine_t *engine);
+EXTERN_C void xhu_wait_until_stopped(xhu_engine_t *engine);
+EXTERN_C void xhu_destroy_engine(xhu_engine_t *engine);
+/*
+ * Renders frame_count interleaved frames, scaled to [-1, 1], into output from
+ * the host audio callback of an XHU_OUTPUT_HOST engine. Never blocks; a paused
+ * or finished engine renders silence. Returns the number of frames Csound rendered.
+ */
+EXTERN_C xhu_u32_t xhu_render(xhu_engine_t *engine, xhu_f32_t *output, xhu_u32_t frame_count);
+EXTERN_C xhu_u64_t xhu_get_captured_frames(xhu_engine_t *engine);
+EXTERN_C xhu_u32_t xhu_get_realtime_status(xhu_engine_t *engine);
+EXTERN_C bool xhu_pause_performance(xhu_engine_t *engine);
+EXTERN_C void xhu_resume_performance(xhu_engine_t *engine);
+EXTERN_C const xhu_audio_clock_t *xhu_get_audio_clock(xhu_engine_t *engine);
+EXTERN_C void xhu_get_startup_stats(xhu_engine_t *engine, xhu_startup_stats_t *stats);
+EXTERN_C void xhu_get_pause_stats(xhu_engine_t *engine, xhu_pause_stats_t *stats);
+EXTERN_C void xhu_set_perform_mode(xhu_engine_t *engine, xhu_perform_mode mode, xhu_u32_t blocks_per_wakeup);
+EXTERN_C void xhu_get_render_stats(xhu_engine_t *engine, xhu_render_stats_t *stats);
+EXTERN_C void xhu_reset_render_stats(xhu_engine_t *engine);
+EXTERN_C void xhu_get_cycle_stats(xhu_engine_t *engine, xhu_cycle_stats_t *stats);
+EXTERN_C void xhu_reset_cycle_stats(xhu_engine_t *engine);
+EXTERN_C void xhu_send_message(xhu_engine_t *engine, const char* message);
+EXTERN_C void xhu_send_score_event(xhu_engine_t *engine, const char type, xhu_audio_data_t* parameters, xhu_s32_t numParameters);
+/*
+ * Hands a batch of score events to the performance thread in one transfer; they
+ * start in the same k-cycle and sample and sequence are ignored. results, when
+ * not NULL, receives the csoundScoreEvent return code of each event. The
+ * synchronous call returns how many events succeeded, or -1 if the batch was
+ * not accepted. The async call reads events and writes results until the
+ * future is done.
+ */
+EXTERN_C xhu_s32_t xhu_send_score_events(xhu_engine_t *engine, const xhu_event_t *events, xhu_u32_t event_count, xhu_s32_t *results);
+EXTERN_C bool xhu_send_score_events_async(xhu_engine_t *engine, const xhu_event_t *events, xhu_u32_t event_count, xhu_s32_t *results, xhu_future_t *future);
+/*
+ * Queues a score event for the k-cycle containing sample, an absolute position
+ * in the engine's rendered output. p2 of the parameters is replaced with the
+ * offset of sample inside that k-cycle. Safe to call from several threads.
+ */
+EXTERN_C bool xhu_schedule_event(xhu_engine_t *engine, xhu_s64_t sample, const char type, const xhu_audio_data_t *parameters, xhu_u32_t parameter_count);
+EXTERN_C bool xhu_schedule_event_at_time(xhu_engine_t *engine, xhu_u64_t time_ns, const char type, const xhu_audio_data_t *parameters, xhu_u32_t parameter_count);
+EXTERN_C void xhu_get_event_stats(xhu_engine_t *engine, xhu_event_stats_t *stats);
+/* Copies up to capacity values of the table into data and returns the table length */
+EXTERN_C const xhu_s32_t xhu_get_table_data(xhu_engine_t *engine, const xhu_s32_t tableNumber, xhu_audio_data_t* const data, xhu_u32_t capacity);
+EXTERN_C void xhu_set_table_data(xhu_engine_t *engine, const xhu_s32_t table, const xhu_audio_data_t *const data, xhu_u32_t data_count);
+/* Copies data_count values into the table starting at offset, in one memcpy between two k-cycles; the last may be the guard point */
+EXTERN_C bool xhu_set_table_range(xhu_engine_t *engine, const xhu_s32_t table, xhu_u32_t offset, const xhu_audio_data_t *const data, xhu_u32_t data_count);
+/* NAN when the table does not exist or index is past its end */
+EXTERN_C const xhu_f32_t xhu_get_table_val(xhu_engine_t *engine, const xhu_s32_t table, const xhu_s32_t index);
+EXTERN_C bool xhu_table_exists(xhu_engine_t *engine, const xhu_s32_t tableNumber);
+EXTERN_C void xhu_init_future(xhu_future_t *future, xhu_future_callback_t callback, void *user_data);
+EXTERN_C bool xhu_future_is_done(const xhu_future_t *future);
+/*
+ * Blocks until the future is done. While the performance is paused the waiting
+ * thread applies the queued commands itself; a table change it waits on fails
+ * then, as Csound only makes it over the following k-cycles.
+ */
+EXTERN_C void xhu_wait_future(xhu_future_t *future);
+/* Completes a future from a host thread; future->engine must be set to wake waiters */
+EXTERN_C void xhu_resolve_future(xhu_future_t *future);
+EXTERN_C xhu_worker_pool_t *xhu_get_worker_pool(xhu_engine_t *engine);
+EXTERN_C xhu_channel_registry_t *xhu_get_channel_registry(xhu_engine_t *engine);
+EXTERN_C bool xhu_get_table_data_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_audio_data_t *data, xhu_u32_t capacity, xhu_future_t *future);
+EXTERN_C bool xhu_set_table_data_async(xhu_engine_t *engine, const xhu_s32_t table, const xhu_audio_data_t *const data, xhu_u32_t data_count, xhu_future_t *future);
+EXTERN_C bool xhu_set_table_range_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_u32_t offset, const xhu_audio_data_t *const data, xhu_u32_t data_count, xhu_future_t *future);
+EXTERN_C bool xhu_get_table_val_async(xhu_engine_t *engine, const xhu_s32_t table, const xhu_s32_t index, xhu_future_t *future);
+EXTERN_C bool xhu_table_exists_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_future_t *future);
+/*
+ * Table numbers from first_dynamic_table on belong to the engine. Creating a
+ * table there fails unless the number was allocated, so two callers can not
+ * overwrite each other's tables. A released number is reused before a new
+ * one is issued.
+ */
+EXTERN_C xhu_table_handle_t xhu_allocate_table_number(xhu_engine_t *engine);
+/* Returns the number to the free list, the table must already be deleted */
+EXTERN_C bool xhu_release_table_number(xhu_engine_t *engine, xhu_table_handle_t handle);
+EXTERN_C bool xhu_is_table_handle_valid(xhu_engine_t *engine, xhu_table_handle_t handle);
+/* Deletes the table and releases its number */
+EXTERN_C void xhu_free_table(xhu_engine_t *engine, xhu_table_handle_t handle);
+EXTERN_C void xhu_get_table_number_stats(xhu_engine_t *engine, xhu_table_number_stats_t *stats);
+EXTERN_C bool xhu_is_table_number_reserved(xhu_engine_t *engine, xhu_s32_t table);
+/*
+ * Creates a table from a numeric f-statement, pfields[0] being the table number.
+ * Takes ownership of pfields, which must come from malloc. The future completes
+ * once the table exists, with the table number as result and its length as value,
+ * or a negative result if Csound did not create it.
+ */
+EXTERN_C bool xhu_send_table_event_async(xhu_engine_t *engine, xhu_audio_data_t *pfields, xhu_u32_t pfield_count, xhu_future_t *future);
+/* As above for an f-statement that needs a string p-field, such as a GEN01 filename */
+EXTERN_C bool xhu_send_table_message_async(xhu_engine_t *engine, xhu_s32_t table, const char *message, xhu_future_t *future);
+/*
+ * Table memory inside Csound, valid until the table is replaced or deleted.
+ * Writing it while Csound reads the table is only safe for tables no
+ * instrument uses at the time, see xhu_shadow_table_t.
+ */
+EXTERN_C xhu_audio_data_t *xhu_get_table_pointer(xhu_engine_t *engine, const xhu_s32_t table, xhu_s32_t *length);
+EXTERN_C bool xhu_get_table_pointer_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_future_t *future);
+/* Stores value into a channel obtained with xhu_get_channel_pointer, between two k-cycles */
+EXTERN_C bool xhu_set_channel_async(xhu_engine_t *engine, xhu_audio_data_t *channel, xhu_audio_data_t value, xhu_future_t *future);
+EXTERN_C bool xhu_begin_table_view(xhu_engine_t *engine, const xhu_s32_t table, xhu_table_view_t *view);
+EXTERN_C bool xhu_end_table_view(xhu_engine_t *engine, xhu_table_view_t *view);
+EXTERN_C void xhu_delete_table(xhu_engine_t *engine, const xhu_s32_t tableNumber);
+/* Deletes without checking that the table exists first */
+EXTERN_C bool xhu_delete_table_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_future_t *future);
+EXTERN_C const xhu_s32_t xhu_get_sample_rate(xhu_engine_t *engine);
+EXTERN_C const xhu_s32_t xhu_get_control_rate(xhu_engine_t *engine);
+EXTERN_C const xhu_audio_data_t xhu_get_0dbfs(xhu_engine_t *engine);
+/* Adds a stream to the ones the performance thread pumps every k-cycle, see xhu_stream.h */
+EXTERN_C bool xhu_attach_stream(xhu_engine_t *engine, xhu_stream_t *stream);
+/* True once the performance thread no longer touches the stream */
+EXTERN_C bool xhu_detach_stream(xhu_engine_t *engine, xhu_stream_t *stream);
+/* Reserves a stream id for one open stream, false when it is taken */
+EXTERN_C bool xhu_claim_stream_id(xhu_engine_t *engine, xhu_u32_t id);
+EXTERN_C void xhu_release_stream_id(xhu_engine_t *engine, xhu_u32_t id);
+EXTERN_C const xhu_s32_t xhu_get_control_size(xhu_engine_t *engine);
+EXTERN_C const xhu_f32_t xhu_get_control_period(xhu_engine_t *engine);
 EXTERN_C bool xhu_set_global_env(const char *name, const char *value);
 EXTERN_C void xhu_set_opcode_path(const char *path);
 EXTERN_C void xhu_set_csd_path(const char *path);
 EXTERN_C void xhu_set_audio_path(const char *path);
-EXTERN_C void xhu_set_output_channel_callback(channelCallback_t callback);
+/* Full path of an audio file name, relative names being resolved against SSDIR */
+EXTERN_C void xhu_resolve_audio_path(const char *filename, char *path, xhu_u32_t size);
+EXTERN_C void xhu_set_output_channel_callback(xhu_engine_t *engine, channelCallback_t callback);
 
 #endif // XHU_CSOUND_WRAPPER_H
@@ -52,4 +52,10 @@ typedef double xhu_f64_t;
 typedef MYFLT xhu_audio_data_t;
 typedef size_t xhu_mem_size_t;
 
+/* One Csound instance with its own performance thread, tables and channels */
+typedef struct xhu_engine_s xhu_engine_t;
+
+/* Completion state of a command, see xhu_csound_wrapper.h */
+typedef struct xhu_future_s xhu_future_t;
+
 #endif // DEFS_H
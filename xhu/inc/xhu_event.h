@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_EVENT_H
+#define XHU_EVENT_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+
+#define XHU_MAX_EVENT_PFIELDS (16)
+
+/* Score event, due at an absolute sample position of the engine when scheduled */
+typedef struct {
+    xhu_s64_t sample;
+    xhu_u64_t sequence;     /* submission order, keeps events due at the same sample in order */
+    xhu_u64_t time_ns;      /* requested host time when scheduled by time, 0 otherwise */
+    char type;
+    xhu_u32_t parameter_count;
+    xhu_audio_data_t parameters[XHU_MAX_EVENT_PFIELDS];
+} xhu_event_t;
+
+/*
+ Binary min-heap of events ordered by due sample, then by submission order.
+ Only the performance thread touches it, events reach it through a ring.
+ */
+typedef struct {
+    xhu_event_t *events;
+    xhu_u32_t capacity;
+    xhu_u32_t count;
+} xhu_event_heap_t;
+
+bool xhu_event_heap_init(xhu_event_heap_t *heap, xhu_u32_t capacity);
+void xhu_event_heap_destroy(xhu_event_heap_t *heap);
+bool xhu_event_heap_push(xhu_event_heap_t *heap, const xhu_event_t *event);
+const xhu_event_t *xhu_event_heap_peek(const xhu_event_heap_t *heap);
+bool xhu_event_heap_pop(xhu_event_heap_t *heap, xhu_event_t *event);
+
+#endif // XHU_EVENT_H
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_GEN_H
+#define XHU_GEN_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+#include "xhu_table.h"
+
+/*
+ Host versions of the Csound GEN routines the tables are usually made with,
+ filling size samples of output without touching the engine. The table load
+ functions run them on the worker threads of the engine; they can also be used
+ directly to prepare data for xhu_load_table_data or a shadow table. The inner
+ loops run over contiguous samples without branches so the compiler can
+ vectorize them.
+ */
+
+/* GEN02, the values are copied and the rest of the table is zero */
+EXTERN_C void xhu_gen_values(xhu_audio_data_t *output, xhu_u32_t size, const xhu_f32_t *values, xhu_u32_t count);
+/*
+ GEN07, a straight line from each segment value to the next one over the
+ length of the segment. The length of the last segment is not used, samples
+ after the last line are zero.
+ */
+EXTERN_C void xhu_gen_segments(xhu_audio_data_t *output, xhu_u32_t size, const xhu_segment_t *segments, xhu_u32_t count);
+/*
+ GEN10, sum of count harmonics of a sine of period size with the given
+ amplitudes. Every harmonic reads one sine period computed per call, so the
+ cost is one sin per sample plus one multiply-add per sample and harmonic.
+ False when the sine period could not be allocated.
+ */
+EXTERN_C bool xhu_gen_harmonics(xhu_audio_data_t *output, xhu_u32_t size, const xhu_f32_t *amplitudes, xhu_u32_t count);
+/*
+ GEN20 window over size samples, in the periodic form used for overlap-add.
+ Fills size + 1 samples, the guard point wraps around to the first one.
+ */
+EXTERN_C void xhu_gen_window(xhu_audio_data_t *output, xhu_u32_t size, xhu_window_type window);
+/* Scales the samples to a peak of 1 as positive GEN numbers do, silence is left alone */
+EXTERN_C void xhu_gen_normalize(xhu_audio_data_t *output, xhu_u32_t size);
+
+#endif // XHU_GEN_H
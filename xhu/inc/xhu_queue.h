@@ -21,6 +21,20 @@
 #define XHU_QUEUE_H
 
 #include <stdbool.h>
+#include "xhu_defs.h"
+
+/*
+ Single-producer/single-consumer ring of fixed-size elements.
+ The producer only advances tail and the consumer only advances head,
+ so neither side ever takes a lock. Capacity must be a power of two.
+ */
+typedef struct {
+    char *elements;
+    xhu_u32_t element_size;
+    xhu_u32_t capacity;
+    xhu_u32_t head;
+    xhu_u32_t tail;
+} xhu_ring_t;
 
 void xhu_queue_init(int *head, int *tail);
 void xhu_queue_enqueue(int *queue,int *tail, int element);
@@ -28,4 +42,12 @@ int xhu_queue_dequeue(int *queue,int *head);
 bool xhu_queue_empty(int head,int tail);
 bool xhu_queue_full(int tail,const int size);
 void xhu_queue_display(int *queue,int head,int tail);
+bool xhu_ring_init(xhu_ring_t *ring, xhu_u32_t capacity, xhu_u32_t element_size);
+void xhu_ring_destroy(xhu_ring_t *ring);
+bool xhu_ring_push(xhu_ring_t *ring, const void *element);
+bool xhu_ring_pop(xhu_ring_t *ring, void *element);
+const void *xhu_ring_peek(xhu_ring_t *ring);
+xhu_u32_t xhu_ring_write(xhu_ring_t *ring, const void *elements, xhu_u32_t count);
+xhu_u32_t xhu_ring_read(xhu_ring_t *ring, void *elements, xhu_u32_t count);
+xhu_u32_t xhu_ring_count(xhu_ring_t *ring);
 #endif // XHU_QUEUE_H
@@ -20,7 +20,9 @@
 #ifndef SOUND_H
 #define SOUND_H
 
+#include <stdbool.h>
 #include "xhu_defs.h"
+#include "xhu_stream.h"
 
 #define XHU_MAX_NAME_SIZE (30)
 #define XHU_MAX_SOUND_ID (300)
@@ -30,11 +32,26 @@
 typedef enum { STOPPED, PLAYING, PAUSED, MUTED } xhu_sound_state;
 typedef xhu_u32_t xhu_sound_handle_t;
 
+typedef enum { XHU_SOURCE_TABLE, XHU_SOURCE_STREAM } xhu_source_type;
+
+/*
+ Sample data a sound plays, either a whole table or a disk stream. Tables
+ play once through instrument sample_table, streams play through instrument
+ sample_stream until stopped.
+ */
+typedef struct {
+    xhu_source_type type;
+    xhu_s32_t table;
+    xhu_stream_t *stream;
+} xhu_sound_source_t;
+
 EXTERN_C void xhu_initialize_sound_management(void);
 EXTERN_C xhu_sound_handle_t xhu_initialize_sound(const xhu_u32_t sound_id, const char *const name);
 EXTERN_C xhu_sound_state xhu_get_sound_state(xhu_sound_handle_t handle);
 EXTERN_C bool xhu_is_sound_valid(xhu_sound_handle_t handle);
 EXTERN_C void xhu_play_sound(xhu_sound_handle_t handle);
 EXTERN_C void xhu_stop_sound(xhu_sound_handle_t handle);
+EXTERN_C void xhu_play_source(xhu_engine_t *engine, const xhu_sound_source_t *source);
+EXTERN_C void xhu_stop_source(xhu_engine_t *engine, const xhu_sound_source_t *source);
 
 #endif // SOUND_H
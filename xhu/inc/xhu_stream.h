@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_STREAM_H
+#define XHU_STREAM_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+
+#define XHU_MAX_STREAMS (16)
+#define XHU_STREAM_CHANNELS (2)
+/* Stream ids run below this, instrument sample_stream plays stream id as instance 4.(id + 1) */
+#define XHU_MAX_STREAM_ID (999)
+
+/*
+ Sound file played from disk through a fixed-size ring. A read-ahead thread
+ decodes the file with libsndfile and keeps the ring topped up; the
+ performance thread moves ksmps frames per k-cycle into the audio channels
+ "xhu.stream.<id>.0" and "xhu.stream.<id>.1", which instrument sample_stream
+ plays. Mono files go to both channels, files with more channels only play
+ the first two. Residency is buffer_frames frames whatever the file length.
+ Opening fails for an id out of range or held by another open stream of the
+ engine.
+ */
+typedef struct xhu_stream_s xhu_stream_t;
+
+EXTERN_C xhu_stream_t *xhu_open_stream(xhu_engine_t *engine, const char *filename, xhu_u32_t id, xhu_u32_t buffer_frames, bool loop);
+/* Fails, leaving the stream open, when it could not be detached from the engine */
+EXTERN_C bool xhu_close_stream(xhu_engine_t *engine, xhu_stream_t *stream);
+EXTERN_C xhu_u32_t xhu_get_stream_id(const xhu_stream_t *stream);
+/* True once a stream that does not loop played the whole file */
+EXTERN_C bool xhu_is_stream_finished(const xhu_stream_t *stream);
+/* k-cycles the ring ran dry before the end of the file */
+EXTERN_C xhu_u64_t xhu_get_stream_underruns(const xhu_stream_t *stream);
+/* Fills the audio channels for the coming k-cycle, on the performance thread only */
+EXTERN_C void xhu_pump_stream(xhu_stream_t *stream);
+
+#endif // XHU_STREAM_H
@@ -24,22 +24,21 @@
 #include <mach-o/dyld.h>
 #endif
 
-#include <time.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xhu_time.h"
 
-void xhu_pause(xhu_array_size_t seconds)
+static inline void xhu_pause(xhu_array_size_t seconds)
 {
-    clock_t goal = clock() + seconds * CLOCKS_PER_SEC;
-    while (goal > clock());
+    xhu_sleep_ns((xhu_u64_t)seconds * XHU_NS_PER_SECOND);
 }
 
-long xhu_get_timestamp_ms()
+static inline long xhu_get_timestamp_ms()
 {
-    clock_t timestamp = clock() * CLK_TCK;
-    
-    return (long)(timestamp / 1000);
+    return (long)(xhu_time_now_ns() / XHU_NS_PER_MS);
 }
 
-char *xhu_get_folder_path(const char *path)
+static inline char *xhu_get_folder_path(const char *path)
 {
     if (path == NULL) {
         return NULL;
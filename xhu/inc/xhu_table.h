@@ -20,7 +20,9 @@
 #ifndef TABLE_H
 #define TABLE_H
 
+#include <stdbool.h>
 #include "xhu_defs.h"
+#include "xhu_allocator.h"
 
 typedef struct {
     xhu_u32_t number;
@@ -54,8 +56,106 @@ typedef struct {
     xhu_u32_t segment_count;
 } xhu_segment_table_t;
 
-EXTERN_C void xhu_create_sample_table(xhu_sample_table_t* const table);
-EXTERN_C void xhu_create_immediate_table(xhu_immediate_table_t* const table);
-EXTERN_C void xhu_create_segment_table(xhu_segment_table_t* const table);
+/* Window shapes numbered as the GEN20 window types */
+typedef enum {
+    XHU_WINDOW_HAMMING = 1,
+    XHU_WINDOW_HANN = 2,
+    XHU_WINDOW_BARTLETT = 3,
+    XHU_WINDOW_BLACKMAN = 4,
+    XHU_WINDOW_RECTANGLE = 8
+} xhu_window_type;
+
+typedef struct {
+    xhu_base_table_t base;
+    xhu_window_type window;
+} xhu_window_table_t;
+
+/*
+ Two Csound tables of the same size behind a control channel holding the
+ number of the one Csound should read. The host writes the back table without
+ pausing anything and commits; the channel switches at the next k-cycle
+ boundary. Instruments must read the channel at k-rate, for example
+     kfn chnget "wavetable"
+     asig tablei aphase, kfn, 1
+ The back table holds what was committed two commits ago. Table numbers of
+ 0 are allocated by the engine and released when the shadow table is
+ destroyed. Destroying sets the channel to 0 before deleting the tables, so
+ instruments still playing then must check kfn.
+ */
+typedef struct {
+    xhu_s32_t numbers[2];
+    xhu_table_handle_t handles[2];
+    xhu_audio_data_t *data[2];
+    xhu_u32_t size;
+    xhu_u32_t front;
+    xhu_audio_data_t *channel;
+    xhu_future_t *swap;
+} xhu_shadow_table_t;
+
+typedef enum {
+    XHU_TABLE_LOADING,
+    XHU_TABLE_READY,
+    XHU_TABLE_FAILED
+} xhu_table_state;
+
+/*
+ Called once a table load finished, on the performance thread or on a worker
+ thread for sample files, so it must not block or call the synchronous xhu
+ functions.
+ */
+typedef void (*xhu_table_callback_t)(xhu_s32_t number, xhu_table_state state, void *user_data);
+
+/*
+ Handle of a table load in flight. Up to 64 loads are issued to Csound at a
+ time, later ones wait in the command queue; starting a load returns NULL
+ once that queue is full. A table number of 0 lets the engine allocate one,
+ which goes back to the engine when the load fails and otherwise belongs to
+ the caller, see xhu_get_table_load_handle and xhu_free_table.
+ */
+typedef struct xhu_table_load_s xhu_table_load_t;
+
+/*
+ Decodes the file with libsndfile on a worker thread of the engine, then
+ creates the table and fills it with one copy at a k-cycle boundary. A
+ positive gen_routine normalizes as GEN01 does, a negative one scales full
+ scale to 0dbfs like it; format is taken from the file header. Files of more
+ than 2^32 - 1 samples are rejected. The table carries no GEN01 sample rate or
+ base pitch for loscil.
+ */
+EXTERN_C xhu_table_load_t *xhu_load_sample_table(xhu_engine_t *engine, const xhu_sample_table_t* const table, xhu_table_callback_t callback, void *user_data);
+/*
+ GEN02 and GEN10 tables are computed on a worker thread of the engine and
+ copied in like sample files, the guard point stays 0 as a GEN10 wrap has it.
+ Other GEN routines run inside Csound on the performance thread.
+ */
+EXTERN_C xhu_table_load_t *xhu_load_immediate_table(xhu_engine_t *engine, const xhu_immediate_table_t* const table, xhu_table_callback_t callback, void *user_data);
+/* GEN07 on a worker thread, a positive gen_routine normalizes the lines */
+EXTERN_C xhu_table_load_t *xhu_load_segment_table(xhu_engine_t *engine, const xhu_segment_table_t* const table, xhu_table_callback_t callback, void *user_data);
+/* GEN20 window on a worker thread with its guard point, gen_routine is not used */
+EXTERN_C xhu_table_load_t *xhu_load_window_table(xhu_engine_t *engine, const xhu_window_table_t* const table, xhu_table_callback_t callback, void *user_data);
+/* Table of count samples copied from host memory, which must stay valid until the load finished */
+EXTERN_C xhu_table_load_t *xhu_load_table_data(xhu_engine_t *engine, xhu_s32_t number, const xhu_audio_data_t *samples, xhu_u32_t count, xhu_table_callback_t callback, void *user_data);
+EXTERN_C xhu_table_state xhu_get_table_load_state(const xhu_table_load_t *load);
+/* Samples in the table once the load is ready, 0 before */
+EXTERN_C xhu_u32_t xhu_get_table_load_length(const xhu_table_load_t *load);
+EXTERN_C xhu_s32_t xhu_get_table_load_number(const xhu_table_load_t *load);
+/* Generation 0 for tables numbered by the caller */
+EXTERN_C xhu_table_handle_t xhu_get_table_load_handle(const xhu_table_load_t *load);
+EXTERN_C xhu_table_state xhu_wait_table_load(xhu_table_load_t *load);
+/* Waits for the load if it is still in flight; a worker job still running after the engine stopped frees it when done */
+EXTERN_C void xhu_release_table_load(xhu_table_load_t *load);
+/* GEN routines inside Csound, the performance thread computes the table and reads GEN01 files */
+EXTERN_C bool xhu_create_sample_table_async(xhu_engine_t *engine, const xhu_sample_table_t* const table, xhu_future_t *future);
+EXTERN_C bool xhu_create_immediate_table_async(xhu_engine_t *engine, const xhu_immediate_table_t* const table, xhu_future_t *future);
+/* The synchronous calls store an allocated table number in base.number when it was 0 */
+EXTERN_C void xhu_create_sample_table(xhu_engine_t *engine, xhu_sample_table_t* const table);
+EXTERN_C void xhu_create_immediate_table(xhu_engine_t *engine, xhu_immediate_table_t* const table);
+EXTERN_C void xhu_create_segment_table(xhu_engine_t *engine, xhu_segment_table_t* const table);
+EXTERN_C void xhu_create_window_table(xhu_engine_t *engine, xhu_window_table_t* const table);
+EXTERN_C bool xhu_create_shadow_table(xhu_engine_t *engine, xhu_shadow_table_t *shadow, xhu_s32_t front_number, xhu_s32_t back_number, xhu_u32_t size, const char *channel_name);
+EXTERN_C void xhu_destroy_shadow_table(xhu_engine_t *engine, xhu_shadow_table_t *shadow);
+/* Back table memory, or NULL while the previous commit has not reached a k-cycle boundary yet */
+EXTERN_C xhu_audio_data_t *xhu_begin_shadow_table_write(xhu_shadow_table_t *shadow);
+EXTERN_C bool xhu_commit_shadow_table(xhu_engine_t *engine, xhu_shadow_table_t *shadow);
 
 #endif /* TABLE_H */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_TIME_H
+#define XHU_TIME_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+
+#define XHU_NS_PER_SECOND (1000000000ull)
+#define XHU_NS_PER_MS (1000000ull)
+#define XHU_AUDIO_CLOCK_BANDWIDTH_HZ (0.5)
+#define XHU_AUDIO_CLOCK_RESET_NS (100000000ll)
+
+/*
+ Correlates the monotonic clock with the sample position of an engine.
+ The performance thread reports the wall time at the start of every k-cycle.
+ With buffered output those k-cycles are rendered in bursts, so the reports
+ go through a second order delay-locked loop. The loop filters out the burst
+ pattern and tracks the actual sample period, and what it publishes is the
+ smoothed anchor and period. A jump larger than
+ XHU_AUDIO_CLOCK_RESET_NS, after a pause for example, restarts the loop.
+ Readers retry while the sequence number is odd or changed under them, so
+ neither side takes a lock.
+ */
+typedef struct {
+    xhu_u32_t sequence;
+    xhu_u64_t anchor_ns;
+    xhu_s64_t anchor_sample;
+    xhu_f64_t sample_period_ns;
+    xhu_f64_t sample_rate;
+    xhu_f64_t filter_time_ns;   /* publishing thread only */
+    xhu_f64_t filter_period_ns; /* publishing thread only */
+    xhu_s64_t filter_sample;    /* publishing thread only */
+    bool filter_locked;         /* publishing thread only */
+} xhu_audio_clock_t;
+
+EXTERN_C xhu_u64_t xhu_time_now_ns(void);
+EXTERN_C void xhu_sleep_ns(xhu_u64_t duration_ns);
+EXTERN_C void xhu_sleep_ms(xhu_u64_t duration_ms);
+EXTERN_C void xhu_audio_clock_init(xhu_audio_clock_t *clock, xhu_f64_t sample_rate);
+EXTERN_C void xhu_audio_clock_publish(xhu_audio_clock_t *clock, xhu_u64_t time_ns, xhu_s64_t sample);
+EXTERN_C void xhu_audio_clock_read(const xhu_audio_clock_t *clock, xhu_u64_t *time_ns, xhu_s64_t *sample);
+EXTERN_C xhu_s64_t xhu_audio_clock_sample_at(const xhu_audio_clock_t *clock, xhu_u64_t time_ns);
+EXTERN_C xhu_u64_t xhu_audio_clock_time_at(const xhu_audio_clock_t *clock, xhu_s64_t sample);
+
+#endif // XHU_TIME_H
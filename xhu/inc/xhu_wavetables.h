@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_WAVETABLES_H
+#define XHU_WAVETABLES_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+
+#define XHU_WAVETABLE_SIZE (4096)
+#define XHU_WAVETABLE_HARMONICS (64)
+
+/*
+ Tables every engine starts with, numbered below first_dynamic_table. The
+ samples are generated by tools/xhu_wavetable_generator.c into
+ xhu_wavetable_data.c and compiled into the library, so starting an engine
+ copies them instead of running GEN routines. Each table has
+ XHU_WAVETABLE_SIZE samples plus the guard point. Saw, square and triangle
+ are band-limited to XHU_WAVETABLE_HARMONICS harmonics and all tables peak at
+ 1. The windows are in the periodic form used for overlap-add.
+ */
+typedef enum {
+    XHU_WAVETABLE_SINE = 1,
+    XHU_WAVETABLE_SAW,
+    XHU_WAVETABLE_SQUARE,
+    XHU_WAVETABLE_TRIANGLE,
+    XHU_WAVETABLE_HANN,
+    XHU_WAVETABLE_HAMMING,
+    XHU_WAVETABLE_BLACKMAN,
+    XHU_WAVETABLE_LAST = XHU_WAVETABLE_BLACKMAN
+} xhu_wavetable;
+
+/* XHU_WAVETABLE_SIZE + 1 samples of a built-in table, NULL for other numbers */
+EXTERN_C const xhu_audio_data_t *xhu_get_wavetable(xhu_s32_t number);
+/*
+ Creates the built-in tables in a started Csound instance that is not
+ performing yet. Numbers the orchestra already uses are left alone.
+ */
+EXTERN_C bool xhu_register_wavetables(CSOUND *csound);
+
+#endif // XHU_WAVETABLES_H
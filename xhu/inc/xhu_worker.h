@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XHU_WORKER_H
+#define XHU_WORKER_H
+
+#include <stdbool.h>
+#include "xhu_defs.h"
+
+typedef void (*xhu_job_function_t)(void *data);
+
+/*
+ Fixed set of host threads running jobs in submission order. Jobs may block,
+ on disk I/O or on futures of an engine, but never on the performance thread.
+ Destroying the pool runs the jobs still queued before the threads exit.
+ */
+typedef struct xhu_worker_pool_s xhu_worker_pool_t;
+
+EXTERN_C xhu_worker_pool_t *xhu_create_worker_pool(xhu_u32_t thread_count);
+EXTERN_C void xhu_destroy_worker_pool(xhu_worker_pool_t *pool);
+EXTERN_C bool xhu_submit_job(xhu_worker_pool_t *pool, xhu_job_function_t function, void *data);
+
+#endif // XHU_WORKER_H
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdlib.h>
+#include "xhu_allocator.h"
+
+#define XHU_NUMBER_ALLOCATED (0xFFFFFFFFu)
+
+bool xhu_number_allocator_init(xhu_number_allocator_t *allocator, xhu_s32_t first, xhu_u32_t capacity)
+{
+    allocator->generations = (xhu_u32_t *)malloc(capacity * sizeof(xhu_u32_t));
+    allocator->next_free = (xhu_u32_t *)malloc(capacity * sizeof(xhu_u32_t));
+    
+    if (allocator->generations == NULL || allocator->next_free == NULL) {
+        free(allocator->generations);
+        free(allocator->next_free);
+        allocator->generations = NULL;
+        allocator->next_free = NULL;
+        
+        return false;
+    }
+    
+    for (xhu_u32_t i = 0; i < capacity; ++i) {
+        allocator->generations[i] = 1;
+    }
+    
+    pthread_mutex_init(&allocator->mutex, NULL);
+    allocator->first = first;
+    allocator->capacity = capacity;
+    allocator->free_head = capacity;
+    allocator->extent = 0;
+    allocator->in_use = 0;
+    
+    return true;
+}
+
+void xhu_number_allocator_destroy(xhu_number_allocator_t *allocator)
+{
+    if (allocator->generations == NULL) {
+        return;
+    }
+    
+    pthread_mutex_destroy(&allocator->mutex);
+    free(allocator->generations);
+    free(allocator->next_free);
+    allocator->generations = NULL;
+    allocator->next_free = NULL;
+}
+
+xhu_table_handle_t xhu_number_allocator_acquire(xhu_number_allocator_t *allocator)
+{
+    xhu_table_handle_t handle = { 0, 0 };
+    xhu_u32_t index = allocator->capacity;
+    
+    pthread_mutex_lock(&allocator->mutex);
+    
+    // Released numbers first, the extent only grows when there is no hole to fill
+    if (allocator->free_head < allocator->capacity) {
+        index = allocator->free_head;
+        allocator->free_head = allocator->next_free[index];
+    } else if (allocator->extent < allocator->capacity) {
+        index = allocator->extent++;
+    }
+    
+    if (index < allocator->capacity) {
+        allocator->next_free[index] = XHU_NUMBER_ALLOCATED;
+        allocator->in_use++;
+        handle.number = allocator->first + (xhu_s32_t)index;
+        handle.generation = allocator->generations[index];
+    }
+    
+    pthread_mutex_unlock(&allocator->mutex);
+    
+    return handle;
+}
+
+static bool xhu_number_allocator_owns(const xhu_number_allocator_t *allocator, xhu_table_handle_t handle)
+{
+    xhu_u32_t index = (xhu_u32_t)(handle.number - allocator->first);
+    
+    return handle.number >= allocator->first && index < allocator->extent &&
+        allocator->next_free[index] == XHU_NUMBER_ALLOCATED &&
+        allocator->generations[index] == handle.generation;
+}
+
+bool xhu_number_allocator_release(xhu_number_allocator_t *allocator, xhu_table_handle_t handle)
+{
+    pthread_mutex_lock(&allocator->mutex);
+    
+    bool owned = xhu_number_allocator_owns(allocator, handle);
+    
+    if (owned) {
+        xhu_u32_t index = (xhu_u32_t)(handle.number - allocator->first);
+        
+        // Generation 0 stays unused so a zeroed handle never validates
+        allocator->generations[index] = allocator->generations[index] + 1 != 0 ? allocator->generations[index] + 1 : 1;
+        allocator->next_free[index] = allocator->free_head;
+        allocator->free_head = index;
+        allocator->in_use--;
+    }
+    
+    pthread_mutex_unlock(&allocator->mutex);
+    
+    return owned;
+}
+
+bool xhu_number_allocator_is_valid(xhu_number_allocator_t *allocator, xhu_table_handle_t handle)
+{
+    pthread_mutex_lock(&allocator->mutex);
+    bool owned = xhu_number_allocator_owns(allocator, handle);
+    pthread_mutex_unlock(&allocator->mutex);
+    
+    return owned;
+}
+
+bool xhu_number_allocator_is_reserved(xhu_number_allocator_t *allocator, xhu_s32_t number)
+{
+    if (number < allocator->first || (xhu_u32_t)(number - allocator->first) >= allocator->capacity) {
+        return false;
+    }
+    
+    xhu_u32_t index = (xhu_u32_t)(number - allocator->first);
+    
+    pthread_mutex_lock(&allocator->mutex);
+    bool reserved = index >= allocator->extent || allocator->next_free[index] != XHU_NUMBER_ALLOCATED;
+    pthread_mutex_unlock(&allocator->mutex);
+    
+    return reserved;
+}
+
+void xhu_number_allocator_get_stats(xhu_number_allocator_t *allocator, xhu_table_number_stats_t *stats)
+{
+    pthread_mutex_lock(&allocator->mutex);
+    stats->capacity = allocator->capacity;
+    stats->in_use = allocator->in_use;
+    stats->extent = allocator->extent;
+    pthread_mutex_unlock(&allocator->mutex);
+    
+    stats->hole_count = stats->extent - stats->in_use;
+    stats->fragmentation = stats->extent > 0 ? (xhu_f64_t)stats->hole_count / stats->extent : 0.0;
+}
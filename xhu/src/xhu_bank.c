@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "xhu_debug.h"
+#include "xhu_csound_wrapper.h"
+#include "xhu_bank.h"
+
+struct xhu_bank_s {
+    void *mapping;
+    xhu_mem_size_t size;
+    const xhu_bank_header_t *header;
+    const xhu_bank_entry_t *entries;
+};
+
+// Rejects banks from another packer version or platform, and entries pointing outside the file
+static bool xhu_validate_bank(xhu_bank_t *bank)
+{
+    const xhu_bank_header_t *header = bank->header;
+    
+    if (bank->size < sizeof(xhu_bank_header_t) ||
+        header->magic != XHU_BANK_MAGIC ||
+        header->version != XHU_BANK_VERSION ||
+        header->sample_size != sizeof(xhu_audio_data_t) ||
+        header->file_size != bank->size) {
+        return false;
+    }
+    
+    // Sizes are compared against what is left of the file, so crafted offsets and counts can not wrap around
+    if (header->index_offset > bank->size ||
+        header->index_offset % _Alignof(xhu_bank_entry_t) != 0 ||
+        header->entry_count > (bank->size - header->index_offset) / sizeof(xhu_bank_entry_t)) {
+        return false;
+    }
+    
+    bank->entries = (const xhu_bank_entry_t *)((const char *)bank->mapping + header->index_offset);
+    
+    for (xhu_u32_t i = 0; i < header->entry_count; ++i) {
+        const xhu_bank_entry_t *entry = &bank->entries[i];
+        
+        if (entry->offset % XHU_BANK_ALIGNMENT != 0 || entry->offset > bank->size) {
+            return false;
+        }
+        
+        xhu_u64_t samples_left = (bank->size - entry->offset) / sizeof(xhu_audio_data_t);
+        
+        if (entry->channel_count > 0 && entry->frame_count > samples_left / entry->channel_count) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+xhu_bank_t *xhu_open_bank(const char *filename)
+{
+    char path[PATH_MAX];
+    struct stat status;
+    xhu_resolve_audio_path(filename, path, sizeof(path));
+    
+    int file = open(path, O_RDONLY);
+    
+    if (file < 0 || fstat(file, &status) != 0 || status.st_size == 0) {
+        XHU_LOG_ERROR("Could not open bank %s", path)
+        
+        if (file >= 0) {
+            close(file);
+        }
+        
+        return NULL;
+    }
+    
+    xhu_bank_t *bank = (xhu_bank_t *)calloc(1, sizeof(xhu_bank_t));
+    void *mapping = mmap(NULL, (xhu_mem_size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    
+    // The mapping keeps the file alive
+    close(file);
+    
+    if (bank == NULL || mapping == MAP_FAILED) {
+        XHU_LOG_ERROR("Could not map bank %s", path)
+        free(bank);
+        
+        if (mapping != MAP_FAILED) {
+            munmap(mapping, (xhu_mem_size_t)status.st_size);
+        }
+        
+        return NULL;
+    }
+    
+    bank->mapping = mapping;
+    bank->size = (xhu_mem_size_t)status.st_size;
+    bank->header = (const xhu_bank_header_t *)mapping;
+    
+    if (!xhu_validate_bank(bank)) {
+        XHU_LOG_ERROR("%s is not a valid version %d bank", path, XHU_BANK_VERSION)
+        xhu_close_bank(bank);
+        
+        return NULL;
+    }
+    
+    XHU_LOG_DEBUG("Mapped bank %s with %u sounds", path, bank->header->entry_count)
+    
+    return bank;
+}
+
+void xhu_close_bank(xhu_bank_t *bank)
+{
+    if (bank == NULL) {
+        return;
+    }
+    
+    munmap(bank->mapping, bank->size);
+    free(bank);
+}
+
+xhu_u32_t xhu_get_bank_entry_count(const xhu_bank_t *bank)
+{
+    return bank->header->entry_count;
+}
+
+const xhu_bank_entry_t *xhu_get_bank_entry(const xhu_bank_t *bank, xhu_u32_t index)
+{
+    return index < bank->header->entry_count ? &bank->entries[index] : NULL;
+}
+
+static int xhu_compare_bank_entry(const void *name, const void *entry)
+{
+    return strncmp((const char *)name, ((const xhu_bank_entry_t *)entry)->name, XHU_BANK_NAME_SIZE);
+}
+
+const xhu_bank_entry_t *xhu_find_bank_entry(const xhu_bank_t *bank, const char *name)
+{
+    return (const xhu_bank_entry_t *)bsearch(name,
+                                             bank->entries,
+                                             bank->header->entry_count,
+                                             sizeof(xhu_bank_entry_t),
+                                             xhu_compare_bank_entry);
+}
+
+const xhu_audio_data_t *xhu_get_bank_samples(const xhu_bank_t *bank, const xhu_bank_entry_t *entry)
+{
+    return (const xhu_audio_data_t *)((const char *)bank->mapping + entry->offset);
+}
+
+xhu_table_load_t *xhu_load_bank_table(
+                                      xhu_engine_t *engine,
+                                      const xhu_bank_t *bank,
+                                      const xhu_bank_entry_t *entry,
+                                      xhu_s32_t number,
+                                      xhu_table_callback_t callback,
+                                      void *user_data
+                                      )
+{
+    const xhu_audio_data_t *samples = xhu_get_bank_samples(bank, entry);
+    xhu_u64_t count = entry->frame_count * entry->channel_count;
+    
+    if (count == 0 || count > UINT32_MAX) {
+        XHU_LOG_ERROR("Bank sound %s does not fit in a table.", entry->name)
+        
+        return NULL;
+    }
+    
+    // Pages of the entry are read in ahead of the copy the worker makes
+    madvise((void *)((xhu_mem_size_t)samples & ~(xhu_mem_size_t)(getpagesize() - 1)),
+            (xhu_mem_size_t)count * sizeof(xhu_audio_data_t) + ((xhu_mem_size_t)samples & (getpagesize() - 1)),
+            MADV_WILLNEED);
+    
+    return xhu_load_table_data(engine, number, samples, (xhu_u32_t)count, callback, user_data);
+}
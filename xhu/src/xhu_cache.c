@@ -0,0 +1,441 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xhu_debug.h"
+#include "xhu_csound_wrapper.h"
+#include "xhu_cache.h"
+
+typedef enum {
+    XHU_CACHE_EMPTY,
+    XHU_CACHE_LOADING,
+    XHU_CACHE_RESIDENT,
+    XHU_CACHE_FAILED,
+    XHU_CACHE_EVICTING,
+    XHU_CACHE_ORPHANED      /* the table could not be deleted, entry and number stay out of use */
+} xhu_cache_entry_state;
+
+typedef struct {
+    char asset_id[XHU_CACHE_ASSET_ID_SIZE];
+    xhu_u64_t hash;
+    xhu_cache_entry_state state;
+    xhu_u32_t reference_count;
+    xhu_u64_t last_played;
+    xhu_u64_t bytes;
+    xhu_table_handle_t table;
+    xhu_table_load_t *load;
+    xhu_future_t eviction;
+} xhu_cache_entry_t;
+
+struct xhu_table_cache_s {
+    xhu_engine_t *engine;
+    const xhu_bank_t *bank;
+    xhu_u32_t capacity;
+    xhu_cache_entry_t *entries;
+    xhu_u32_t *index;           /* open addressed by asset hash, entry position + 1 or 0 when empty */
+    xhu_u32_t index_mask;
+    xhu_u64_t clock;
+    xhu_table_cache_stats_t stats;
+};
+
+// FNV-1a, compared before the asset id itself
+static xhu_u64_t xhu_hash_asset_id(const char *asset_id)
+{
+    xhu_u64_t hash = 14695981039346656037ull;
+    
+    for (const char *c = asset_id; *c != '\0'; ++c) {
+        hash = (hash ^ (unsigned char)*c) * 1099511628211ull;
+    }
+    
+    return hash;
+}
+
+/*
+ Only entries holding their asset, loading, resident or failed, are in the
+ index. An entry being evicted no longer holds it, a new acquire loads the
+ asset into another entry.
+ */
+static xhu_cache_entry_t *xhu_find_cache_entry(const xhu_table_cache_t *cache, const char *asset_id)
+{
+    xhu_u64_t hash = xhu_hash_asset_id(asset_id);
+    xhu_u32_t slot = (xhu_u32_t)hash & cache->index_mask;
+    
+    // The index is never more than half full, so an empty slot always ends the probe
+    while (cache->index[slot] != 0) {
+        xhu_cache_entry_t *entry = &cache->entries[cache->index[slot] - 1];
+        
+        if (entry->hash == hash && strncmp(entry->asset_id, asset_id, XHU_CACHE_ASSET_ID_SIZE) == 0) {
+            return entry;
+        }
+        
+        slot = (slot + 1) & cache->index_mask;
+    }
+    
+    return NULL;
+}
+
+static void xhu_index_cache_entry(xhu_table_cache_t *cache, const xhu_cache_entry_t *entry)
+{
+    xhu_u32_t slot = (xhu_u32_t)entry->hash & cache->index_mask;
+    
+    while (cache->index[slot] != 0) {
+        slot = (slot + 1) & cache->index_mask;
+    }
+    
+    cache->index[slot] = (xhu_u32_t)(entry - cache->entries) + 1;
+}
+
+// Backward shift deletion, later members of the probe sequence move into the gap so no lookup stops early
+static void xhu_unindex_cache_entry(xhu_table_cache_t *cache, const xhu_cache_entry_t *entry)
+{
+    xhu_u32_t position = (xhu_u32_t)(entry - cache->entries) + 1;
+    xhu_u32_t gap = (xhu_u32_t)entry->hash & cache->index_mask;
+    
+    while (cache->index[gap] != position) {
+        gap = (gap + 1) & cache->index_mask;
+    }
+    
+    for (xhu_u32_t slot = (gap + 1) & cache->index_mask; cache->index[slot] != 0; slot = (slot + 1) & cache->index_mask) {
+        xhu_u32_t home = (xhu_u32_t)cache->entries[cache->index[slot] - 1].hash & cache->index_mask;
+        
+        // The gap lies between the home slot of the entry and where it sits now
+        if (((slot - home) & cache->index_mask) >= ((slot - gap) & cache->index_mask)) {
+            cache->index[gap] = cache->index[slot];
+            gap = slot;
+        }
+    }
+    
+    cache->index[gap] = 0;
+}
+
+static void xhu_evict_cache_entry(xhu_table_cache_t *cache, xhu_cache_entry_t *entry)
+{
+    xhu_init_future(&entry->eviction, NULL, NULL);
+    xhu_unindex_cache_entry(cache, entry);
+    
+    if (entry->state == XHU_CACHE_RESIDENT) {
+        cache->stats.resident_bytes -= entry->bytes;
+        cache->stats.resident_count--;
+        cache->stats.eviction_count++;
+    }
+    
+    // Failed loads left no table behind and already gave their number back
+    if (entry->state == XHU_CACHE_FAILED) {
+        entry->state = XHU_CACHE_EMPTY;
+        
+        return;
+    }
+    
+    if (!xhu_delete_table_async(cache->engine, entry->table.number, &entry->eviction)) {
+        XHU_LOG_ERROR("Could not evict %s from table %d. The entry is not used again.", entry->asset_id, entry->table.number)
+        entry->state = XHU_CACHE_ORPHANED;
+        
+        return;
+    }
+    
+    entry->state = XHU_CACHE_EVICTING;
+    XHU_LOG_DEBUG("Evicting %s from table %d", entry->asset_id, entry->table.number)
+}
+
+// The number goes back to the engine only with the table gone, otherwise the next load would get a live table
+static void xhu_finish_cache_eviction(xhu_table_cache_t *cache, xhu_cache_entry_t *entry)
+{
+    if (entry->eviction.result != CSOUND_SUCCESS) {
+        XHU_LOG_ERROR("Could not delete table %d of %s. The entry is not used again.", entry->table.number, entry->asset_id)
+        entry->state = XHU_CACHE_ORPHANED;
+        
+        return;
+    }
+    
+    xhu_release_table_number(cache->engine, entry->table);
+    entry->state = XHU_CACHE_EMPTY;
+}
+
+// Least recently played entry that no voice holds, or NULL
+static xhu_cache_entry_t *xhu_find_eviction_candidate(xhu_table_cache_t *cache)
+{
+    xhu_cache_entry_t *candidate = NULL;
+    
+    for (xhu_u32_t i = 0; i < cache->capacity; ++i) {
+        xhu_cache_entry_t *entry = &cache->entries[i];
+        
+        if ((entry->state == XHU_CACHE_RESIDENT || entry->state == XHU_CACHE_FAILED) &&
+            entry->reference_count == 0 &&
+            (candidate == NULL || entry->last_played < candidate->last_played)) {
+            candidate = entry;
+        }
+    }
+    
+    return candidate;
+}
+
+static void xhu_enforce_cache_budget(xhu_table_cache_t *cache, xhu_u64_t incoming_bytes)
+{
+    while (cache->stats.resident_bytes + incoming_bytes > cache->stats.budget_bytes) {
+        xhu_cache_entry_t *candidate = xhu_find_eviction_candidate(cache);
+        
+        if (candidate == NULL) {
+            XHU_LOG_WARN("Table cache holds %llu bytes over its budget in tables that are playing.",
+                         (unsigned long long)(cache->stats.resident_bytes + incoming_bytes - cache->stats.budget_bytes))
+            break;
+        }
+        
+        xhu_evict_cache_entry(cache, candidate);
+    }
+}
+
+// Loads into a table number the engine allocates
+static xhu_table_load_t *xhu_start_cache_load(xhu_table_cache_t *cache, xhu_cache_entry_t *entry)
+{
+    if (cache->bank != NULL) {
+        const xhu_bank_entry_t *bank_entry = xhu_find_bank_entry(cache->bank, entry->asset_id);
+        
+        if (bank_entry == NULL) {
+            XHU_LOG_ERROR("Bank has no sound %s", entry->asset_id)
+            return NULL;
+        }
+        
+        // Bank sounds have a known size, room is made before the load rather than after
+        xhu_enforce_cache_budget(cache, bank_entry->frame_count * bank_entry->channel_count * sizeof(xhu_audio_data_t));
+        
+        return xhu_load_bank_table(cache->engine, cache->bank, bank_entry, 0, NULL, NULL);
+    }
+    
+    xhu_sample_table_t sample_table = { { 0, 0, 0, (xhu_u32_t)-1 }, entry->asset_id, 0, 0, 0 };
+    
+    return xhu_load_sample_table(cache->engine, &sample_table, NULL, NULL);
+}
+
+static void xhu_finish_cache_load(xhu_table_cache_t *cache, xhu_cache_entry_t *entry)
+{
+    bool resident = xhu_get_table_load_state(entry->load) == XHU_TABLE_READY;
+    
+    entry->bytes = (xhu_u64_t)xhu_get_table_load_length(entry->load) * sizeof(xhu_audio_data_t);
+    entry->state = resident ? XHU_CACHE_RESIDENT : XHU_CACHE_FAILED;
+    xhu_release_table_load(entry->load);
+    entry->load = NULL;
+    cache->stats.loading_count--;
+    
+    if (resident) {
+        cache->stats.resident_bytes += entry->bytes;
+        cache->stats.resident_count++;
+    }
+}
+
+xhu_table_cache_t *xhu_create_table_cache(
+                                          xhu_engine_t *engine,
+                                          const xhu_bank_t *bank,
+                                          xhu_u32_t capacity,
+                                          xhu_u64_t budget_bytes
+                                          )
+{
+    xhu_table_cache_t *cache = (xhu_table_cache_t *)calloc(1, sizeof(xhu_table_cache_t));
+    
+    if (cache == NULL) {
+        return NULL;
+    }
+    
+    // Twice the entries keeps probe sequences short, a power of two so the hash is masked
+    xhu_u32_t index_size = 2;
+    
+    while (index_size < 2 * capacity) {
+        index_size *= 2;
+    }
+    
+    cache->entries = (xhu_cache_entry_t *)calloc(capacity, sizeof(xhu_cache_entry_t));
+    cache->index = (xhu_u32_t *)calloc(index_size, sizeof(xhu_u32_t));
+    
+    if (cache->entries == NULL || cache->index == NULL) {
+        free(cache->entries);
+        free(cache->index);
+        free(cache);
+        
+        return NULL;
+    }
+    
+    cache->index_mask = index_size - 1;
+    
+    cache->engine = engine;
+    cache->bank = bank;
+    cache->capacity = capacity;
+    cache->stats.budget_bytes = budget_bytes;
+    
+    return cache;
+}
+
+void xhu_destroy_table_cache(xhu_table_cache_t *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    
+    for (xhu_u32_t i = 0; i < cache->capacity; ++i) {
+        xhu_cache_entry_t *entry = &cache->entries[i];
+        
+        if (entry->state == XHU_CACHE_LOADING) {
+            xhu_wait_table_load(entry->load);
+            xhu_finish_cache_load(cache, entry);
+        }
+        
+        if (entry->state == XHU_CACHE_RESIDENT || entry->state == XHU_CACHE_FAILED) {
+            xhu_evict_cache_entry(cache, entry);
+        }
+        
+        if (entry->state == XHU_CACHE_EVICTING) {
+            xhu_wait_future(&entry->eviction);
+            xhu_finish_cache_eviction(cache, entry);
+        }
+    }
+    
+    free(cache->entries);
+    free(cache->index);
+    free(cache);
+}
+
+xhu_s32_t xhu_acquire_cached_table(xhu_table_cache_t *cache, const char *asset_id)
+{
+    xhu_cache_entry_t *entry = xhu_find_cache_entry(cache, asset_id);
+    
+    if (entry != NULL && entry->state != XHU_CACHE_FAILED) {
+        cache->stats.hit_count++;
+        entry->reference_count++;
+        entry->last_played = ++cache->clock;
+        
+        return entry->table.number;
+    }
+    
+    if (strlen(asset_id) >= XHU_CACHE_ASSET_ID_SIZE) {
+        XHU_LOG_ERROR("Asset id %s is longer than %d characters.", asset_id, XHU_CACHE_ASSET_ID_SIZE - 1)
+        return -1;
+    }
+    
+    // A failed asset is loaded again once the voices that tried to play it let go
+    if (entry != NULL) {
+        if (entry->reference_count > 0) {
+            return -1;
+        }
+        
+        xhu_unindex_cache_entry(cache, entry);
+        entry->state = XHU_CACHE_EMPTY;
+    }
+    
+    cache->stats.miss_count++;
+    entry = NULL;
+    
+    for (xhu_u32_t i = 0; i < cache->capacity && entry == NULL; ++i) {
+        if (cache->entries[i].state == XHU_CACHE_EMPTY) {
+            entry = &cache->entries[i];
+        }
+    }
+    
+    // Every entry in use, the least recently played one makes room once its table is deleted
+    while (entry == NULL) {
+        xhu_cache_entry_t *candidate = xhu_find_eviction_candidate(cache);
+        
+        if (candidate == NULL) {
+            XHU_LOG_ERROR("Could not cache %s. All %u entries are in use.", asset_id, cache->capacity)
+            return -1;
+        }
+        
+        xhu_evict_cache_entry(cache, candidate);
+        
+        if (candidate->state == XHU_CACHE_EVICTING) {
+            xhu_wait_future(&candidate->eviction);
+            xhu_finish_cache_eviction(cache, candidate);
+        }
+        
+        if (candidate->state == XHU_CACHE_EMPTY) {
+            entry = candidate;
+        }
+    }
+    
+    snprintf(entry->asset_id, XHU_CACHE_ASSET_ID_SIZE, "%s", asset_id);
+    entry->hash = xhu_hash_asset_id(asset_id);
+    entry->bytes = 0;
+    entry->reference_count = 1;
+    entry->last_played = ++cache->clock;
+    entry->state = XHU_CACHE_LOADING;
+    entry->load = xhu_start_cache_load(cache, entry);
+    
+    // The caller gets no table to release, so the entry must not stay held
+    if (entry->load == NULL) {
+        entry->reference_count = 0;
+        entry->state = XHU_CACHE_EMPTY;
+        
+        return -1;
+    }
+    
+    entry->table = xhu_get_table_load_handle(entry->load);
+    xhu_index_cache_entry(cache, entry);
+    cache->stats.loading_count++;
+    
+    return entry->table.number;
+}
+
+void xhu_release_cached_table(xhu_table_cache_t *cache, const char *asset_id)
+{
+    xhu_cache_entry_t *entry = xhu_find_cache_entry(cache, asset_id);
+    
+    if (entry == NULL || entry->reference_count == 0) {
+        XHU_LOG_WARN("Released %s more often than it was acquired.", asset_id)
+        return;
+    }
+    
+    entry->reference_count--;
+    entry->last_played = ++cache->clock;
+}
+
+xhu_table_state xhu_get_cached_table_state(const xhu_table_cache_t *cache, const char *asset_id)
+{
+    const xhu_cache_entry_t *entry = xhu_find_cache_entry(cache, asset_id);
+    
+    if (entry == NULL || entry->state == XHU_CACHE_FAILED || entry->state == XHU_CACHE_EVICTING) {
+        return XHU_TABLE_FAILED;
+    }
+    
+    return entry->state == XHU_CACHE_RESIDENT ? XHU_TABLE_READY : XHU_TABLE_LOADING;
+}
+
+void xhu_update_table_cache(xhu_table_cache_t *cache)
+{
+    for (xhu_u32_t i = 0; i < cache->capacity; ++i) {
+        xhu_cache_entry_t *entry = &cache->entries[i];
+        
+        if (entry->state == XHU_CACHE_LOADING && xhu_get_table_load_state(entry->load) != XHU_TABLE_LOADING) {
+            xhu_finish_cache_load(cache, entry);
+        } else if (entry->state == XHU_CACHE_EVICTING && xhu_future_is_done(&entry->eviction)) {
+            xhu_finish_cache_eviction(cache, entry);
+        }
+    }
+    
+    xhu_enforce_cache_budget(cache, 0);
+}
+
+void xhu_set_table_cache_budget(xhu_table_cache_t *cache, xhu_u64_t budget_bytes)
+{
+    cache->stats.budget_bytes = budget_bytes;
+    xhu_enforce_cache_budget(cache, 0);
+}
+
+void xhu_get_table_cache_stats(const xhu_table_cache_t *cache, xhu_table_cache_stats_t *stats)
+{
+    *stats = cache->stats;
+}
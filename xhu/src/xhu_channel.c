@@ -17,11 +17,16 @@
  *
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
 #include "xhu_channel.h"
 #include "xhu_math_utilities.h"
 #include "xhu_csound_wrapper.h"
 
-
+// Twice the channel count keeps probe sequences short, a power of two so the hash is masked
+#define CHANNEL_MAP_SIZE (2 * MAX_CHANNELS)
 #define PARAMETER_NAME_MAX_LENGTH (16)
 #define AGGREGATE_ID_MAX_LENGTH (32)
 
@@ -29,19 +34,15 @@ typedef struct {
     xhu_channel_handle_t handle;
     xhu_audio_data_t *channel_pointer;
     channel_state state;
-    char *sound_aggregate_id;
-    char parameter_name[PARAMETER_NAME_MAX_LENGTH];            /**< The name of the sound parameter the channel controls */
+    xhu_u32_t used;                         /**< Set last when the slot is filled, lookups read it first */
+    char name[CHANNEL_NAME_MAX_LENGTH];     /**< The Csound channel name, direction.sound aggregate id.parameter */
 } xhu_channel_t;
 
-typedef struct {
-    xhu_channel_handle_t handle;
-} xhu_callback_channel_t;
-
-xhu_channel_t channels[MAX_CHANNELS];
-xhu_u32_t channel_handle_map[MAX_CHANNELS];
-
-xhu_u32_t handle_count;
-xhu_u32_t last_available_map_index;
+struct xhu_channel_registry_s {
+    xhu_channel_t channels[CHANNEL_MAP_SIZE];
+    xhu_u32_t channel_count;
+    pthread_mutex_t mutex;
+};
 
 void form_channel_aggregate_id(
                                channel_direction direction,
@@ -51,58 +52,223 @@ void form_channel_aggregate_id(
                                )
 {
     char direction_prefix = direction == INPUT ? 'i' : 'o';
-    sprintf(result, "%s.%s.%s", &direction_prefix, sound_id, parameter_name);
+    snprintf(result, CHANNEL_NAME_MAX_LENGTH, "%c.%s.%s", direction_prefix, sound_id, parameter_name);
+}
+
+xhu_channel_registry_t *xhu_create_channel_registry(void)
+{
+    xhu_channel_registry_t *registry = (xhu_channel_registry_t *)calloc(1, sizeof(xhu_channel_registry_t));
+    
+    if (registry == NULL)
+    {
+        return NULL;
+    }
+    
+    pthread_mutex_init(&registry->mutex, NULL);
+    
+    return registry;
+}
+
+void xhu_destroy_channel_registry(xhu_channel_registry_t *registry)
+{
+    if (registry == NULL)
+    {
+        return;
+    }
+    
+    pthread_mutex_destroy(&registry->mutex);
+    free(registry);
+}
+
+// Slot holding the name, or the empty slot ending its probe sequence
+static xhu_channel_t *find_channel(xhu_channel_registry_t *registry, const char *name, xhu_u64_t name_hash)
+{
+    xhu_u32_t index = (xhu_u32_t)name_hash & (CHANNEL_MAP_SIZE - 1);
+    
+    for (;;)
+    {
+        xhu_channel_t *channel = &registry->channels[index];
+        
+        if (!__atomic_load_n(&channel->used, __ATOMIC_ACQUIRE))
+        {
+            return channel;
+        }
+        
+        if (channel->handle.hash == name_hash && strcmp(channel->name, name) == 0)
+        {
+            return channel;
+        }
+        
+        // The map is never more than half full, so an empty slot always ends the probe
+        index = (index + 1) & (CHANNEL_MAP_SIZE - 1);
+    }
+}
+
+static const xhu_channel_handle_t *register_channel(
+                                                    xhu_engine_t *engine,
+                                                    const char *name,
+                                                    xhu_s32_t flags,
+                                                    channel_state state
+                                                    )
+{
+    xhu_channel_registry_t *registry = xhu_get_channel_registry(engine);
+    xhu_u64_t name_hash = hash((char *)name);
+    xhu_channel_t *channel = find_channel(registry, name, name_hash);
+    
+    if (__atomic_load_n(&channel->used, __ATOMIC_ACQUIRE))
+    {
+        return &channel->handle;
+    }
+    
+    if (strlen(name) >= CHANNEL_NAME_MAX_LENGTH)
+    {
+        XHU_LOG_ERROR("Channel name %s is longer than %d characters.", name, CHANNEL_NAME_MAX_LENGTH - 1)
+        return NULL;
+    }
+    
+    pthread_mutex_lock(&registry->mutex);
+    
+    // Another thread may have registered the name, or taken the slot, since the lookup
+    channel = find_channel(registry, name, name_hash);
+    
+    if (!channel->used)
+    {
+        xhu_audio_data_t *channel_pointer = NULL;
+        
+        if (registry->channel_count < MAX_CHANNELS)
+        {
+            channel_pointer = xhu_get_channel_pointer(engine, name, flags);
+        }
+        else
+        {
+            XHU_LOG_ERROR("Could not register channel %s, %d channels are registered.", name, MAX_CHANNELS)
+        }
+        
+        if (channel_pointer == NULL)
+        {
+            pthread_mutex_unlock(&registry->mutex);
+            return NULL;
+        }
+        
+        channel->handle.map_index = (xhu_u32_t)(channel - registry->channels);
+        channel->handle.hash = name_hash;
+        channel->channel_pointer = channel_pointer;
+        channel->state = state;
+        strcpy(channel->name, name);
+        __atomic_store_n(&registry->channel_count, registry->channel_count + 1, __ATOMIC_RELAXED);
+        __atomic_store_n(&channel->used, 1, __ATOMIC_RELEASE);
+    }
+    
+    pthread_mutex_unlock(&registry->mutex);
+    
+    return &channel->handle;
+}
+
+const xhu_channel_handle_t *xhu_register_channel(xhu_engine_t *engine, const char *name, xhu_s32_t flags)
+{
+    return register_channel(engine, name, flags, ACTIVE);
 }
 
-void xhu_create_channels(xhu_u32_t count)
+const xhu_channel_handle_t *xhu_find_channel(xhu_engine_t *engine, const char *name)
 {
-    for (xhu_u32_t index = 0; index < MAX_CHANNELS; ++index)
+    xhu_channel_t *channel = find_channel(xhu_get_channel_registry(engine), name, hash((char *)name));
+    
+    return __atomic_load_n(&channel->used, __ATOMIC_ACQUIRE) ? &channel->handle : NULL;
+}
+
+bool xhu_is_channel_registry_full(xhu_engine_t *engine)
+{
+    return __atomic_load_n(&xhu_get_channel_registry(engine)->channel_count, __ATOMIC_RELAXED) >= MAX_CHANNELS;
+}
+
+void xhu_create_channels(xhu_engine_t *engine, xhu_u32_t count)
+{
+    for (xhu_u32_t index = 0; index < count; ++index)
     {
-        char channel_name[4];
-        sprintf(channel_name, "%d", index);
+        char channel_name[16];
+        sprintf(channel_name, "%u", index);
         xhu_s32_t flags = CSOUND_OUTPUT_CHANNEL | CSOUND_CONTROL_CHANNEL;
-        channels[index].channel_pointer = xhu_get_channel_pointer(channel_name, flags);
+        
+        if (xhu_register_channel(engine, channel_name, flags) == NULL)
+        {
+            break;
+        }
     }
 }
 
 const xhu_channel_handle_t *const create_channel(
+                    xhu_engine_t *engine,
                     channel_direction direction,
                     channel_state state,
                     const char *sound_aggregate_id,
                     const char *parameter_name
                     )
 {
-    // TODO: Sanity check parameter name length
-    strncpy(channels[handle_count].parameter_name, parameter_name, PARAMETER_NAME_MAX_LENGTH);
-//    form_channel_aggregate_id(
-//                              direction,
-//                              sound_aggregate_id,
-//                              parameter_name
-//                              );
-    channels[handle_count].handle.map_index = last_available_map_index;
+    if (strlen(sound_aggregate_id) >= AGGREGATE_ID_MAX_LENGTH || strlen(parameter_name) >= PARAMETER_NAME_MAX_LENGTH)
+    {
+        XHU_LOG_ERROR("Sound aggregate id %s or parameter name %s is too long.", sound_aggregate_id, parameter_name)
+        return NULL;
+    }
+    
+    char name[CHANNEL_NAME_MAX_LENGTH];
+    form_channel_aggregate_id(direction, sound_aggregate_id, parameter_name, name);
+    xhu_s32_t flags = (direction == INPUT ? CSOUND_INPUT_CHANNEL : CSOUND_OUTPUT_CHANNEL) | CSOUND_CONTROL_CHANNEL;
+    
+    return register_channel(engine, name, flags, state);
+}
 
-    return &channels[handle_count].handle;
+// The channel a handle refers to, NULL for handles of another registry
+static xhu_channel_t *get_channel(xhu_engine_t *engine, const xhu_channel_handle_t *const handle)
+{
+    xhu_channel_t *channel = &xhu_get_channel_registry(engine)->channels[handle->map_index & (CHANNEL_MAP_SIZE - 1)];
+    
+    return __atomic_load_n(&channel->used, __ATOMIC_ACQUIRE) && channel->handle.hash == handle->hash ? channel : NULL;
 }
 
-void xhu_suspend_channel(xhu_channel_handle_t handle)
+void xhu_suspend_channel(xhu_engine_t *engine, xhu_channel_handle_t handle)
 {
+    xhu_channel_t *channel = get_channel(engine, &handle);
     
+    if (channel != NULL)
+    {
+        __atomic_store_n(&channel->state, SUSPENDED, __ATOMIC_RELAXED);
+    }
 }
 
-channel_state get_channel_state(const xhu_channel_handle_t *const handle)
+void xhu_resume_channel(xhu_engine_t *engine, xhu_channel_handle_t handle)
 {
-    return ACTIVE;
+    xhu_channel_t *channel = get_channel(engine, &handle);
+    
+    if (channel != NULL)
+    {
+        __atomic_store_n(&channel->state, ACTIVE, __ATOMIC_RELAXED);
+    }
+}
+
+channel_state get_channel_state(xhu_engine_t *engine, const xhu_channel_handle_t *const handle)
+{
+    xhu_channel_t *channel = get_channel(engine, handle);
+    
+    return channel != NULL ? __atomic_load_n(&channel->state, __ATOMIC_RELAXED) : SUSPENDED;
 }
 
 void set_channel_value(
+                       xhu_engine_t *engine,
                        const xhu_channel_handle_t *const handle_pointer,
                        xhu_audio_data_t value
                        )
 {
+    xhu_channel_t *channel = get_channel(engine, handle_pointer);
     
+    if (channel != NULL && __atomic_load_n(&channel->state, __ATOMIC_RELAXED) == ACTIVE)
+    {
+        *channel->channel_pointer = value;
+    }
 }
 
-xhu_audio_data_t get_channel_value(const xhu_channel_handle_t *const handle)
+xhu_audio_data_t get_channel_value(xhu_engine_t *engine, const xhu_channel_handle_t *const handle)
 {
-    return 0.0f;
+    xhu_channel_t *channel = get_channel(engine, handle);
+    
+    return channel != NULL ? *channel->channel_pointer : 0.0;
 }
@@ -17,24 +17,174 @@
  *
  */
 
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
 #include <time.h>
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#ifdef __APPLE__
+#include <mach/mach.h>
+#include <mach/thread_policy.h>
+#endif
 #include "xhu_debug.h"
 #include "xhu_csound_wrapper.h"
 #include "xhu_system_utilities.h"
 #include "xhu_math_utilities.h"
+#include "xhu_queue.h"
+#include "xhu_time.h"
+#include "xhu_event.h"
+#include "xhu_worker.h"
+#include "xhu_stream.h"
+#include "xhu_wavetables.h"
 
 //#define MACOS_BUNDLE
 
+#define XHU_COMMAND_QUEUE_SIZE (256)
+#define XHU_EVENT_QUEUE_SIZE (1024)
+#define XHU_EVENT_HEAP_SIZE (4096)
+#define XHU_MAX_PENDING_TABLES (64)
+#define XHU_PENDING_TABLE_TIMEOUT_SECONDS (2)
+#define XHU_MAX_VERSIONED_TABLES (1024)
+#define XHU_FUTURE_WAIT_TIMEOUT_MS (10)
+#define XHU_PAUSE_SPIN_MIN (64)
+#define XHU_PAUSE_SPIN_MAX (4096)
+#define XHU_MAX_CSOUND_ARGS (8)
+#define XHU_STACK_PREFAULT_SIZE (256 * 1024)
+
+typedef enum {
+    XHU_COMMAND_GET_TABLE_DATA,
+    XHU_COMMAND_SET_TABLE_DATA,
+    XHU_COMMAND_GET_TABLE_VAL,
+    XHU_COMMAND_TABLE_EXISTS,
+    XHU_COMMAND_SEND_EVENTS,
+    XHU_COMMAND_CREATE_TABLE,
+    XHU_COMMAND_GET_TABLE_POINTER,
+    XHU_COMMAND_SET_CHANNEL,
+    XHU_COMMAND_DELETE_TABLE,
+    XHU_COMMAND_ATTACH_STREAM,
+    XHU_COMMAND_DETACH_STREAM
+} xhu_command_type;
+
+typedef struct {
+    xhu_command_type type;
+    xhu_s32_t table;
+    xhu_s32_t index;
+    xhu_audio_data_t *data;
+    const xhu_audio_data_t *source;
+    xhu_u32_t count;
+    xhu_future_t *future;
+    const xhu_event_t *events;
+    xhu_s32_t *results;
+    char *message;
+    xhu_audio_data_t value;
+    xhu_stream_t *stream;
+} xhu_command_t;
+
+// A table event that Csound has not turned into a table, or not been given yet
+typedef struct {
+    xhu_s32_t table;
+    bool deleting;
+    bool replaces_table;
+    bool issued;
+    xhu_audio_data_t *pfields;
+    xhu_u32_t pfield_count;
+    char *message;
+    xhu_s64_t ready_sample;
+    xhu_s64_t deadline_sample;
+    xhu_future_t *future;
+} xhu_pending_table_t;
+
+// Published by the performance thread, readers is counted by table views on any thread
+typedef struct {
+    xhu_u32_t version;
+    xhu_u32_t readers;
+    xhu_audio_data_t *data;
+    xhu_s32_t length;
+} xhu_table_slot_t;
+
+typedef struct {
+    xhu_u64_t cycle_count;
+    xhu_u64_t overrun_count;
+    xhu_s64_t last_overrun_sample;
+    xhu_u64_t total_ns;
+    xhu_u64_t worst_ns;
+    xhu_u64_t histogram[XHU_CYCLE_HISTOGRAM_BUCKETS];
+} xhu_cycle_counters_t;
+
 typedef struct {
+    xhu_u64_t dispatched_count;
+    xhu_u64_t late_count;
+    xhu_u64_t dropped_count;
+    xhu_s64_t max_late_samples;
+    xhu_s64_t total_late_samples;
+    xhu_u64_t timed_count;
+    xhu_s64_t min_timing_error_ns;
+    xhu_s64_t max_timing_error_ns;
+    xhu_s64_t total_timing_error_ns;
+} xhu_event_counters_t;
+
+struct xhu_engine_s {
     CSOUND* csound;
     xhu_s32_t compile_result;
+    bool perf_thread_running;
     bool run_performance_thread;
     bool pause_csound_thread;
     bool csound_thread_paused;
-} xhu_csound_state_t;
-
-xhu_csound_state_t _xhu_csound_state;
-volatile bool _xhu_perf_thread_running;
+    bool applying_paused_commands;
+    bool commands_closed;
+    xhu_ring_t commands;
+    void *completion_lock;
+    void *park_lock;
+    void *pause_ack_lock;
+    xhu_u32_t pause_spin_limit;
+    xhu_u64_t pause_start_ns;
+    xhu_pause_stats_t pause_stats;
+    xhu_audio_clock_t audio_clock;
+    xhu_engine_options_t options;
+    xhu_perform_mode perform_mode;
+    xhu_u32_t blocks_per_wakeup;
+    xhu_render_stats_t render_stats;
+    xhu_render_stats_t render_stats_baseline;
+    void *thread;
+    xhu_u32_t channel_count;
+    xhu_s64_t render_sample_limit;
+    xhu_u64_t captured_frames;
+    xhu_u32_t realtime_status;
+    xhu_u64_t cpu_start_ns;
+    xhu_u64_t cycle_clock_ns;
+    xhu_u64_t control_period_ns;
+    xhu_cycle_counters_t cycle_counters;
+    bool cycle_stats_reset_requested;
+    xhu_u32_t spout_frame;
+    xhu_audio_data_t output_scale;
+    bool startup_complete;
+    void *startup_lock;
+    xhu_u64_t startup_begin_ns;
+    xhu_u64_t thread_start_ns;
+    xhu_startup_stats_t startup_stats;
+    xhu_ring_t scheduled_events;
+    xhu_event_heap_t event_heap;
+    xhu_u64_t event_sequence;
+    xhu_event_counters_t event_counters;
+    xhu_pending_table_t pending_tables[XHU_MAX_PENDING_TABLES];
+    xhu_u32_t pending_table_count;
+    xhu_table_slot_t table_slots[XHU_MAX_VERSIONED_TABLES];
+    xhu_number_allocator_t table_numbers;
+    xhu_stream_t *streams[XHU_MAX_STREAMS];     // performance thread only
+    xhu_u32_t stream_count;
+    bool stream_ids[XHU_MAX_STREAM_ID];         // held by open streams
+    void *submit_mutex;             // commands come from the host thread and the workers
+    xhu_worker_pool_t *workers;
+    xhu_channel_registry_t *channels;
+};
 
 xhu_s32_t xhu_log_level = XHU_LOG_LEVEL_DEBUG;
 bool xhu_log_with_func_info = false;
@@ -61,6 +211,18 @@ static void xhu_set_executable_path()
         XHU_LOG_ERROR("Buffer too small; need size %u", size)
     }
     
+    xhu_executable_path = xhu_get_folder_path(full_path);
+    XHU_LOG_DEBUG("Executable path is %s", xhu_executable_path)
+#elif defined(__linux__)
+    char full_path[PATH_MAX];
+    ssize_t size = readlink("/proc/self/exe", full_path, sizeof(full_path) - 1);
+    
+    if (size < 0) {
+        size = 0;
+        XHU_LOG_ERROR("Could not resolve executable path")
+    }
+    
+    full_path[size] = '\0';
     xhu_executable_path = xhu_get_folder_path(full_path);
     XHU_LOG_DEBUG("Executable path is %s", xhu_executable_path)
 #else
@@ -114,315 +276,2033 @@ static void xhu_print_csound_return_code(const char *function_name, xhu_s32_t re
 #endif
 }
 
-uintptr_t csound_thread(void* data)
+static void xhu_complete_future(xhu_future_t *future)
 {
-    xhu_csound_state_t* state = (xhu_csound_state_t*)data;
-    
-    if (state->compile_result == CSOUND_SUCCESS) {
-        _xhu_perf_thread_running = true;
-        XHU_LOG_DEBUG("Csound performance thread created")
-        
-        while (true) {
-            // Yield for non-reentrant API functions
-            if (state->pause_csound_thread) {
-                state->csound_thread_paused = true;
-                XHU_LOG_DEBUG("CSOUND THREAD YIELD")
-            }
-            
-            while (state->pause_csound_thread);
-            
-            state->csound_thread_paused = false;
-            
-            if (csoundPerformKsmps(state->csound) != 0 || !state->run_performance_thread) {
-                break;
-            }
-        }
-        
-        _xhu_perf_thread_running = false;
-        XHU_LOG_DEBUG("Csound performance loop stopped")
-        csoundDestroy(state->csound);
-        XHU_LOG_DEBUG("Csound instance destroyed")
+    if (future->callback != NULL) {
+        future->callback(future, future->user_data);
     }
     
-    return 1;
+    // Synchronous callers may release the future as soon as this store is visible
+    __atomic_store_n(&future->done, 1, __ATOMIC_RELEASE);
 }
 
-void xhu_set_opcode_path(const char *path)
+static xhu_table_slot_t *xhu_get_table_slot(xhu_engine_t *engine, xhu_s32_t table)
 {
-#ifdef MACOS_BUNDLE
-    sprintf(xhu_opcode_path, "%s%s", xhu_executable_path, "/../Frameworks");
-#else
-    sprintf(xhu_opcode_path, "%s%s", xhu_executable_path, "/lib");
-#endif
-    xhu_set_global_env("OPCODE6DIR64", xhu_opcode_path);
+    return table > 0 && table < XHU_MAX_VERSIONED_TABLES ? &engine->table_slots[table] : NULL;
 }
 
-void xhu_set_audio_path(const char *path)
+// An odd version tells view readers the table is being changed; seq_cst pairs with the reader count
+static void xhu_lock_table_slot(xhu_table_slot_t *slot)
 {
-    const char *suffix = "/Resources/audio";
-#ifdef MACOS_BUNDLE
-    sprintf(xhu_audio_path, "%s%s%s", xhu_executable_path, "/..", suffix);
-#else
-    sprintf(xhu_audio_path, "%s%s", xhu_executable_path, suffix);
-#endif
-    xhu_set_global_env("SSDIR", xhu_audio_path);
+    if (slot != NULL) {
+        __atomic_store_n(&slot->version, slot->version + 1, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
 }
 
-void xhu_set_csd_path(const char *path)
+static void xhu_unlock_table_slot(xhu_table_slot_t *slot, xhu_audio_data_t *data, xhu_s32_t length)
 {
-    const char *suffix = "/Resources/csound/xhu.csd";
-#ifdef MACOS_BUNDLE
-    sprintf(xhu_csd_path, "%s%s%s", xhu_executable_path, "/../", suffix);
-#else
-    sprintf(xhu_csd_path, "%s%s", xhu_executable_path, suffix);
-#endif
+    if (slot != NULL) {
+        __atomic_store_n(&slot->data, length > 0 ? data : NULL, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->length, length > 0 ? length : 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->version, slot->version + 1, __ATOMIC_RELEASE);
+    }
 }
 
-bool xhu_start(bool bundle)
+static void xhu_issue_table_event(xhu_engine_t *engine, xhu_pending_table_t *pending)
 {
-    srand((unsigned)time(NULL));
+    xhu_s64_t now = csoundGetCurrentTimeSamples(engine->csound);
+    pending->issued = true;
+    pending->ready_sample = now + 2 * csoundGetKsmps(engine->csound);
+    pending->deadline_sample = now + (xhu_s64_t)(XHU_PENDING_TABLE_TIMEOUT_SECONDS * csoundGetSr(engine->csound));
     
-    // Set Csound environment variables
-    xhu_set_executable_path();
-    xhu_set_opcode_path(NULL);
-    xhu_set_csd_path(NULL);
-    xhu_set_audio_path(NULL);
+    if (pending->message != NULL) {
+        csoundInputMessage(engine->csound, pending->message);
+    } else {
+        csoundScoreEvent(engine->csound, 'f', pending->pfields, pending->pfield_count);
+    }
     
-    // Create Csound instance
-    _xhu_csound_state.csound = csoundCreate(NULL);
+    // Csound copies the event, the buffers handed over by the submitting thread end here
+    free(pending->pfields);
+    free(pending->message);
+    pending->pfields = NULL;
+    pending->message = NULL;
+}
+
+/*
+ Csound applies an f-statement at the latest in the k-cycle after the one it
+ was given in. A new table is ready as soon as it exists, a deleted one as
+ soon as it is gone; a replaced table, which Csound may rebuild in the same
+ memory, once that k-cycle has passed. Events that would free memory an open
+ table view reads wait until the view is closed.
+ */
+static bool xhu_poll_pending_table(xhu_engine_t *engine, xhu_pending_table_t *pending)
+{
+    xhu_table_slot_t *slot = xhu_get_table_slot(engine, pending->table);
+    bool running = __atomic_load_n(&engine->perf_thread_running, __ATOMIC_ACQUIRE);
     
-    if (_xhu_csound_state.csound == NULL) {
-        XHU_LOG_FATAL( "Csound instance creation failed")
-        return false;
+    if (!pending->issued && running) {
+        // Commands applied while the performance is paused leave the event for when it resumes
+        if (engine->applying_paused_commands ||
+            (slot != NULL && __atomic_load_n(&slot->readers, __ATOMIC_SEQ_CST) > 0)) {
+            return false;
+        }
+        
+        xhu_issue_table_event(engine, pending);
     }
     
-    _xhu_perf_thread_running = false;
+    xhu_audio_data_t *table_ptr = NULL;
+    xhu_s32_t length = csoundGetTable(engine->csound, &table_ptr, pending->table);
+    xhu_s64_t now = csoundGetCurrentTimeSamples(engine->csound);
+    xhu_future_t *future = pending->future;
     
-    _xhu_csound_state.compile_result = CSOUND_ERROR;
-    _xhu_csound_state.run_performance_thread = false;
+    if (pending->deleting && length <= 0) {
+        future->result = CSOUND_SUCCESS;
+        future->value = 0;
+    } else if (!pending->deleting && length > 0 && (!pending->replaces_table || now >= pending->ready_sample)) {
+        future->result = pending->table;
+        future->value = length;
+    } else if (!pending->issued || now >= pending->deadline_sample || !running) {
+        future->result = CSOUND_ERROR;
+        future->value = 0;
+        free(pending->pfields);
+        free(pending->message);
+    } else {
+        return false;
+    }
     
-    csoundSetMessageCallback(_xhu_csound_state.csound, xhu_msg_callback);
+    xhu_unlock_table_slot(slot, table_ptr, length);
+    xhu_complete_future(future);
     
-    // Compile orchestra file
-    xhu_s32_t cSoundArgsCount = 2;
-    char* cSoundArgs[cSoundArgsCount];
-    cSoundArgs[0] = "csound";
-    char temp[strlen(xhu_csd_path) + 1];
-    strcpy(temp, xhu_csd_path);
-    cSoundArgs[1] = temp;
-    _xhu_csound_state.compile_result = csoundCompile(_xhu_csound_state.csound, cSoundArgsCount, cSoundArgs);
-    xhu_print_csound_return_code("cSoundCompile", _xhu_csound_state.compile_result);
+    return true;
+}
+
+static xhu_u32_t xhu_poll_pending_tables(xhu_engine_t *engine)
+{
+    xhu_u32_t completed = 0;
+    xhu_u32_t i = 0;
     
-    if (_xhu_csound_state.compile_result != CSOUND_SUCCESS) {
-        XHU_LOG_FATAL( "Csound .csd compilation failed")
-        
-        return false;
+    while (i < engine->pending_table_count) {
+        if (xhu_poll_pending_table(engine, &engine->pending_tables[i])) {
+            engine->pending_tables[i] = engine->pending_tables[--engine->pending_table_count];
+            ++completed;
+        } else {
+            ++i;
+        }
     }
     
-    // Start performance thread
-    _xhu_csound_state.run_performance_thread = true;
-    _xhu_csound_state.pause_csound_thread = false;
-    _xhu_csound_state.csound_thread_paused = false;
+    return completed;
+}
+
+// Returns false when the future completes later, from xhu_poll_pending_tables
+static bool xhu_create_table(xhu_engine_t *engine, xhu_command_t *command)
+{
+    xhu_future_t *future = command->future;
     
-    if (csoundCreateThread(csound_thread, (void *)&_xhu_csound_state) == NULL) {
-        XHU_LOG_FATAL( "Csound performance thread creation failed")
+    if (engine->pending_table_count == XHU_MAX_PENDING_TABLES) {
+        XHU_LOG_ERROR("Could not change table %d. Too many tables are pending.", command->table)
+        future->result = CSOUND_ERROR;
+        free(command->data);
+        free(command->message);
         
-        return false;
+        return true;
     }
     
-    // Wait for performance thread
-    while (true) {
-        if (_xhu_perf_thread_running) {
-            break;
-        }
-        xhu_pause(1);
-    }
+    xhu_pending_table_t *pending = &engine->pending_tables[engine->pending_table_count++];
+    xhu_audio_data_t *table_ptr = NULL;
+    pending->table = command->table;
+    pending->deleting = command->type == XHU_COMMAND_DELETE_TABLE;
+    pending->replaces_table = csoundGetTable(engine->csound, &table_ptr, command->table) > 0;
+    pending->issued = false;
+    pending->pfields = command->data;
+    pending->pfield_count = command->count;
+    pending->message = command->message;
+    pending->future = future;
     
-    // Everything is OK...
-    XHU_LOG_DEBUG("Csound wrapper initialized and performance thread running")
+    // Blocks new views first, the event goes out now or once the open views are closed
+    xhu_lock_table_slot(xhu_get_table_slot(engine, command->table));
     
-    return true;
+    return false;
 }
 
-void xhu_stop(void)
+static void xhu_execute_command(xhu_engine_t *engine, xhu_command_t *command)
 {
-    _xhu_csound_state.run_performance_thread = false;
+    CSOUND *csound = engine->csound;
+    xhu_future_t *future = command->future;
+    xhu_audio_data_t *table_ptr = NULL;
+    xhu_table_slot_t *slot = xhu_get_table_slot(engine, command->table);
+    
+    switch (command->type) {
+        case XHU_COMMAND_GET_TABLE_DATA:
+            future->result = csoundGetTable(csound, &table_ptr, command->table);
+            
+            if (future->result > 0) {
+                xhu_u32_t count = (xhu_u32_t)future->result < command->count ? (xhu_u32_t)future->result : command->count;
+                memcpy(command->data, table_ptr, count * sizeof(xhu_audio_data_t));
+            }
+            break;
+        case XHU_COMMAND_SET_TABLE_DATA:
+            future->result = csoundGetTable(csound, &table_ptr, command->table);
+            
+            // One copy straight into the ftable between two k-cycles, Csound allocates the guard point after length
+            if (future->result < 0 || (xhu_u64_t)command->index + command->count > (xhu_u64_t)future->result + 1) {
+                future->result = CSOUND_ERROR;
+            } else {
+                xhu_s32_t length = future->result;
+                
+                xhu_lock_table_slot(slot);
+                memcpy(table_ptr + command->index, command->source, command->count * sizeof(xhu_audio_data_t));
+                xhu_unlock_table_slot(slot, table_ptr, length);
+                future->result = CSOUND_SUCCESS;
+            }
+            break;
+        case XHU_COMMAND_GET_TABLE_VAL:
+            future->result = csoundGetTable(csound, &table_ptr, command->table);
+            
+            if (future->result <= 0 || (xhu_u64_t)command->index >= (xhu_u64_t)future->result) {
+                future->result = CSOUND_ERROR;
+            } else {
+                future->value = table_ptr[command->index];
+                future->result = CSOUND_SUCCESS;
+            }
+            break;
+        case XHU_COMMAND_TABLE_EXISTS:
+            future->result = csoundGetTable(csound, &table_ptr, command->table);
+            future->value = future->result > 0 && table_ptr != NULL;
+            break;
+        case XHU_COMMAND_SEND_EVENTS:
+            // The whole batch is applied in one k-cycle, inside the API lock the performance thread already holds
+            future->result = 0;
+            
+            for (xhu_u32_t i = 0; i < command->count; ++i) {
+                const xhu_event_t *event = &command->events[i];
+                xhu_s32_t result = csoundScoreEvent(csound, event->type, event->parameters, event->parameter_count);
+                
+                if (command->results != NULL) {
+                    command->results[i] = result;
+                }
+                
+                if (result == CSOUND_SUCCESS) {
+                    ++future->result;
+                }
+            }
+            break;
+        case XHU_COMMAND_CREATE_TABLE:
+        case XHU_COMMAND_DELETE_TABLE:
+            if (!xhu_create_table(engine, command)) {
+                return;
+            }
+            break;
+        case XHU_COMMAND_GET_TABLE_POINTER:
+            future->result = csoundGetTable(csound, &future->data, command->table);
+            
+            // Publishes tables the orchestra created to views, unless a table event is pending for them
+            if (slot != NULL && (slot->version & 1) == 0 && slot->data != future->data) {
+                xhu_lock_table_slot(slot);
+                xhu_unlock_table_slot(slot, future->data, future->result);
+            }
+            break;
+        case XHU_COMMAND_SET_CHANNEL:
+            *command->data = command->value;
+            future->result = CSOUND_SUCCESS;
+            break;
+        case XHU_COMMAND_ATTACH_STREAM:
+            future->result = CSOUND_ERROR;
+            
+            if (engine->stream_count < XHU_MAX_STREAMS) {
+                engine->streams[engine->stream_count++] = command->stream;
+                future->result = CSOUND_SUCCESS;
+            }
+            break;
+        case XHU_COMMAND_DETACH_STREAM:
+            future->result = CSOUND_ERROR;
+            
+            for (xhu_u32_t i = 0; i < engine->stream_count; ++i) {
+                if (engine->streams[i] == command->stream) {
+                    engine->streams[i] = engine->streams[--engine->stream_count];
+                    future->result = CSOUND_SUCCESS;
+                    break;
+                }
+            }
+            break;
+    }
+    
+    xhu_complete_future(future);
 }
 
-void xhu_set_log_level(xhu_s32_t level)
+static inline bool xhu_perf_thread_running(xhu_engine_t *engine)
 {
-    xhu_log_level = level;
+    return __atomic_load_n(&engine->perf_thread_running, __ATOMIC_ACQUIRE);
 }
 
-xhu_audio_data_t *xhu_get_channel_pointer(const char *name, xhu_s32_t flags)
+// Applies queued commands between two k-cycles, on the performance thread only
+static void xhu_drain_commands(xhu_engine_t *engine)
 {
-    xhu_audio_data_t *channel;
-    xhu_s32_t result = csoundGetChannelPtr(_xhu_csound_state.csound, &channel, name, flags);
+    xhu_command_t command;
+    const xhu_command_t *next;
+    xhu_u32_t completed = 0;
     
-    if (result == CSOUND_SUCCESS) {
-        XHU_LOG_DEBUG("Got pointer to channel %s", name)
-        return channel;
+    while ((next = (const xhu_command_t *)xhu_ring_peek(&engine->commands)) != NULL) {
+        bool changes_table = next->type == XHU_COMMAND_CREATE_TABLE || next->type == XHU_COMMAND_DELETE_TABLE;
+        
+        // Table changes wait in the queue for a free pending slot, commands behind them wait in order
+        if (changes_table && engine->pending_table_count == XHU_MAX_PENDING_TABLES && xhu_perf_thread_running(engine) &&
+            !engine->applying_paused_commands) {
+            break;
+        }
+        
+        xhu_ring_pop(&engine->commands, &command);
+        xhu_execute_command(engine, &command);
+        ++completed;
     }
     
-    xhu_print_csound_return_code("csoundGetChannelPtr", result);
-    XHU_LOG_ERROR("Could not get pointer to channel %s", name)
-    return NULL;
+    // Also fails whatever is still pending once the performance thread stopped
+    completed += xhu_poll_pending_tables(engine);
+    
+    if (completed > 0) {
+        csoundNotifyThreadLock(engine->completion_lock);
+    }
 }
 
-xhu_audio_data_t xhu_get_control_channel_value(xhu_audio_data_t *channel)
+// Fails a table change that was not handed to Csound yet, it only takes effect over the following k-cycles
+static void xhu_cancel_pending_table(xhu_engine_t *engine, xhu_future_t *future)
 {
-    return *channel;
+    for (xhu_u32_t i = 0; i < engine->pending_table_count; ++i) {
+        xhu_pending_table_t *pending = &engine->pending_tables[i];
+        
+        if (pending->future != future || pending->issued) {
+            continue;
+        }
+        
+        xhu_audio_data_t *table_ptr = NULL;
+        xhu_s32_t length = csoundGetTable(engine->csound, &table_ptr, pending->table);
+        
+        XHU_LOG_ERROR("Could not change table %d. Performance is paused.", pending->table)
+        free(pending->pfields);
+        free(pending->message);
+        future->result = CSOUND_ERROR;
+        future->value = 0;
+        xhu_unlock_table_slot(xhu_get_table_slot(engine, pending->table), table_ptr, length);
+        engine->pending_tables[i] = engine->pending_tables[--engine->pending_table_count];
+        xhu_complete_future(future);
+        
+        return;
+    }
 }
 
-void xhu_set_control_channel_value(xhu_audio_data_t value, const char *name)
+/*
+ A parked performance thread leaves Csound to the host, so a thread waiting on
+ a future applies the queued commands itself instead of waiting for the
+ resume. The submit mutex keeps other waiting threads and the resume out.
+ Returns false when the performance thread is not parked.
+ */
+static bool xhu_apply_commands_while_paused(xhu_engine_t *engine, xhu_future_t *future)
 {
-    xhu_audio_data_t *chnPtr = NULL;
-    xhu_s32_t chnType = CSOUND_INPUT_CHANNEL | CSOUND_CONTROL_CHANNEL;
-    xhu_s32_t result = csoundGetChannelPtr(_xhu_csound_state.csound, &chnPtr, name, chnType);
+    csoundLockMutex(engine->submit_mutex);
     
-    if (result == CSOUND_SUCCESS) {
-        *chnPtr = (xhu_audio_data_t)value;
-        XHU_LOG_DEBUG("Value %f sent to channel %s", value, name)
-    } else {
-        xhu_print_csound_return_code("csoundGetChannelPtr", result);
+    bool parked = __atomic_load_n(&engine->pause_csound_thread, __ATOMIC_ACQUIRE) &&
+        __atomic_load_n(&engine->csound_thread_paused, __ATOMIC_ACQUIRE);
+    
+    if (parked) {
+        engine->applying_paused_commands = true;
+        xhu_drain_commands(engine);
+        engine->applying_paused_commands = false;
+        xhu_cancel_pending_table(engine, future);
     }
+    
+    csoundUnlockMutex(engine->submit_mutex);
+    
+    return parked;
 }
 
-void xhu_send_message(const char* message)
+static inline void xhu_cpu_relax(void)
 {
-    XHU_LOG_DEBUG("Sending message to Csound:\n%s", message);
-    csoundInputMessage(_xhu_csound_state.csound, message);
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
 }
 
-void xhu_send_score_event(const char type, xhu_audio_data_t* parameters, xhu_s32_t numParameters)
+/*
+ Parks the performance thread on a thread lock while a pause is requested.
+ xhu_resume_performance clears the acknowledgement, a pause requested again
+ before the thread woke up is acknowledged anew.
+ */
+static void xhu_park_if_paused(xhu_engine_t *engine)
 {
-    xhu_s32_t result = csoundScoreEvent(_xhu_csound_state.csound, type, parameters, numParameters);
-    
-    if(result == CSOUND_SUCCESS) {
-        XHU_LOG_DEBUG("Sent score event");
-    } else {
-        xhu_print_csound_return_code("csoundScoreEvent", result);
+    while (__atomic_load_n(&engine->pause_csound_thread, __ATOMIC_ACQUIRE)) {
+        if (!__atomic_load_n(&engine->csound_thread_paused, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n(&engine->csound_thread_paused, true, __ATOMIC_RELEASE);
+            csoundNotifyThreadLock(engine->pause_ack_lock);
+        }
+        
+        csoundWaitThreadLockNoTimeout(engine->park_lock);
     }
 }
 
-const xhu_s32_t xhu_get_sample_rate(void)
+static bool xhu_submit_command(xhu_engine_t *engine, xhu_command_t *command)
 {
-    return xhu_round_to_int(csoundGetSr(_xhu_csound_state.csound));
+    if (!xhu_perf_thread_running(engine)) {
+        XHU_LOG_ERROR("Could not submit command. Performance thread is not running.")
+        
+        return false;
+    }
+    
+    command->future->engine = engine;
+    
+    csoundLockMutex(engine->submit_mutex);
+    bool pushed = xhu_ring_push(&engine->commands, command);
+    csoundUnlockMutex(engine->submit_mutex);
+    
+    if (!pushed) {
+        XHU_LOG_ERROR("Could not submit command. Command queue is full.")
+        
+        return false;
+    }
+    
+    return true;
 }
 
-const xhu_s32_t xhu_get_control_rate(void)
+// Moves newly scheduled events into the heap and sends those due in the coming k-cycle
+static void xhu_dispatch_events(xhu_engine_t *engine)
 {
-    return csoundGetKr(_xhu_csound_state.csound);
+    xhu_event_counters_t *counters = &engine->event_counters;
+    xhu_event_t event;
+    
+    while (xhu_ring_pop(&engine->scheduled_events, &event)) {
+        if (!xhu_event_heap_push(&engine->event_heap, &event)) {
+            __atomic_store_n(&counters->dropped_count, counters->dropped_count + 1, __ATOMIC_RELAXED);
+        }
+    }
+    
+    const xhu_event_t *next = xhu_event_heap_peek(&engine->event_heap);
+    
+    if (next == NULL) {
+        return;
+    }
+    
+    xhu_s64_t block_start = csoundGetCurrentTimeSamples(engine->csound);
+    xhu_s64_t block_end = block_start + csoundGetKsmps(engine->csound);
+    xhu_f64_t sample_rate = engine->audio_clock.sample_rate;
+    
+    while (next != NULL && next->sample < block_end) {
+        xhu_event_heap_pop(&engine->event_heap, &event);
+        xhu_s64_t offset = event.sample - block_start;
+        
+        // Late events start at once, the lateness is what the jitter statistics report
+        if (offset < 0) {
+            __atomic_store_n(&counters->late_count, counters->late_count + 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&counters->total_late_samples, counters->total_late_samples - offset, __ATOMIC_RELAXED);
+            
+            if (-offset > counters->max_late_samples) {
+                __atomic_store_n(&counters->max_late_samples, -offset, __ATOMIC_RELAXED);
+            }
+            
+            offset = 0;
+        }
+        
+        // p2 is relative to the current k-cycle, with --sample-accurate Csound honours the sub-block part
+        if (event.parameter_count > 1) {
+            event.parameters[1] = offset / sample_rate;
+        }
+        
+        // Events scheduled by time also record how far from the requested time they actually start
+        if (event.time_ns != 0) {
+            xhu_u64_t start_ns = xhu_audio_clock_time_at(&engine->audio_clock, block_start + offset);
+            xhu_s64_t error_ns = (xhu_s64_t)(start_ns - event.time_ns);
+            
+            if (counters->timed_count == 0 || error_ns < counters->min_timing_error_ns) {
+                __atomic_store_n(&counters->min_timing_error_ns, error_ns, __ATOMIC_RELAXED);
+            }
+            
+            if (counters->timed_count == 0 || error_ns > counters->max_timing_error_ns) {
+                __atomic_store_n(&counters->max_timing_error_ns, error_ns, __ATOMIC_RELAXED);
+            }
+            
+            __atomic_store_n(&counters->total_timing_error_ns, counters->total_timing_error_ns + error_ns, __ATOMIC_RELAXED);
+            __atomic_store_n(&counters->timed_count, counters->timed_count + 1, __ATOMIC_RELAXED);
+        }
+        
+        csoundScoreEvent(engine->csound, event.type, event.parameters, event.parameter_count);
+        __atomic_store_n(&counters->dispatched_count, counters->dispatched_count + 1, __ATOMIC_RELAXED);
+        next = xhu_event_heap_peek(&engine->event_heap);
+    }
 }
 
-const xhu_s32_t xhu_get_control_size(void)
+// Registered with Csound so commands are applied at every k-cycle, however many are rendered per wakeup
+static void xhu_sense_event_callback(CSOUND *csound, void *user_data)
 {
-    return csoundGetKsmps(_xhu_csound_state.csound);
+    xhu_engine_t *engine = (xhu_engine_t *)user_data;
+    
+    xhu_audio_clock_publish(&engine->audio_clock, xhu_time_now_ns(), csoundGetCurrentTimeSamples(csound));
+    xhu_drain_commands(engine);
+    xhu_dispatch_events(engine);
+    
+    for (xhu_u32_t i = 0; i < engine->stream_count; ++i) {
+        xhu_pump_stream(engine->streams[i]);
+    }
 }
 
-const xhu_f32_t xhu_get_control_period(void)
+// CPU time rather than wall time, so waiting on the audio device is not counted as rendering
+static xhu_u64_t xhu_get_thread_cpu_time_ns(void)
 {
-    return 1.0f / xhu_get_sample_rate() * xhu_get_control_size(); // ksmps duration
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    struct timespec time_spec;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time_spec);
+    
+    return (xhu_u64_t)time_spec.tv_sec * 1000000000ull + (xhu_u64_t)time_spec.tv_nsec;
+#else
+    return (xhu_u64_t)clock() * (1000000000ull / CLOCKS_PER_SEC);
+#endif
 }
 
-const xhu_s32_t xhu_get_table_data(const xhu_s32_t table_id, xhu_audio_data_t *data)
+static void xhu_clear_cycle_counters(xhu_cycle_counters_t *counters)
 {
-    xhu_s32_t length = -1;
+    __atomic_store_n(&counters->cycle_count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&counters->overrun_count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&counters->last_overrun_sample, -1, __ATOMIC_RELAXED);
+    __atomic_store_n(&counters->total_ns, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&counters->worst_ns, 0, __ATOMIC_RELAXED);
     
-    if (table_id == 0)
-    {
-        XHU_LOG_ERROR("Table ID is undefined.")
-        
-        return length;
+    for (xhu_u32_t i = 0; i < XHU_CYCLE_HISTOGRAM_BUCKETS; ++i) {
+        __atomic_store_n(&counters->histogram[i], 0, __ATOMIC_RELAXED);
     }
+}
+
+// Single writer: only the performance thread updates the counters, readers load them relaxed
+static void xhu_record_cycles(xhu_engine_t *engine, xhu_u32_t cycles)
+{
+    xhu_cycle_counters_t *counters = &engine->cycle_counters;
+    xhu_u64_t now = xhu_get_thread_cpu_time_ns();
+    xhu_u64_t cycle_ns = (now - engine->cycle_clock_ns) / cycles;
+    engine->cycle_clock_ns = now;
     
-    if (data == NULL)
-    {
-        XHU_LOG_ERROR("Data pointer is NULL.")
-        
-        return length;
+    if (__atomic_load_n(&engine->cycle_stats_reset_requested, __ATOMIC_ACQUIRE)) {
+        xhu_clear_cycle_counters(counters);
+        __atomic_store_n(&engine->cycle_stats_reset_requested, false, __ATOMIC_RELEASE);
     }
     
-    _xhu_csound_state.pause_csound_thread = true;
+    xhu_u64_t bucket = cycle_ns * XHU_CYCLE_HISTOGRAM_BUCKETS_PER_PERIOD / engine->control_period_ns;
     
-    while (!_xhu_csound_state.csound_thread_paused);
+    if (bucket >= XHU_CYCLE_HISTOGRAM_BUCKETS) {
+        bucket = XHU_CYCLE_HISTOGRAM_BUCKETS - 1;
+    }
     
-    length = csoundGetTable(_xhu_csound_state.csound, &data, table_id);
+    __atomic_store_n(&counters->histogram[bucket], counters->histogram[bucket] + cycles, __ATOMIC_RELAXED);
+    __atomic_store_n(&counters->cycle_count, counters->cycle_count + cycles, __ATOMIC_RELAXED);
+    __atomic_store_n(&counters->total_ns, counters->total_ns + cycle_ns * cycles, __ATOMIC_RELAXED);
     
-    if (length >= 0) {
-        XHU_LOG_DEBUG("Got data for table %d", table_id);
-    } else {
-        XHU_LOG_ERROR("Could not get data for table %d. Table does not exist.", table_id)
+    if (cycle_ns > counters->worst_ns) {
+        __atomic_store_n(&counters->worst_ns, cycle_ns, __ATOMIC_RELAXED);
     }
     
-    _xhu_csound_state.pause_csound_thread = false;
-    
-    return length;
+    if (cycle_ns > engine->control_period_ns) {
+        __atomic_store_n(&counters->overrun_count, counters->overrun_count + cycles, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters->last_overrun_sample, csoundGetCurrentTimeSamples(engine->csound), __ATOMIC_RELAXED);
+    }
 }
 
-void xhu_set_table_data(const xhu_s32_t table, const xhu_audio_data_t *const data, xhu_u32_t data_count)
+// Copies rendered frames into the host buffer of an offline memory render
+static void xhu_capture_output(xhu_engine_t *engine, const xhu_audio_data_t *samples, xhu_u32_t frame_count)
 {
-    if (table == TABLE_UNDEFINED) {
-        XHU_LOG_DEBUG("Table is undefined.");
-        return;
-    }
-    
-    _xhu_csound_state.pause_csound_thread = true;
+    const xhu_engine_options_t *options = &engine->options;
+    xhu_u64_t captured_frames = engine->captured_frames;
+    xhu_u64_t free_frames = options->output_buffer_frames - captured_frames;
+    xhu_u64_t frames = frame_count < free_frames ? frame_count : free_frames;
     
-    while (!_xhu_csound_state.csound_thread_paused);
+    memcpy(options->output_buffer + captured_frames * engine->channel_count,
+           samples,
+           frames * engine->channel_count * sizeof(xhu_audio_data_t));
+    __atomic_store_n(&engine->captured_frames, captured_frames + frames, __ATOMIC_RELEASE);
     
-    for (xhu_u32_t i = 0; i < data_count; ++i) {
-        csoundTableSet(_xhu_csound_state.csound, table, i, data[i]);
+    if (captured_frames + frames == options->output_buffer_frames) {
+        __atomic_store_n(&engine->run_performance_thread, false, __ATOMIC_RELEASE);
     }
-    
-    _xhu_csound_state.pause_csound_thread = false;
 }
 
-const xhu_f32_t xhu_get_table_val(const xhu_s32_t tableNumber, const xhu_s32_t index)
+static xhu_s32_t xhu_perform(xhu_engine_t *engine)
 {
-    xhu_f32_t value = NAN;
+    xhu_perform_mode mode = __atomic_load_n(&engine->perform_mode, __ATOMIC_RELAXED);
+    bool capture = engine->options.output_mode == XHU_OUTPUT_MEMORY;
+    xhu_s32_t result = 0;
     
-    if (tableNumber <= 0) {
-        XHU_LOG_ERROR("Could not retrieve data. Invalid table number.")
+    if (mode == XHU_PERFORM_BUFFER) {
+        result = csoundPerformBuffer(engine->csound);
         
-        return value;
-    }
-    
-    if (index < 0) {
-        XHU_LOG_ERROR("Could not retrieve data. Index is negative.")
+        xhu_u32_t frames = (xhu_u32_t)(csoundGetOutputBufferSize(engine->csound) / engine->channel_count);
+        xhu_u32_t cycles = frames / csoundGetKsmps(engine->csound);
+        xhu_record_cycles(engine, cycles > 0 ? cycles : 1);
+        
+        if (capture && result == 0) {
+            xhu_capture_output(engine, csoundGetOutputBuffer(engine->csound), frames);
+        }
         
-        return value;
+        return result;
     }
     
-    _xhu_csound_state.pause_csound_thread = true;
-    
-    while (!_xhu_csound_state.csound_thread_paused);
+    xhu_u32_t blocks = __atomic_load_n(&engine->blocks_per_wakeup, __ATOMIC_RELAXED);
     
-    value = csoundTableGet(_xhu_csound_state.csound, tableNumber, index);
-    _xhu_csound_state.pause_csound_thread = false;
+    for (xhu_u32_t i = 0; i < blocks && result == 0; ++i) {
+        result = csoundPerformKsmps(engine->csound);
+        xhu_record_cycles(engine, 1);
+        
+        if (capture && result == 0) {
+            xhu_capture_output(engine, csoundGetSpout(engine->csound), csoundGetKsmps(engine->csound));
+        }
+    }
     
-    return value;
+    return result;
 }
 
-bool xhu_table_exists(xhu_s32_t tableNumber)
+static void xhu_update_render_stats(xhu_engine_t *engine)
 {
-    bool exists = false;
+    xhu_render_stats_t *stats = &engine->render_stats;
+    xhu_f64_t cpu_time_ms = (engine->cycle_clock_ns - engine->cpu_start_ns) / 1000000.0;
     
-    if (tableNumber == 0) {
+    __atomic_store_n(&stats->wakeup_count, stats->wakeup_count + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats->rendered_samples, csoundGetCurrentTimeSamples(engine->csound), __ATOMIC_RELAXED);
+    __atomic_store(&stats->cpu_time_ms, &cpu_time_ms, __ATOMIC_RELAXED);
+}
+
+// Touches the pages the deepest k-cycle is likely to need, so they are resident before audio starts
+static void xhu_prefault_stack(void)
+{
+    volatile char stack[XHU_STACK_PREFAULT_SIZE];
+    
+    for (xhu_u32_t i = 0; i < XHU_STACK_PREFAULT_SIZE; i += 4096) {
+        stack[i] = 0;
+    }
+    
+    (void)stack;
+}
+
+// Runs on the performance thread; every option that cannot be applied is logged and skipped
+static void xhu_apply_realtime_options(xhu_engine_t *engine)
+{
+    const xhu_engine_options_t *options = &engine->options;
+    xhu_u32_t status = 0;
+    
+    if (options->sched_policy != XHU_SCHED_DEFAULT) {
+        struct sched_param param;
+        xhu_s32_t policy = options->sched_policy == XHU_SCHED_FIFO ? SCHED_FIFO : SCHED_RR;
+        xhu_s32_t min_priority = sched_get_priority_min(policy);
+        xhu_s32_t max_priority = sched_get_priority_max(policy);
+        
+        param.sched_priority = options->sched_priority < min_priority ? min_priority :
+            options->sched_priority > max_priority ? max_priority : options->sched_priority;
+        
+        xhu_s32_t result = pthread_setschedparam(pthread_self(), policy, &param);
+        
+        if (result == 0) {
+            status |= XHU_REALTIME_PRIORITY;
+            XHU_LOG_DEBUG("Performance thread priority set to %d", param.sched_priority)
+        } else {
+            XHU_LOG_WARN("Could not set performance thread priority: %s", strerror(result))
+        }
+    }
+    
+    if (options->cpu_affinity >= 0) {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(options->cpu_affinity, &cpu_set);
+        xhu_s32_t result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        
+        if (result == 0) {
+            status |= XHU_REALTIME_AFFINITY;
+            XHU_LOG_DEBUG("Performance thread pinned to CPU %d", options->cpu_affinity)
+        } else {
+            XHU_LOG_WARN("Could not pin performance thread to CPU %d: %s", options->cpu_affinity, strerror(result))
+        }
+#elif defined(__APPLE__)
+        // macOS only supports affinity tags, which the scheduler treats as a hint
+        thread_affinity_policy_data_t policy = { options->cpu_affinity + 1 };
+        kern_return_t result = thread_policy_set(pthread_mach_thread_np(pthread_self()),
+                                                 THREAD_AFFINITY_POLICY,
+                                                 (thread_policy_t)&policy,
+                                                 THREAD_AFFINITY_POLICY_COUNT);
+        
+        if (result == KERN_SUCCESS) {
+            status |= XHU_REALTIME_AFFINITY;
+            XHU_LOG_DEBUG("Performance thread affinity tag set to %d", policy.affinity_tag)
+        } else {
+            XHU_LOG_WARN("Could not set performance thread affinity tag: %d", result)
+        }
+#else
+        XHU_LOG_WARN("CPU affinity is not supported on this platform")
+#endif
+    }
+    
+    if (options->lock_memory) {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+            status |= XHU_REALTIME_MEMORY_LOCKED;
+            XHU_LOG_DEBUG("Process memory locked")
+        } else {
+            XHU_LOG_WARN("Could not lock process memory: %s", strerror(errno))
+        }
+        
+        xhu_prefault_stack();
+        status |= XHU_REALTIME_STACK_PREFAULTED;
+    }
+    
+    __atomic_store_n(&engine->realtime_status, status, __ATOMIC_RELEASE);
+}
+
+// Wakes xhu_start once the first k-cycle is rendered, or the thread gave up before that
+static void xhu_signal_startup(xhu_engine_t *engine)
+{
+    if (engine->startup_complete) {
+        return;
+    }
+    
+    xhu_u64_t now = xhu_time_now_ns();
+    engine->startup_stats.first_cycle_ms = (xhu_f64_t)(now - engine->thread_start_ns) / XHU_NS_PER_MS;
+    engine->startup_stats.total_ms = (xhu_f64_t)(now - engine->startup_begin_ns) / XHU_NS_PER_MS;
+    __atomic_store_n(&engine->startup_complete, true, __ATOMIC_RELEASE);
+    csoundNotifyThreadLock(engine->startup_lock);
+}
+
+// Runs on whichever thread rendered last, once no further k-cycle will be performed
+static void xhu_finish_performance(xhu_engine_t *engine)
+{
+    __atomic_store_n(&engine->perf_thread_running, false, __ATOMIC_RELEASE);
+    // Complete anything submitted before the flag was cleared
+    xhu_drain_commands(engine);
+    xhu_signal_startup(engine);
+    __atomic_store_n(&engine->commands_closed, true, __ATOMIC_RELEASE);
+    csoundNotifyThreadLock(engine->completion_lock);
+}
+
+// Closes the devices and output file, the instance stays until xhu_destroy_engine so queries keep working
+static void xhu_close_engine(xhu_engine_t *engine)
+{
+    xhu_finish_performance(engine);
+    csoundCleanup(engine->csound);
+    XHU_LOG_DEBUG("Csound performance closed")
+}
+
+uintptr_t csound_thread(void* data)
+{
+    xhu_engine_t *engine = (xhu_engine_t *)data;
+    
+    if (engine->compile_result == CSOUND_SUCCESS) {
+        xhu_apply_realtime_options(engine);
+        
+        engine->cpu_start_ns = xhu_get_thread_cpu_time_ns();
+        engine->cycle_clock_ns = engine->cpu_start_ns;
+        
+        __atomic_store_n(&engine->perf_thread_running, true, __ATOMIC_RELEASE);
+        XHU_LOG_DEBUG("Csound performance thread created")
+        
+        while (true) {
+            // Yield for non-reentrant API functions
+            xhu_park_if_paused(engine);
+            
+            xhu_s32_t result = xhu_perform(engine);
+            xhu_update_render_stats(engine);
+            xhu_signal_startup(engine);
+            
+            if (result != 0 || !__atomic_load_n(&engine->run_performance_thread, __ATOMIC_ACQUIRE)) {
+                break;
+            }
+            
+            if (engine->render_sample_limit > 0 &&
+                csoundGetCurrentTimeSamples(engine->csound) >= engine->render_sample_limit) {
+                XHU_LOG_DEBUG("Offline render duration reached")
+                break;
+            }
+        }
+        
+        XHU_LOG_DEBUG("Csound performance loop stopped")
+        xhu_close_engine(engine);
+    }
+    
+    return 1;
+}
+
+void xhu_set_opcode_path(const char *path)
+{
+#ifdef MACOS_BUNDLE
+    sprintf(xhu_opcode_path, "%s%s", xhu_executable_path, "/../Frameworks");
+#else
+    sprintf(xhu_opcode_path, "%s%s", xhu_executable_path, "/lib");
+#endif
+    xhu_set_global_env("OPCODE6DIR64", xhu_opcode_path);
+}
+
+void xhu_set_audio_path(const char *path)
+{
+    const char *suffix = "/Resources/audio";
+#ifdef MACOS_BUNDLE
+    sprintf(xhu_audio_path, "%s%s%s", xhu_executable_path, "/..", suffix);
+#else
+    sprintf(xhu_audio_path, "%s%s", xhu_executable_path, suffix);
+#endif
+    xhu_set_global_env("SSDIR", xhu_audio_path);
+}
+
+void xhu_resolve_audio_path(const char *filename, char *path, xhu_u32_t size)
+{
+    // Relative names are looked up where GEN01 looks, in SSDIR
+    if (filename[0] == '/' || xhu_audio_path[0] == '\0') {
+        snprintf(path, size, "%s", filename);
+    } else {
+        snprintf(path, size, "%s/%s", xhu_audio_path, filename);
+    }
+}
+
+void xhu_set_csd_path(const char *path)
+{
+    const char *suffix = "/Resources/csound/xhu.csd";
+#ifdef MACOS_BUNDLE
+    sprintf(xhu_csd_path, "%s%s%s", xhu_executable_path, "/../", suffix);
+#else
+    sprintf(xhu_csd_path, "%s%s", xhu_executable_path, suffix);
+#endif
+}
+
+void xhu_get_default_engine_options(xhu_engine_options_t *options)
+{
+    options->bundle = false;
+    options->perform_mode = XHU_PERFORM_KSMPS;
+    options->blocks_per_wakeup = 1;
+    options->buffer_size = 0;
+    options->output_mode = XHU_OUTPUT_REALTIME;
+    options->output_path = NULL;
+    options->output_buffer = NULL;
+    options->output_buffer_frames = 0;
+    options->render_duration = 0.0f;
+    options->sched_policy = XHU_SCHED_DEFAULT;
+    options->sched_priority = 0;
+    options->cpu_affinity = -1;
+    options->lock_memory = false;
+    options->csd_path = NULL;
+    options->sample_accurate_events = true;
+    options->worker_count = 2;
+    options->first_dynamic_table = 100;
+    options->dynamic_table_count = XHU_MAX_VERSIONED_TABLES - 100;
+}
+
+// Releases what xhu_start allocated, the performance has ended or never started
+static void xhu_free_engine(xhu_engine_t *engine)
+{
+    // Jobs still queued run against a stopped engine and fail at once
+    xhu_destroy_worker_pool(engine->workers);
+    
+    if (engine->csound != NULL) {
+        csoundDestroy(engine->csound);
+        XHU_LOG_DEBUG("Csound instance destroyed")
+    }
+    
+    xhu_number_allocator_destroy(&engine->table_numbers);
+    xhu_destroy_channel_registry(engine->channels);
+    
+    xhu_ring_destroy(&engine->commands);
+    xhu_ring_destroy(&engine->scheduled_events);
+    xhu_event_heap_destroy(&engine->event_heap);
+    
+    if (engine->completion_lock != NULL) {
+        csoundDestroyThreadLock(engine->completion_lock);
+    }
+    
+    if (engine->park_lock != NULL) {
+        csoundDestroyThreadLock(engine->park_lock);
+    }
+    
+    if (engine->pause_ack_lock != NULL) {
+        csoundDestroyThreadLock(engine->pause_ack_lock);
+    }
+    
+    if (engine->startup_lock != NULL) {
+        csoundDestroyThreadLock(engine->startup_lock);
+    }
+    
+    if (engine->submit_mutex != NULL) {
+        csoundDestroyMutex(engine->submit_mutex);
+    }
+    
+    free(engine);
+}
+
+xhu_engine_t *xhu_start(const xhu_engine_options_t *options)
+{
+    xhu_engine_options_t default_options;
+    
+    if (options == NULL) {
+        xhu_get_default_engine_options(&default_options);
+        options = &default_options;
+    }
+    
+    srand((unsigned)time(NULL));
+    
+    if (options->output_mode == XHU_OUTPUT_FILE && options->output_path == NULL) {
+        XHU_LOG_FATAL("File output requires an output path")
+        return NULL;
+    }
+    
+    if (options->output_mode == XHU_OUTPUT_MEMORY &&
+        (options->output_buffer == NULL || options->output_buffer_frames == 0)) {
+        XHU_LOG_FATAL("Memory output requires an output buffer")
+        return NULL;
+    }
+    
+    xhu_engine_t *engine = (xhu_engine_t *)calloc(1, sizeof(xhu_engine_t));
+    
+    if (engine == NULL) {
+        XHU_LOG_FATAL("Engine allocation failed")
+        return NULL;
+    }
+    
+    engine->options = *options;
+    engine->startup_begin_ns = xhu_time_now_ns();
+    
+    xhu_startup_stats_t *startup = &engine->startup_stats;
+    xhu_u64_t step_ns = engine->startup_begin_ns;
+    xhu_u64_t now;
+    
+    // Set Csound environment variables, these are shared by every engine in the process
+    xhu_set_executable_path();
+    xhu_set_opcode_path(NULL);
+    xhu_set_csd_path(NULL);
+    xhu_set_audio_path(NULL);
+    
+    now = xhu_time_now_ns();
+    startup->env_setup_ms = (xhu_f64_t)(now - step_ns) / XHU_NS_PER_MS;
+    step_ns = now;
+    
+    // Create Csound instance
+    engine->csound = csoundCreate(engine);
+    
+    if (engine->csound == NULL) {
+        XHU_LOG_FATAL( "Csound instance creation failed")
+        xhu_free_engine(engine);
+        return NULL;
+    }
+    
+    now = xhu_time_now_ns();
+    startup->create_ms = (xhu_f64_t)(now - step_ns) / XHU_NS_PER_MS;
+    step_ns = now;
+    
+    engine->compile_result = CSOUND_ERROR;
+    
+    csoundSetMessageCallback(engine->csound, xhu_msg_callback);
+    
+    // Compile orchestra file, command line options override the .csd options
+    const char *csd_path = options->csd_path != NULL ? options->csd_path : xhu_csd_path;
+    xhu_s32_t cSoundArgsCount = 2;
+    char* cSoundArgs[XHU_MAX_CSOUND_ARGS];
+    cSoundArgs[0] = "csound";
+    char temp[strlen(csd_path) + 1];
+    strcpy(temp, csd_path);
+    cSoundArgs[1] = temp;
+    char buffer_size_arg[32];
+    char output_arg[PATH_MAX + 3];
+    
+    if (options->buffer_size > 0) {
+        sprintf(buffer_size_arg, "-b%u", options->buffer_size);
+        cSoundArgs[cSoundArgsCount++] = buffer_size_arg;
+    }
+    
+    if (options->sample_accurate_events) {
+        cSoundArgs[cSoundArgsCount++] = "--sample-accurate";
+    }
+    
+    // Offline modes replace the real-time device so the loop is never paced by audio hardware
+    if (options->output_mode == XHU_OUTPUT_FILE) {
+        snprintf(output_arg, sizeof(output_arg), "-o%s", options->output_path);
+        cSoundArgs[cSoundArgsCount++] = output_arg;
+        cSoundArgs[cSoundArgsCount++] = "-W";
+    } else if (options->output_mode == XHU_OUTPUT_MEMORY || options->output_mode == XHU_OUTPUT_HOST) {
+        csoundSetHostImplementedAudioIO(engine->csound, 1, 0);
+        cSoundArgs[cSoundArgsCount++] = "-odac";
+    }
+    
+    // csoundCompile split in two so orchestra compilation and module initialization are timed apart
+    engine->compile_result = csoundCompileArgs(engine->csound, cSoundArgsCount, cSoundArgs);
+    xhu_print_csound_return_code("csoundCompileArgs", engine->compile_result);
+    
+    now = xhu_time_now_ns();
+    startup->compile_ms = (xhu_f64_t)(now - step_ns) / XHU_NS_PER_MS;
+    step_ns = now;
+    
+    if (engine->compile_result == CSOUND_SUCCESS) {
+        engine->compile_result = csoundStart(engine->csound);
+        xhu_print_csound_return_code("csoundStart", engine->compile_result);
+        
+        now = xhu_time_now_ns();
+        startup->module_init_ms = (xhu_f64_t)(now - step_ns) / XHU_NS_PER_MS;
+        step_ns = now;
+    }
+    
+    // Nothing performs yet, so the built-in tables are copied in from this thread
+    if (engine->compile_result == CSOUND_SUCCESS && !xhu_register_wavetables(engine->csound)) {
+        engine->compile_result = CSOUND_ERROR;
+    }
+    
+    now = xhu_time_now_ns();
+    startup->wavetable_ms = (xhu_f64_t)(now - step_ns) / XHU_NS_PER_MS;
+    step_ns = now;
+    
+    if (engine->compile_result != CSOUND_SUCCESS) {
+        XHU_LOG_FATAL( "Csound .csd compilation failed")
+        xhu_free_engine(engine);
+        
+        return NULL;
+    }
+    
+    csoundRegisterSenseEventCallback(engine->csound, xhu_sense_event_callback, engine);
+    xhu_set_perform_mode(engine, options->perform_mode, options->blocks_per_wakeup);
+    engine->channel_count = csoundGetNchnls(engine->csound);
+    engine->control_period_ns = (xhu_u64_t)(1000000000.0 * csoundGetKsmps(engine->csound) /
+                                                      csoundGetSr(engine->csound));
+    xhu_clear_cycle_counters(&engine->cycle_counters);
+    xhu_audio_clock_init(&engine->audio_clock, csoundGetSr(engine->csound));
+    
+    if (options->output_mode != XHU_OUTPUT_REALTIME && options->render_duration > 0.0f) {
+        engine->render_sample_limit = (xhu_s64_t)(options->render_duration * csoundGetSr(engine->csound));
+    }
+    
+    if (!xhu_ring_init(&engine->commands, XHU_COMMAND_QUEUE_SIZE, sizeof(xhu_command_t)) ||
+        !xhu_ring_init(&engine->scheduled_events, XHU_EVENT_QUEUE_SIZE, sizeof(xhu_event_t)) ||
+        !xhu_event_heap_init(&engine->event_heap, XHU_EVENT_HEAP_SIZE)) {
+        XHU_LOG_FATAL("Command and event queue allocation failed")
+        xhu_free_engine(engine);
+        
+        return NULL;
+    }
+    
+    engine->completion_lock = csoundCreateThreadLock();
+    engine->park_lock = csoundCreateThreadLock();
+    engine->pause_ack_lock = csoundCreateThreadLock();
+    engine->startup_lock = csoundCreateThreadLock();
+    engine->submit_mutex = csoundCreateMutex(0);
+    engine->workers = xhu_create_worker_pool(options->worker_count > 0 ? options->worker_count : 1);
+    engine->channels = xhu_create_channel_registry();
+    
+    if (engine->submit_mutex == NULL || engine->workers == NULL || engine->channels == NULL ||
+        !xhu_number_allocator_init(&engine->table_numbers, options->first_dynamic_table, options->dynamic_table_count)) {
+        XHU_LOG_FATAL("Worker thread, channel registry and table number allocator creation failed")
+        xhu_free_engine(engine);
+        
+        return NULL;
+    }
+    
+    engine->pause_spin_limit = XHU_PAUSE_SPIN_MAX;
+    
+    // The host audio callback drives the engine through xhu_render, there is no thread to start
+    if (options->output_mode == XHU_OUTPUT_HOST) {
+        engine->spout_frame = csoundGetKsmps(engine->csound);
+        engine->output_scale = 1.0 / csoundGet0dBFS(engine->csound);
+        engine->cpu_start_ns = xhu_get_thread_cpu_time_ns();
+        engine->cycle_clock_ns = engine->cpu_start_ns;
+        engine->run_performance_thread = true;
+        engine->startup_complete = true;
+        startup->total_ms = (xhu_f64_t)(xhu_time_now_ns() - engine->startup_begin_ns) / XHU_NS_PER_MS;
+        __atomic_store_n(&engine->perf_thread_running, true, __ATOMIC_RELEASE);
+        XHU_LOG_DEBUG("Csound engine initialized for host rendering")
+        
+        return engine;
+    }
+    
+    // Start performance thread
+    engine->run_performance_thread = true;
+    engine->thread_start_ns = xhu_time_now_ns();
+    engine->thread = csoundCreateThread(csound_thread, (void *)engine);
+    
+    if (engine->thread == NULL) {
+        XHU_LOG_FATAL( "Csound performance thread creation failed")
+        xhu_free_engine(engine);
+        
+        return NULL;
+    }
+    
+    // Sleep until the first k-cycle is rendered, a short offline render may already have finished
+    while (!__atomic_load_n(&engine->startup_complete, __ATOMIC_ACQUIRE)) {
+        csoundWaitThreadLockNoTimeout(engine->startup_lock);
+    }
+    
+    // Everything is OK...
+    XHU_LOG_DEBUG("Csound engine started in %.3f ms (env %.3f, create %.3f, compile %.3f, modules %.3f, wavetables %.3f, first k-cycle %.3f)",
+                  startup->total_ms,
+                  startup->env_setup_ms,
+                  startup->create_ms,
+                  startup->compile_ms,
+                  startup->module_init_ms,
+                  startup->wavetable_ms,
+                  startup->first_cycle_ms)
+    
+    return engine;
+}
+
+void xhu_stop(xhu_engine_t *engine)
+{
+    __atomic_store_n(&engine->run_performance_thread, false, __ATOMIC_RELEASE);
+    
+    // A parked thread has to wake up to notice the stop request
+    if (__atomic_load_n(&engine->pause_csound_thread, __ATOMIC_ACQUIRE)) {
+        xhu_resume_performance(engine);
+    }
+}
+
+void xhu_wait_until_stopped(xhu_engine_t *engine)
+{
+    if (engine->thread == NULL) {
+        return;
+    }
+    
+    csoundJoinThread(engine->thread);
+    engine->thread = NULL;
+}
+
+void xhu_destroy_engine(xhu_engine_t *engine)
+{
+    if (engine == NULL) {
+        return;
+    }
+    
+    xhu_stop(engine);
+    xhu_wait_until_stopped(engine);
+    
+    // The performance thread closed its engine when it ended, a host rendered one is closed here
+    if (engine->options.output_mode == XHU_OUTPUT_HOST) {
+        xhu_close_engine(engine);
+    }
+    
+    xhu_free_engine(engine);
+}
+
+// Plain loop over restrict pointers, unrolled so the compiler emits packed double to float conversions
+static void xhu_convert_samples(xhu_f32_t *restrict output,
+                                const xhu_audio_data_t *restrict input,
+                                xhu_u32_t count,
+                                xhu_audio_data_t scale)
+{
+    xhu_u32_t i = 0;
+    
+    for (; i + 4 <= count; i += 4) {
+        output[i] = (xhu_f32_t)(input[i] * scale);
+        output[i + 1] = (xhu_f32_t)(input[i + 1] * scale);
+        output[i + 2] = (xhu_f32_t)(input[i + 2] * scale);
+        output[i + 3] = (xhu_f32_t)(input[i + 3] * scale);
+    }
+    
+    for (; i < count; ++i) {
+        output[i] = (xhu_f32_t)(input[i] * scale);
+    }
+}
+
+xhu_u32_t xhu_render(xhu_engine_t *engine, xhu_f32_t *output, xhu_u32_t frame_count)
+{
+    xhu_u32_t channels = engine->channel_count;
+    
+    if (engine->options.output_mode != XHU_OUTPUT_HOST ||
+        !__atomic_load_n(&engine->run_performance_thread, __ATOMIC_ACQUIRE)) {
+        memset(output, 0, (xhu_mem_size_t)frame_count * channels * sizeof(xhu_f32_t));
+        
+        return 0;
+    }
+    
+    // A paused host engine acknowledges at once and renders silence, the audio callback must not block
+    if (__atomic_load_n(&engine->pause_csound_thread, __ATOMIC_ACQUIRE)) {
+        if (!__atomic_load_n(&engine->csound_thread_paused, __ATOMIC_RELAXED)) {
+            __atomic_store_n(&engine->csound_thread_paused, true, __ATOMIC_RELEASE);
+            csoundNotifyThreadLock(engine->pause_ack_lock);
+        }
+        
+        memset(output, 0, (xhu_mem_size_t)frame_count * channels * sizeof(xhu_f32_t));
+        
+        return 0;
+    }
+    
+    // The callback thread may change between calls, so only CPU time spent in here is accumulated
+    xhu_u64_t now = xhu_get_thread_cpu_time_ns();
+    engine->cpu_start_ns += now - engine->cycle_clock_ns;
+    engine->cycle_clock_ns = now;
+    
+    xhu_u32_t ksmps = csoundGetKsmps(engine->csound);
+    const xhu_audio_data_t *spout = csoundGetSpout(engine->csound);
+    xhu_u32_t rendered = 0;
+    
+    while (rendered < frame_count) {
+        if (engine->spout_frame == ksmps) {
+            // A finished score or render limit ends the engine as the performance thread would
+            if ((engine->render_sample_limit > 0 &&
+                 csoundGetCurrentTimeSamples(engine->csound) >= engine->render_sample_limit) ||
+                csoundPerformKsmps(engine->csound) != 0) {
+                XHU_LOG_DEBUG("Host rendered performance finished")
+                __atomic_store_n(&engine->run_performance_thread, false, __ATOMIC_RELEASE);
+                xhu_finish_performance(engine);
+                break;
+            }
+            
+            xhu_record_cycles(engine, 1);
+            engine->spout_frame = 0;
+        }
+        
+        xhu_u32_t frames = ksmps - engine->spout_frame;
+        
+        if (frames > frame_count - rendered) {
+            frames = frame_count - rendered;
+        }
+        
+        xhu_convert_samples(output + (xhu_mem_size_t)rendered * channels,
+                            spout + (xhu_mem_size_t)engine->spout_frame * channels,
+                            frames * channels,
+                            engine->output_scale);
+        engine->spout_frame += frames;
+        rendered += frames;
+    }
+    
+    if (rendered < frame_count) {
+        memset(output + (xhu_mem_size_t)rendered * channels,
+               0,
+               (xhu_mem_size_t)(frame_count - rendered) * channels * sizeof(xhu_f32_t));
+    }
+    
+    xhu_update_render_stats(engine);
+    
+    return rendered;
+}
+
+xhu_u32_t xhu_get_realtime_status(xhu_engine_t *engine)
+{
+    return __atomic_load_n(&engine->realtime_status, __ATOMIC_ACQUIRE);
+}
+
+xhu_u64_t xhu_get_captured_frames(xhu_engine_t *engine)
+{
+    return __atomic_load_n(&engine->captured_frames, __ATOMIC_ACQUIRE);
+}
+
+bool xhu_pause_performance(xhu_engine_t *engine)
+{
+    if (!xhu_perf_thread_running(engine)) {
+        XHU_LOG_ERROR("Could not pause. Performance thread is not running.")
+        
+        return false;
+    }
+    
+    if (__atomic_load_n(&engine->pause_csound_thread, __ATOMIC_ACQUIRE)) {
+        XHU_LOG_WARN("Performance thread is already paused.")
+        
+        return true;
+    }
+    
+    xhu_u64_t request_ns = xhu_time_now_ns();
+    __atomic_store_n(&engine->pause_csound_thread, true, __ATOMIC_RELEASE);
+    
+    // Spin briefly in case the thread is between k-cycles, then block
+    xhu_u32_t spins = 0;
+    
+    while (spins < engine->pause_spin_limit && !__atomic_load_n(&engine->csound_thread_paused, __ATOMIC_ACQUIRE)) {
+        xhu_cpu_relax();
+        ++spins;
+    }
+    
+    if (spins < engine->pause_spin_limit) {
+        engine->pause_spin_limit = spins * 2 + XHU_PAUSE_SPIN_MIN;
+        
+        if (engine->pause_spin_limit > XHU_PAUSE_SPIN_MAX) {
+            engine->pause_spin_limit = XHU_PAUSE_SPIN_MAX;
+        }
+    } else {
+        engine->pause_spin_limit = engine->pause_spin_limit / 2 > XHU_PAUSE_SPIN_MIN ?
+            engine->pause_spin_limit / 2 : XHU_PAUSE_SPIN_MIN;
+        ++engine->pause_stats.blocked_acknowledge_count;
+        
+        while (!__atomic_load_n(&engine->csound_thread_paused, __ATOMIC_ACQUIRE)) {
+            if (!xhu_perf_thread_running(engine)) {
+                __atomic_store_n(&engine->pause_csound_thread, false, __ATOMIC_RELEASE);
+                XHU_LOG_ERROR("Performance thread stopped before acknowledging the pause.")
+                
+                return false;
+            }
+            
+            csoundWaitThreadLock(engine->pause_ack_lock, XHU_FUTURE_WAIT_TIMEOUT_MS);
+        }
+    }
+    
+    engine->pause_start_ns = xhu_time_now_ns();
+    
+    xhu_f64_t acknowledge_time_ms = (xhu_f64_t)(engine->pause_start_ns - request_ns) / XHU_NS_PER_MS;
+    
+    if (acknowledge_time_ms > engine->pause_stats.longest_acknowledge_time_ms) {
+        engine->pause_stats.longest_acknowledge_time_ms = acknowledge_time_ms;
+    }
+    
+    XHU_LOG_DEBUG("Performance thread paused")
+    
+    return true;
+}
+
+void xhu_resume_performance(xhu_engine_t *engine)
+{
+    if (!__atomic_load_n(&engine->pause_csound_thread, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+    
+    // Waits for a thread applying commands in the meantime, see xhu_apply_commands_while_paused.
+    // The acknowledgement goes first so a new pause never sees the one of this pause.
+    csoundLockMutex(engine->submit_mutex);
+    __atomic_store_n(&engine->csound_thread_paused, false, __ATOMIC_RELEASE);
+    __atomic_store_n(&engine->pause_csound_thread, false, __ATOMIC_RELEASE);
+    csoundUnlockMutex(engine->submit_mutex);
+    csoundNotifyThreadLock(engine->park_lock);
+    
+    xhu_f64_t pause_time_ms = (xhu_f64_t)(xhu_time_now_ns() - engine->pause_start_ns) / XHU_NS_PER_MS;
+    
+    ++engine->pause_stats.pause_count;
+    engine->pause_stats.last_pause_time_ms = pause_time_ms;
+    engine->pause_stats.total_pause_time_ms += pause_time_ms;
+    
+    if (pause_time_ms > engine->pause_stats.longest_pause_time_ms) {
+        engine->pause_stats.longest_pause_time_ms = pause_time_ms;
+    }
+    
+    XHU_LOG_DEBUG("Performance thread resumed after %f ms", pause_time_ms)
+}
+
+const xhu_audio_clock_t *xhu_get_audio_clock(xhu_engine_t *engine)
+{
+    return &engine->audio_clock;
+}
+
+void xhu_get_startup_stats(xhu_engine_t *engine, xhu_startup_stats_t *stats)
+{
+    *stats = engine->startup_stats;
+}
+
+void xhu_get_pause_stats(xhu_engine_t *engine, xhu_pause_stats_t *stats)
+{
+    *stats = engine->pause_stats;
+}
+
+void xhu_set_perform_mode(xhu_engine_t *engine, xhu_perform_mode mode, xhu_u32_t blocks_per_wakeup)
+{
+    if (blocks_per_wakeup == 0) {
+        XHU_LOG_WARN("Blocks per wakeup must be at least 1.")
+        blocks_per_wakeup = 1;
+    }
+    
+    __atomic_store_n(&engine->perform_mode, mode, __ATOMIC_RELAXED);
+    __atomic_store_n(&engine->blocks_per_wakeup, blocks_per_wakeup, __ATOMIC_RELAXED);
+    
+    if (mode == XHU_PERFORM_BUFFER) {
+        XHU_LOG_DEBUG("Rendering one -b buffer per wakeup")
+    } else {
+        XHU_LOG_DEBUG("Rendering %u ksmps blocks per wakeup", blocks_per_wakeup)
+    }
+}
+
+static void xhu_load_render_stats(xhu_engine_t *engine, xhu_render_stats_t *stats)
+{
+    xhu_render_stats_t *current = &engine->render_stats;
+    stats->wakeup_count = __atomic_load_n(&current->wakeup_count, __ATOMIC_RELAXED);
+    stats->rendered_samples = __atomic_load_n(&current->rendered_samples, __ATOMIC_RELAXED);
+    __atomic_load(&current->cpu_time_ms, &stats->cpu_time_ms, __ATOMIC_RELAXED);
+}
+
+void xhu_get_render_stats(xhu_engine_t *engine, xhu_render_stats_t *stats)
+{
+    const xhu_render_stats_t *baseline = &engine->render_stats_baseline;
+    xhu_load_render_stats(engine, stats);
+    stats->wakeup_count -= baseline->wakeup_count;
+    stats->rendered_samples -= baseline->rendered_samples;
+    stats->cpu_time_ms -= baseline->cpu_time_ms;
+    stats->cpu_ms_per_rendered_second = 0.0;
+    
+    if (stats->rendered_samples > 0) {
+        xhu_f64_t rendered_seconds = (xhu_f64_t)stats->rendered_samples / csoundGetSr(engine->csound);
+        stats->cpu_ms_per_rendered_second = stats->cpu_time_ms / rendered_seconds;
+    }
+}
+
+void xhu_reset_render_stats(xhu_engine_t *engine)
+{
+    xhu_load_render_stats(engine, &engine->render_stats_baseline);
+}
+
+void xhu_get_cycle_stats(xhu_engine_t *engine, xhu_cycle_stats_t *stats)
+{
+    const xhu_cycle_counters_t *counters = &engine->cycle_counters;
+    xhu_u64_t total_ns = __atomic_load_n(&counters->total_ns, __ATOMIC_RELAXED);
+    
+    stats->cycle_count = __atomic_load_n(&counters->cycle_count, __ATOMIC_RELAXED);
+    stats->overrun_count = __atomic_load_n(&counters->overrun_count, __ATOMIC_RELAXED);
+    stats->last_overrun_sample = __atomic_load_n(&counters->last_overrun_sample, __ATOMIC_RELAXED);
+    stats->control_period_us = engine->control_period_ns / 1000.0;
+    stats->worst_cycle_us = __atomic_load_n(&counters->worst_ns, __ATOMIC_RELAXED) / 1000.0;
+    stats->mean_cycle_us = 0.0;
+    stats->duty_cycle = 0.0;
+    
+    for (xhu_u32_t i = 0; i < XHU_CYCLE_HISTOGRAM_BUCKETS; ++i) {
+        stats->histogram[i] = __atomic_load_n(&counters->histogram[i], __ATOMIC_RELAXED);
+    }
+    
+    if (stats->cycle_count > 0) {
+        stats->mean_cycle_us = total_ns / 1000.0 / stats->cycle_count;
+        stats->duty_cycle = (xhu_f64_t)total_ns / ((xhu_f64_t)engine->control_period_ns * stats->cycle_count);
+    }
+}
+
+void xhu_reset_cycle_stats(xhu_engine_t *engine)
+{
+    __atomic_store_n(&engine->cycle_stats_reset_requested, true, __ATOMIC_RELEASE);
+}
+
+void xhu_set_log_level(xhu_s32_t level)
+{
+    xhu_log_level = level;
+}
+
+xhu_audio_data_t *xhu_get_channel_pointer(xhu_engine_t *engine, const char *name, xhu_s32_t flags)
+{
+    xhu_audio_data_t *channel;
+    xhu_s32_t result = csoundGetChannelPtr(engine->csound, &channel, name, flags);
+    
+    if (result == CSOUND_SUCCESS) {
+        XHU_LOG_DEBUG("Got pointer to channel %s", name)
+        return channel;
+    }
+    
+    xhu_print_csound_return_code("csoundGetChannelPtr", result);
+    XHU_LOG_ERROR("Could not get pointer to channel %s", name)
+    return NULL;
+}
+
+xhu_audio_data_t xhu_get_control_channel_value(xhu_audio_data_t *channel)
+{
+    return *channel;
+}
+
+void xhu_set_control_channel_value(xhu_engine_t *engine, xhu_audio_data_t value, const char *name)
+{
+    // csoundGetChannelPtr is a locked string lookup, the registry asks it once per name
+    const xhu_channel_handle_t *handle = xhu_find_channel(engine, name);
+    
+    if (handle == NULL && strlen(name) < CHANNEL_NAME_MAX_LENGTH && !xhu_is_channel_registry_full(engine)) {
+        handle = xhu_register_channel(engine, name, CSOUND_INPUT_CHANNEL | CSOUND_CONTROL_CHANNEL);
+    }
+    
+    // Names past the registry capacity, such as per-instance ones in a long session, take the slow path
+    if (handle != NULL) {
+        set_channel_value(engine, handle, value);
+    } else {
+        csoundSetControlChannel(engine->csound, name, value);
+    }
+    
+    XHU_LOG_DEBUG("Value %f sent to channel %s", value, name)
+}
+
+void xhu_send_message(xhu_engine_t *engine, const char* message)
+{
+    XHU_LOG_DEBUG("Sending message to Csound:\n%s", message);
+    csoundInputMessage(engine->csound, message);
+}
+
+void xhu_send_score_event(xhu_engine_t *engine, const char type, xhu_audio_data_t* parameters, xhu_s32_t numParameters)
+{
+    xhu_s32_t result = csoundScoreEvent(engine->csound, type, parameters, numParameters);
+    
+    if(result == CSOUND_SUCCESS) {
+        XHU_LOG_DEBUG("Sent score event");
+    } else {
+        xhu_print_csound_return_code("csoundScoreEvent", result);
+    }
+}
+
+const xhu_s32_t xhu_get_sample_rate(xhu_engine_t *engine)
+{
+    return xhu_round_to_int(csoundGetSr(engine->csound));
+}
+
+const xhu_s32_t xhu_get_control_rate(xhu_engine_t *engine)
+{
+    return csoundGetKr(engine->csound);
+}
+
+const xhu_audio_data_t xhu_get_0dbfs(xhu_engine_t *engine)
+{
+    return csoundGet0dBFS(engine->csound);
+}
+
+static bool xhu_submit_stream_command(xhu_engine_t *engine, xhu_command_type type, xhu_stream_t *stream)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    xhu_command_t command = { type, 0, 0, NULL, NULL, 0, &future, NULL, NULL, NULL, 0, stream };
+    
+    if (!xhu_submit_command(engine, &command)) {
+        return false;
+    }
+    
+    xhu_wait_future(&future);
+    
+    return future.result == CSOUND_SUCCESS;
+}
+
+bool xhu_attach_stream(xhu_engine_t *engine, xhu_stream_t *stream)
+{
+    if (!xhu_submit_stream_command(engine, XHU_COMMAND_ATTACH_STREAM, stream)) {
+        XHU_LOG_ERROR("Could not attach stream %u. At most %d streams play at once.", xhu_get_stream_id(stream), XHU_MAX_STREAMS)
+        
+        return false;
+    }
+    
+    return true;
+}
+
+bool xhu_detach_stream(xhu_engine_t *engine, xhu_stream_t *stream)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    xhu_command_t command = { XHU_COMMAND_DETACH_STREAM, 0, 0, NULL, NULL, 0, &future, NULL, NULL, NULL, 0, stream };
+    
+    // An engine that stopped pumps no stream anymore, only a full queue leaves the stream attached
+    if (!xhu_submit_command(engine, &command)) {
+        return !xhu_perf_thread_running(engine);
+    }
+    
+    xhu_wait_future(&future);
+    
+    return xhu_future_is_done(&future) || !xhu_perf_thread_running(engine);
+}
+
+bool xhu_claim_stream_id(xhu_engine_t *engine, xhu_u32_t id)
+{
+    return id < XHU_MAX_STREAM_ID && !__atomic_exchange_n(&engine->stream_ids[id], true, __ATOMIC_ACQ_REL);
+}
+
+void xhu_release_stream_id(xhu_engine_t *engine, xhu_u32_t id)
+{
+    if (id < XHU_MAX_STREAM_ID) {
+        __atomic_store_n(&engine->stream_ids[id], false, __ATOMIC_RELEASE);
+    }
+}
+
+const xhu_s32_t xhu_get_control_size(xhu_engine_t *engine)
+{
+    return csoundGetKsmps(engine->csound);
+}
+
+const xhu_f32_t xhu_get_control_period(xhu_engine_t *engine)
+{
+    return 1.0f / xhu_get_sample_rate(engine) * xhu_get_control_size(engine); // ksmps duration
+}
+
+bool xhu_send_score_events_async(xhu_engine_t *engine,
+                                 const xhu_event_t *events,
+                                 xhu_u32_t event_count,
+                                 xhu_s32_t *results,
+                                 xhu_future_t *future)
+{
+    if (events == NULL || event_count == 0) {
+        XHU_LOG_ERROR("Could not send events. The batch is empty.")
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_SEND_EVENTS, 0, 0, NULL, NULL, event_count, future, events, results, NULL, 0 };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+xhu_s32_t xhu_send_score_events(xhu_engine_t *engine,
+                                const xhu_event_t *events,
+                                xhu_u32_t event_count,
+                                xhu_s32_t *results)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_send_score_events_async(engine, events, event_count, results, &future)) {
+        return -1;
+    }
+    
+    xhu_wait_future(&future);
+    
+    if (future.result != (xhu_s32_t)event_count) {
+        XHU_LOG_ERROR("%d of %u score events failed", (xhu_s32_t)event_count - future.result, event_count)
+    }
+    
+    return future.result;
+}
+
+xhu_table_handle_t xhu_allocate_table_number(xhu_engine_t *engine)
+{
+    xhu_table_handle_t handle = xhu_number_allocator_acquire(&engine->table_numbers);
+    
+    if (handle.number == 0) {
+        XHU_LOG_ERROR("Could not allocate a table number. All %u are in use.", engine->table_numbers.capacity)
+    }
+    
+    return handle;
+}
+
+bool xhu_release_table_number(xhu_engine_t *engine, xhu_table_handle_t handle)
+{
+    return xhu_number_allocator_release(&engine->table_numbers, handle);
+}
+
+bool xhu_is_table_handle_valid(xhu_engine_t *engine, xhu_table_handle_t handle)
+{
+    return xhu_number_allocator_is_valid(&engine->table_numbers, handle);
+}
+
+void xhu_free_table(xhu_engine_t *engine, xhu_table_handle_t handle)
+{
+    if (!xhu_is_table_handle_valid(engine, handle)) {
+        XHU_LOG_ERROR("Table handle %d.%u is stale.", handle.number, handle.generation)
+        
+        return;
+    }
+    
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (xhu_delete_table_async(engine, handle.number, &future)) {
+        xhu_wait_future(&future);
+    }
+    
+    xhu_release_table_number(engine, handle);
+}
+
+void xhu_get_table_number_stats(xhu_engine_t *engine, xhu_table_number_stats_t *stats)
+{
+    xhu_number_allocator_get_stats(&engine->table_numbers, stats);
+}
+
+// Numbers of the allocator are only written through handles, which is what catches collisions
+bool xhu_is_table_number_reserved(xhu_engine_t *engine, xhu_s32_t table)
+{
+    return xhu_number_allocator_is_reserved(&engine->table_numbers, table);
+}
+
+bool xhu_send_table_event_async(xhu_engine_t *engine,
+                                xhu_audio_data_t *pfields,
+                                xhu_u32_t pfield_count,
+                                xhu_future_t *future)
+{
+    if (pfield_count < 4 || pfields[0] <= 0) {
+        XHU_LOG_ERROR("Could not create table. Invalid f-statement.")
+        free(pfields);
+        
+        return false;
+    }
+    
+    xhu_s32_t table = (xhu_s32_t)pfields[0];
+    
+    if (xhu_is_table_number_reserved(engine, table)) {
+        XHU_LOG_ERROR("Could not create table %d. It belongs to the table number allocator and was not allocated.", table)
+        free(pfields);
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_CREATE_TABLE, table, 0, pfields, NULL, pfield_count, future, NULL, NULL, NULL, 0 };
+    
+    if (!xhu_submit_command(engine, &command)) {
+        free(pfields);
+        
+        return false;
+    }
+    
+    return true;
+}
+
+bool xhu_send_table_message_async(xhu_engine_t *engine,
+                                  xhu_s32_t table,
+                                  const char *message,
+                                  xhu_future_t *future)
+{
+    if (table <= 0) {
+        XHU_LOG_ERROR("Could not create table. Invalid table number.")
+        
+        return false;
+    }
+    
+    if (xhu_is_table_number_reserved(engine, table)) {
+        XHU_LOG_ERROR("Could not create table %d. It belongs to the table number allocator and was not allocated.", table)
+        
+        return false;
+    }
+    
+    char *message_copy = strdup(message);
+    
+    if (message_copy == NULL) {
+        XHU_LOG_ERROR("Could not create table %d. Out of memory.", table)
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_CREATE_TABLE, table, 0, NULL, NULL, 0, future, NULL, NULL, message_copy, 0 };
+    
+    if (!xhu_submit_command(engine, &command)) {
+        free(message_copy);
+        
+        return false;
+    }
+    
+    return true;
+}
+
+static bool xhu_push_scheduled_event(xhu_engine_t *engine,
+                                     xhu_s64_t sample,
+                                     xhu_u64_t time_ns,
+                                     const char type,
+                                     const xhu_audio_data_t *parameters,
+                                     xhu_u32_t parameter_count)
+{
+    if (parameter_count > XHU_MAX_EVENT_PFIELDS) {
+        XHU_LOG_ERROR("Could not schedule event. More than %d parameters.", XHU_MAX_EVENT_PFIELDS)
+        
+        return false;
+    }
+    
+    if (!xhu_perf_thread_running(engine)) {
+        XHU_LOG_ERROR("Could not schedule event. Performance thread is not running.")
+        
+        return false;
+    }
+    
+    xhu_event_t event;
+    event.sample = sample;
+    event.time_ns = time_ns;
+    event.type = type;
+    event.parameter_count = parameter_count;
+    memcpy(event.parameters, parameters, parameter_count * sizeof(xhu_audio_data_t));
+    
+    // The event ring has one producer like the command ring, and the sequence orders events of equal sample
+    csoundLockMutex(engine->submit_mutex);
+    event.sequence = engine->event_sequence++;
+    bool pushed = xhu_ring_push(&engine->scheduled_events, &event);
+    csoundUnlockMutex(engine->submit_mutex);
+    
+    if (!pushed) {
+        XHU_LOG_ERROR("Could not schedule event. Event queue is full.")
+        
+        return false;
+    }
+    
+    return true;
+}
+
+bool xhu_schedule_event(xhu_engine_t *engine,
+                        xhu_s64_t sample,
+                        const char type,
+                        const xhu_audio_data_t *parameters,
+                        xhu_u32_t parameter_count)
+{
+    return xhu_push_scheduled_event(engine, sample, 0, type, parameters, parameter_count);
+}
+
+bool xhu_schedule_event_at_time(xhu_engine_t *engine,
+                                xhu_u64_t time_ns,
+                                const char type,
+                                const xhu_audio_data_t *parameters,
+                                xhu_u32_t parameter_count)
+{
+    xhu_s64_t sample = xhu_audio_clock_sample_at(&engine->audio_clock, time_ns);
+    
+    return xhu_push_scheduled_event(engine, sample, time_ns, type, parameters, parameter_count);
+}
+
+void xhu_get_event_stats(xhu_engine_t *engine, xhu_event_stats_t *stats)
+{
+    const xhu_event_counters_t *counters = &engine->event_counters;
+    
+    stats->dispatched_count = __atomic_load_n(&counters->dispatched_count, __ATOMIC_RELAXED);
+    stats->late_count = __atomic_load_n(&counters->late_count, __ATOMIC_RELAXED);
+    stats->dropped_count = __atomic_load_n(&counters->dropped_count, __ATOMIC_RELAXED);
+    stats->max_late_samples = __atomic_load_n(&counters->max_late_samples, __ATOMIC_RELAXED);
+    stats->mean_late_samples = 0.0;
+    
+    if (stats->late_count > 0) {
+        stats->mean_late_samples = (xhu_f64_t)__atomic_load_n(&counters->total_late_samples, __ATOMIC_RELAXED) /
+            stats->late_count;
+    }
+    
+    stats->timed_count = __atomic_load_n(&counters->timed_count, __ATOMIC_RELAXED);
+    stats->min_timing_error_us = 0.0;
+    stats->max_timing_error_us = 0.0;
+    stats->mean_timing_error_us = 0.0;
+    
+    if (stats->timed_count > 0) {
+        stats->min_timing_error_us = __atomic_load_n(&counters->min_timing_error_ns, __ATOMIC_RELAXED) / 1000.0;
+        stats->max_timing_error_us = __atomic_load_n(&counters->max_timing_error_ns, __ATOMIC_RELAXED) / 1000.0;
+        stats->mean_timing_error_us = (xhu_f64_t)__atomic_load_n(&counters->total_timing_error_ns, __ATOMIC_RELAXED) /
+            stats->timed_count / 1000.0;
+    }
+}
+
+void xhu_init_future(xhu_future_t *future, xhu_future_callback_t callback, void *user_data)
+{
+    future->done = 0;
+    future->result = -1;
+    future->value = NAN;
+    future->callback = callback;
+    future->user_data = user_data;
+    future->engine = NULL;
+    future->data = NULL;
+}
+
+bool xhu_get_table_pointer_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_future_t *future)
+{
+    if (table <= 0) {
+        XHU_LOG_ERROR("Could not get table pointer. Invalid table number.")
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_GET_TABLE_POINTER, table, 0, NULL, NULL, 0, future, NULL, NULL, NULL, 0 };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+xhu_audio_data_t *xhu_get_table_pointer(xhu_engine_t *engine, const xhu_s32_t table, xhu_s32_t *length)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_get_table_pointer_async(engine, table, &future)) {
+        return NULL;
+    }
+    
+    xhu_wait_future(&future);
+    
+    if (length != NULL) {
+        *length = future.result;
+    }
+    
+    return future.result > 0 ? future.data : NULL;
+}
+
+bool xhu_set_channel_async(xhu_engine_t *engine,
+                           xhu_audio_data_t *channel,
+                           xhu_audio_data_t value,
+                           xhu_future_t *future)
+{
+    if (channel == NULL) {
+        XHU_LOG_ERROR("Could not set channel. Channel pointer is NULL.")
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_SET_CHANNEL, 0, 0, channel, NULL, 0, future, NULL, NULL, NULL, value };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+void xhu_resolve_future(xhu_future_t *future)
+{
+    xhu_complete_future(future);
+    
+    if (future->engine != NULL) {
+        csoundNotifyThreadLock(future->engine->completion_lock);
+    }
+}
+
+xhu_worker_pool_t *xhu_get_worker_pool(xhu_engine_t *engine)
+{
+    return engine->workers;
+}
+
+xhu_channel_registry_t *xhu_get_channel_registry(xhu_engine_t *engine)
+{
+    return engine->channels;
+}
+
+bool xhu_future_is_done(const xhu_future_t *future)
+{
+    return __atomic_load_n(&future->done, __ATOMIC_ACQUIRE) != 0;
+}
+
+void xhu_wait_future(xhu_future_t *future)
+{
+    xhu_engine_t *engine = future->engine;
+    
+    while (!xhu_future_is_done(future)) {
+        if (__atomic_load_n(&engine->commands_closed, __ATOMIC_ACQUIRE) && !xhu_future_is_done(future)) {
+            XHU_LOG_ERROR("Performance thread stopped before the command completed.")
+            
+            return;
+        }
+        
+        if (xhu_apply_commands_while_paused(engine, future) && xhu_future_is_done(future)) {
+            return;
+        }
+        
+        csoundWaitThreadLock(engine->completion_lock, XHU_FUTURE_WAIT_TIMEOUT_MS);
+    }
+}
+
+bool xhu_get_table_data_async(xhu_engine_t *engine,
+                              const xhu_s32_t table_id,
+                              xhu_audio_data_t *data,
+                              xhu_u32_t capacity,
+                              xhu_future_t *future)
+{
+    if (table_id == 0)
+    {
+        XHU_LOG_ERROR("Table ID is undefined.")
+        
+        return false;
+    }
+    
+    if (data == NULL)
+    {
+        XHU_LOG_ERROR("Data pointer is NULL.")
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_GET_TABLE_DATA, table_id, 0, data, NULL, capacity, future, NULL, NULL, NULL, 0 };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+const xhu_s32_t xhu_get_table_data(xhu_engine_t *engine, const xhu_s32_t table_id, xhu_audio_data_t *data, xhu_u32_t capacity)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_get_table_data_async(engine, table_id, data, capacity, &future)) {
+        return -1;
+    }
+    
+    xhu_wait_future(&future);
+    
+    xhu_s32_t length = future.result;
+    
+    if (length >= 0) {
+        XHU_LOG_DEBUG("Got data for table %d", table_id);
+    } else {
+        XHU_LOG_ERROR("Could not get data for table %d. Table does not exist.", table_id)
+    }
+    
+    return length;
+}
+
+bool xhu_set_table_range_async(xhu_engine_t *engine,
+                               const xhu_s32_t table,
+                               xhu_u32_t offset,
+                               const xhu_audio_data_t *const data,
+                               xhu_u32_t data_count,
+                               xhu_future_t *future)
+{
+    if (table == TABLE_UNDEFINED) {
+        XHU_LOG_DEBUG("Table is undefined.");
+        return false;
+    }
+    
+    if (offset > INT_MAX) {
+        XHU_LOG_ERROR("Could not set table data. Offset %u is out of range.", offset)
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_SET_TABLE_DATA, table, (xhu_s32_t)offset, NULL, data, data_count, future, NULL, NULL, NULL, 0 };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+bool xhu_set_table_range(xhu_engine_t *engine,
+                         const xhu_s32_t table,
+                         xhu_u32_t offset,
+                         const xhu_audio_data_t *const data,
+                         xhu_u32_t data_count)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_set_table_range_async(engine, table, offset, data, data_count, &future)) {
+        return false;
+    }
+    
+    xhu_wait_future(&future);
+    
+    if (future.result != CSOUND_SUCCESS) {
+        XHU_LOG_ERROR("Could not set data %u to %u of table %d. Table does not exist or is too short.",
+                      offset, offset + data_count, table)
+        
+        return false;
+    }
+    
+    return true;
+}
+
+bool xhu_set_table_data_async(xhu_engine_t *engine, const xhu_s32_t table, const xhu_audio_data_t *const data, xhu_u32_t data_count, xhu_future_t *future)
+{
+    return xhu_set_table_range_async(engine, table, 0, data, data_count, future);
+}
+
+void xhu_set_table_data(xhu_engine_t *engine, const xhu_s32_t table, const xhu_audio_data_t *const data, xhu_u32_t data_count)
+{
+    xhu_set_table_range(engine, table, 0, data, data_count);
+}
+
+bool xhu_get_table_val_async(xhu_engine_t *engine, const xhu_s32_t tableNumber, const xhu_s32_t index, xhu_future_t *future)
+{
+    if (tableNumber <= 0) {
+        XHU_LOG_ERROR("Could not retrieve data. Invalid table number.")
+        
+        return false;
+    }
+    
+    if (index < 0) {
+        XHU_LOG_ERROR("Could not retrieve data. Index is negative.")
+        
+        return false;
+    }
+    
+    xhu_command_t command = { XHU_COMMAND_GET_TABLE_VAL, tableNumber, index, NULL, NULL, 0, future, NULL, NULL, NULL, 0 };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+const xhu_f32_t xhu_get_table_val(xhu_engine_t *engine, const xhu_s32_t tableNumber, const xhu_s32_t index)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_get_table_val_async(engine, tableNumber, index, &future)) {
+        return future.value;
+    }
+    
+    xhu_wait_future(&future);
+    
+    if (future.result != CSOUND_SUCCESS) {
+        XHU_LOG_ERROR("Could not get value %d of table %d. Table does not exist or is too short.", index, tableNumber)
+    }
+    
+    return future.value;
+}
+
+bool xhu_table_exists_async(xhu_engine_t *engine, const xhu_s32_t tableNumber, xhu_future_t *future)
+{
+    if (tableNumber == 0) {
         XHU_LOG_ERROR("Could not retrieve data. Table is undefined.")
         
-        return exists;
+        return false;
     }
     
-    xhu_s32_t length = -1;
-    xhu_audio_data_t *tablePtr = NULL;
-    _xhu_csound_state.pause_csound_thread = true;
+    xhu_command_t command = { XHU_COMMAND_TABLE_EXISTS, tableNumber, 0, NULL, NULL, 0, future, NULL, NULL, NULL, 0 };
+    
+    return xhu_submit_command(engine, &command);
+}
+
+bool xhu_table_exists(xhu_engine_t *engine, xhu_s32_t tableNumber)
+{
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_table_exists_async(engine, tableNumber, &future)) {
+        return false;
+    }
     
-    while (!_xhu_csound_state.csound_thread_paused);
+    xhu_wait_future(&future);
     
-    length = csoundGetTable(_xhu_csound_state.csound, &tablePtr, tableNumber);
-    _xhu_csound_state.pause_csound_thread = false;
-    exists = length > 0 && tablePtr != NULL;
+    bool exists = xhu_future_is_done(&future) && future.value != 0;
     
     if (exists) {
         XHU_LOG_DEBUG("Table %d exists.", tableNumber)
@@ -433,7 +2313,25 @@ bool xhu_table_exists(xhu_s32_t tableNumber)
     return exists;
 }
 
-void xhu_delete_table(const xhu_s32_t table_id)
+bool xhu_delete_table_async(xhu_engine_t *engine, const xhu_s32_t table, xhu_future_t *future)
+{
+    // Goes through the pending table list so the delete waits for open views of the table
+    char message[50];
+    sprintf(message, "f -%d 0", table);
+    
+    char *message_copy = strdup(message);
+    xhu_command_t command = { XHU_COMMAND_DELETE_TABLE, table, 0, NULL, NULL, 0, future, NULL, NULL, message_copy, 0 };
+    
+    if (message_copy == NULL || !xhu_submit_command(engine, &command)) {
+        free(message_copy);
+        
+        return false;
+    }
+    
+    return true;
+}
+
+void xhu_delete_table(xhu_engine_t *engine, const xhu_s32_t table_id)
 {
     if (table_id == TABLE_UNDEFINED) {
         XHU_LOG_DEBUG("Table is undefined.")
@@ -441,15 +2339,70 @@ void xhu_delete_table(const xhu_s32_t table_id)
         return;
     }
     
-    if (xhu_table_exists(table_id)) {
-        char message[50];
-        sprintf(message, "f -%d 0", table_id);
-        xhu_send_message(message);
+    if (!xhu_table_exists(engine, table_id)) {
+        XHU_LOG_DEBUG("Table %d does not exist.", table_id)
         
+        return;
+    }
+    
+    xhu_future_t future;
+    xhu_init_future(&future, NULL, NULL);
+    
+    if (!xhu_delete_table_async(engine, table_id, &future)) {
+        return;
+    }
+    
+    xhu_wait_future(&future);
+    
+    if (future.result == CSOUND_SUCCESS) {
         XHU_LOG_DEBUG("Deleted table %d", table_id)
     } else {
-        XHU_LOG_DEBUG("Table %d does not exist.", table_id)
+        XHU_LOG_ERROR("Could not delete table %d", table_id)
+    }
+}
+
+bool xhu_begin_table_view(xhu_engine_t *engine, const xhu_s32_t table, xhu_table_view_t *view)
+{
+    xhu_table_slot_t *slot = xhu_get_table_slot(engine, table);
+    
+    if (slot == NULL) {
+        XHU_LOG_ERROR("Table %d is outside the range of table views.", table)
+        
+        return false;
     }
+    
+    // The first view of a table the orchestra created has to ask the performance thread for its memory
+    if (__atomic_load_n(&slot->data, __ATOMIC_ACQUIRE) == NULL && xhu_get_table_pointer(engine, table, NULL) == NULL) {
+        return false;
+    }
+    
+    // Registered as a reader before checking the version, so a pending delete or replace waits for this view
+    __atomic_add_fetch(&slot->readers, 1, __ATOMIC_SEQ_CST);
+    view->version = __atomic_load_n(&slot->version, __ATOMIC_SEQ_CST);
+    view->data = __atomic_load_n(&slot->data, __ATOMIC_RELAXED);
+    view->length = __atomic_load_n(&slot->length, __ATOMIC_RELAXED);
+    view->table = table;
+    
+    if ((view->version & 1) != 0 || view->data == NULL) {
+        __atomic_sub_fetch(&slot->readers, 1, __ATOMIC_RELEASE);
+        
+        return false;
+    }
+    
+    return true;
+}
+
+bool xhu_end_table_view(xhu_engine_t *engine, xhu_table_view_t *view)
+{
+    xhu_table_slot_t *slot = xhu_get_table_slot(engine, view->table);
+    
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    
+    bool consistent = __atomic_load_n(&slot->version, __ATOMIC_RELAXED) == view->version;
+    __atomic_sub_fetch(&slot->readers, 1, __ATOMIC_RELEASE);
+    view->data = NULL;
+    
+    return consistent;
 }
 
 bool xhu_set_global_env(const char *name, const char *value)
@@ -470,7 +2423,7 @@ bool xhu_set_global_env(const char *name, const char *value)
     return success;
 }
 
-void xhu_set_output_channel_callback(channelCallback_t callback)
+void xhu_set_output_channel_callback(xhu_engine_t *engine, channelCallback_t callback)
 {
-    csoundSetOutputChannelCallback(_xhu_csound_state.csound, callback);
+    csoundSetOutputChannelCallback(engine->csound, callback);
 }
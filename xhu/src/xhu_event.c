@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdlib.h>
+#include "xhu_event.h"
+
+static inline bool xhu_event_before(const xhu_event_t *a, const xhu_event_t *b)
+{
+    return a->sample < b->sample || (a->sample == b->sample && a->sequence < b->sequence);
+}
+
+static inline void xhu_event_swap(xhu_event_t *a, xhu_event_t *b)
+{
+    xhu_event_t temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+bool xhu_event_heap_init(xhu_event_heap_t *heap, xhu_u32_t capacity)
+{
+    heap->events = (xhu_event_t *)malloc((xhu_mem_size_t)capacity * sizeof(xhu_event_t));
+    heap->capacity = heap->events != NULL ? capacity : 0;
+    heap->count = 0;
+    
+    return heap->events != NULL;
+}
+
+void xhu_event_heap_destroy(xhu_event_heap_t *heap)
+{
+    free(heap->events);
+    heap->events = NULL;
+    heap->capacity = 0;
+    heap->count = 0;
+}
+
+bool xhu_event_heap_push(xhu_event_heap_t *heap, const xhu_event_t *event)
+{
+    if (heap->count == heap->capacity) {
+        return false;
+    }
+    
+    xhu_u32_t index = heap->count++;
+    heap->events[index] = *event;
+    
+    while (index > 0) {
+        xhu_u32_t parent = (index - 1) / 2;
+        
+        if (!xhu_event_before(&heap->events[index], &heap->events[parent])) {
+            break;
+        }
+        
+        xhu_event_swap(&heap->events[index], &heap->events[parent]);
+        index = parent;
+    }
+    
+    return true;
+}
+
+const xhu_event_t *xhu_event_heap_peek(const xhu_event_heap_t *heap)
+{
+    return heap->count > 0 ? &heap->events[0] : NULL;
+}
+
+bool xhu_event_heap_pop(xhu_event_heap_t *heap, xhu_event_t *event)
+{
+    if (heap->count == 0) {
+        return false;
+    }
+    
+    *event = heap->events[0];
+    heap->events[0] = heap->events[--heap->count];
+    
+    xhu_u32_t index = 0;
+    
+    while (true) {
+        xhu_u32_t left = 2 * index + 1;
+        xhu_u32_t right = left + 1;
+        xhu_u32_t first = index;
+        
+        if (left < heap->count && xhu_event_before(&heap->events[left], &heap->events[first])) {
+            first = left;
+        }
+        
+        if (right < heap->count && xhu_event_before(&heap->events[right], &heap->events[first])) {
+            first = right;
+        }
+        
+        if (first == index) {
+            break;
+        }
+        
+        xhu_event_swap(&heap->events[index], &heap->events[first]);
+        index = first;
+    }
+    
+    return true;
+}
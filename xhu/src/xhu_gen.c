@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "xhu_gen.h"
+
+void xhu_gen_values(xhu_audio_data_t *restrict output, xhu_u32_t size, const xhu_f32_t *restrict values, xhu_u32_t count)
+{
+    xhu_u32_t copied = count < size ? count : size;
+    
+    for (xhu_u32_t i = 0; i < copied; ++i) {
+        output[i] = values[i];
+    }
+    
+    memset(output + copied, 0, (size - copied) * sizeof(xhu_audio_data_t));
+}
+
+void xhu_gen_segments(xhu_audio_data_t *restrict output, xhu_u32_t size, const xhu_segment_t *restrict segments, xhu_u32_t count)
+{
+    xhu_u32_t position = 0;
+    
+    for (xhu_u32_t s = 0; s + 1 < count && position < size; ++s) {
+        xhu_u32_t length = segments[s].length;
+        
+        if (length == 0) {
+            continue;
+        }
+        
+        const xhu_audio_data_t start = segments[s].value;
+        const xhu_audio_data_t slope = (segments[s + 1].value - start) / length;
+        xhu_audio_data_t *restrict line = output + position;
+        
+        if (length > size - position) {
+            length = size - position;
+        }
+        
+        for (xhu_u32_t i = 0; i < length; ++i) {
+            line[i] = start + slope * i;
+        }
+        
+        position += length;
+    }
+    
+    memset(output + position, 0, (size - position) * sizeof(xhu_audio_data_t));
+}
+
+bool xhu_gen_harmonics(xhu_audio_data_t *restrict output, xhu_u32_t size, const xhu_f32_t *restrict amplitudes, xhu_u32_t count)
+{
+    xhu_audio_data_t *restrict sine = (xhu_audio_data_t *)malloc(size * sizeof(xhu_audio_data_t));
+    
+    if (sine == NULL) {
+        return false;
+    }
+    
+    const xhu_audio_data_t step = 2.0 * M_PI / size;
+    
+    for (xhu_u32_t i = 0; i < size; ++i) {
+        sine[i] = sin(step * i);
+    }
+    
+    memset(output, 0, size * sizeof(xhu_audio_data_t));
+    
+    // Harmonic k of sample i is the sine at phase k * i modulo the period, a mask for powers of two
+    const bool power_of_two = (size & (size - 1)) == 0;
+    const xhu_u32_t mask = size - 1;
+    
+    for (xhu_u32_t k = 1; k <= count; ++k) {
+        const xhu_audio_data_t amplitude = amplitudes[k - 1];
+        
+        if (amplitude == 0) {
+            continue;
+        }
+        
+        if (power_of_two) {
+            // Products wrap around 2^32, which the mask does not see
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] += amplitude * sine[(i * k) & mask];
+            }
+        } else {
+            const xhu_u32_t increment = k % size;
+            xhu_u32_t phase = 0;
+            
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] += amplitude * sine[phase];
+                phase += increment;
+                phase -= phase >= size ? size : 0;
+            }
+        }
+    }
+    
+    free(sine);
+    
+    return true;
+}
+
+void xhu_gen_window(xhu_audio_data_t *restrict output, xhu_u32_t size, xhu_window_type window)
+{
+    const xhu_audio_data_t step = 2.0 * M_PI / size;
+    
+    switch (window) {
+        case XHU_WINDOW_HAMMING:
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] = 0.54 - 0.46 * cos(step * i);
+            }
+            break;
+        case XHU_WINDOW_HANN:
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] = 0.5 - 0.5 * cos(step * i);
+            }
+            break;
+        case XHU_WINDOW_BARTLETT:
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] = 1.0 - fabs(2.0 * i / size - 1.0);
+            }
+            break;
+        case XHU_WINDOW_BLACKMAN:
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] = 0.42 - 0.5 * cos(step * i) + 0.08 * cos(2.0 * step * i);
+            }
+            break;
+        case XHU_WINDOW_RECTANGLE:
+        default:
+            for (xhu_u32_t i = 0; i < size; ++i) {
+                output[i] = 1.0;
+            }
+            break;
+    }
+    
+    output[size] = output[0];
+}
+
+void xhu_gen_normalize(xhu_audio_data_t *restrict output, xhu_u32_t size)
+{
+    xhu_audio_data_t peak = 0;
+    
+    for (xhu_u32_t i = 0; i < size; ++i) {
+        const xhu_audio_data_t magnitude = fabs(output[i]);
+        peak = magnitude > peak ? magnitude : peak;
+    }
+    
+    if (peak == 0) {
+        return;
+    }
+    
+    const xhu_audio_data_t scale = 1.0 / peak;
+    
+    for (xhu_u32_t i = 0; i < size; ++i) {
+        output[i] *= scale;
+    }
+}
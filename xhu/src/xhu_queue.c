@@ -19,6 +19,8 @@
 
 #include "xhu_queue.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 /*
  initialize queue pointers
  */
@@ -71,3 +73,140 @@ void xhu_queue_display(int *q,int head,int tail)
         printf("%d ",q[i--]);
     printf("\n");
 }
+
+/*
+ allocate ring storage
+ precondition: capacity is a power of two
+ */
+bool xhu_ring_init(xhu_ring_t *ring, xhu_u32_t capacity, xhu_u32_t element_size)
+{
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        return false;
+    }
+    
+    ring->elements = (char *)malloc((xhu_mem_size_t)capacity * element_size);
+    ring->element_size = element_size;
+    ring->capacity = capacity;
+    ring->head = 0;
+    ring->tail = 0;
+    
+    return ring->elements != NULL;
+}
+
+/*
+ release ring storage
+ precondition: neither side is using the ring
+ */
+void xhu_ring_destroy(xhu_ring_t *ring)
+{
+    free(ring->elements);
+    ring->elements = NULL;
+    ring->capacity = 0;
+}
+
+/*
+ copy an element into the ring, producer side only
+ return false if the ring is full
+ */
+bool xhu_ring_push(xhu_ring_t *ring, const void *element)
+{
+    xhu_u32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    xhu_u32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    
+    if (tail - head == ring->capacity) {
+        return false;
+    }
+    
+    memcpy(ring->elements + (tail & (ring->capacity - 1)) * ring->element_size, element, ring->element_size);
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    
+    return true;
+}
+
+/*
+ copy the oldest element out of the ring, consumer side only
+ return false if the ring is empty
+ */
+bool xhu_ring_pop(xhu_ring_t *ring, void *element)
+{
+    xhu_u32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    xhu_u32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    
+    if (head == tail) {
+        return false;
+    }
+    
+    memcpy(element, ring->elements + (head & (ring->capacity - 1)) * ring->element_size, ring->element_size);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    
+    return true;
+}
+
+/*
+ copy up to count elements into the ring, producer side only
+ return the number of elements copied
+ */
+xhu_u32_t xhu_ring_write(xhu_ring_t *ring, const void *elements, xhu_u32_t count)
+{
+    xhu_u32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    xhu_u32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    xhu_u32_t free_count = ring->capacity - (tail - head);
+    
+    if (count > free_count) {
+        count = free_count;
+    }
+    
+    // At most two copies, the second one starting over at the beginning of the storage
+    xhu_u32_t index = tail & (ring->capacity - 1);
+    xhu_u32_t first = ring->capacity - index < count ? ring->capacity - index : count;
+    memcpy(ring->elements + index * ring->element_size, elements, first * ring->element_size);
+    memcpy(ring->elements, (const char *)elements + first * ring->element_size, (count - first) * ring->element_size);
+    __atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+    
+    return count;
+}
+
+/*
+ copy up to count of the oldest elements out of the ring, consumer side only
+ return the number of elements copied
+ */
+xhu_u32_t xhu_ring_read(xhu_ring_t *ring, void *elements, xhu_u32_t count)
+{
+    xhu_u32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    xhu_u32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    
+    if (count > tail - head) {
+        count = tail - head;
+    }
+    
+    xhu_u32_t index = head & (ring->capacity - 1);
+    xhu_u32_t first = ring->capacity - index < count ? ring->capacity - index : count;
+    memcpy(elements, ring->elements + index * ring->element_size, first * ring->element_size);
+    memcpy((char *)elements + first * ring->element_size, ring->elements, (count - first) * ring->element_size);
+    __atomic_store_n(&ring->head, head + count, __ATOMIC_RELEASE);
+    
+    return count;
+}
+
+/*
+ element at the head without consuming it, consumer side only
+ */
+const void *xhu_ring_peek(xhu_ring_t *ring)
+{
+    xhu_u32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    xhu_u32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    
+    if (head == tail) {
+        return NULL;
+    }
+    
+    return ring->elements + (head & (ring->capacity - 1)) * ring->element_size;
+}
+
+/*
+ return the number of queued elements, exact only on the consumer side
+ */
+xhu_u32_t xhu_ring_count(xhu_ring_t *ring)
+{
+    return __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+}
@@ -10,8 +10,11 @@
 #include "xhu_debug.h"
 #include "xhu_sound.h"
 #include "xhu_channel.h"
+#include "xhu_csound_wrapper.h"
 
 #define INVALID_SOUND_HANDLE (INT_MAX)
+#define XHU_SAMPLE_TABLE_INSTRUMENT (3)
+#define XHU_SAMPLE_STREAM_INSTRUMENT (4)
 
 typedef struct {
     xhu_sound_handle_t handle;
@@ -120,4 +123,46 @@ void xhu_stop_sound(xhu_sound_handle_t handle)
     stopped_handles[last_stopped] = handle;
 }
 
+// Each stream gets its own fractional instance, so it can be turned off on its own
+static xhu_audio_data_t xhu_get_source_instrument(const xhu_sound_source_t *source)
+{
+    if (source->type == XHU_SOURCE_STREAM)
+    {
+        return XHU_SAMPLE_STREAM_INSTRUMENT + (xhu_get_stream_id(source->stream) + 1) / 1000.0;
+    }
+    
+    return XHU_SAMPLE_TABLE_INSTRUMENT;
+}
 
+void xhu_play_source(xhu_engine_t *engine, const xhu_sound_source_t *source)
+{
+    xhu_audio_data_t parameters[4];
+    parameters[0] = xhu_get_source_instrument(source);
+    parameters[1] = 0;
+    
+    if (source->type == XHU_SOURCE_STREAM)
+    {
+        parameters[2] = -1;
+        parameters[3] = xhu_get_stream_id(source->stream);
+    }
+    else
+    {
+        // sample_table replaces the duration with the table length
+        parameters[2] = 1;
+        parameters[3] = source->table;
+    }
+    
+    xhu_send_score_event(engine, 'i', parameters, 4);
+}
+
+void xhu_stop_source(xhu_engine_t *engine, const xhu_sound_source_t *source)
+{
+    // Only held stream instances can be turned off, tables stop at their end
+    if (source->type != XHU_SOURCE_STREAM)
+    {
+        return;
+    }
+    
+    xhu_audio_data_t parameters[3] = { -xhu_get_source_instrument(source), 0, 0 };
+    xhu_send_score_event(engine, 'i', parameters, 3);
+}
@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sndfile.h>
+#include "xhu_debug.h"
+#include "xhu_queue.h"
+#include "xhu_csound_wrapper.h"
+#include "xhu_stream.h"
+
+#define XHU_STREAM_DEFAULT_FRAMES (65536)
+#define XHU_STREAM_REFILL_TIMEOUT_MS (20)
+
+// sf_readf_double decodes straight into xhu_audio_data_t buffers
+_Static_assert(sizeof(xhu_audio_data_t) == sizeof(double), "MYFLT must be double to decode with sf_readf_double");
+
+struct xhu_stream_s {
+    xhu_engine_t *engine;
+    SNDFILE *file;
+    xhu_u32_t file_channels;
+    xhu_u32_t channel_count;
+    xhu_u32_t id;
+    bool id_claimed;
+    bool loop;
+    xhu_ring_t ring;                // interleaved frames of channel_count samples
+    xhu_u32_t chunk_frames;
+    xhu_audio_data_t *file_buffer;  // read-ahead thread only
+    xhu_audio_data_t *chunk;        // read-ahead thread only
+    xhu_audio_data_t *block;        // performance thread only
+    xhu_u32_t ksmps;
+    xhu_audio_data_t *channels[XHU_STREAM_CHANNELS];
+    pthread_t thread;
+    void *refill_lock;
+    bool stopping;
+    bool end_of_file;
+    bool finished;
+    xhu_u64_t underrun_count;
+};
+
+// Reads one chunk from the file into the ring, rewinding looping streams at the end
+static bool xhu_read_stream_chunk(xhu_stream_t *stream)
+{
+    xhu_u32_t frame_count = 0;
+    bool end_of_file = false;
+    bool rewound = false;
+    
+    while (frame_count < stream->chunk_frames) {
+        sf_count_t read = sf_readf_double(stream->file, stream->file_buffer, stream->chunk_frames - frame_count);
+        
+        for (sf_count_t i = 0; i < read; ++i) {
+            for (xhu_u32_t channel = 0; channel < stream->channel_count; ++channel) {
+                stream->chunk[(frame_count + i) * stream->channel_count + channel] = stream->file_buffer[i * stream->file_channels + channel];
+            }
+        }
+        
+        frame_count += (xhu_u32_t)read;
+        
+        if (read > 0) {
+            rewound = false;
+            continue;
+        }
+        
+        // Nothing read straight after a rewind means the file is empty, anything else loops
+        if (!stream->loop || rewound || sf_seek(stream->file, 0, SF_SEEK_SET) < 0) {
+            end_of_file = true;
+            break;
+        }
+        
+        rewound = true;
+    }
+    
+    // The ring has room for the chunk, the read-ahead thread checked before reading
+    xhu_ring_write(&stream->ring, stream->chunk, frame_count * stream->channel_count);
+    
+    // Published after the last samples, so the performance thread never sees the end too early
+    if (end_of_file) {
+        __atomic_store_n(&stream->end_of_file, true, __ATOMIC_RELEASE);
+    }
+    
+    return frame_count > 0;
+}
+
+static void *xhu_stream_thread(void *data)
+{
+    xhu_stream_t *stream = (xhu_stream_t *)data;
+    xhu_u32_t chunk_samples = stream->chunk_frames * stream->channel_count;
+    
+    while (!__atomic_load_n(&stream->stopping, __ATOMIC_ACQUIRE)) {
+        xhu_u32_t free_samples = stream->ring.capacity - xhu_ring_count(&stream->ring);
+        
+        if (free_samples >= chunk_samples && !__atomic_load_n(&stream->end_of_file, __ATOMIC_ACQUIRE)) {
+            xhu_read_stream_chunk(stream);
+            continue;
+        }
+        
+        // The performance thread wakes this thread once the ring is half empty
+        csoundWaitThreadLock(stream->refill_lock, XHU_STREAM_REFILL_TIMEOUT_MS);
+    }
+    
+    return NULL;
+}
+
+static void xhu_free_stream(xhu_stream_t *stream)
+{
+    if (stream->id_claimed) {
+        xhu_release_stream_id(stream->engine, stream->id);
+    }
+    
+    if (stream->file != NULL) {
+        sf_close(stream->file);
+    }
+    
+    if (stream->refill_lock != NULL) {
+        csoundDestroyThreadLock(stream->refill_lock);
+    }
+    
+    xhu_ring_destroy(&stream->ring);
+    free(stream->file_buffer);
+    free(stream->chunk);
+    free(stream->block);
+    free(stream);
+}
+
+static xhu_u32_t xhu_next_power_of_two(xhu_u32_t value)
+{
+    xhu_u32_t power = 1;
+    
+    while (power < value) {
+        power <<= 1;
+    }
+    
+    return power;
+}
+
+xhu_stream_t *xhu_open_stream(xhu_engine_t *engine, const char *filename, xhu_u32_t id, xhu_u32_t buffer_frames, bool loop)
+{
+    xhu_stream_t *stream = (xhu_stream_t *)calloc(1, sizeof(xhu_stream_t));
+    SF_INFO info;
+    
+    if (stream == NULL) {
+        XHU_LOG_ERROR("Could not allocate stream %u.", id)
+        
+        return NULL;
+    }
+    
+    stream->engine = engine;
+    stream->id = id;
+    stream->id_claimed = xhu_claim_stream_id(engine, id);
+    
+    // The id names the channels and the instrument instance, two streams can not share it
+    if (!stream->id_claimed) {
+        XHU_LOG_ERROR("Could not open stream %u. The id is in use or not below %d.", id, XHU_MAX_STREAM_ID)
+        xhu_free_stream(stream);
+        
+        return NULL;
+    }
+    
+    char path[PATH_MAX];
+    xhu_resolve_audio_path(filename, path, sizeof(path));
+    memset(&info, 0, sizeof(info));
+    stream->file = sf_open(path, SFM_READ, &info);
+    
+    if (stream->file == NULL) {
+        XHU_LOG_ERROR("Could not open %s: %s", filename, sf_strerror(NULL))
+        xhu_free_stream(stream);
+        
+        return NULL;
+    }
+    
+    stream->loop = loop;
+    stream->file_channels = info.channels;
+    stream->channel_count = info.channels < XHU_STREAM_CHANNELS ? info.channels : XHU_STREAM_CHANNELS;
+    stream->ksmps = xhu_get_control_size(engine);
+    
+    // The ring is read and refilled in quarters, so one chunk decoded up front is enough to start
+    buffer_frames = xhu_next_power_of_two(buffer_frames > 0 ? buffer_frames : XHU_STREAM_DEFAULT_FRAMES);
+    stream->chunk_frames = buffer_frames / 4;
+    stream->file_buffer = (xhu_audio_data_t *)malloc(stream->chunk_frames * stream->file_channels * sizeof(xhu_audio_data_t));
+    stream->chunk = (xhu_audio_data_t *)malloc(stream->chunk_frames * stream->channel_count * sizeof(xhu_audio_data_t));
+    stream->block = (xhu_audio_data_t *)malloc(stream->ksmps * stream->channel_count * sizeof(xhu_audio_data_t));
+    stream->refill_lock = csoundCreateThreadLock();
+    
+    if (stream->chunk_frames < stream->ksmps ||
+        stream->file_buffer == NULL || stream->chunk == NULL || stream->block == NULL || stream->refill_lock == NULL ||
+        !xhu_ring_init(&stream->ring, buffer_frames * stream->channel_count, sizeof(xhu_audio_data_t))) {
+        XHU_LOG_ERROR("Could not allocate a buffer of %u frames for stream %u.", buffer_frames, id)
+        xhu_free_stream(stream);
+        
+        return NULL;
+    }
+    
+    for (xhu_u32_t channel = 0; channel < XHU_STREAM_CHANNELS; ++channel) {
+        char name[64];
+        snprintf(name, sizeof(name), "xhu.stream.%u.%u", id, channel);
+        stream->channels[channel] = xhu_get_channel_pointer(engine, name, CSOUND_INPUT_CHANNEL | CSOUND_AUDIO_CHANNEL);
+        
+        if (stream->channels[channel] == NULL) {
+            xhu_free_stream(stream);
+            
+            return NULL;
+        }
+    }
+    
+    if (!xhu_read_stream_chunk(stream)) {
+        XHU_LOG_ERROR("Could not read %s", filename)
+        xhu_free_stream(stream);
+        
+        return NULL;
+    }
+    
+    if (pthread_create(&stream->thread, NULL, xhu_stream_thread, stream) != 0) {
+        XHU_LOG_ERROR("Could not create read-ahead thread of stream %u.", id)
+        xhu_free_stream(stream);
+        
+        return NULL;
+    }
+    
+    if (!xhu_attach_stream(engine, stream)) {
+        __atomic_store_n(&stream->stopping, true, __ATOMIC_RELEASE);
+        pthread_join(stream->thread, NULL);
+        xhu_free_stream(stream);
+        
+        return NULL;
+    }
+    
+    XHU_LOG_DEBUG("Opened stream %u on %s", id, filename)
+    
+    return stream;
+}
+
+bool xhu_close_stream(xhu_engine_t *engine, xhu_stream_t *stream)
+{
+    if (stream == NULL) {
+        return true;
+    }
+    
+    // Once detached the performance thread no longer touches the stream
+    if (!xhu_detach_stream(engine, stream)) {
+        XHU_LOG_ERROR("Could not close stream %u. It is still attached to the engine.", stream->id)
+        
+        return false;
+    }
+    
+    __atomic_store_n(&stream->stopping, true, __ATOMIC_RELEASE);
+    csoundNotifyThreadLock(stream->refill_lock);
+    pthread_join(stream->thread, NULL);
+    XHU_LOG_DEBUG("Closed stream %u", stream->id)
+    xhu_free_stream(stream);
+    
+    return true;
+}
+
+xhu_u32_t xhu_get_stream_id(const xhu_stream_t *stream)
+{
+    return stream->id;
+}
+
+bool xhu_is_stream_finished(const xhu_stream_t *stream)
+{
+    return __atomic_load_n(&stream->finished, __ATOMIC_ACQUIRE);
+}
+
+xhu_u64_t xhu_get_stream_underruns(const xhu_stream_t *stream)
+{
+    return __atomic_load_n(&stream->underrun_count, __ATOMIC_RELAXED);
+}
+
+void xhu_pump_stream(xhu_stream_t *stream)
+{
+    xhu_u32_t channel_count = stream->channel_count;
+    xhu_u32_t wanted = stream->ksmps * channel_count;
+    xhu_u32_t half = stream->ring.capacity / 2;
+    bool above_half = xhu_ring_count(&stream->ring) > half;
+    xhu_u32_t count = xhu_ring_read(&stream->ring, stream->block, wanted);
+    
+    if (count < wanted) {
+        memset(stream->block + count, 0, (wanted - count) * sizeof(xhu_audio_data_t));
+        
+        // Running dry is only an underrun while there is file left to read
+        if (__atomic_load_n(&stream->end_of_file, __ATOMIC_ACQUIRE) && xhu_ring_count(&stream->ring) == 0) {
+            __atomic_store_n(&stream->finished, true, __ATOMIC_RELEASE);
+        } else {
+            __atomic_store_n(&stream->underrun_count, stream->underrun_count + 1, __ATOMIC_RELAXED);
+        }
+    }
+    
+    for (xhu_u32_t i = 0; i < stream->ksmps; ++i) {
+        stream->channels[0][i] = stream->block[i * channel_count];
+        stream->channels[1][i] = stream->block[i * channel_count + channel_count - 1];
+    }
+    
+    // One wake-up per half ring rather than one per k-cycle
+    if (above_half && xhu_ring_count(&stream->ring) <= half) {
+        csoundNotifyThreadLock(stream->refill_lock);
+    }
+}
@@ -18,106 +18,946 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <sndfile.h>
 #include "xhu_csound_wrapper.h"
 #include "xhu_debug.h"
 #include "xhu_table.h"
+#include "xhu_gen.h"
 
-void xhu_create_sample_table(xhu_sample_table_t* const table)
+#define XHU_TABLE_HEADER_PFIELDS (4)
+
+// sf_readf_double decodes straight into xhu_audio_data_t buffers
+_Static_assert(sizeof(xhu_audio_data_t) == sizeof(double), "MYFLT must be double to decode with sf_readf_double");
+
+struct xhu_table_load_s {
+    xhu_future_t future;
+    xhu_s32_t number;
+    xhu_table_handle_t handle;
+    xhu_table_callback_t callback;
+    void *user_data;
+    xhu_u32_t references;   /* the caller's, plus one while a worker job runs */
+};
+
+typedef struct {
+    xhu_engine_t *engine;
+    xhu_table_load_t *load;
+    xhu_sample_table_t table;
+    char *filename;
+    xhu_audio_data_t full_scale;    /* 0dbfs of the engine, applied when not normalizing */
+} xhu_decode_job_t;
+
+typedef struct {
+    xhu_engine_t *engine;
+    xhu_table_load_t *load;
+    const xhu_audio_data_t *samples;
+    xhu_u32_t count;
+} xhu_copy_job_t;
+
+// A private copy of the GEN arguments, the caller's arrays may be gone once the load started
+typedef struct {
+    xhu_engine_t *engine;
+    xhu_table_load_t *load;
+    xhu_s32_t gen_routine;
+    xhu_u32_t size;
+    xhu_f32_t *values;
+    xhu_segment_t *segments;
+    xhu_u32_t count;
+    xhu_window_type window;
+} xhu_gen_job_t;
+
+static void xhu_wait_for_table(xhu_future_t *future, xhu_u32_t number)
+{
+    xhu_wait_future(future);
+    
+    if (future->result > 0)
+    {
+        XHU_LOG_DEBUG("Created table %u", number)
+    }
+    else
+    {
+        XHU_LOG_ERROR("Could not create table %u", number)
+    }
+}
+
+static bool xhu_create_zero_table(xhu_engine_t *engine, xhu_s32_t number, xhu_u32_t size, xhu_future_t *future)
+{
+    const xhu_audio_data_t line[] = { number, 0, size, -7, 0, size, 0 };
+    xhu_audio_data_t *pfields = (xhu_audio_data_t *)malloc(sizeof(line));
+    
+    if (pfields == NULL)
+    {
+        return false;
+    }
+    
+    memcpy(pfields, line, sizeof(line));
+    xhu_init_future(future, NULL, NULL);
+    
+    return xhu_send_table_event_async(engine, pfields, sizeof(line) / sizeof(line[0]), future);
+}
+
+bool xhu_create_sample_table_async(xhu_engine_t *engine, const xhu_sample_table_t* const table, xhu_future_t *future)
 {
-    char message[128];
-    sprintf(
-            message,
-            "f %u 0 0 %u \"%s\" %f %u %u",
-            table->base.number,
-            table->base.gen_routine,
-            table->filename,
-            table->skip_time,
-            table->format,
-            table->channel
-            );
-    xhu_send_message(message);
+    // GEN01 takes its filename as a string p-field, which only the text form of an f-statement can carry
+    char message[PATH_MAX + 128];
+    snprintf(
+             message,
+             sizeof(message),
+             "f %u 0 0 %u \"%s\" %f %u %u",
+             table->base.number,
+             table->base.gen_routine,
+             table->filename,
+             table->skip_time,
+             table->format,
+             table->channel
+             );
     
-    while (!xhu_table_exists(table->base.number)); // TODO: replace with safer solution
+    return xhu_send_table_message_async(engine, table->base.number, message, future);
 }
 
-void xhu_create_immediate_table(xhu_immediate_table_t* const table)
+void xhu_create_sample_table(xhu_engine_t *engine, xhu_sample_table_t* const table)
+{
+    xhu_table_load_t *load = xhu_load_sample_table(engine, table, NULL, NULL);
+    
+    if (load != NULL)
+    {
+        if (xhu_wait_table_load(load) == XHU_TABLE_READY)
+        {
+            table->base.number = load->number;
+        }
+        
+        xhu_release_table_load(load);
+    }
+}
+
+bool xhu_create_immediate_table_async(xhu_engine_t *engine, const xhu_immediate_table_t* const table, xhu_future_t *future)
 {
     if (table->value_count > table->base.size)
     {
         XHU_LOG_ERROR("Value count can not exceed table size for immediate table.")
+        return false;
+    }
+    
+    // Values go to Csound as numeric p-fields, ownership of the buffer passes to the wrapper
+    xhu_u32_t pfield_count = XHU_TABLE_HEADER_PFIELDS + table->value_count;
+    xhu_audio_data_t *pfields = (xhu_audio_data_t *)malloc(pfield_count * sizeof(xhu_audio_data_t));
+    
+    if (pfields == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate p-fields for table %u.", table->base.number)
+        return false;
+    }
+    
+    pfields[0] = table->base.number;
+    pfields[1] = 0;
+    pfields[2] = table->base.size;
+    pfields[3] = table->base.gen_routine;
+    
+    for (xhu_u32_t i = 0; i < table->value_count; ++i)
+    {
+        pfields[XHU_TABLE_HEADER_PFIELDS + i] = table->values[i];
+    }
+    
+    return xhu_send_table_event_async(engine, pfields, pfield_count, future);
+}
+
+void xhu_create_immediate_table(xhu_engine_t *engine, xhu_immediate_table_t* const table)
+{
+    xhu_table_load_t *load = xhu_load_immediate_table(engine, table, NULL, NULL);
+    
+    if (load != NULL)
+    {
+        if (xhu_wait_table_load(load) == XHU_TABLE_READY)
+        {
+            table->base.number = load->number;
+        }
+        
+        xhu_release_table_load(load);
+    }
+}
+
+static xhu_table_state xhu_table_state_of(const xhu_future_t *future)
+{
+    return future->result > 0 ? XHU_TABLE_READY : XHU_TABLE_FAILED;
+}
+
+static void xhu_table_loaded(xhu_future_t *future, void *user_data)
+{
+    xhu_table_load_t *load = (xhu_table_load_t *)user_data;
+    
+    if (load->callback != NULL)
+    {
+        load->callback(load->number, xhu_table_state_of(future), load->user_data);
+    }
+}
+
+static xhu_table_load_t *xhu_new_table_load(xhu_engine_t *engine, xhu_s32_t number, xhu_table_callback_t callback, void *user_data)
+{
+    xhu_table_load_t *load = (xhu_table_load_t *)malloc(sizeof(xhu_table_load_t));
+    xhu_table_handle_t handle = { number, 0 };
+    
+    if (number == 0)
+    {
+        handle = xhu_allocate_table_number(engine);
+    }
+    
+    if (load == NULL || handle.number == 0)
+    {
+        XHU_LOG_ERROR("Could not allocate load of table %d.", number)
+        free(load);
+        
+        if (handle.number != 0)
+        {
+            xhu_release_table_number(engine, handle);
+        }
+        return NULL;
+    }
+    
+    load->number = handle.number;
+    load->handle = handle;
+    load->callback = callback;
+    load->user_data = user_data;
+    load->references = 1;
+    xhu_init_future(&load->future, xhu_table_loaded, load);
+    
+    // Waiting on the load needs the engine before a worker submits anything
+    load->future.engine = engine;
+    
+    return load;
+}
+
+// Frees a load that never started, with the number it allocated
+static void xhu_discard_table_load(xhu_engine_t *engine, xhu_table_load_t *load)
+{
+    if (load == NULL)
+    {
         return;
     }
     
-    xhu_u32_t values_string_size = 2 * table->value_count + 1;
-    char values_string[values_string_size];
-    
-    for (xhu_u32_t i = 0; i < table->value_count; i += 2)
-    {
-        values_string[i] = ' ';
-        values_string[i + 1] = table->values[i];
-    }
-    
-    values_string[values_string_size] = '\0';
-    
-    char message[values_string_size + 64];
-    
-    sprintf(
-            message,
-            "f %u 0 0 %u %s",
-            table->base.number,
-            table->base.gen_routine,
-            values_string
-            );
-    
-    xhu_send_message(message);
-    
-    while (!xhu_table_exists(table->base.number)); // TODO: replace with safer solution
-}
-
-void xhu_create_segment_table(xhu_segment_table_t* const table)
-{
-    //    xhu_u32_t segments_string_size = 4 * table->segment_count + 1;
-    //    char segments_string[segments_string_size];
-    //    xhu_f32_t total_length = 0;
-    //
-    //    for (xhu_u32_t i = 0; i < table->segment_count; ++i)
-    //    {
-    //        segments_string[i] = " ";
-    //        char value_string[1079];
-    //        segments_string[i] = "";
-    //        segments_string[i] = " ";
-    //        segments_string[i] = "";
-    //        total_length += table->segments[i].length;
-    //    }
-    //
-    //    if (total_length < table->base.size)
-    //    {
-    //        XHU_LOG_WARN("Segment length sum is less than table size. Padding table end with zeros.");
-    //    }
-    //
-    //    if (total_length > table->base.size)
-    //    {
-    //        XHU_LOG_WARN("Segment length sum is bigger than table size. Excess segments will not be included.");
-    //    }
-    //
-    //    for (xhu_u32_t i = 0; i < numSegments; i++)
-    //    {
-    //        message += " " + xhu_to_string<xhu_f32_t>(table->segments.at(i).value);
-    //        message += " " + xhu_to_string<xhu_f32_t>(table->segments.at(i).length);
-    //    }
-    //
-    //
-    ////    xhu_str_t message = "f " + xhu_to_string<xhu_s32_t>(table->number);
-    ////    message += " 0 " + xhu_to_string<xhu_s32_t>(table->size) + " -7";
-    ////
-    ////    for (xhu_s32_t i = 0; i < numSegments; i++)
-    ////    {
-    ////        message += " " + xhu_to_string<xhu_f32_t>(table->segments.at(i).value);
-    ////        message += " " + xhu_to_string<xhu_f32_t>(table->segments.at(i).length);
-    ////    }
-    //
-    //    xhu_send_message(message);
-    //
-    //    while (!xhu_table_exists(table->number));
+    if (load->handle.generation != 0)
+    {
+        xhu_release_table_number(engine, load->handle);
+    }
+    
+    free(load);
+}
+
+// Drops a reference, the last one frees the load and the number of a load that failed
+static void xhu_unref_table_load(xhu_table_load_t *load)
+{
+    if (__atomic_sub_fetch(&load->references, 1, __ATOMIC_ACQ_REL) > 0)
+    {
+        return;
+    }
+    
+    // A failed load leaves no table behind, so its allocated number is free again
+    if (load->handle.generation != 0 && xhu_table_state_of(&load->future) == XHU_TABLE_FAILED)
+    {
+        xhu_release_table_number(load->future.engine, load->handle);
+    }
+    
+    free(load);
+}
+
+// The job keeps the load alive until it finished, even when the caller released it after the engine stopped
+static bool xhu_submit_load_job(xhu_engine_t *engine, xhu_table_load_t *load, xhu_job_function_t function, void *job)
+{
+    load->references = 2;
+    
+    if (!xhu_submit_job(xhu_get_worker_pool(engine), function, job))
+    {
+        load->references = 1;
+        return false;
+    }
+    
+    return true;
+}
+
+// Decodes the channel GEN01 would read, interleaved for channel 0, on a worker thread
+static xhu_audio_data_t *xhu_decode_sample_file(const xhu_decode_job_t *job, xhu_u32_t *count)
+{
+    const xhu_sample_table_t *table = &job->table;
+    SF_INFO info;
+    memset(&info, 0, sizeof(info));
+    char path[PATH_MAX];
+    xhu_resolve_audio_path(job->filename, path, sizeof(path));
+    SNDFILE *file = sf_open(path, SFM_READ, &info);
+    
+    if (file == NULL)
+    {
+        XHU_LOG_ERROR("Could not open %s: %s", job->filename, sf_strerror(NULL))
+        return NULL;
+    }
+    
+    sf_count_t skip = (sf_count_t)(table->skip_time * info.samplerate);
+    sf_count_t frames = info.frames - skip;
+    
+    if (table->channel > (xhu_u32_t)info.channels || frames <= 0 || (skip > 0 && sf_seek(file, skip, SF_SEEK_SET) < 0))
+    {
+        XHU_LOG_ERROR("Could not read channel %u of %s from %f seconds.", table->channel, job->filename, table->skip_time)
+        sf_close(file);
+        return NULL;
+    }
+    
+    if ((xhu_u64_t)frames * (table->channel > 0 ? 1 : info.channels) > UINT32_MAX)
+    {
+        XHU_LOG_ERROR("Could not read %s. %lld frames do not fit in a table.", job->filename, (long long)frames)
+        sf_close(file);
+        return NULL;
+    }
+    
+    xhu_audio_data_t *samples = (xhu_audio_data_t *)malloc((xhu_mem_size_t)frames * info.channels * sizeof(xhu_audio_data_t));
+    
+    if (samples == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate %lld frames for %s.", (long long)frames, job->filename)
+        sf_close(file);
+        return NULL;
+    }
+    
+    frames = sf_readf_double(file, samples, frames);
+    sf_close(file);
+    
+    xhu_u64_t sample_count = (xhu_u64_t)frames * info.channels;
+    
+    if (table->channel > 0)
+    {
+        for (sf_count_t i = 0; i < frames; ++i)
+        {
+            samples[i] = samples[i * info.channels + table->channel - 1];
+        }
+        
+        sample_count = frames;
+    }
+    
+    if (table->base.size > 0 && sample_count > table->base.size)
+    {
+        sample_count = table->base.size;
+    }
+    
+    // A positive GEN number normalizes like GEN01 does
+    if ((xhu_s32_t)table->base.gen_routine > 0)
+    {
+        xhu_audio_data_t peak = 0;
+        
+        for (xhu_u64_t i = 0; i < sample_count; ++i)
+        {
+            peak = fmax(peak, fabs(samples[i]));
+        }
+        
+        for (xhu_u64_t i = 0; peak > 0 && i < sample_count; ++i)
+        {
+            samples[i] /= peak;
+        }
+    }
+    else if (job->full_scale != 1.0)
+    {
+        // libsndfile reads full scale as 1.0, GEN01 as 0dbfs
+        for (xhu_u64_t i = 0; i < sample_count; ++i)
+        {
+            samples[i] *= job->full_scale;
+        }
+    }
+    
+    *count = (xhu_u32_t)sample_count;
+    
+    return samples;
+}
+
+// Creates the table empty and fills it with one copy at a k-cycle boundary, then completes the load
+static void xhu_fill_table(xhu_engine_t *engine, xhu_table_load_t *load, xhu_u32_t size, const xhu_audio_data_t *samples, xhu_u32_t count)
+{
+    xhu_future_t future;
+    
+    if (samples != NULL && xhu_create_zero_table(engine, load->number, size, &future))
+    {
+        xhu_wait_future(&future);
+        xhu_s32_t created = future.result;
+        xhu_init_future(&future, NULL, NULL);
+        
+        if (created > 0 && xhu_set_table_range_async(engine, load->number, 0, samples, count, &future))
+        {
+            xhu_wait_future(&future);
+            
+            if (future.result == 0)
+            {
+                load->future.result = load->number;
+                load->future.value = size;
+            }
+        }
+    }
+    
+    xhu_resolve_future(&load->future);
+}
+
+static void xhu_run_decode_job(void *data)
+{
+    xhu_decode_job_t *job = (xhu_decode_job_t *)data;
+    xhu_u32_t count = 0;
+    xhu_audio_data_t *samples = xhu_decode_sample_file(job, &count);
+    
+    xhu_fill_table(job->engine, job->load, job->table.base.size > 0 ? job->table.base.size : count, samples, count);
+    xhu_unref_table_load(job->load);
+    free(samples);
+    free(job->filename);
+    free(job);
+}
+
+static void xhu_run_copy_job(void *data)
+{
+    xhu_copy_job_t *job = (xhu_copy_job_t *)data;
+    
+    xhu_fill_table(job->engine, job->load, job->count, job->samples, job->count);
+    xhu_unref_table_load(job->load);
+    free(job);
+}
+
+static void xhu_run_gen_job(void *data)
+{
+    xhu_gen_job_t *job = (xhu_gen_job_t *)data;
+    xhu_audio_data_t *samples = (xhu_audio_data_t *)malloc((job->size + 1) * sizeof(xhu_audio_data_t));
+    xhu_u32_t count = job->size;
+    
+    if (samples != NULL)
+    {
+        switch (abs(job->gen_routine))
+        {
+            case 2:
+                xhu_gen_values(samples, job->size, job->values, job->count);
+                break;
+            case 7:
+                xhu_gen_segments(samples, job->size, job->segments, job->count);
+                break;
+            case 10:
+                if (!xhu_gen_harmonics(samples, job->size, job->values, job->count))
+                {
+                    free(samples);
+                    samples = NULL;
+                }
+                break;
+            default:
+                // Windows come with their guard point, the other routines leave it 0
+                xhu_gen_window(samples, job->size, job->window);
+                count = job->size + 1;
+                break;
+        }
+    }
+    
+    if (samples != NULL && job->gen_routine > 0)
+    {
+        xhu_gen_normalize(samples, job->size);
+    }
+    
+    if (samples == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate %u samples for table %d.", job->size, job->load->number)
+    }
+    
+    xhu_fill_table(job->engine, job->load, job->size, samples, count);
+    xhu_unref_table_load(job->load);
+    free(samples);
+    free(job->values);
+    free(job->segments);
+    free(job);
+}
+
+// Takes over the arrays of the job, which are freed with it whatever the outcome
+static xhu_table_load_t *xhu_submit_gen_job(
+                                            xhu_engine_t *engine,
+                                            const xhu_base_table_t *base,
+                                            xhu_gen_job_t *job,
+                                            xhu_table_callback_t callback,
+                                            void *user_data
+                                            )
+{
+    xhu_table_load_t *load = NULL;
+    
+    if (base->size == 0)
+    {
+        XHU_LOG_ERROR("Table %u generated on the host needs a size.", base->number)
+    }
+    else if (job->count > 0 && job->values == NULL && job->segments == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate arguments of table %u.", base->number)
+    }
+    else
+    {
+        load = xhu_new_table_load(engine, base->number, callback, user_data);
+    }
+    
+    if (load == NULL)
+    {
+        free(job->values);
+        free(job->segments);
+        free(job);
+        return NULL;
+    }
+    
+    job->engine = engine;
+    job->load = load;
+    job->gen_routine = (xhu_s32_t)base->gen_routine;
+    job->size = base->size;
+    
+    if (!xhu_submit_load_job(engine, load, xhu_run_gen_job, job))
+    {
+        xhu_discard_table_load(engine, load);
+        free(job->values);
+        free(job->segments);
+        free(job);
+        return NULL;
+    }
+    
+    return load;
+}
+
+static xhu_gen_job_t *xhu_new_gen_job(void)
+{
+    return (xhu_gen_job_t *)calloc(1, sizeof(xhu_gen_job_t));
 }
 
+xhu_table_load_t *xhu_load_table_data(
+                                      xhu_engine_t *engine,
+                                      xhu_s32_t number,
+                                      const xhu_audio_data_t *samples,
+                                      xhu_u32_t count,
+                                      xhu_table_callback_t callback,
+                                      void *user_data
+                                      )
+{
+    xhu_table_load_t *load = xhu_new_table_load(engine, number, callback, user_data);
+    xhu_copy_job_t *job = (xhu_copy_job_t *)malloc(sizeof(xhu_copy_job_t));
+    
+    if (load == NULL || job == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate load of table %d.", number)
+        xhu_discard_table_load(engine, load);
+        free(job);
+        return NULL;
+    }
+    
+    job->engine = engine;
+    job->load = load;
+    job->samples = samples;
+    job->count = count;
+    
+    if (!xhu_submit_load_job(engine, load, xhu_run_copy_job, job))
+    {
+        xhu_discard_table_load(engine, load);
+        free(job);
+        return NULL;
+    }
+    
+    return load;
+}
+
+xhu_table_load_t *xhu_load_sample_table(
+                                        xhu_engine_t *engine,
+                                        const xhu_sample_table_t* const table,
+                                        xhu_table_callback_t callback,
+                                        void *user_data
+                                        )
+{
+    xhu_table_load_t *load = xhu_new_table_load(engine, table->base.number, callback, user_data);
+    xhu_decode_job_t *job = (xhu_decode_job_t *)malloc(sizeof(xhu_decode_job_t));
+    char *filename = strdup(table->filename);
+    
+    if (load == NULL || job == NULL || filename == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate load of %s.", table->filename)
+        xhu_discard_table_load(engine, load);
+        free(job);
+        free(filename);
+        return NULL;
+    }
+    
+    job->engine = engine;
+    job->load = load;
+    job->table = *table;
+    job->table.base.number = load->number;
+    job->filename = filename;
+    job->full_scale = xhu_get_0dbfs(engine);
+    
+    if (!xhu_submit_load_job(engine, load, xhu_run_decode_job, job))
+    {
+        xhu_discard_table_load(engine, load);
+        free(job);
+        free(filename);
+        return NULL;
+    }
+    
+    return load;
+}
+
+xhu_table_load_t *xhu_load_immediate_table(
+                                           xhu_engine_t *engine,
+                                           const xhu_immediate_table_t* const table,
+                                           xhu_table_callback_t callback,
+                                           void *user_data
+                                           )
+{
+    xhu_s32_t gen_routine = abs((xhu_s32_t)table->base.gen_routine);
+    
+    if (gen_routine == 2 || gen_routine == 10)
+    {
+        if (gen_routine == 2 && table->value_count > table->base.size)
+        {
+            XHU_LOG_ERROR("Value count can not exceed table size for immediate table.")
+            return NULL;
+        }
+        
+        xhu_gen_job_t *job = xhu_new_gen_job();
+        
+        if (job == NULL)
+        {
+            XHU_LOG_ERROR("Could not allocate load of table %u.", table->base.number)
+            return NULL;
+        }
+        
+        job->count = table->value_count;
+        job->values = (xhu_f32_t *)malloc(table->value_count * sizeof(xhu_f32_t));
+        
+        if (job->values != NULL)
+        {
+            memcpy(job->values, table->values, table->value_count * sizeof(xhu_f32_t));
+        }
+        
+        return xhu_submit_gen_job(engine, &table->base, job, callback, user_data);
+    }
+    
+    xhu_table_load_t *load = xhu_new_table_load(engine, table->base.number, callback, user_data);
+    
+    if (load == NULL)
+    {
+        return NULL;
+    }
+    
+    xhu_immediate_table_t numbered_table = *table;
+    numbered_table.base.number = load->number;
+    
+    if (!xhu_create_immediate_table_async(engine, &numbered_table, &load->future))
+    {
+        xhu_discard_table_load(engine, load);
+        return NULL;
+    }
+    
+    return load;
+}
+
+xhu_table_load_t *xhu_load_segment_table(
+                                         xhu_engine_t *engine,
+                                         const xhu_segment_table_t* const table,
+                                         xhu_table_callback_t callback,
+                                         void *user_data
+                                         )
+{
+    xhu_gen_job_t *job = xhu_new_gen_job();
+    
+    if (job == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate load of table %u.", table->base.number)
+        return NULL;
+    }
+    
+    xhu_u64_t total_length = 0;
+    
+    for (xhu_u32_t i = 0; i + 1 < table->segment_count; ++i)
+    {
+        total_length += table->segments[i].length;
+    }
+    
+    if (total_length < table->base.size)
+    {
+        XHU_LOG_WARN("Segment length sum is less than table size. Padding table end with zeros.")
+    }
+    
+    if (total_length > table->base.size)
+    {
+        XHU_LOG_WARN("Segment length sum is bigger than table size. Excess segments will not be included.")
+    }
+    
+    job->count = table->segment_count;
+    job->segments = (xhu_segment_t *)malloc(table->segment_count * sizeof(xhu_segment_t));
+    
+    if (job->segments != NULL)
+    {
+        memcpy(job->segments, table->segments, table->segment_count * sizeof(xhu_segment_t));
+    }
+    
+    // GEN07 is the routine the job runs, only the sign is the caller's
+    xhu_base_table_t base = table->base;
+    base.gen_routine = (xhu_s32_t)base.gen_routine < 0 ? -7 : 7;
+    
+    return xhu_submit_gen_job(engine, &base, job, callback, user_data);
+}
+
+xhu_table_load_t *xhu_load_window_table(
+                                        xhu_engine_t *engine,
+                                        const xhu_window_table_t* const table,
+                                        xhu_table_callback_t callback,
+                                        void *user_data
+                                        )
+{
+    xhu_gen_job_t *job = xhu_new_gen_job();
+    
+    if (job == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate load of table %u.", table->base.number)
+        return NULL;
+    }
+    
+    job->window = table->window;
+    
+    // Windows peak at 1 already
+    xhu_base_table_t base = table->base;
+    base.gen_routine = -20;
+    
+    return xhu_submit_gen_job(engine, &base, job, callback, user_data);
+}
+
+xhu_table_state xhu_get_table_load_state(const xhu_table_load_t *load)
+{
+    if (!xhu_future_is_done(&load->future))
+    {
+        return XHU_TABLE_LOADING;
+    }
+    
+    return xhu_table_state_of(&load->future);
+}
+
+xhu_u32_t xhu_get_table_load_length(const xhu_table_load_t *load)
+{
+    return xhu_get_table_load_state(load) == XHU_TABLE_READY ? (xhu_u32_t)load->future.value : 0;
+}
+
+xhu_s32_t xhu_get_table_load_number(const xhu_table_load_t *load)
+{
+    return load->number;
+}
+
+xhu_table_handle_t xhu_get_table_load_handle(const xhu_table_load_t *load)
+{
+    return load->handle;
+}
+
+xhu_table_state xhu_wait_table_load(xhu_table_load_t *load)
+{
+    xhu_wait_for_table(&load->future, load->number);
+    
+    return xhu_table_state_of(&load->future);
+}
+
+void xhu_release_table_load(xhu_table_load_t *load)
+{
+    if (load == NULL)
+    {
+        return;
+    }
+    
+    // The performance thread writes the future until it is done, a worker job holds its own reference
+    xhu_wait_future(&load->future);
+    xhu_unref_table_load(load);
+}
+
+// Deletes the tables of a shadow table, created[i] for each one Csound made, and releases allocated numbers
+static void xhu_discard_shadow_tables(xhu_engine_t *engine, xhu_shadow_table_t *shadow, const bool *created)
+{
+    for (xhu_u32_t i = 0; i < 2; ++i)
+    {
+        if (created[i])
+        {
+            xhu_delete_table(engine, shadow->numbers[i]);
+        }
+        
+        if (shadow->handles[i].generation != 0)
+        {
+            xhu_release_table_number(engine, shadow->handles[i]);
+        }
+    }
+    
+    free(shadow->swap);
+    shadow->swap = NULL;
+}
+
+bool xhu_create_shadow_table(
+                             xhu_engine_t *engine,
+                             xhu_shadow_table_t *shadow,
+                             xhu_s32_t front_number,
+                             xhu_s32_t back_number,
+                             xhu_u32_t size,
+                             const char *channel_name
+                             )
+{
+    xhu_future_t futures[2];
+    bool submitted[2] = { false, false };
+    bool created[2] = { false, false };
+    
+    const xhu_s32_t numbers[2] = { front_number, back_number };
+    
+    shadow->size = size;
+    shadow->front = 0;
+    shadow->swap = (xhu_future_t *)malloc(sizeof(xhu_future_t));
+    
+    if (shadow->swap == NULL)
+    {
+        XHU_LOG_ERROR("Could not allocate shadow table %d.", front_number)
+        return false;
+    }
+    
+    for (xhu_u32_t i = 0; i < 2; ++i)
+    {
+        xhu_table_handle_t handle = { numbers[i], 0 };
+        shadow->handles[i] = handle;
+    }
+    
+    for (xhu_u32_t i = 0; i < 2; ++i)
+    {
+        if (numbers[i] == 0)
+        {
+            shadow->handles[i] = xhu_allocate_table_number(engine);
+            
+            if (shadow->handles[i].number == 0)
+            {
+                XHU_LOG_ERROR("Could not allocate a number for shadow table %u.", i)
+                xhu_discard_shadow_tables(engine, shadow, created);
+                return false;
+            }
+        }
+        
+        shadow->numbers[i] = shadow->handles[i].number;
+    }
+    
+    for (xhu_u32_t i = 0; i < 2; ++i)
+    {
+        submitted[i] = xhu_create_zero_table(engine, shadow->numbers[i], size, &futures[i]);
+        
+        if (!submitted[i])
+        {
+            break;
+        }
+    }
+    
+    // The futures live on this stack, so every submitted one is waited for before any return
+    for (xhu_u32_t i = 0; i < 2; ++i)
+    {
+        if (submitted[i])
+        {
+            xhu_wait_future(&futures[i]);
+            created[i] = futures[i].result > 0;
+            shadow->data[i] = created[i] ? xhu_get_table_pointer(engine, shadow->numbers[i], NULL) : NULL;
+        }
+    }
+    
+    for (xhu_u32_t i = 0; i < 2; ++i)
+    {
+        if (!created[i] || shadow->data[i] == NULL)
+        {
+            XHU_LOG_ERROR("Could not create shadow table %d.", shadow->numbers[i])
+            xhu_discard_shadow_tables(engine, shadow, created);
+            return false;
+        }
+    }
+    
+    shadow->channel = xhu_get_channel_pointer(engine, channel_name, CSOUND_INPUT_CHANNEL | CSOUND_CONTROL_CHANNEL);
+    
+    if (shadow->channel == NULL)
+    {
+        xhu_discard_shadow_tables(engine, shadow, created);
+        return false;
+    }
+    
+    xhu_init_future(shadow->swap, NULL, NULL);
+    
+    if (!xhu_set_channel_async(engine, shadow->channel, shadow->numbers[0], shadow->swap))
+    {
+        xhu_discard_shadow_tables(engine, shadow, created);
+        return false;
+    }
+    
+    xhu_wait_future(shadow->swap);
+    XHU_LOG_DEBUG("Created shadow tables %d and %d on channel %s", shadow->numbers[0], shadow->numbers[1], channel_name)
+    
+    return true;
+}
+
+void xhu_destroy_shadow_table(xhu_engine_t *engine, xhu_shadow_table_t *shadow)
+{
+    const bool created[2] = { true, true };
+    
+    xhu_wait_future(shadow->swap);
+    xhu_init_future(shadow->swap, NULL, NULL);
+    
+    // The channel lets go of the front table at a k-cycle boundary before either table is deleted
+    if (xhu_set_channel_async(engine, shadow->channel, 0, shadow->swap))
+    {
+        xhu_wait_future(shadow->swap);
+    }
+    
+    xhu_discard_shadow_tables(engine, shadow, created);
+}
+
+xhu_audio_data_t *xhu_begin_shadow_table_write(xhu_shadow_table_t *shadow)
+{
+    // Until the swap lands Csound may still be reading what is about to become the back table
+    if (!xhu_future_is_done(shadow->swap))
+    {
+        return NULL;
+    }
+    
+    return shadow->data[1 - shadow->front];
+}
+
+bool xhu_commit_shadow_table(xhu_engine_t *engine, xhu_shadow_table_t *shadow)
+{
+    if (!xhu_future_is_done(shadow->swap))
+    {
+        XHU_LOG_WARN("Previous commit of shadow table %d is still pending.", shadow->numbers[0])
+        return false;
+    }
+    
+    xhu_u32_t back = 1 - shadow->front;
+    xhu_init_future(shadow->swap, NULL, NULL);
+    
+    // The command ring publishes the back table writes to the performance thread before the switch
+    if (!xhu_set_channel_async(engine, shadow->channel, shadow->numbers[back], shadow->swap))
+    {
+        xhu_resolve_future(shadow->swap);
+        return false;
+    }
+    
+    shadow->front = back;
+    
+    return true;
+}
+
+void xhu_create_segment_table(xhu_engine_t *engine, xhu_segment_table_t* const table)
+{
+    xhu_table_load_t *load = xhu_load_segment_table(engine, table, NULL, NULL);
+    
+    if (load != NULL)
+    {
+        if (xhu_wait_table_load(load) == XHU_TABLE_READY)
+        {
+            table->base.number = load->number;
+        }
+        
+        xhu_release_table_load(load);
+    }
+}
+
+void xhu_create_window_table(xhu_engine_t *engine, xhu_window_table_t* const table)
+{
+    xhu_table_load_t *load = xhu_load_window_table(engine, table, NULL, NULL);
+    
+    if (load != NULL)
+    {
+        if (xhu_wait_table_load(load) == XHU_TABLE_READY)
+        {
+            table->base.number = load->number;
+        }
+        
+        xhu_release_table_load(load);
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <time.h>
+#include <errno.h>
+#include <math.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#endif
+#include "xhu_time.h"
+
+xhu_u64_t xhu_time_now_ns(void)
+{
+#ifdef __APPLE__
+    static mach_timebase_info_data_t timebase;
+    
+    if (timebase.denom == 0) {
+        mach_timebase_info(&timebase);
+    }
+    
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+    struct timespec time_spec;
+    clock_gettime(CLOCK_MONOTONIC, &time_spec);
+    
+    return (xhu_u64_t)time_spec.tv_sec * XHU_NS_PER_SECOND + (xhu_u64_t)time_spec.tv_nsec;
+#endif
+}
+
+void xhu_sleep_ns(xhu_u64_t duration_ns)
+{
+    struct timespec remaining;
+    remaining.tv_sec = (time_t)(duration_ns / XHU_NS_PER_SECOND);
+    remaining.tv_nsec = (long)(duration_ns % XHU_NS_PER_SECOND);
+    
+    // Signals cut nanosleep short, keep sleeping for what is left
+    while (nanosleep(&remaining, &remaining) != 0 && errno == EINTR);
+}
+
+void xhu_sleep_ms(xhu_u64_t duration_ms)
+{
+    xhu_sleep_ns(duration_ms * XHU_NS_PER_MS);
+}
+
+void xhu_audio_clock_init(xhu_audio_clock_t *clock, xhu_f64_t sample_rate)
+{
+    clock->sequence = 0;
+    clock->anchor_ns = xhu_time_now_ns();
+    clock->anchor_sample = 0;
+    clock->sample_period_ns = XHU_NS_PER_SECOND / sample_rate;
+    clock->sample_rate = sample_rate;
+    clock->filter_time_ns = (xhu_f64_t)clock->anchor_ns;
+    clock->filter_period_ns = clock->sample_period_ns;
+    clock->filter_sample = 0;
+    clock->filter_locked = false;
+}
+
+// One step of the loop, the coefficients follow the interval since the last report
+static void xhu_audio_clock_filter(xhu_audio_clock_t *clock, xhu_u64_t time_ns, xhu_s64_t sample)
+{
+    xhu_s64_t elapsed_samples = sample - clock->filter_sample;
+    xhu_f64_t predicted_ns = clock->filter_time_ns + elapsed_samples * clock->filter_period_ns;
+    xhu_f64_t error_ns = (xhu_f64_t)time_ns - predicted_ns;
+    
+    if (!clock->filter_locked || elapsed_samples <= 0 ||
+        error_ns > XHU_AUDIO_CLOCK_RESET_NS || error_ns < -XHU_AUDIO_CLOCK_RESET_NS) {
+        clock->filter_time_ns = (xhu_f64_t)time_ns;
+        clock->filter_sample = sample;
+        clock->filter_period_ns = XHU_NS_PER_SECOND / clock->sample_rate;
+        clock->filter_locked = true;
+        
+        return;
+    }
+    
+    xhu_f64_t omega = 2.0 * M_PI * XHU_AUDIO_CLOCK_BANDWIDTH_HZ * elapsed_samples / clock->sample_rate;
+    
+    clock->filter_time_ns = predicted_ns + M_SQRT2 * omega * error_ns;
+    clock->filter_sample = sample;
+    clock->filter_period_ns += omega * omega * error_ns / elapsed_samples;
+}
+
+void xhu_audio_clock_publish(xhu_audio_clock_t *clock, xhu_u64_t time_ns, xhu_s64_t sample)
+{
+    xhu_audio_clock_filter(clock, time_ns, sample);
+    
+    xhu_u32_t sequence = clock->sequence;
+    xhu_u64_t anchor_ns = (xhu_u64_t)clock->filter_time_ns;
+    
+    __atomic_store_n(&clock->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&clock->anchor_ns, anchor_ns, __ATOMIC_RELAXED);
+    __atomic_store_n(&clock->anchor_sample, sample, __ATOMIC_RELAXED);
+    __atomic_store(&clock->sample_period_ns, &clock->filter_period_ns, __ATOMIC_RELAXED);
+    __atomic_store_n(&clock->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+static void xhu_audio_clock_read_period(const xhu_audio_clock_t *clock, xhu_u64_t *time_ns, xhu_s64_t *sample, xhu_f64_t *period_ns)
+{
+    xhu_u32_t sequence;
+    
+    do {
+        sequence = __atomic_load_n(&clock->sequence, __ATOMIC_ACQUIRE);
+        *time_ns = __atomic_load_n(&clock->anchor_ns, __ATOMIC_RELAXED);
+        *sample = __atomic_load_n(&clock->anchor_sample, __ATOMIC_RELAXED);
+        __atomic_load(&clock->sample_period_ns, period_ns, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((sequence & 1) != 0 || sequence != __atomic_load_n(&clock->sequence, __ATOMIC_RELAXED));
+}
+
+void xhu_audio_clock_read(const xhu_audio_clock_t *clock, xhu_u64_t *time_ns, xhu_s64_t *sample)
+{
+    xhu_f64_t period_ns;
+    xhu_audio_clock_read_period(clock, time_ns, sample, &period_ns);
+}
+
+xhu_s64_t xhu_audio_clock_sample_at(const xhu_audio_clock_t *clock, xhu_u64_t time_ns)
+{
+    xhu_u64_t anchor_ns;
+    xhu_s64_t anchor_sample;
+    xhu_f64_t period_ns;
+    xhu_audio_clock_read_period(clock, &anchor_ns, &anchor_sample, &period_ns);
+    
+    // Signed difference so times before the anchor map to earlier samples
+    xhu_f64_t elapsed_ns = (xhu_f64_t)(xhu_s64_t)(time_ns - anchor_ns);
+    
+    return anchor_sample + (xhu_s64_t)(elapsed_ns / period_ns);
+}
+
+xhu_u64_t xhu_audio_clock_time_at(const xhu_audio_clock_t *clock, xhu_s64_t sample)
+{
+    xhu_u64_t anchor_ns;
+    xhu_s64_t anchor_sample;
+    xhu_f64_t period_ns;
+    xhu_audio_clock_read_period(clock, &anchor_ns, &anchor_sample, &period_ns);
+    
+    return anchor_ns + (xhu_u64_t)(xhu_s64_t)((sample - anchor_sample) * period_ns);
+}
@@ -0,0 +1,7202 @@
+/* Generated by tools/xhu_wavetable_generator.c, do not edit */
+
+#include "xhu_wavetables.h"
+
+const xhu_audio_data_t xhu_wavetable_data[XHU_WAVETABLE_LAST][XHU_WAVETABLE_SIZE + 1] = {
+    /* sine */
+    {
+        0, 0.0015339801862847655, 0.0030679567629659761, 0.0046019261204485705,
+        0.0061358846491544753, 0.007669828739531097, 0.0092037547820598194, 0.010737659167264491,
+        0.012271538285719925, 0.013805388528060391, 0.0153392062849881, 0.01687298794728171,
+        0.01840672990580482, 0.019940428551514441, 0.021474080275469508, 0.023007681468839369,
+        0.024541228522912288, 0.026074717829103901, 0.02760814577896574, 0.029141508764193722,
+        0.030674803176636626, 0.032208025408304586, 0.03374117185137758, 0.035274238898213947,
+        0.036807222941358832, 0.038340120373552694, 0.039872927587739811, 0.041405640977076739,
+        0.04293825693494082, 0.044470771854938668, 0.046003182130914623, 0.047535484156959303,
+        0.049067674327418015, 0.050599749036899282, 0.052131704680283324, 0.05366353765273052,
+        0.055195244349689934, 0.056726821166907748, 0.058258264500435752, 0.059789570746639868,
+        0.061320736302208578, 0.062851757564161406, 0.064382630929857465, 0.065913352797003805,
+        0.067443919563664051, 0.068974327628266746, 0.070504573389613856, 0.072034653246889332,
+        0.073564563599667426, 0.075094300847921305, 0.076623861392031492, 0.078153241632794232,
+        0.079682437971430126, 0.081211446809592441, 0.082740264549375692, 0.084268887593324071,
+        0.085797312344439894, 0.087325535206192059, 0.0888535525825246, 0.090381360877864983,
+        0.091908956497132724, 0.093436335845747787, 0.094963495329638992, 0.096490431355252593,
+        0.098017140329560604, 0.099543618660069319, 0.10106986275482782, 0.10259586902243628,
+        0.10412163387205459, 0.10564715371341062, 0.10717242495680884, 0.10869744401313872,
+        0.11022220729388306, 0.11174671121112659, 0.11327095217756435, 0.11479492660651008,
+        0.11631863091190475, 0.11784206150832498, 0.11936521481099135, 0.12088808723577708,
+        0.1224106751992162, 0.12393297511851216, 0.12545498341154623, 0.12697669649688587,
+        0.12849811079379317, 0.13001922272223335, 0.13154002870288312, 0.13306052515713906,
+        0.13458070850712617, 0.1361005751757062, 0.13762012158648604, 0.1391393441638262,
+        0.14065823933284921, 0.14217680351944803, 0.14369503315029447, 0.14521292465284746,
+        0.14673047445536175, 0.14824767898689603, 0.14976453467732151, 0.15128103795733022,
+        0.15279718525844344, 0.1543129730130201, 0.15582839765426523, 0.15734345561623825,
+        0.15885814333386145, 0.16037245724292828, 0.16188639378011183, 0.16339994938297323,
+        0.16491312048996992, 0.1664259035404641, 0.16793829497473117, 0.16945029123396796,
+        0.17096188876030122, 0.17247308399679595, 0.17398387338746382, 0.17549425337727143,
+        0.17700422041214875, 0.17851377093899751, 0.18002290140569951, 0.18153160826112497,
+        0.18303988795514095, 0.18454773693861962, 0.18605515166344663, 0.1875621285825296,
+        0.18906866414980619, 0.19057475482025274, 0.19208039704989244, 0.19358558729580361,
+        0.19509032201612825, 0.19659459767008022, 0.19809841071795356, 0.19960175762113097,
+        0.2011046348420919, 0.20260703884442113, 0.20410896609281687, 0.20561041305309924,
+        0.20711137619221856, 0.20861185197826349, 0.21011183688046961, 0.21161132736922755,
+        0.21311031991609136, 0.21460881099378676, 0.21610679707621952, 0.21760427463848364,
+        0.2191012401568698, 0.22059769010887351, 0.22209362097320351, 0.22358902922978999,
+        0.22508391135979283, 0.22657826384561, 0.22807208317088573, 0.22956536582051887,
+        0.23105810828067111, 0.23255030703877524, 0.23404195858354343, 0.23553305940497549,
+        0.2370236059943672, 0.23851359484431842, 0.2400030224487415, 0.24149188530286933,
+        0.24298017990326387, 0.24446790274782415, 0.24595505033579459, 0.24744161916777327,
+        0.24892760574572015, 0.25041300657296522, 0.25189781815421697, 0.25338203699557016,
+        0.25486565960451457, 0.25634868248994291, 0.25783110216215899, 0.25931291513288623,
+        0.26079411791527551, 0.26227470702391359, 0.26375467897483135, 0.26523403028551179,
+        0.26671275747489837, 0.26819085706340318, 0.26966832557291509, 0.27114515952680801,
+        0.27262135544994898, 0.27409690986870638, 0.27557181931095814, 0.2770460803060999,
+        0.27851968938505306, 0.27999264308027322, 0.28146493792575794, 0.28293657045705539,
+        0.28440753721127188, 0.28587783472708062, 0.28734745954472951, 0.28881640820604948,
+        0.29028467725446233, 0.29175226323498926, 0.29321916269425863, 0.29468537218051433,
+        0.29615088824362379, 0.2976157074350862, 0.29907982630804048, 0.30054324141727345,
+        0.30200594931922808, 0.30346794657201132, 0.30492922973540237, 0.30638979537086092,
+        0.30784964004153487, 0.30930876031226873, 0.31076715274961147, 0.31222481392182488,
+        0.31368174039889152, 0.31513792875252244, 0.31659337555616585, 0.31804807738501495,
+        0.31950203081601569, 0.32095523242787521, 0.32240767880106985, 0.32385936651785285,
+        0.32531029216226293, 0.32676045232013173, 0.3282098435790925, 0.32965846252858749,
+        0.33110630575987643, 0.33255336986604422, 0.33399965144200938, 0.3354451470845316,
+        0.33688985339222005, 0.33833376696554113, 0.33977688440682685, 0.34121920232028236,
+        0.34266071731199438, 0.34410142598993881, 0.34554132496398909, 0.34698041084592368,
+        0.34841868024943456, 0.34985612979013492, 0.35129275608556709, 0.35272855575521073,
+        0.35416352542049034, 0.35559766170478385, 0.35703096123342998, 0.35846342063373654,
+        0.35989503653498811, 0.36132580556845428, 0.36275572436739723, 0.36418478956707989,
+        0.36561299780477385, 0.36704034571976718, 0.36846682995337232, 0.3698924471489341,
+        0.37131719395183754, 0.37274106700951576, 0.37416406297145793, 0.37558617848921722,
+        0.37700741021641826, 0.37842775480876556, 0.37984720892405116, 0.38126576922216238,
+        0.38268343236508978, 0.38410019501693504, 0.38551605384391885, 0.38693100551438858,
+        0.38834504669882625, 0.38975817406985641, 0.39117038430225387, 0.39258167407295147,
+        0.3939920400610481, 0.39540147894781635, 0.39680998741671031, 0.39821756215337356,
+        0.39962419984564679, 0.40102989718357562, 0.40243465085941843, 0.40383845756765407,
+        0.40524131400498986, 0.40664321687036903, 0.40804416286497869, 0.40944414869225759,
+        0.41084317105790391, 0.41224122666988289, 0.4136383122384345, 0.41503442447608163,
+        0.41642956009763715, 0.41782371582021227, 0.41921688836322391, 0.42060907444840251,
+        0.42200027079979968, 0.42339047414379605, 0.42477968120910881, 0.42616788872679962,
+        0.42755509343028208, 0.42894129205532949, 0.43032648134008261, 0.43171065802505726,
+        0.43309381885315196, 0.43447596056965565, 0.43585707992225547, 0.43723717366104409,
+        0.43861623853852766, 0.43999427130963326, 0.44137126873171667, 0.44274722756457002,
+        0.4441221445704292, 0.44549601651398174, 0.44686884016237416, 0.44824061228521989,
+        0.44961132965460654, 0.45098098904510386, 0.45234958723377089, 0.45371712100016387,
+        0.45508358712634384, 0.45644898239688392, 0.45781330359887717, 0.45917654752194409,
+        0.46053871095824001, 0.46189979070246273, 0.46325978355186015, 0.46461868630623782,
+        0.46597649576796618, 0.46733320874198842, 0.4686888220358279, 0.47004333245959562,
+        0.47139673682599764, 0.47274903195034279, 0.47410021465054997, 0.47545028174715587,
+        0.47679923006332209, 0.47814705642484301, 0.47949375766015301, 0.48083933060033396,
+        0.48218377207912272, 0.48352707893291874, 0.48486924800079106, 0.48621027612448642,
+        0.487550160148436, 0.48888889691976317, 0.49022648328829116, 0.4915629161065499,
+        0.49289819222978404, 0.49423230851595967, 0.49556526182577254, 0.49689704902265447,
+        0.49822766697278187, 0.49955711254508184, 0.50088538261124071, 0.50221247404571079,
+        0.50353838372571758, 0.50486310853126759, 0.50618664534515523, 0.50750899105297087,
+        0.50883014254310699, 0.51015009670676681, 0.5114688504379703, 0.51278640063356296,
+        0.51410274419322166, 0.51541787801946293, 0.51673179901764987, 0.51804450409599934,
+        0.51935599016558964, 0.52066625414036716, 0.52197529293715439, 0.52328310347565643,
+        0.52458968267846895, 0.52589502747108463, 0.52719913478190128, 0.52850200154222848,
+        0.52980362468629461, 0.531104001151255, 0.5324031278771979, 0.53370100180715296,
+        0.53499761988709715, 0.53629297906596318, 0.53758707629564539, 0.53887990853100842,
+        0.54017147272989285, 0.54146176585312344, 0.54275078486451589, 0.54403852673088382,
+        0.54532498842204646, 0.54661016691083486, 0.54789405917310019, 0.54917666218771966,
+        0.55045797293660481, 0.55173798840470734, 0.55301670558002747, 0.55429412145362,
+        0.55557023301960218, 0.5568450372751601, 0.5581185312205561, 0.55939071185913614,
+        0.56066157619733603, 0.56193112124468947, 0.56319934401383409, 0.5644662415205195,
+        0.56573181078361312, 0.56699604882510868, 0.56825895267013149, 0.56952051934694714,
+        0.57078074588696726, 0.57203962932475705, 0.5732971666980422, 0.57455335504771576,
+        0.57580819141784534, 0.57706167285567944, 0.57831379641165559, 0.57956455913940563,
+        0.58081395809576453, 0.58206199034077544, 0.58330865293769829, 0.58455394295301533,
+        0.58579785745643886, 0.58704039352091797, 0.58828154822264522, 0.58952131864106394,
+        0.59075970185887416, 0.59199669496204099, 0.5932322950397998, 0.59446649918466443,
+        0.59569930449243336, 0.5969307080621965, 0.59816070699634227, 0.59938929840056454,
+        0.60061647938386897, 0.60184224705858003, 0.60306659854034816, 0.60428953094815596,
+        0.60551104140432555, 0.60673112703452448, 0.60794978496777363, 0.60916701233645321,
+        0.61038280627630948, 0.61159716392646191, 0.61281008242940971, 0.61402155893103838,
+        0.61523159058062682, 0.61644017453085365, 0.61764730793780387, 0.61885298796097632,
+        0.6200572117632891, 0.62125997651108755, 0.62246127937414997, 0.62366111752569453,
+        0.62485948814238634, 0.62605638840434352, 0.62725181549514408, 0.62844576660183271,
+        0.62963823891492698, 0.63082922962842447, 0.63201873593980906, 0.63320675505005719,
+        0.63439328416364549, 0.63557832048855611, 0.6367618612362842, 0.63794390362184406,
+        0.63912444486377573, 0.64030348218415167, 0.64148101280858316, 0.64265703396622686,
+        0.64383154288979139, 0.64500453681554393, 0.64617601298331628, 0.64734596863651206,
+        0.64851440102211244, 0.64968130739068319, 0.65084668499638088, 0.6520105310969595,
+        0.65317284295377676, 0.65433361783180044, 0.65549285299961535, 0.65665054572942894,
+        0.65780669329707864, 0.65896129298203732, 0.66011434206742048, 0.66126583783999227,
+        0.66241577759017178, 0.66356415861203977, 0.66471097820334479, 0.66585623366550972,
+        0.66699992230363747, 0.66814204142651845, 0.66928258834663601, 0.67042156038017309,
+        0.67155895484701833, 0.67269476907077286, 0.67382900037875604, 0.67496164610201193,
+        0.67609270357531592, 0.67722217013718033, 0.67835004312986147, 0.67947631989936497,
+        0.68060099779545302, 0.68172407417164971, 0.68284554638524808, 0.6839654117973154,
+        0.68508366777270036, 0.68620031168003859, 0.68731534089175905, 0.68842875278409044,
+        0.68954054473706683, 0.6906507141345346, 0.69175925836415775, 0.69286617481742463,
+        0.693971460889654, 0.69507511398000088, 0.69617713149146299, 0.69727751083088652,
+        0.69837624940897292, 0.69947334464028377, 0.70056879394324834, 0.70166259474016845,
+        0.7027547444572253, 0.70384524052448494, 0.70493408037590488, 0.70602126144933974,
+        0.70710678118654746, 0.70819063703319529, 0.70927282643886558, 0.71035334685706231,
+        0.71143219574521643, 0.71250937056469232, 0.71358486878079352, 0.71465868786276898,
+        0.71573082528381859, 0.71680127852109954, 0.71787004505573171, 0.71893712237280438,
+        0.72000250796138165, 0.72106619931450811, 0.72212819392921535, 0.72318848930652735,
+        0.72424708295146689, 0.72530397237306066, 0.72635915508434601, 0.72741262860237577,
+        0.7284643904482252, 0.7295144381469969, 0.73056276922782759, 0.73160938122389252,
+        0.73265427167241282, 0.73369743811466026, 0.73473887809596339, 0.73577858916571348,
+        0.73681656887736979, 0.73785281478846598, 0.73888732446061511, 0.73992009545951609,
+        0.74095112535495911, 0.74198041172083096, 0.74300795213512172, 0.74403374417992918,
+        0.74505778544146595, 0.74608007351006378, 0.74710060598018013, 0.74811938045040349,
+        0.74913639452345926, 0.75015164580621496, 0.75116513190968637, 0.7521768504490427,
+        0.75318679904361241, 0.75419497531688917, 0.75520137689653655, 0.75620600141439454,
+        0.75720884650648446, 0.75820990981301528, 0.75920918897838796, 0.76020668165120242,
+        0.76120238548426178, 0.7621962981345789, 0.76318841726338127, 0.76417874053611667,
+        0.76516726562245896, 0.76615399019631281, 0.7671389119358204, 0.76812202852336531,
+        0.76910333764557959, 0.7700828369933479, 0.77106052426181371, 0.77203639715038441,
+        0.77301045336273699, 0.77398269060682279, 0.77495310659487382, 0.77592169904340758,
+        0.77688846567323244, 0.77785340420945304, 0.77881651238147587, 0.77977778792301444,
+        0.78073722857209438, 0.78169483207105939, 0.78265059616657573, 0.7836045186096382,
+        0.78455659715557524, 0.78550682956405393, 0.78645521359908577, 0.78740174702903132,
+        0.78834642762660623, 0.78928925316888565, 0.79023022143731003, 0.79116933021769009,
+        0.79210657730021239, 0.79304196047944364, 0.79397547755433717, 0.79490712632823701,
+        0.79583690460888346, 0.79676481020841872, 0.79769084094339104, 0.79861499463476082,
+        0.79953726910790501, 0.80045766219262271, 0.80137617172314013, 0.80229279553811572,
+        0.80320753148064483, 0.8041203773982657, 0.80503133114296366, 0.80594039057117628,
+        0.80684755354379922, 0.80775281792619036, 0.80865618158817498, 0.80955764240405126,
+        0.81045719825259477, 0.81135484701706373, 0.81225058658520388, 0.81314441484925359,
+        0.8140363297059483, 0.81492632905652662, 0.81581441080673378, 0.81670057286682785,
+        0.81758481315158371, 0.81846712958029866, 0.8193475200767969, 0.82022598256943469,
+        0.82110251499110465, 0.82197711527924155, 0.82284978137582632, 0.82372051122739132,
+        0.82458930278502529, 0.82545615400437744, 0.82632106284566342, 0.82718402727366902,
+        0.8280450452577558, 0.82890411477186487, 0.82976123379452305, 0.8306164003088462,
+        0.83146961230254524, 0.83232086776792968, 0.83317016470191319, 0.83401750110601813,
+        0.83486287498638001, 0.8357062843537526, 0.83654772722351189, 0.83738720161566194,
+        0.83822470555483797, 0.83906023707031263, 0.83989379419599941, 0.84072537497045807,
+        0.84155497743689833, 0.84238259964318596, 0.84320823964184544, 0.84403189549006641,
+        0.84485356524970701, 0.84567324698729907, 0.84649093877405202, 0.84730663868585832,
+        0.84812034480329712, 0.84893205521163961, 0.84974176800085244, 0.85054948126560337,
+        0.8513551931052652, 0.85215890162391983, 0.85296060493036363, 0.8537603011381113,
+        0.85455798836540053, 0.85535366473519603, 0.85614732837519447, 0.85693897741782865,
+        0.85772861000027212, 0.85851622426444274, 0.85930181835700836, 0.86008539042939014,
+        0.86086693863776731, 0.8616464611430813, 0.8624239561110405, 0.86319942171212416,
+        0.8639728561215867, 0.86474425751946238, 0.86551362409056898, 0.86628095402451299,
+        0.86704624551569265, 0.86780949676330321, 0.8685707059713409, 0.86932987134860673,
+        0.87008699110871135, 0.87084206347007886, 0.87159508665595109, 0.87234605889439154,
+        0.87309497841829009, 0.87384184346536675, 0.87458665227817611, 0.87532940310411078,
+        0.8760700941954066, 0.87680872380914576, 0.87754529020726124, 0.87827979165654146,
+        0.87901222642863341, 0.87974259280004741, 0.88047088905216075, 0.88119711347122198,
+        0.88192126434835494, 0.88264333997956279, 0.88336333866573158, 0.88408125871263499,
+        0.88479709843093779, 0.88551085613619995, 0.88622253014888064, 0.88693211879434208,
+        0.88763962040285393, 0.88834503330959624, 0.88904835585466457, 0.88974958638307289,
+        0.89044872324475788, 0.89114576479458318, 0.89184070939234272, 0.89253355540276469,
+        0.89322430119551532, 0.89391294514520325, 0.89459948563138258, 0.89528392103855758,
+        0.89596624975618511, 0.89664647017868015, 0.89732458070541832, 0.89800057974073988,
+        0.89867446569395382, 0.89934623697934146, 0.90001589201616028, 0.90068342922864686,
+        0.90134884704602203, 0.90201214390249307, 0.90267331823725883, 0.90333236849451182,
+        0.90398929312344334, 0.90464409057824624, 0.90529675931811882, 0.90594729780726846,
+        0.90659570451491533, 0.90724197791529593, 0.90788611648766615, 0.90852811871630612,
+        0.90916798309052227, 0.90980570810465222, 0.91044129225806714, 0.91107473405517625,
+        0.91170603200542988, 0.91233518462332275, 0.9129621904283981, 0.91358704794525081,
+        0.91420975570353069, 0.91483031223794609, 0.91544871608826783, 0.91606496579933161,
+        0.9166790599210427, 0.91729099700837791, 0.91790077562139039, 0.91850839432521225,
+        0.91911385169005777, 0.91971714629122736, 0.92031827670911048, 0.92091724152918952,
+        0.9215140393420419, 0.92210866874334507, 0.92270112833387852, 0.92329141671952764,
+        0.92387953251128674, 0.9244654743252626, 0.92504924078267758, 0.92563083050987272,
+        0.92621024213831127, 0.92678747430458175, 0.92736252565040111, 0.92793539482261789,
+        0.92850608047321548, 0.92907458125931575, 0.92964089584318133, 0.93020502289221907,
+        0.93076696107898371, 0.93132670908118043, 0.93188426558166815, 0.93243962926846236,
+        0.93299279883473885, 0.93354377297883617, 0.93409255040425887, 0.93463912981968078,
+        0.9351835099389475, 0.93572568948108037, 0.93626566717027826, 0.93680344173592156,
+        0.93733901191257496, 0.93787237643998989, 0.93840353406310806, 0.93893248353206449,
+        0.93945922360218992, 0.93998375303401394, 0.9405060705932683, 0.94102617505088926,
+        0.94154406518302081, 0.94205973977101731, 0.94257319760144687, 0.94308443746609349,
+        0.94359345816196039, 0.94410025849127266, 0.94460483726148026, 0.94510719328526061,
+        0.94560732538052128, 0.94610523237040334, 0.94660091308328353, 0.94709436635277722,
+        0.94758559101774109, 0.94807458592227623, 0.94856134991573027, 0.94904588185270056,
+        0.94952818059303667, 0.950008245001843, 0.9504860739494817, 0.95096166631157508,
+        0.95143502096900834, 0.95190613680793223, 0.95237501271976588, 0.95284164760119872,
+        0.95330604035419375, 0.95376818988599033, 0.95422809510910567, 0.95468575494133834,
+        0.95514116830577067, 0.95559433413077111, 0.95604525134999641, 0.95649391890239499,
+        0.95694033573220894, 0.95738450078897586, 0.95782641302753291, 0.95826607140801767,
+        0.9587034748958716, 0.95913862246184189, 0.95957151308198452, 0.96000214573766585,
+        0.96043051941556579, 0.96085663310767966, 0.96128048581132064, 0.96170207652912254,
+        0.96212140426904158, 0.96253846804435916, 0.96295326687368388, 0.96336579978095405,
+        0.96377606579543984, 0.96418406395174572, 0.96458979328981265, 0.96499325285492032,
+        0.9653944416976894, 0.96579335887408357, 0.96619000344541262, 0.96658437447833312,
+        0.96697647104485207, 0.96736629222232851, 0.96775383709347551, 0.96813910474636233,
+        0.96852209427441727, 0.96890280477642887, 0.96928123535654853, 0.96965738512429245,
+        0.97003125319454397, 0.9704028386875555, 0.97077214072895035, 0.97113915844972509,
+        0.97150389098625178, 0.9718663374802794, 0.97222649707893627, 0.97258436893473221,
+        0.97293995220556007, 0.97329324605469825, 0.97364424965081187, 0.97399296216795583,
+        0.97433938278557586, 0.97468351068851067, 0.97502534506699412, 0.97536488511665687,
+        0.97570213003852857, 0.97603707903903902, 0.97636973133002114, 0.97670008612871184,
+        0.97702814265775439, 0.97735390014519996, 0.97767735782450993, 0.97799851493455714,
+        0.97831737071962765, 0.9786339244294231, 0.9789481753190622, 0.97926012264908202,
+        0.97956976568544052, 0.97987710369951764, 0.98018213596811732, 0.98048486177346938,
+        0.98078528040323043, 0.98108339115048659, 0.98137919331375456, 0.98167268619698311,
+        0.98196386910955524, 0.98225274136628937, 0.98253930228744124, 0.98282355119870524,
+        0.98310548743121629, 0.98338511032155118, 0.98366241921173025, 0.98393741344921892,
+        0.98421009238692903, 0.98448045538322093, 0.98474850180190421, 0.98501423101223984,
+        0.98527764238894122, 0.98553873531217606, 0.98579750916756737, 0.98605396334619544,
+        0.98630809724459867, 0.98655991026477541, 0.98680940181418542, 0.98705657130575097,
+        0.98730141815785843, 0.98754394179435923, 0.98778414164457218, 0.98802201714328353,
+        0.98825756773074946, 0.98849079285269659, 0.98872169196032378, 0.98895026451030299,
+        0.98917650996478101, 0.98940042779138038, 0.98962201746320078, 0.98984127845882053,
+        0.99005821026229712, 0.99027281236316911, 0.99048508425645698, 0.99069502544266463,
+        0.99090263542778001, 0.99110791372327678, 0.99131085984611544, 0.9915114733187439,
+        0.99170975366909953, 0.99190570043060933, 0.9920993131421918, 0.99229059134825737,
+        0.99247953459870997, 0.99266614244894802, 0.9928504144598651, 0.99303235019785141,
+        0.9932119492347945, 0.99338921114808065, 0.9935641355205953, 0.9937367219407246,
+        0.99390697000235606, 0.99407487930487937, 0.9942404494531879, 0.9944036800576791,
+        0.99456457073425542, 0.9947231211043257, 0.99487933079480562, 0.99503319943811863,
+        0.99518472667219682, 0.99533391214048228, 0.99548075549192694, 0.99562525638099431,
+        0.99576741446765982, 0.99590722941741172, 0.99604470090125197, 0.99617982859569687,
+        0.996312612182778, 0.99644305135004263, 0.99657114579055484, 0.99669689520289606,
+        0.99682029929116567, 0.99694135776498216, 0.99706007033948296, 0.99717643673532619,
+        0.99729045667869021, 0.9974021299012753, 0.99751145614030345, 0.99761843513851955,
+        0.99772306664419164, 0.99782535041111164, 0.997925286198596, 0.99802287377148624,
+        0.99811811290014918, 0.99821100336047819, 0.99830154493389289, 0.99838973740734016,
+        0.99847558057329477, 0.99855907422975931, 0.99864021818026527, 0.99871901223387294,
+        0.99879545620517241, 0.99886954991428356, 0.99894129318685687, 0.99901068585407338,
+        0.99907772775264536, 0.99914241872481691, 0.99920475861836389, 0.99926474728659442,
+        0.99932238458834954, 0.99937767038800285, 0.99943060455546173, 0.99948118696616695,
+        0.99952941750109314, 0.99957529604674922, 0.99961882249517864, 0.99965999674395922,
+        0.99969881869620425, 0.99973528826056168, 0.99976940535121528, 0.99980116988788426,
+        0.9998305817958234, 0.99985764100582386, 0.99988234745421256, 0.9999047010828529,
+        0.9999247018391445, 0.99994234967602391, 0.9999576445519639, 0.99997058643097414,
+        0.99998117528260111, 0.9999894110819284, 0.99999529380957619, 0.99999882345170188,
+        1, 0.99999882345170188, 0.99999529380957619, 0.9999894110819284,
+        0.99998117528260111, 0.99997058643097414, 0.9999576445519639, 0.99994234967602391,
+        0.9999247018391445, 0.9999047010828529, 0.99988234745421256, 0.99985764100582386,
+        0.9998305817958234, 0.99980116988788426, 0.99976940535121528, 0.99973528826056168,
+        0.99969881869620425, 0.99965999674395922, 0.99961882249517864, 0.99957529604674922,
+        0.99952941750109314, 0.99948118696616695, 0.99943060455546173, 0.99937767038800285,
+        0.99932238458834954, 0.99926474728659442, 0.99920475861836389, 0.99914241872481691,
+        0.99907772775264536, 0.99901068585407338, 0.99894129318685687, 0.99886954991428356,
+        0.99879545620517241, 0.99871901223387294, 0.99864021818026527, 0.99855907422975931,
+        0.99847558057329477, 0.99838973740734016, 0.99830154493389289, 0.99821100336047819,
+        0.99811811290014918, 0.99802287377148624, 0.997925286198596, 0.99782535041111164,
+        0.99772306664419164, 0.99761843513851955, 0.99751145614030345, 0.9974021299012753,
+        0.99729045667869021, 0.99717643673532619, 0.99706007033948296, 0.99694135776498216,
+        0.99682029929116578, 0.99669689520289606, 0.99657114579055484, 0.99644305135004263,
+        0.996312612182778, 0.99617982859569687, 0.99604470090125197, 0.99590722941741172,
+        0.99576741446765982, 0.99562525638099431, 0.99548075549192694, 0.99533391214048228,
+        0.99518472667219693, 0.99503319943811863, 0.99487933079480562, 0.9947231211043257,
+        0.99456457073425542, 0.9944036800576791, 0.9942404494531879, 0.99407487930487948,
+        0.99390697000235606, 0.9937367219407246, 0.9935641355205953, 0.99338921114808065,
+        0.9932119492347945, 0.99303235019785141, 0.9928504144598651, 0.99266614244894802,
+        0.99247953459870997, 0.99229059134825737, 0.9920993131421918, 0.99190570043060933,
+        0.99170975366909953, 0.99151147331874401, 0.99131085984611544, 0.99110791372327689,
+        0.99090263542778001, 0.99069502544266463, 0.99048508425645698, 0.99027281236316911,
+        0.99005821026229712, 0.98984127845882053, 0.98962201746320089, 0.98940042779138038,
+        0.98917650996478101, 0.98895026451030299, 0.98872169196032378, 0.9884907928526967,
+        0.98825756773074946, 0.98802201714328353, 0.98778414164457218, 0.98754394179435934,
+        0.98730141815785843, 0.98705657130575097, 0.98680940181418553, 0.98655991026477552,
+        0.98630809724459867, 0.98605396334619544, 0.98579750916756748, 0.98553873531217606,
+        0.98527764238894122, 0.98501423101223984, 0.98474850180190421, 0.98448045538322093,
+        0.98421009238692903, 0.98393741344921892, 0.98366241921173025, 0.98338511032155118,
+        0.98310548743121629, 0.98282355119870535, 0.98253930228744124, 0.98225274136628937,
+        0.98196386910955524, 0.98167268619698311, 0.98137919331375456, 0.98108339115048671,
+        0.98078528040323043, 0.98048486177346938, 0.98018213596811743, 0.97987710369951764,
+        0.97956976568544052, 0.97926012264908213, 0.9789481753190622, 0.97863392442942321,
+        0.97831737071962765, 0.97799851493455714, 0.97767735782450993, 0.97735390014520007,
+        0.97702814265775439, 0.97670008612871184, 0.97636973133002114, 0.97603707903903913,
+        0.97570213003852857, 0.97536488511665698, 0.97502534506699412, 0.97468351068851067,
+        0.97433938278557586, 0.97399296216795583, 0.97364424965081198, 0.97329324605469825,
+        0.97293995220556018, 0.97258436893473221, 0.97222649707893638, 0.9718663374802794,
+        0.97150389098625178, 0.97113915844972509, 0.97077214072895035, 0.9704028386875555,
+        0.97003125319454397, 0.96965738512429245, 0.96928123535654853, 0.96890280477642887,
+        0.96852209427441738, 0.96813910474636244, 0.96775383709347551, 0.96736629222232851,
+        0.96697647104485207, 0.96658437447833312, 0.96619000344541262, 0.96579335887408368,
+        0.9653944416976894, 0.96499325285492044, 0.96458979328981276, 0.96418406395174583,
+        0.96377606579543984, 0.96336579978095405, 0.96295326687368388, 0.96253846804435916,
+        0.96212140426904158, 0.96170207652912254, 0.96128048581132064, 0.96085663310767966,
+        0.9604305194155659, 0.96000214573766585, 0.95957151308198452, 0.95913862246184201,
+        0.9587034748958716, 0.95826607140801767, 0.95782641302753291, 0.95738450078897597,
+        0.95694033573220894, 0.9564939189023951, 0.95604525134999652, 0.95559433413077111,
+        0.95514116830577067, 0.95468575494133834, 0.95422809510910567, 0.95376818988599033,
+        0.95330604035419386, 0.95284164760119872, 0.95237501271976588, 0.95190613680793235,
+        0.95143502096900834, 0.95096166631157508, 0.95048607394948181, 0.950008245001843,
+        0.94952818059303667, 0.94904588185270067, 0.94856134991573038, 0.94807458592227623,
+        0.9475855910177412, 0.94709436635277722, 0.94660091308328353, 0.94610523237040345,
+        0.94560732538052139, 0.94510719328526061, 0.94460483726148026, 0.94410025849127266,
+        0.94359345816196039, 0.94308443746609349, 0.94257319760144687, 0.94205973977101742,
+        0.94154406518302081, 0.94102617505088926, 0.9405060705932683, 0.93998375303401405,
+        0.93945922360218992, 0.93893248353206449, 0.93840353406310817, 0.93787237643998989,
+        0.93733901191257496, 0.93680344173592156, 0.93626566717027826, 0.93572568948108037,
+        0.93518350993894761, 0.93463912981968078, 0.93409255040425898, 0.93354377297883628,
+        0.93299279883473885, 0.93243962926846236, 0.93188426558166815, 0.93132670908118054,
+        0.93076696107898371, 0.93020502289221907, 0.92964089584318133, 0.92907458125931575,
+        0.92850608047321559, 0.92793539482261789, 0.92736252565040111, 0.92678747430458175,
+        0.92621024213831138, 0.92563083050987283, 0.9250492407826777, 0.9244654743252626,
+        0.92387953251128674, 0.92329141671952775, 0.92270112833387852, 0.92210866874334518,
+        0.92151403934204201, 0.92091724152918952, 0.92031827670911059, 0.91971714629122736,
+        0.91911385169005777, 0.91850839432521225, 0.9179007756213905, 0.91729099700837802,
+        0.9166790599210427, 0.91606496579933172, 0.91544871608826783, 0.9148303122379462,
+        0.91420975570353069, 0.91358704794525081, 0.91296219042839821, 0.91233518462332286,
+        0.91170603200542988, 0.91107473405517636, 0.91044129225806725, 0.90980570810465233,
+        0.90916798309052249, 0.90852811871630612, 0.90788611648766615, 0.90724197791529593,
+        0.90659570451491533, 0.90594729780726857, 0.90529675931811882, 0.90464409057824613,
+        0.90398929312344345, 0.90333236849451182, 0.90267331823725883, 0.90201214390249329,
+        0.90134884704602203, 0.90068342922864686, 0.90001589201616028, 0.89934623697934157,
+        0.89867446569395393, 0.89800057974073988, 0.89732458070541832, 0.89664647017868027,
+        0.89596624975618522, 0.89528392103855747, 0.89459948563138281, 0.89391294514520325,
+        0.89322430119551521, 0.89253355540276469, 0.89184070939234272, 0.89114576479458341,
+        0.89044872324475799, 0.88974958638307278, 0.88904835585466468, 0.88834503330959635,
+        0.88763962040285393, 0.88693211879434231, 0.88622253014888064, 0.88551085613619984,
+        0.8847970984309379, 0.88408125871263499, 0.88336333866573169, 0.8826433399795629,
+        0.88192126434835505, 0.8811971134712222, 0.88047088905216087, 0.87974259280004741,
+        0.87901222642863353, 0.87827979165654158, 0.87754529020726124, 0.87680872380914576,
+        0.8760700941954066, 0.875329403104111, 0.87458665227817622, 0.87384184346536686,
+        0.8730949784182902, 0.87234605889439154, 0.87159508665595098, 0.87084206347007898,
+        0.87008699110871146, 0.86932987134860673, 0.86857070597134101, 0.86780949676330321,
+        0.86704624551569276, 0.86628095402451311, 0.86551362409056909, 0.86474425751946249,
+        0.86397285612158681, 0.86319942171212416, 0.86242395611104061, 0.8616464611430813,
+        0.8608669386377672, 0.86008539042939025, 0.85930181835700836, 0.85851622426444296,
+        0.85772861000027212, 0.85693897741782876, 0.85614732837519458, 0.85535366473519603,
+        0.85455798836540053, 0.85376030113811152, 0.85296060493036374, 0.85215890162391972,
+        0.8513551931052652, 0.85054948126560348, 0.84974176800085266, 0.84893205521163972,
+        0.84812034480329723, 0.84730663868585854, 0.84649093877405213, 0.84567324698729907,
+        0.84485356524970723, 0.84403189549006641, 0.84320823964184544, 0.84238259964318596,
+        0.84155497743689844, 0.84072537497045818, 0.83989379419599963, 0.83906023707031263,
+        0.83822470555483819, 0.83738720161566194, 0.83654772722351201, 0.83570628435375272,
+        0.83486287498638012, 0.83401750110601802, 0.8331701647019133, 0.83232086776792968,
+        0.83146961230254546, 0.83061640030884631, 0.82976123379452305, 0.8289041147718651,
+        0.8280450452577558, 0.82718402727366913, 0.82632106284566365, 0.82545615400437755,
+        0.82458930278502518, 0.82372051122739154, 0.82284978137582632, 0.82197711527924144,
+        0.82110251499110476, 0.82022598256943469, 0.81934752007679712, 0.81846712958029877,
+        0.81758481315158371, 0.81670057286682796, 0.81581441080673378, 0.81492632905652651,
+        0.81403632970594852, 0.81314441484925359, 0.81225058658520388, 0.81135484701706384,
+        0.81045719825259477, 0.80955764240405148, 0.80865618158817509, 0.80775281792619036,
+        0.80684755354379945, 0.80594039057117639, 0.80503133114296355, 0.80412037739826581,
+        0.80320753148064494, 0.80229279553811561, 0.80137617172314035, 0.80045766219262282,
+        0.79953726910790524, 0.79861499463476093, 0.79769084094339104, 0.79676481020841894,
+        0.79583690460888357, 0.7949071263282369, 0.79397547755433728, 0.79304196047944364,
+        0.79210657730021228, 0.79116933021769031, 0.79023022143731003, 0.78928925316888587,
+        0.78834642762660634, 0.78740174702903132, 0.78645521359908588, 0.78550682956405404,
+        0.78455659715557513, 0.78360451860963831, 0.78265059616657573, 0.78169483207105928,
+        0.7807372285720946, 0.77977778792301444, 0.77881651238147609, 0.77785340420945315,
+        0.77688846567323244, 0.7759216990434078, 0.77495310659487393, 0.77398269060682279,
+        0.7730104533627371, 0.77203639715038452, 0.77106052426181371, 0.77008283699334801,
+        0.76910333764557959, 0.76812202852336553, 0.76713891193582051, 0.76615399019631292,
+        0.76516726562245907, 0.76417874053611679, 0.76318841726338127, 0.76219629813457901,
+        0.76120238548426189, 0.76020668165120231, 0.75920918897838818, 0.75820990981301528,
+        0.75720884650648468, 0.75620600141439454, 0.75520137689653655, 0.75419497531688928,
+        0.75318679904361252, 0.7521768504490427, 0.75116513190968659, 0.75015164580621507,
+        0.74913639452345926, 0.74811938045040371, 0.74710060598018013, 0.746080073510064,
+        0.74505778544146606, 0.74403374417992929, 0.74300795213512183, 0.74198041172083107,
+        0.74095112535495899, 0.73992009545951631, 0.73888732446061522, 0.73785281478846587,
+        0.73681656887737002, 0.73577858916571348, 0.73473887809596361, 0.73369743811466037,
+        0.73265427167241282, 0.73160938122389274, 0.73056276922782759, 0.72951443814699701,
+        0.72846439044822531, 0.72741262860237577, 0.7263591550843459, 0.72530397237306088,
+        0.72424708295146689, 0.72318848930652757, 0.72212819392921546, 0.72106619931450811,
+        0.72000250796138177, 0.71893712237280449, 0.71787004505573171, 0.71680127852109965,
+        0.71573082528381871, 0.71465868786276898, 0.71358486878079375, 0.71250937056469232,
+        0.71143219574521666, 0.71035334685706242, 0.70927282643886558, 0.70819063703319551,
+        0.70710678118654757, 0.70602126144933974, 0.7049340803759051, 0.70384524052448505,
+        0.70275474445722519, 0.70166259474016868, 0.70056879394324834, 0.69947334464028399,
+        0.69837624940897292, 0.69727751083088652, 0.6961771314914631, 0.69507511398000099,
+        0.693971460889654, 0.69286617481742485, 0.69175925836415786, 0.6906507141345346,
+        0.68954054473706705, 0.68842875278409044, 0.68731534089175927, 0.6862003116800387,
+        0.68508366777270036, 0.68396541179731563, 0.68284554638524819, 0.68172407417164971,
+        0.68060099779545324, 0.67947631989936508, 0.67835004312986136, 0.67722217013718056,
+        0.67609270357531592, 0.67496164610201226, 0.67382900037875615, 0.67269476907077286,
+        0.67155895484701855, 0.6704215603801732, 0.66928258834663601, 0.66814204142651867,
+        0.66699992230363758, 0.66585623366550961, 0.66471097820334502, 0.66356415861203977,
+        0.66241577759017201, 0.66126583783999238, 0.66011434206742048, 0.65896129298203754,
+        0.65780669329707875, 0.65665054572942905, 0.65549285299961557, 0.65433361783180055,
+        0.65317284295377664, 0.65201053109695972, 0.65084668499638099, 0.64968130739068342,
+        0.64851440102211255, 0.64734596863651206, 0.64617601298331662, 0.64500453681554404,
+        0.64383154288979139, 0.64265703396622709, 0.64148101280858316, 0.64030348218415156,
+        0.63912444486377584, 0.63794390362184406, 0.63676186123628442, 0.63557832048855623,
+        0.63439328416364549, 0.63320675505005741, 0.63201873593980906, 0.63082922962842447,
+        0.62963823891492721, 0.62844576660183271, 0.62725181549514408, 0.62605638840434363,
+        0.62485948814238634, 0.62366111752569486, 0.62246127937415008, 0.62125997651108755,
+        0.62005721176328943, 0.61885298796097643, 0.61764730793780387, 0.61644017453085376,
+        0.61523159058062693, 0.61402155893103838, 0.61281008242940982, 0.61159716392646191,
+        0.6103828062763097, 0.60916701233645332, 0.60794978496777363, 0.6067311270345247,
+        0.60551104140432566, 0.60428953094815596, 0.60306659854034839, 0.60184224705858014,
+        0.60061647938386886, 0.59938929840056465, 0.59816070699634238, 0.59693070806219672,
+        0.59569930449243347, 0.59446649918466443, 0.59323229503980002, 0.59199669496204099,
+        0.59075970185887416, 0.58952131864106405, 0.58828154822264533, 0.58704039352091797,
+        0.58579785745643898, 0.58455394295301533, 0.58330865293769851, 0.58206199034077566,
+        0.58081395809576453, 0.57956455913940597, 0.5783137964116557, 0.57706167285567944,
+        0.57580819141784545, 0.57455335504771587, 0.57329716669804209, 0.57203962932475727,
+        0.57078074588696726, 0.56952051934694747, 0.56825895267013171, 0.56699604882510868,
+        0.56573181078361345, 0.5644662415205195, 0.56319934401383409, 0.56193112124468958,
+        0.56066157619733614, 0.55939071185913603, 0.55811853122055632, 0.5568450372751601,
+        0.55557023301960218, 0.55429412145362023, 0.55301670558002758, 0.55173798840470767,
+        0.55045797293660492, 0.54917666218771966, 0.54789405917310041, 0.54661016691083497,
+        0.54532498842204635, 0.54403852673088404, 0.54275078486451589, 0.54146176585312333,
+        0.54017147272989297, 0.53887990853100842, 0.53758707629564573, 0.53629297906596329,
+        0.53499761988709715, 0.53370100180715319, 0.53240312787719801, 0.53110400115125489,
+        0.52980362468629483, 0.52850200154222848, 0.52719913478190128, 0.52589502747108485,
+        0.52458968267846895, 0.52328310347565665, 0.5219752929371545, 0.52066625414036716,
+        0.51935599016558975, 0.51804450409599945, 0.51673179901764976, 0.51541787801946315,
+        0.51410274419322177, 0.51278640063356296, 0.51146885043797052, 0.51015009670676681,
+        0.50883014254310732, 0.50750899105297098, 0.50618664534515523, 0.5048631085312677,
+        0.50353838372571769, 0.50221247404571068, 0.50088538261124094, 0.49955711254508195,
+        0.49822766697278176, 0.49689704902265469, 0.49556526182577254, 0.49423230851596001,
+        0.49289819222978415, 0.4915629161065499, 0.49022648328829138, 0.48888889691976328,
+        0.48755016014843588, 0.48621027612448658, 0.48486924800079112, 0.48352707893291863,
+        0.48218377207912289, 0.48083933060033396, 0.47949375766015329, 0.47814705642484318,
+        0.47679923006332209, 0.47545028174715609, 0.47410021465055008, 0.47274903195034274,
+        0.47139673682599786, 0.47004333245959568, 0.46868882203582785, 0.46733320874198858,
+        0.46597649576796618, 0.46461868630623809, 0.46325978355186032, 0.46189979070246273,
+        0.46053871095824023, 0.4591765475219442, 0.45781330359887717, 0.45644898239688414,
+        0.45508358712634389, 0.45371712100016376, 0.45234958723377106, 0.45098098904510386,
+        0.44961132965460687, 0.44824061228522005, 0.44686884016237416, 0.44549601651398196,
+        0.44412214457042931, 0.44274722756456997, 0.44137126873171689, 0.43999427130963331,
+        0.43861623853852755, 0.43723717366104425, 0.43585707992225553, 0.43447596056965598,
+        0.43309381885315207, 0.43171065802505726, 0.43032648134008289, 0.4289412920553296,
+        0.42755509343028203, 0.42616788872679984, 0.42477968120910886, 0.42339047414379594,
+        0.42200027079979985, 0.42060907444840256, 0.41921688836322424, 0.41782371582021244,
+        0.41642956009763715, 0.41503442447608185, 0.41363831223843461, 0.41224122666988283,
+        0.41084317105790413, 0.40944414869225765, 0.40804416286497858, 0.4066432168703692,
+        0.40524131400498992, 0.40383845756765441, 0.4024346508594186, 0.40102989718357562,
+        0.39962419984564707, 0.39821756215337367, 0.39680998741671025, 0.39540147894781652,
+        0.39399204006104815, 0.39258167407295141, 0.39117038430225404, 0.38975817406985647,
+        0.38834504669882658, 0.38693100551438875, 0.38551605384391885, 0.38410019501693532,
+        0.38268343236508989, 0.38126576922216232, 0.37984720892405138, 0.37842775480876567,
+        0.37700741021641815, 0.37558617848921738, 0.37416406297145804, 0.37274106700951609,
+        0.37131719395183771, 0.3698924471489341, 0.3684668299533726, 0.36704034571976729,
+        0.3656129978047738, 0.36418478956708011, 0.36275572436739728, 0.36132580556845417,
+        0.35989503653498833, 0.3584634206337366, 0.35703096123343031, 0.35559766170478402,
+        0.3541635254204904, 0.35272855575521095, 0.3512927560855672, 0.34985612979013486,
+        0.34841868024943479, 0.34698041084592374, 0.34554132496398898, 0.34410142598993904,
+        0.34266071731199443, 0.34121920232028269, 0.33977688440682702, 0.33833376696554118,
+        0.33688985339222033, 0.33544514708453171, 0.33399965144200938, 0.33255336986604445,
+        0.33110630575987648, 0.32965846252858744, 0.32820984357909272, 0.32676045232013184,
+        0.32531029216226326, 0.32385936651785302, 0.32240767880106985, 0.32095523242787549,
+        0.3195020308160158, 0.31804807738501489, 0.31659337555616607, 0.3151379287525225,
+        0.31368174039889141, 0.31222481392182511, 0.31076715274961153, 0.309308760312269,
+        0.30784964004153503, 0.30638979537086092, 0.30492922973540265, 0.30346794657201143,
+        0.30200594931922803, 0.30054324141727368, 0.29907982630804053, 0.29761570743508614,
+        0.29615088824362401, 0.29468537218051438, 0.29321916269425896, 0.29175226323498943,
+        0.29028467725446239, 0.28881640820604976, 0.28734745954472962, 0.28587783472708056,
+        0.2844075372112721, 0.28293657045705545, 0.28146493792575789, 0.27999264308027344,
+        0.27851968938505317, 0.27704608030610023, 0.27557181931095831, 0.27409690986870638,
+        0.27262135544994925, 0.27114515952680812, 0.26966832557291509, 0.2681908570634034,
+        0.26671275747489848, 0.26523403028551173, 0.26375467897483157, 0.2622747070239137,
+        0.26079411791527585, 0.2593129151328864, 0.25783110216215899, 0.25634868248994319,
+        0.25486565960451468, 0.2533820369955701, 0.25189781815421719, 0.25041300657296534,
+        0.24892760574572009, 0.24744161916777349, 0.24595505033579465, 0.24446790274782448,
+        0.24298017990326407, 0.24149188530286936, 0.24000302244874178, 0.23851359484431855,
+        0.23702360599436717, 0.23553305940497574, 0.23404195858354351, 0.23255030703877516,
+        0.23105810828067133, 0.22956536582051892, 0.22807208317088606, 0.22657826384561017,
+        0.22508391135979283, 0.22358902922979029, 0.22209362097320365, 0.22059769010887351,
+        0.21910124015687005, 0.21760427463848372, 0.21610679707621944, 0.21460881099378698,
+        0.21311031991609142, 0.21161132736922789, 0.2101118368804698, 0.20861185197826351,
+        0.20711137619221884, 0.20561041305309938, 0.20410896609281684, 0.20260703884442138,
+        0.20110463484209201, 0.19960175762113092, 0.19809841071795381, 0.19659459767008028,
+        0.19509032201612861, 0.1935855872958038, 0.19208039704989247, 0.19057475482025307,
+        0.18906866414980636, 0.18756212858252957, 0.18605515166344691, 0.1845477369386197,
+        0.1830398879551409, 0.18153160826112522, 0.18002290140569957, 0.17851377093899742,
+        0.17700422041214894, 0.17549425337727145, 0.17398387338746413, 0.17247308399679612,
+        0.17096188876030122, 0.16945029123396821, 0.16793829497473128, 0.16642590354046405,
+        0.16491312048997014, 0.16339994938297328, 0.16188639378011174, 0.16037245724292845,
+        0.15885814333386147, 0.15734345561623855, 0.15582839765426537, 0.15431297301302008,
+        0.15279718525844369, 0.15128103795733031, 0.14976453467732145, 0.14824767898689625,
+        0.1467304744553618, 0.14521292465284735, 0.14369503315029464, 0.14217680351944809,
+        0.14065823933284954, 0.13913934416382634, 0.13762012158648604, 0.13610057517570648,
+        0.13458070850712628, 0.13306052515713901, 0.13154002870288334, 0.13001922272223343,
+        0.12849811079379309, 0.12697669649688606, 0.12545498341154626, 0.12393297511851248,
+        0.12241067519921635, 0.12088808723577706, 0.11936521481099163, 0.11784206150832509,
+        0.11631863091190471, 0.11479492660651031, 0.11327095217756442, 0.1117467112111265,
+        0.11022220729388324, 0.10869744401313874, 0.10717242495680916, 0.10564715371341075,
+        0.10412163387205457, 0.10259586902243656, 0.10106986275482793, 0.099543618660069277,
+        0.098017140329560826, 0.096490431355252662, 0.094963495329638908, 0.093436335845747967,
+        0.091908956497132752, 0.090381360877865288, 0.088853552582524753, 0.087325535206192059,
+        0.085797312344440158, 0.084268887593324182, 0.082740264549375636, 0.081211446809592663,
+        0.079682437971430195, 0.078153241632794149, 0.076623861392031686, 0.075094300847921347,
+        0.073564563599667732, 0.072034653246889471, 0.070504573389613856, 0.068974327628267024,
+        0.067443919563664176, 0.065913352797003763, 0.064382630929857701, 0.06285175756416149,
+        0.061320736302208488, 0.059789570746640069, 0.058258264500435794, 0.056726821166908067,
+        0.055195244349690094, 0.05366353765273052, 0.052131704680283594, 0.050599749036899393,
+        0.049067674327417966, 0.047535484156959538, 0.046003182130914706, 0.044470771854938584,
+        0.042938256934941021, 0.041405640977076774, 0.03987292758774013, 0.038340120373552854,
+        0.036807222941358832, 0.035274238898214232, 0.033741171851377705, 0.032208025408304544,
+        0.030674803176636865, 0.029141508764193802, 0.02760814577896566, 0.026074717829104099,
+        0.024541228522912326, 0.023007681468839695, 0.021474080275469667, 0.019940428551514438,
+        0.018406729905805101, 0.016872987947281835, 0.01533920628498806, 0.013805388528060632,
+        0.012271538285720007, 0.010737659167264411, 0.0092037547820600207, 0.0076698287395311378,
+        0.0061358846491547988, 0.0046019261204487327, 0.003067956762965977, 0.0015339801862850493,
+        1.2246467991473532e-16, -0.0015339801862848043, -0.0030679567629657324, -0.0046019261204484881,
+        -0.0061358846491545542, -0.0076698287395308932, -0.0092037547820597761, -0.010737659167264166,
+        -0.012271538285719762, -0.013805388528060387, -0.015339206284987816, -0.016872987947281589,
+        -0.018406729905804858, -0.019940428551514192, -0.021474080275469421, -0.023007681468839448,
+        -0.02454122852291208, -0.026074717829103856, -0.027608145778965414, -0.029141508764193556,
+        -0.030674803176636619, -0.032208025408304294, -0.033741171851377455, -0.035274238898213982,
+        -0.036807222941358582, -0.038340120373552611, -0.039872927587739887, -0.041405640977076531,
+        -0.042938256934940779, -0.044470771854938335, -0.046003182130914456, -0.047535484156959296,
+        -0.049067674327417724, -0.05059974903689915, -0.052131704680283351, -0.053663537652730277,
+        -0.055195244349689851, -0.056726821166907818, -0.058258264500435551, -0.059789570746639827,
+        -0.061320736302208245, -0.06285175756416124, -0.064382630929857451, -0.065913352797003527,
+        -0.067443919563663926, -0.068974327628266774, -0.070504573389613606, -0.072034653246889235,
+        -0.073564563599667496, -0.075094300847921097, -0.076623861392031437, -0.078153241632793899,
+        -0.079682437971429945, -0.081211446809592427, -0.0827402645493754, -0.084268887593323932,
+        -0.085797312344439922, -0.087325535206191809, -0.088853552582524503, -0.090381360877865052,
+        -0.091908956497132516, -0.093436335845747731, -0.094963495329638659, -0.096490431355252412,
+        -0.09801714032956059, -0.099543618660069041, -0.10106986275482768, -0.10259586902243631,
+        -0.10412163387205432, -0.10564715371341052, -0.10717242495680891, -0.10869744401313849,
+        -0.110222207293883, -0.11174671121112625, -0.11327095217756417, -0.11479492660651007,
+        -0.11631863091190447, -0.11784206150832484, -0.11936521481099138, -0.12088808723577682,
+        -0.1224106751992161, -0.12393297511851223, -0.12545498341154601, -0.12697669649688581,
+        -0.12849811079379284, -0.13001922272223318, -0.13154002870288309, -0.13306052515713876,
+        -0.13458070850712606, -0.13610057517570623, -0.13762012158648579, -0.13913934416382612,
+        -0.14065823933284929, -0.14217680351944784, -0.14369503315029439, -0.14521292465284713,
+        -0.14673047445536158, -0.14824767898689603, -0.1497645346773212, -0.15128103795733008,
+        -0.15279718525844344, -0.15431297301301983, -0.15582839765426512, -0.1573434556162383,
+        -0.15885814333386122, -0.1603724572429282, -0.16188639378011149, -0.16339994938297306,
+        -0.16491312048996989, -0.16642590354046383, -0.16793829497473103, -0.16945029123396799,
+        -0.17096188876030097, -0.17247308399679587, -0.17398387338746388, -0.1754942533772712,
+        -0.17700422041214869, -0.17851377093899717, -0.18002290140569935, -0.18153160826112497,
+        -0.18303988795514065, -0.18454773693861948, -0.18605515166344666, -0.18756212858252932,
+        -0.18906866414980611, -0.19057475482025282, -0.19208039704989222, -0.19358558729580355,
+        -0.19509032201612836, -0.19659459767008003, -0.19809841071795356, -0.19960175762113067,
+        -0.20110463484209176, -0.20260703884442113, -0.20410896609281662, -0.20561041305309916,
+        -0.20711137619221859, -0.20861185197826326, -0.21011183688046955, -0.21161132736922766,
+        -0.2131103199160912, -0.21460881099378673, -0.21610679707621921, -0.21760427463848347,
+        -0.2191012401568698, -0.22059769010887326, -0.22209362097320343, -0.22358902922979004,
+        -0.22508391135979261, -0.22657826384560992, -0.22807208317088581, -0.2295653658205187,
+        -0.23105810828067108, -0.23255030703877494, -0.23404195858354326, -0.23553305940497551,
+        -0.23702360599436695, -0.23851359484431833, -0.24000302244874153, -0.24149188530286911,
+        -0.24298017990326382, -0.24446790274782426, -0.24595505033579443, -0.24744161916777327,
+        -0.24892760574571987, -0.25041300657296511, -0.25189781815421697, -0.25338203699556988,
+        -0.25486565960451446, -0.25634868248994291, -0.25783110216215877, -0.25931291513288618,
+        -0.26079411791527563, -0.26227470702391342, -0.26375467897483135, -0.26523403028551151,
+        -0.26671275747489825, -0.26819085706340318, -0.26966832557291481, -0.2711451595268079,
+        -0.27262135544994903, -0.27409690986870616, -0.27557181931095809, -0.27704608030610001,
+        -0.27851968938505289, -0.27999264308027322, -0.28146493792575766, -0.28293657045705517,
+        -0.28440753721127182, -0.28587783472708034, -0.2873474595447294, -0.28881640820604954,
+        -0.29028467725446211, -0.29175226323498921, -0.29321916269425874, -0.29468537218051416,
+        -0.29615088824362379, -0.29761570743508592, -0.29907982630804031, -0.30054324141727345,
+        -0.30200594931922781, -0.3034679465720112, -0.30492922973540243, -0.3063897953708607,
+        -0.30784964004153481, -0.30930876031226878, -0.31076715274961131, -0.31222481392182488,
+        -0.31368174039889118, -0.31513792875252222, -0.31659337555616585, -0.31804807738501467,
+        -0.31950203081601558, -0.32095523242787527, -0.32240767880106963, -0.3238593665178528,
+        -0.32531029216226298, -0.32676045232013157, -0.3282098435790925, -0.32965846252858721,
+        -0.33110630575987626, -0.33255336986604422, -0.3339996514420091, -0.33544514708453149,
+        -0.33688985339222011, -0.33833376696554091, -0.3397768844068268, -0.34121920232028247,
+        -0.34266071731199421, -0.34410142598993881, -0.34554132496398876, -0.34698041084592351,
+        -0.34841868024943456, -0.34985612979013464, -0.35129275608556698, -0.35272855575521073,
+        -0.35416352542049012, -0.3555976617047838, -0.35703096123343009, -0.35846342063373637,
+        -0.35989503653498811, -0.36132580556845395, -0.36275572436739706, -0.36418478956707989,
+        -0.36561299780477358, -0.36704034571976707, -0.36846682995337238, -0.36989244714893388,
+        -0.37131719395183743, -0.37274106700951587, -0.37416406297145782, -0.37558617848921716,
+        -0.37700741021641793, -0.37842775480876539, -0.37984720892405116, -0.3812657692221621,
+        -0.38268343236508967, -0.3841001950169351, -0.38551605384391863, -0.38693100551438853,
+        -0.38834504669882636, -0.38975817406985624, -0.39117038430225382, -0.39258167407295119,
+        -0.39399204006104793, -0.3954014789478163, -0.39680998741671003, -0.39821756215337345,
+        -0.39962419984564684, -0.4010298971835754, -0.40243465085941837, -0.40383845756765419,
+        -0.40524131400498969, -0.40664321687036897, -0.40804416286497835, -0.40944414869225743,
+        -0.41084317105790391, -0.41224122666988261, -0.41363831223843439, -0.41503442447608163,
+        -0.41642956009763693, -0.41782371582021222, -0.41921688836322402, -0.42060907444840234,
+        -0.42200027079979963, -0.42339047414379571, -0.42477968120910864, -0.42616788872679962,
+        -0.42755509343028181, -0.42894129205532938, -0.43032648134008267, -0.43171065802505704,
+        -0.43309381885315185, -0.43447596056965576, -0.43585707992225531, -0.43723717366104403,
+        -0.43861623853852733, -0.43999427130963309, -0.44137126873171667, -0.44274722756456975,
+        -0.44412214457042909, -0.44549601651398174, -0.44686884016237394, -0.44824061228521983,
+        -0.44961132965460665, -0.45098098904510364, -0.45234958723377083, -0.45371712100016354,
+        -0.45508358712634367, -0.45644898239688392, -0.45781330359887695, -0.45917654752194398,
+        -0.46053871095824006, -0.46189979070246251, -0.46325978355186009, -0.46461868630623787,
+        -0.46597649576796596, -0.46733320874198836, -0.46868882203582762, -0.47004333245959545,
+        -0.47139673682599764, -0.47274903195034251, -0.47410021465054986, -0.47545028174715592,
+        -0.47679923006332187, -0.47814705642484295, -0.47949375766015306, -0.48083933060033374,
+        -0.48218377207912266, -0.48352707893291841, -0.48486924800079095, -0.48621027612448636,
+        -0.48755016014843566, -0.48888889691976306, -0.49022648328829116, -0.49156291610654973,
+        -0.49289819222978393, -0.49423230851595978, -0.49556526182577232, -0.49689704902265447,
+        -0.49822766697278154, -0.49955711254508173, -0.50088538261124071, -0.50221247404571057,
+        -0.50353838372571746, -0.50486310853126759, -0.50618664534515501, -0.50750899105297076,
+        -0.5088301425431071, -0.51015009670676659, -0.5114688504379703, -0.51278640063356273,
+        -0.51410274419322155, -0.51541787801946293, -0.51673179901764965, -0.51804450409599923,
+        -0.51935599016558964, -0.52066625414036694, -0.52197529293715428, -0.52328310347565643,
+        -0.52458968267846873, -0.52589502747108463, -0.52719913478190106, -0.52850200154222826,
+        -0.52980362468629461, -0.53110400115125467, -0.53240312787719779, -0.53370100180715296,
+        -0.53499761988709693, -0.53629297906596307, -0.53758707629564551, -0.5388799085310082,
+        -0.54017147272989285, -0.54146176585312322, -0.54275078486451578, -0.54403852673088382,
+        -0.54532498842204613, -0.54661016691083475, -0.54789405917310019, -0.54917666218771954,
+        -0.5504579729366047, -0.55173798840470745, -0.55301670558002736, -0.55429412145362,
+        -0.55557023301960196, -0.55684503727515988, -0.5581185312205561, -0.5593907118591358,
+        -0.56066157619733592, -0.56193112124468936, -0.56319934401383387, -0.56446624152051939,
+        -0.56573181078361323, -0.56699604882510846, -0.56825895267013149, -0.56952051934694725,
+        -0.57078074588696714, -0.57203962932475705, -0.57329716669804198, -0.57455335504771565,
+        -0.57580819141784534, -0.57706167285567933, -0.57831379641165548, -0.57956455913940574,
+        -0.5808139580957643, -0.58206199034077544, -0.5833086529376984, -0.5845539429530151,
+        -0.58579785745643886, -0.58704039352091775, -0.58828154822264511, -0.58952131864106394,
+        -0.59075970185887394, -0.59199669496204088, -0.5932322950397998, -0.59446649918466421,
+        -0.59569930449243325, -0.5969307080621965, -0.59816070699634216, -0.59938929840056454,
+        -0.60061647938386864, -0.60184224705857992, -0.60306659854034816, -0.60428953094815585,
+        -0.60551104140432543, -0.60673112703452448, -0.60794978496777341, -0.6091670123364531,
+        -0.61038280627630948, -0.6115971639264618, -0.61281008242940971, -0.61402155893103816,
+        -0.61523159058062671, -0.61644017453085365, -0.61764730793780365, -0.61885298796097621,
+        -0.62005721176328921, -0.62125997651108744, -0.62246127937414986, -0.62366111752569464,
+        -0.62485948814238623, -0.62605638840434352, -0.62725181549514386, -0.6284457666018326,
+        -0.62963823891492698, -0.63082922962842425, -0.63201873593980895, -0.6332067550500573,
+        -0.63439328416364527, -0.63557832048855611, -0.63676186123628431, -0.63794390362184394,
+        -0.63912444486377573, -0.64030348218415145, -0.64148101280858305, -0.64265703396622686,
+        -0.64383154288979128, -0.64500453681554382, -0.64617601298331639, -0.64734596863651184,
+        -0.64851440102211233, -0.64968130739068319, -0.65084668499638076, -0.6520105310969595,
+        -0.65317284295377653, -0.65433361783180033, -0.65549285299961535, -0.65665054572942883,
+        -0.65780669329707853, -0.65896129298203732, -0.66011434206742026, -0.66126583783999215,
+        -0.66241577759017178, -0.66356415861203966, -0.66471097820334479, -0.66585623366550939,
+        -0.66699992230363736, -0.66814204142651845, -0.66928258834663579, -0.67042156038017298,
+        -0.67155895484701844, -0.67269476907077275, -0.67382900037875593, -0.67496164610201204,
+        -0.67609270357531581, -0.67722217013718033, -0.67835004312986125, -0.67947631989936486,
+        -0.68060099779545302, -0.6817240741716496, -0.68284554638524797, -0.6839654117973154,
+        -0.68508366777270013, -0.68620031168003848, -0.68731534089175916, -0.68842875278409033,
+        -0.68954054473706683, -0.69065071413453438, -0.69175925836415764, -0.69286617481742463,
+        -0.69397146088965378, -0.69507511398000077, -0.69617713149146299, -0.6972775108308864,
+        -0.6983762494089728, -0.69947334464028388, -0.70056879394324822, -0.70166259474016845,
+        -0.70275474445722508, -0.70384524052448483, -0.70493408037590488, -0.70602126144933952,
+        -0.70710678118654746, -0.70819063703319529, -0.70927282643886547, -0.71035334685706231,
+        -0.71143219574521643, -0.71250937056469221, -0.71358486878079352, -0.71465868786276876,
+        -0.71573082528381848, -0.71680127852109954, -0.71787004505573149, -0.71893712237280438,
+        -0.72000250796138165, -0.72106619931450788, -0.72212819392921523, -0.72318848930652746,
+        -0.72424708295146678, -0.72530397237306066, -0.72635915508434568, -0.72741262860237565,
+        -0.7284643904482252, -0.72951443814699679, -0.73056276922782748, -0.73160938122389252,
+        -0.73265427167241259, -0.73369743811466015, -0.7347388780959635, -0.73577858916571337,
+        -0.73681656887736979, -0.73785281478846576, -0.738887324460615, -0.73992009545951609,
+        -0.74095112535495888, -0.74198041172083096, -0.74300795213512172, -0.74403374417992907,
+        -0.74505778544146584, -0.74608007351006378, -0.74710060598018002, -0.74811938045040349,
+        -0.74913639452345904, -0.75015164580621496, -0.75116513190968637, -0.75217685044904248,
+        -0.75318679904361241, -0.75419497531688917, -0.75520137689653632, -0.75620600141439442,
+        -0.75720884650648423, -0.75820990981301517, -0.75920918897838796, -0.76020668165120242,
+        -0.761202385484262, -0.76219629813457856, -0.76318841726338105, -0.76417874053611656,
+        -0.76516726562245896, -0.76615399019631303, -0.76713891193582007, -0.76812202852336509,
+        -0.76910333764557948, -0.7700828369933479, -0.77106052426181382, -0.77203639715038463,
+        -0.77301045336273666, -0.77398269060682257, -0.77495310659487382, -0.77592169904340758,
+        -0.77688846567323255, -0.7778534042094527, -0.77881651238147565, -0.77977778792301433,
+        -0.78073722857209438, -0.7816948320710595, -0.78265059616657584, -0.78360451860963798,
+        -0.78455659715557502, -0.78550682956405382, -0.78645521359908577, -0.78740174702903143,
+        -0.78834642762660589, -0.78928925316888543, -0.79023022143730992, -0.79116933021769009,
+        -0.79210657730021239, -0.79304196047944386, -0.79397547755433684, -0.79490712632823679,
+        -0.79583690460888346, -0.79676481020841872, -0.79769084094339116, -0.79861499463476049,
+        -0.79953726910790479, -0.8004576621926226, -0.80137617172314013, -0.80229279553811572,
+        -0.80320753148064505, -0.80412037739826547, -0.80503133114296344, -0.80594039057117617,
+        -0.80684755354379922, -0.80775281792619047, -0.80865618158817465, -0.80955764240405104,
+        -0.81045719825259466, -0.81135484701706373, -0.81225058658520399, -0.8131444148492537,
+        -0.81403632970594808, -0.8149263290565264, -0.81581441080673367, -0.81670057286682773,
+        -0.81758481315158382, -0.81846712958029832, -0.81934752007679668, -0.82022598256943446,
+        -0.82110251499110465, -0.82197711527924155, -0.82284978137582643, -0.82372051122739109,
+        -0.82458930278502507, -0.82545615400437744, -0.82632106284566342, -0.82718402727366924,
+        -0.82804504525775546, -0.82890411477186465, -0.82976123379452293, -0.8306164003088462,
+        -0.83146961230254524, -0.8323208677679298, -0.83317016470191285, -0.83401750110601791,
+        -0.83486287498638001, -0.8357062843537526, -0.83654772722351212, -0.8373872016156616,
+        -0.83822470555483786, -0.83906023707031252, -0.83989379419599941, -0.84072537497045807,
+        -0.84155497743689855, -0.84238259964318563, -0.84320823964184521, -0.8440318954900663,
+        -0.84485356524970701, -0.84567324698729918, -0.84649093877405179, -0.84730663868585809,
+        -0.84812034480329712, -0.84893205521163961, -0.84974176800085255, -0.85054948126560359,
+        -0.85135519310526486, -0.85215890162391961, -0.85296060493036352, -0.85376030113811141,
+        -0.85455798836540064, -0.8553536647351957, -0.85614732837519425, -0.85693897741782854,
+        -0.85772861000027201, -0.85851622426444285, -0.85930181835700847, -0.86008539042938992,
+        -0.86086693863776709, -0.86164646114308119, -0.8624239561110405, -0.86319942171212427,
+        -0.86397285612158647, -0.86474425751946216, -0.86551362409056898, -0.86628095402451288,
+        -0.86704624551569265, -0.86780949676330332, -0.86857070597134067, -0.86932987134860662,
+        -0.87008699110871135, -0.87084206347007886, -0.87159508665595109, -0.87234605889439121,
+        -0.87309497841828987, -0.87384184346536675, -0.87458665227817611, -0.87532940310411089,
+        -0.87607009419540671, -0.87680872380914543, -0.87754529020726113, -0.87827979165654146,
+        -0.87901222642863341, -0.87974259280004752, -0.88047088905216053, -0.88119711347122187,
+        -0.88192126434835494, -0.88264333997956268, -0.88336333866573158, -0.8840812587126351,
+        -0.88479709843093757, -0.88551085613619973, -0.88622253014888053, -0.88693211879434219,
+        -0.88763962040285405, -0.88834503330959602, -0.88904835585466435, -0.88974958638307267,
+        -0.89044872324475788, -0.89114576479458329, -0.89184070939234283, -0.89253355540276436,
+        -0.89322430119551521, -0.89391294514520314, -0.8945994856313827, -0.89528392103855758,
+        -0.89596624975618488, -0.89664647017868004, -0.89732458070541821, -0.89800057974073977,
+        -0.89867446569395382, -0.89934623697934168, -0.90001589201615995, -0.90068342922864675,
+        -0.90134884704602192, -0.90201214390249318, -0.90267331823725883, -0.9033323684945116,
+        -0.90398929312344312, -0.90464409057824613, -0.9052967593181187, -0.90594729780726846,
+        -0.90659570451491545, -0.90724197791529559, -0.90788611648766604, -0.90852811871630601,
+        -0.90916798309052238, -0.90980570810465233, -0.91044129225806691, -0.91107473405517614,
+        -0.91170603200542977, -0.91233518462332275, -0.91296219042839821, -0.91358704794525092,
+        -0.91420975570353047, -0.91483031223794598, -0.91544871608826772, -0.91606496579933172,
+        -0.9166790599210427, -0.91729099700837768, -0.91790077562139027, -0.91850839432521214,
+        -0.91911385169005766, -0.91971714629122736, -0.92031827670911059, -0.9209172415291893,
+        -0.92151403934204179, -0.92210866874334507, -0.92270112833387852, -0.92329141671952764,
+        -0.92387953251128652, -0.92446547432526249, -0.92504924078267747, -0.92563083050987272,
+        -0.92621024213831138, -0.92678747430458186, -0.92736252565040089, -0.92793539482261767,
+        -0.92850608047321548, -0.92907458125931575, -0.92964089584318133, -0.93020502289221918,
+        -0.9307669610789836, -0.93132670908118032, -0.93188426558166804, -0.93243962926846236,
+        -0.93299279883473896, -0.93354377297883595, -0.93409255040425876, -0.93463912981968067,
+        -0.93518350993894761, -0.93572568948108037, -0.93626566717027837, -0.93680344173592145,
+        -0.93733901191257485, -0.93787237643998977, -0.93840353406310817, -0.9389324835320646,
+        -0.9394592236021897, -0.93998375303401382, -0.9405060705932683, -0.94102617505088926,
+        -0.94154406518302081, -0.94205973977101742, -0.94257319760144676, -0.94308443746609338,
+        -0.94359345816196027, -0.94410025849127266, -0.94460483726148037, -0.94510719328526038,
+        -0.94560732538052117, -0.94610523237040334, -0.94660091308328353, -0.94709436635277722,
+        -0.9475855910177412, -0.94807458592227611, -0.94856134991573016, -0.94904588185270056,
+        -0.94952818059303667, -0.95000824500184311, -0.95048607394948159, -0.95096166631157497,
+        -0.95143502096900834, -0.95190613680793235, -0.95237501271976588, -0.95284164760119872,
+        -0.95330604035419375, -0.95376818988599021, -0.95422809510910556, -0.95468575494133834,
+        -0.95514116830577078, -0.95559433413077088, -0.95604525134999629, -0.95649391890239499,
+        -0.95694033573220882, -0.95738450078897597, -0.95782641302753302, -0.95826607140801756,
+        -0.95870347489587149, -0.95913862246184189, -0.95957151308198452, -0.96000214573766596,
+        -0.96043051941556568, -0.96085663310767955, -0.96128048581132053, -0.96170207652912254,
+        -0.96212140426904158, -0.96253846804435927, -0.96295326687368377, -0.96336579978095394,
+        -0.96377606579543984, -0.96418406395174583, -0.96458979328981276, -0.96499325285492021,
+        -0.96539444169768929, -0.96579335887408357, -0.9661900034454125, -0.96658437447833312,
+        -0.96697647104485218, -0.96736629222232839, -0.9677538370934754, -0.96813910474636233,
+        -0.96852209427441727, -0.96890280477642887, -0.96928123535654831, -0.96965738512429234,
+        -0.97003125319454397, -0.9704028386875555, -0.97077214072895035, -0.9711391584497252,
+        -0.97150389098625167, -0.97186633748027929, -0.97222649707893627, -0.97258436893473221,
+        -0.97293995220556018, -0.97329324605469814, -0.97364424965081187, -0.97399296216795583,
+        -0.97433938278557586, -0.97468351068851067, -0.97502534506699423, -0.97536488511665687,
+        -0.97570213003852846, -0.97603707903903902, -0.97636973133002114, -0.97670008612871184,
+        -0.97702814265775428, -0.97735390014519996, -0.97767735782450993, -0.97799851493455703,
+        -0.97831737071962765, -0.97863392442942321, -0.97894817531906209, -0.97926012264908202,
+        -0.97956976568544052, -0.97987710369951764, -0.98018213596811743, -0.98048486177346927,
+        -0.98078528040323032, -0.98108339115048659, -0.98137919331375456, -0.98167268619698311,
+        -0.98196386910955535, -0.98225274136628937, -0.98253930228744124, -0.98282355119870524,
+        -0.98310548743121629, -0.98338511032155129, -0.98366241921173014, -0.98393741344921881,
+        -0.98421009238692903, -0.98448045538322093, -0.98474850180190421, -0.98501423101223984,
+        -0.98527764238894111, -0.98553873531217606, -0.98579750916756737, -0.98605396334619544,
+        -0.98630809724459867, -0.98655991026477541, -0.98680940181418542, -0.98705657130575097,
+        -0.98730141815785832, -0.98754394179435934, -0.98778414164457218, -0.98802201714328353,
+        -0.98825756773074946, -0.98849079285269659, -0.98872169196032378, -0.98895026451030299,
+        -0.9891765099647809, -0.98940042779138027, -0.98962201746320078, -0.98984127845882053,
+        -0.99005821026229712, -0.99027281236316911, -0.99048508425645698, -0.99069502544266463,
+        -0.99090263542778001, -0.99110791372327689, -0.99131085984611544, -0.9915114733187439,
+        -0.99170975366909953, -0.99190570043060933, -0.9920993131421918, -0.99229059134825737,
+        -0.99247953459871008, -0.99266614244894791, -0.9928504144598651, -0.99303235019785141,
+        -0.9932119492347945, -0.99338921114808065, -0.9935641355205953, -0.9937367219407246,
+        -0.99390697000235606, -0.99407487930487937, -0.9942404494531879, -0.9944036800576791,
+        -0.99456457073425542, -0.9947231211043257, -0.99487933079480562, -0.99503319943811863,
+        -0.99518472667219693, -0.99533391214048217, -0.99548075549192694, -0.99562525638099431,
+        -0.99576741446765982, -0.99590722941741172, -0.99604470090125197, -0.99617982859569687,
+        -0.996312612182778, -0.99644305135004263, -0.99657114579055484, -0.99669689520289606,
+        -0.99682029929116567, -0.99694135776498205, -0.99706007033948296, -0.99717643673532608,
+        -0.99729045667869021, -0.9974021299012753, -0.99751145614030345, -0.99761843513851955,
+        -0.99772306664419164, -0.99782535041111164, -0.997925286198596, -0.99802287377148613,
+        -0.99811811290014918, -0.99821100336047819, -0.99830154493389278, -0.99838973740734016,
+        -0.99847558057329477, -0.99855907422975931, -0.99864021818026516, -0.99871901223387294,
+        -0.99879545620517241, -0.99886954991428356, -0.99894129318685687, -0.99901068585407327,
+        -0.99907772775264536, -0.99914241872481691, -0.99920475861836389, -0.99926474728659442,
+        -0.99932238458834943, -0.99937767038800285, -0.99943060455546173, -0.99948118696616695,
+        -0.99952941750109314, -0.99957529604674922, -0.99961882249517864, -0.99965999674395922,
+        -0.99969881869620425, -0.99973528826056168, -0.99976940535121528, -0.99980116988788426,
+        -0.9998305817958234, -0.99985764100582386, -0.99988234745421256, -0.9999047010828529,
+        -0.9999247018391445, -0.99994234967602391, -0.9999576445519639, -0.99997058643097414,
+        -0.99998117528260111, -0.9999894110819284, -0.99999529380957619, -0.99999882345170188,
+        -1, -0.99999882345170188, -0.99999529380957619, -0.9999894110819284,
+        -0.99998117528260111, -0.99997058643097414, -0.9999576445519639, -0.99994234967602391,
+        -0.9999247018391445, -0.9999047010828529, -0.99988234745421256, -0.99985764100582386,
+        -0.9998305817958234, -0.99980116988788426, -0.99976940535121528, -0.99973528826056168,
+        -0.99969881869620425, -0.99965999674395922, -0.99961882249517864, -0.99957529604674922,
+        -0.99952941750109314, -0.99948118696616695, -0.99943060455546173, -0.99937767038800285,
+        -0.99932238458834954, -0.99926474728659453, -0.99920475861836389, -0.99914241872481691,
+        -0.99907772775264536, -0.99901068585407338, -0.99894129318685687, -0.99886954991428356,
+        -0.99879545620517241, -0.99871901223387294, -0.99864021818026527, -0.99855907422975931,
+        -0.99847558057329477, -0.99838973740734016, -0.99830154493389289, -0.99821100336047819,
+        -0.99811811290014918, -0.99802287377148624, -0.997925286198596, -0.99782535041111164,
+        -0.99772306664419164, -0.99761843513851955, -0.99751145614030345, -0.9974021299012753,
+        -0.99729045667869021, -0.99717643673532619, -0.99706007033948296, -0.99694135776498216,
+        -0.99682029929116567, -0.99669689520289606, -0.99657114579055484, -0.99644305135004263,
+        -0.996312612182778, -0.99617982859569687, -0.99604470090125208, -0.99590722941741172,
+        -0.99576741446765982, -0.99562525638099431, -0.99548075549192694, -0.99533391214048228,
+        -0.99518472667219693, -0.99503319943811863, -0.99487933079480562, -0.9947231211043257,
+        -0.99456457073425542, -0.9944036800576791, -0.99424044945318801, -0.99407487930487948,
+        -0.99390697000235606, -0.9937367219407246, -0.9935641355205953, -0.99338921114808076,
+        -0.99321194923479461, -0.99303235019785141, -0.9928504144598651, -0.99266614244894802,
+        -0.99247953459871008, -0.99229059134825737, -0.9920993131421918, -0.99190570043060933,
+        -0.99170975366909953, -0.9915114733187439, -0.99131085984611544, -0.99110791372327689,
+        -0.99090263542778001, -0.99069502544266463, -0.99048508425645698, -0.99027281236316922,
+        -0.99005821026229712, -0.98984127845882053, -0.98962201746320089, -0.98940042779138038,
+        -0.9891765099647809, -0.9889502645103031, -0.98872169196032378, -0.9884907928526967,
+        -0.98825756773074946, -0.98802201714328353, -0.98778414164457229, -0.98754394179435934,
+        -0.98730141815785843, -0.98705657130575108, -0.98680940181418542, -0.98655991026477541,
+        -0.98630809724459878, -0.98605396334619555, -0.98579750916756748, -0.98553873531217606,
+        -0.98527764238894122, -0.98501423101223995, -0.98474850180190432, -0.98448045538322093,
+        -0.98421009238692914, -0.98393741344921892, -0.98366241921173025, -0.98338511032155129,
+        -0.9831054874312164, -0.98282355119870535, -0.98253930228744124, -0.98225274136628937,
+        -0.98196386910955535, -0.98167268619698322, -0.98137919331375467, -0.98108339115048671,
+        -0.98078528040323043, -0.98048486177346927, -0.98018213596811754, -0.97987710369951775,
+        -0.97956976568544063, -0.97926012264908202, -0.9789481753190622, -0.97863392442942332,
+        -0.97831737071962777, -0.97799851493455714, -0.97767735782451004, -0.97735390014519996,
+        -0.97702814265775428, -0.97670008612871195, -0.97636973133002125, -0.97603707903903913,
+        -0.97570213003852857, -0.97536488511665698, -0.97502534506699423, -0.97468351068851078,
+        -0.97433938278557597, -0.97399296216795594, -0.97364424965081187, -0.97329324605469814,
+        -0.97293995220556029, -0.97258436893473232, -0.97222649707893638, -0.9718663374802794,
+        -0.97150389098625178, -0.97113915844972531, -0.97077214072895046, -0.9704028386875555,
+        -0.97003125319454397, -0.96965738512429245, -0.96928123535654842, -0.96890280477642898,
+        -0.96852209427441738, -0.96813910474636244, -0.96775383709347551, -0.96736629222232851,
+        -0.96697647104485229, -0.96658437447833323, -0.96619000344541262, -0.96579335887408368,
+        -0.9653944416976894, -0.96499325285492032, -0.96458979328981287, -0.96418406395174594,
+        -0.96377606579543995, -0.96336579978095405, -0.96295326687368388, -0.96253846804435939,
+        -0.96212140426904169, -0.96170207652912265, -0.96128048581132064, -0.96085663310767966,
+        -0.96043051941556579, -0.96000214573766607, -0.95957151308198463, -0.95913862246184201,
+        -0.9587034748958716, -0.95826607140801767, -0.95782641302753302, -0.95738450078897608,
+        -0.95694033573220894, -0.9564939189023951, -0.95604525134999641, -0.95559433413077099,
+        -0.95514116830577089, -0.95468575494133845, -0.95422809510910567, -0.95376818988599033,
+        -0.95330604035419386, -0.95284164760119883, -0.95237501271976599, -0.95190613680793246,
+        -0.95143502096900845, -0.95096166631157508, -0.9504860739494817, -0.95000824500184322,
+        -0.94952818059303679, -0.94904588185270067, -0.94856134991573027, -0.94807458592227623,
+        -0.94758559101774131, -0.94709436635277733, -0.94660091308328365, -0.94610523237040345,
+        -0.94560732538052128, -0.94510719328526049, -0.94460483726148048, -0.94410025849127277,
+        -0.94359345816196039, -0.94308443746609349, -0.94257319760144687, -0.94205973977101753,
+        -0.94154406518302092, -0.94102617505088937, -0.94050607059326841, -0.93998375303401394,
+        -0.93945922360218981, -0.93893248353206471, -0.93840353406310828, -0.93787237643998989,
+        -0.93733901191257496, -0.93680344173592156, -0.93626566717027848, -0.93572568948108048,
+        -0.93518350993894772, -0.93463912981968078, -0.93409255040425887, -0.93354377297883617,
+        -0.93299279883473907, -0.93243962926846258, -0.93188426558166815, -0.93132670908118054,
+        -0.93076696107898371, -0.93020502289221929, -0.92964089584318144, -0.92907458125931597,
+        -0.92850608047321559, -0.92793539482261789, -0.927362525650401, -0.92678747430458197,
+        -0.92621024213831149, -0.92563083050987283, -0.92504924078267758, -0.9244654743252626,
+        -0.92387953251128663, -0.92329141671952786, -0.92270112833387874, -0.92210866874334518,
+        -0.9215140393420419, -0.92091724152918941, -0.92031827670911082, -0.91971714629122747,
+        -0.91911385169005788, -0.91850839432521225, -0.91790077562139039, -0.9172909970083778,
+        -0.91667905992104282, -0.91606496579933183, -0.91544871608826783, -0.9148303122379462,
+        -0.91420975570353058, -0.91358704794525103, -0.91296219042839832, -0.91233518462332286,
+        -0.91170603200542988, -0.91107473405517625, -0.91044129225806714, -0.90980570810465244,
+        -0.90916798309052249, -0.90852811871630623, -0.90788611648766626, -0.90724197791529582,
+        -0.90659570451491556, -0.90594729780726868, -0.90529675931811893, -0.90464409057824624,
+        -0.90398929312344334, -0.90333236849451171, -0.90267331823725905, -0.90201214390249329,
+        -0.90134884704602214, -0.90068342922864686, -0.90001589201616017, -0.8993462369793418,
+        -0.89867446569395404, -0.89800057974073999, -0.89732458070541832, -0.89664647017868015,
+        -0.895966249756185, -0.8952839210385577, -0.89459948563138281, -0.89391294514520336,
+        -0.89322430119551532, -0.89253355540276458, -0.89184070939234295, -0.89114576479458341,
+        -0.89044872324475799, -0.88974958638307289, -0.88904835585466457, -0.88834503330959624,
+        -0.88763962040285416, -0.88693211879434231, -0.88622253014888075, -0.88551085613619995,
+        -0.88479709843093768, -0.88408125871263532, -0.8833633386657318, -0.8826433399795629,
+        -0.88192126434835505, -0.88119711347122198, -0.88047088905216064, -0.87974259280004763,
+        -0.87901222642863364, -0.87827979165654158, -0.87754529020726135, -0.87680872380914565,
+        -0.87607009419540693, -0.875329403104111, -0.87458665227817622, -0.87384184346536686,
+        -0.87309497841829009, -0.87234605889439143, -0.87159508665595131, -0.87084206347007909,
+        -0.87008699110871146, -0.86932987134860673, -0.86857070597134078, -0.86780949676330355,
+        -0.86704624551569287, -0.86628095402451311, -0.86551362409056909, -0.86474425751946238,
+        -0.86397285612158659, -0.86319942171212438, -0.86242395611104072, -0.86164646114308141,
+        -0.86086693863776731, -0.86008539042939014, -0.8593018183570087, -0.85851622426444296,
+        -0.85772861000027223, -0.85693897741782876, -0.85614732837519447, -0.85535366473519592,
+        -0.85455798836540076, -0.85376030113811152, -0.85296060493036374, -0.85215890162391983,
+        -0.85135519310526508, -0.8505494812656037, -0.84974176800085266, -0.84893205521163972,
+        -0.84812034480329734, -0.84730663868585832, -0.84649093877405202, -0.84567324698729929,
+        -0.84485356524970723, -0.84403189549006652, -0.84320823964184544, -0.84238259964318585,
+        -0.84155497743689878, -0.84072537497045829, -0.83989379419599963, -0.83906023707031274,
+        -0.83822470555483797, -0.83738720161566182, -0.83654772722351223, -0.83570628435375272,
+        -0.83486287498638012, -0.83401750110601813, -0.83317016470191307, -0.83232086776793002,
+        -0.83146961230254546, -0.83061640030884643, -0.82976123379452316, -0.82890411477186487,
+        -0.82804504525775569, -0.82718402727366935, -0.82632106284566365, -0.82545615400437766,
+        -0.82458930278502529, -0.82372051122739132, -0.82284978137582665, -0.82197711527924178,
+        -0.82110251499110487, -0.82022598256943469, -0.8193475200767969, -0.81846712958029855,
+        -0.81758481315158404, -0.81670057286682796, -0.81581441080673389, -0.81492632905652662,
+        -0.8140363297059483, -0.81314441484925393, -0.81225058658520422, -0.81135484701706395,
+        -0.81045719825259488, -0.80955764240405126, -0.80865618158817487, -0.80775281792619069,
+        -0.80684755354379945, -0.80594039057117639, -0.80503133114296366, -0.8041203773982657,
+        -0.80320753148064528, -0.80229279553811594, -0.80137617172314035, -0.80045766219262282,
+        -0.79953726910790501, -0.79861499463476071, -0.79769084094339138, -0.79676481020841894,
+        -0.79583690460888368, -0.79490712632823701, -0.79397547755433706, -0.79304196047944409,
+        -0.79210657730021261, -0.79116933021769031, -0.79023022143731014, -0.78928925316888565,
+        -0.78834642762660612, -0.78740174702903176, -0.78645521359908599, -0.78550682956405404,
+        -0.78455659715557524, -0.7836045186096382, -0.78265059616657606, -0.78169483207105972,
+        -0.7807372285720946, -0.77977778792301455, -0.77881651238147598, -0.77785340420945293,
+        -0.77688846567323278, -0.7759216990434078, -0.77495310659487404, -0.77398269060682279,
+        -0.77301045336273688, -0.77203639715038486, -0.77106052426181404, -0.77008283699334812,
+        -0.7691033376455797, -0.76812202852336542, -0.76713891193582029, -0.76615399019631325,
+        -0.76516726562245918, -0.7641787405361169, -0.76318841726338127, -0.7621962981345789,
+        -0.76120238548426222, -0.76020668165120275, -0.75920918897838818, -0.75820990981301539,
+        -0.75720884650648457, -0.75620600141439442, -0.75520137689653688, -0.75419497531688939,
+        -0.75318679904361263, -0.7521768504490427, -0.75116513190968637, -0.75015164580621541,
+        -0.74913639452345959, -0.74811938045040371, -0.74710060598018024, -0.74608007351006378,
+        -0.74505778544146584, -0.74403374417992962, -0.74300795213512194, -0.74198041172083118,
+        -0.74095112535495911, -0.73992009545951609, -0.73888732446061556, -0.73785281478846632,
+        -0.73681656887737002, -0.73577858916571359, -0.73473887809596339, -0.73369743811466015,
+        -0.73265427167241315, -0.73160938122389285, -0.7305627692278277, -0.72951443814699701,
+        -0.72846439044822509, -0.72741262860237621, -0.72635915508434634, -0.72530397237306099,
+        -0.724247082951467, -0.72318848930652735, -0.72212819392921523, -0.72106619931450844,
+        -0.72000250796138188, -0.7189371223728046, -0.71787004505573182, -0.71680127852109943,
+        -0.71573082528381904, -0.71465868786276932, -0.71358486878079375, -0.71250937056469243,
+        -0.71143219574521643, -0.7103533468570622, -0.70927282643886602, -0.70819063703319562,
+        -0.70710678118654768, -0.70602126144933985, -0.70493408037590488, -0.70384524052448538,
+        -0.70275474445722563, -0.70166259474016868, -0.70056879394324845, -0.69947334464028377,
+        -0.69837624940897269, -0.69727751083088696, -0.69617713149146321, -0.69507511398000099,
+        -0.693971460889654, -0.69286617481742463, -0.69175925836415819, -0.69065071413453494,
+        -0.68954054473706716, -0.68842875278409055, -0.68731534089175905, -0.68620031168003848,
+        -0.6850836677727008, -0.68396541179731574, -0.68284554638524819, -0.68172407417164982,
+        -0.68060099779545302, -0.67947631989936552, -0.6783500431298618, -0.67722217013718067,
+        -0.67609270357531603, -0.67496164610201204, -0.67382900037875593, -0.6726947690707733,
+        -0.67155895484701866, -0.67042156038017331, -0.66928258834663612, -0.66814204142651845,
+        -0.66699992230363803, -0.66585623366551006, -0.66471097820334513, -0.66356415861203988,
+        -0.66241577759017178, -0.66126583783999204, -0.66011434206742092, -0.65896129298203765,
+        -0.65780669329707886, -0.65665054572942905, -0.65549285299961535, -0.654333617831801,
+        -0.65317284295377709, -0.65201053109695972, -0.65084668499638099, -0.64968130739068319,
+        -0.64851440102211233, -0.6473459686365125, -0.64617601298331662, -0.64500453681554415,
+        -0.6438315428897915, -0.64265703396622675, -0.64148101280858361, -0.64030348218415201,
+        -0.63912444486377595, -0.63794390362184417, -0.6367618612362842, -0.635578320488556,
+        -0.63439328416364593, -0.63320675505005752, -0.63201873593980917, -0.63082922962842458,
+        -0.62963823891492698, -0.62844576660183316, -0.62725181549514453, -0.62605638840434374,
+        -0.62485948814238645, -0.62366111752569453, -0.62246127937414986, -0.621259976511088,
+        -0.62005721176328954, -0.61885298796097654, -0.61764730793780398, -0.61644017453085354,
+        -0.61523159058062737, -0.61402155893103882, -0.61281008242940993, -0.61159716392646202,
+        -0.61038280627630948, -0.6091670123364531, -0.60794978496777408, -0.60673112703452481,
+        -0.60551104140432566, -0.60428953094815607, -0.60306659854034816, -0.60184224705858058,
+        -0.60061647938386931, -0.59938929840056476, -0.59816070699634238, -0.5969307080621965,
+        -0.59569930449243325, -0.59446649918466488, -0.59323229503980013, -0.5919966949620411,
+        -0.59075970185887428, -0.58952131864106383, -0.58828154822264578, -0.58704039352091841,
+        -0.58579785745643909, -0.58455394295301544, -0.58330865293769829, -0.58206199034077544,
+        -0.58081395809576497, -0.57956455913940608, -0.57831379641165581, -0.57706167285567955,
+        -0.57580819141784523, -0.57455335504771632, -0.57329716669804265, -0.57203962932475738,
+        -0.57078074588696737, -0.56952051934694714, -0.56825895267013138, -0.56699604882510912,
+        -0.56573181078361356, -0.56446624152051961, -0.5631993440138342, -0.56193112124468936,
+        -0.56066157619733659, -0.55939071185913647, -0.55811853122055644, -0.55684503727516022,
+        -0.55557023301960218, -0.55429412145362, -0.55301670558002802, -0.55173798840470778,
+        -0.55045797293660503, -0.54917666218771977, -0.54789405917310008, -0.54661016691083542,
+        -0.5453249884220468, -0.54403852673088415, -0.542750784864516, -0.54146176585312344,
+        -0.54017147272989274, -0.53887990853100887, -0.53758707629564584, -0.5362929790659634,
+        -0.53499761988709726, -0.53370100180715285, -0.53240312787719857, -0.53110400115125544,
+        -0.52980362468629494, -0.52850200154222859, -0.52719913478190139, -0.52589502747108452,
+        -0.52458968267846939, -0.52328310347565676, -0.5219752929371545, -0.52066625414036727,
+        -0.51935599016558953, -0.51804450409599989, -0.51673179901765032, -0.51541787801946326,
+        -0.51410274419322188, -0.51278640063356307, -0.5114688504379703, -0.51015009670676725,
+        -0.50883014254310743, -0.50750899105297109, -0.50618664534515534, -0.50486310853126748,
+        -0.50353838372571813, -0.50221247404571123, -0.50088538261124105, -0.499557112545082,
+        -0.49822766697278187, -0.49689704902265441, -0.49556526182577304, -0.49423230851596012,
+        -0.49289819222978426, -0.49156291610655001, -0.4902264832882911, -0.48888889691976373,
+        -0.48755016014843638, -0.4862102761244867, -0.48486924800079123, -0.48352707893291874,
+        -0.48218377207912261, -0.48083933060033446, -0.4794937576601534, -0.47814705642484329,
+        -0.4767992300633222, -0.47545028174715581, -0.47410021465055058, -0.47274903195034323,
+        -0.47139673682599792, -0.47004333245959579, -0.46868882203582796, -0.4673332087419883,
+        -0.46597649576796668, -0.4646186863062382, -0.46325978355186043, -0.46189979070246284,
+        -0.46053871095823995, -0.4591765475219447, -0.45781330359887767, -0.45644898239688425,
+        -0.455083587126344, -0.45371712100016387, -0.45234958723377072, -0.45098098904510436,
+        -0.44961132965460698, -0.44824061228522016, -0.44686884016237427, -0.44549601651398169,
+        -0.44412214457042981, -0.44274722756457047, -0.441371268731717, -0.43999427130963342,
+        -0.43861623853852766, -0.43723717366104398, -0.43585707992225603, -0.43447596056965609,
+        -0.43309381885315218, -0.43171065802505737, -0.43032648134008256, -0.4289412920553301,
+        -0.42755509343028253, -0.42616788872679995, -0.42477968120910897, -0.42339047414379605,
+        -0.42200027079979957, -0.42060907444840306, -0.41921688836322435, -0.41782371582021255,
+        -0.41642956009763726, -0.41503442447608158, -0.41363831223843517, -0.41224122666988333,
+        -0.41084317105790424, -0.40944414869225781, -0.40804416286497869, -0.40664321687036886,
+        -0.40524131400499042, -0.40383845756765452, -0.40243465085941871, -0.40102989718357573,
+        -0.39962419984564679, -0.39821756215337423, -0.39680998741671081, -0.39540147894781663,
+        -0.39399204006104827, -0.39258167407295153, -0.39117038430225376, -0.38975817406985702,
+        -0.38834504669882669, -0.38693100551438886, -0.38551605384391896, -0.38410019501693499,
+        -0.38268343236509039, -0.38126576922216282, -0.37984720892405149, -0.37842775480876578,
+        -0.37700741021641826, -0.3755861784892171, -0.37416406297145854, -0.3727410670095162,
+        -0.37131719395183782, -0.36989244714893421, -0.36846682995337227, -0.36704034571976701,
+        -0.36561299780477435, -0.36418478956708022, -0.36275572436739739, -0.36132580556845428,
+        -0.359895036534988, -0.3584634206337371, -0.35703096123343042, -0.35559766170478413,
+        -0.35416352542049051, -0.35272855575521067, -0.35129275608556693, -0.34985612979013542,
+        -0.3484186802494349, -0.34698041084592385, -0.34554132496398909, -0.3441014259899387,
+        -0.34266071731199493, -0.3412192023202828, -0.33977688440682713, -0.33833376696554129,
+        -0.33688985339222, -0.33544514708453144, -0.33399965144200988, -0.33255336986604456,
+        -0.3311063057598766, -0.32965846252858755, -0.32820984357909239, -0.32676045232013234,
+        -0.32531029216226337, -0.32385936651785313, -0.32240767880106996, -0.32095523242787521,
+        -0.31950203081601547, -0.31804807738501545, -0.31659337555616623, -0.31513792875252261,
+        -0.31368174039889152, -0.31222481392182483, -0.31076715274961209, -0.30930876031226917,
+        -0.30784964004153514, -0.30638979537086108, -0.30492922973540237, -0.30346794657201109,
+        -0.30200594931922858, -0.30054324141727379, -0.29907982630804064, -0.29761570743508625,
+        -0.29615088824362373, -0.29468537218051494, -0.29321916269425907, -0.29175226323498954,
+        -0.2902846772544625, -0.28881640820604942, -0.28734745954472934, -0.28587783472708111,
+        -0.28440753721127221, -0.28293657045705556, -0.28146493792575805, -0.27999264308027311,
+        -0.27851968938505367, -0.27704608030610034, -0.27557181931095842, -0.2740969098687065,
+        -0.27262135544994898, -0.27114515952680784, -0.26966832557291559, -0.26819085706340356,
+        -0.26671275747489859, -0.26523403028551185, -0.26375467897483129, -0.2622747070239142,
+        -0.26079411791527596, -0.25931291513288651, -0.25783110216215915, -0.25634868248994286,
+        -0.25486565960451441, -0.25338203699557066, -0.2518978181542173, -0.25041300657296545,
+        -0.2489276057457202, -0.24744161916777319, -0.24595505033579521, -0.24446790274782459,
+        -0.24298017990326418, -0.24149188530286947, -0.24000302244874144, -0.23851359484431825,
+        -0.23702360599436773, -0.23553305940497588, -0.23404195858354362, -0.2325503070387753,
+        -0.231058108280671, -0.22956536582051948, -0.22807208317088618, -0.22657826384561028,
+        -0.22508391135979297, -0.22358902922978996, -0.22209362097320334, -0.22059769010887406,
+        -0.21910124015687016, -0.21760427463848384, -0.21610679707621955, -0.21460881099378668,
+        -0.21311031991609197, -0.21161132736922802, -0.21011183688046992, -0.20861185197826362,
+        -0.20711137619221853, -0.20561041305309907, -0.2041089660928174, -0.20260703884442149,
+        -0.20110463484209212, -0.19960175762113103, -0.19809841071795348, -0.19659459767008083,
+        -0.19509032201612872, -0.19358558729580391, -0.19208039704989258, -0.19057475482025274,
+        -0.18906866414980603, -0.18756212858253013, -0.18605515166344702, -0.18454773693861984,
+        -0.18303988795514101, -0.18153160826112488, -0.18002290140570013, -0.17851377093899798,
+        -0.17700422041214905, -0.17549425337727156, -0.17398387338746379, -0.17247308399679578,
+        -0.17096188876030177, -0.16945029123396835, -0.16793829497473139, -0.16642590354046419,
+        -0.16491312048996981, -0.16339994938297386, -0.1618863937801123, -0.16037245724292856,
+        -0.15885814333386158, -0.15734345561623825, -0.15582839765426507, -0.15431297301302063,
+        -0.1527971852584438, -0.15128103795733044, -0.14976453467732159, -0.14824767898689595,
+        -0.14673047445536239, -0.14521292465284794, -0.14369503315029475, -0.1421768035194482,
+        -0.14065823933284921, -0.13913934416382603, -0.13762012158648659, -0.13610057517570659,
+        -0.13458070850712642, -0.13306052515713912, -0.13154002870288301, -0.13001922272223398,
+        -0.12849811079379364, -0.12697669649688617, -0.12545498341154637, -0.12393297511851216,
+        -0.12241067519921603, -0.12088808723577762, -0.11936521481099176, -0.1178420615083252,
+        -0.11631863091190484, -0.11479492660650999, -0.11327095217756497, -0.11174671121112706,
+        -0.11022220729388336, -0.10869744401313887, -0.10717242495680884, -0.10564715371341044,
+        -0.10412163387205513, -0.10259586902243668, -0.10106986275482806, -0.099543618660069402,
+        -0.098017140329560506, -0.096490431355253231, -0.094963495329639477, -0.093436335845748092,
+        -0.091908956497132877, -0.090381360877864969, -0.08885355258252442, -0.087325535206192628,
+        -0.085797312344440282, -0.084268887593324307, -0.082740264549375761, -0.081211446809592344,
+        -0.07968243797143075, -0.078153241632794718, -0.076623861392031811, -0.075094300847921472,
+        -0.073564563599667412, -0.072034653246889152, -0.070504573389614425, -0.068974327628267135,
+        -0.067443919563664287, -0.065913352797003888, -0.064382630929857368, -0.062851757564162059,
+        -0.061320736302209057, -0.059789570746640187, -0.058258264500435912, -0.056726821166907741,
+        -0.055195244349689775, -0.053663537652731082, -0.052131704680283719, -0.050599749036899518,
+        -0.049067674327418091, -0.047535484156959219, -0.046003182130915268, -0.044470771854939146,
+        -0.042938256934941139, -0.041405640977076899, -0.039872927587739811, -0.038340120373552534,
+        -0.036807222941359394, -0.03527423889821435, -0.033741171851377823, -0.032208025408304662,
+        -0.030674803176636543, -0.029141508764194368, -0.027608145778966225, -0.02607471782910422,
+        -0.024541228522912448, -0.023007681468839372, -0.021474080275469345, -0.019940428551515003,
+        -0.018406729905805226, -0.016872987947281957, -0.015339206284988182, -0.013805388528060311,
+        -0.012271538285720572, -0.010737659167264976, -0.0092037547820601438, -0.0076698287395312609,
+        -0.006135884649154477, -0.0046019261204484109, -0.0030679567629665438, -0.0015339801862851719,
+        0,
+    },
+    /* saw */
+    {
+        0, 0.053696381435167542, 0.10721634724971976, 0.1603845169943337,
+        0.21302757333153713, 0.26497527556979278, 0.31606145172491135, 0.36612496220582147,
+        0.41501062843731712, 0.46257011999864095, 0.50866279417153004, 0.55315648215211177,
+        0.59592821658493633, 0.63686489552122849, 0.67586387838361217, 0.71283351003227469,
+        0.7476935695687158, 0.7803756410785837, 0.81082340410013642, 0.83899284220495318,
+        0.86485236868792459, 0.88838286897945073, 0.90957766000930373, 0.92844236736396679,
+        0.9449947216826261, 0.95926427632664313, 0.97129204892873156, 0.98113008997673334,
+        0.9888409821086529, 0.99449727428642454, 0.99818085547207369, 0.99998227284800534,
+        0.99999999999999944, 0.99833966081438863, 0.99511321512733686, 0.99043811240218127,
+        0.98443641989878761, 0.97723393193558106, 0.96895926692955836, 0.95974295893180983,
+        0.94971655035589875, 0.93901169252439765, 0.92775926053577029, 0.91608848878105198,
+        0.90412613321897572, 0.89199566625150462, 0.87981650973156478, 0.86770331128389711,
+        0.85576526873149439, 0.84410550699739606, 0.83282051139836721, 0.82199962076704436,
+        0.81172458333650099, 0.80206917780019615, 0.79309890142514727, 0.78487072655142476,
+        0.77743292626115035, 0.77082496944954892, 0.76507748498381822, 0.76021229409691338,
+        0.75624250963717854, 0.7531727002852715, 0.75099911736094016, 0.74970998137781886,
+        0.74928582506798114, 0.74969988919293606, 0.75091856708698324, 0.75290189354519121,
+        0.75560407337400248, 0.75897404466971452, 0.76295607168048418, 0.76749036194235221,
+        0.77251370226001848, 0.77796010802924931, 0.78376148037000581, 0.78984826555742171,
+        0.7961501113009859, 0.8025965145297449, 0.8091174554916255, 0.81564401316641499,
+        0.82210895722252808, 0.82844731201496358, 0.83459688842335733, 0.84049877966170905,
+        0.84609781755214064, 0.85134298614062009, 0.85618778993934619, 0.86059057450483412,
+        0.86451479749888815, 0.86792924882766842, 0.87080821890813986, 0.87313161456731347,
+        0.8748850225339968, 0.87605972093144324, 0.87665263961847228, 0.87666627065277003,
+        0.87610853055963622, 0.87499257647909845, 0.87333657863093006, 0.8711634518778838,
+        0.86850054947962252, 0.86537932241116544, 0.86183494786799808, 0.85790593079360955,
+        0.85363368244267657, 0.84906208013323969, 0.84423701244333405, 0.83920591417106316,
+        0.83401729540208813, 0.82872026901505835, 0.82336408090425961, 0.81799764711063061,
+        0.81266910192836239, 0.80742536089625971, 0.80231170239250904, 0.79737137133064306,
+        0.79264520820554651, 0.78817130646390487, 0.78398470087617833, 0.78011708927003043,
+        0.77659658965101386, 0.77344753438854286, 0.77069030278690986, 0.76834119299563453,
+        0.76641233384419261, 0.76491163681636554, 0.7638427880124804, 0.76320527958689566,
+        0.76299447979633961, 0.76320174045521216, 0.76381454026965201, 0.76481666221564792,
+        0.76618840284046941, 0.76790681110337089, 0.76994595413311095, 0.77227720706814873,
+        0.77486956396199935, 0.77768996658256673, 0.78070364781130219, 0.78387448625656186,
+        0.78716536863602393, 0.79053855645567483, 0.79395605351751519, 0.79737997082446144,
+        0.80077288551816617, 0.80409819058273124, 0.80732043217333826, 0.81040563158217693,
+        0.81332158903303753, 0.8160381666986346, 0.81852754855902132, 0.82076447496307303,
+        0.82272645001553779, 0.82439392018693747, 0.82575042283009437, 0.82678270358241657,
+        0.82748080193451656, 0.82783810455046947, 0.82785136623014399, 0.82752069870682288,
+        0.82684952777093068, 0.82584451950047877, 0.8245154766582371, 0.82287520658211488,
+        0.82093936214652885, 0.81872625760646689, 0.81625666135050323, 0.81355356778248289,
+        0.81064195072227929, 0.80754850086273022, 0.80430134994132485, 0.80092978438065954,
+        0.79746395122047276, 0.79393455920578837, 0.79037257791028226, 0.78680893776153671,
+        0.78327423379575434, 0.77979843590439901, 0.77641060824494967, 0.77313864037363589,
+        0.7700089925208855, 0.76704645727183796, 0.76427393973627233, 0.76171225809657839,
+        0.759379966210872, 0.75729319972326614, 0.75546554689674461, 0.75390794513849158,
+        0.75262860393519782, 0.75163295465927304, 0.750923627448431, 0.75050045510325836,
+        0.75036050369252494, 0.75049812930647553, 0.75090506015648373, 0.75157050298743355,
+        0.75248127254907504, 0.75362194266640481, 0.7549750172585773, 0.75652111948266032,
+        0.75823919702416331, 0.76010674142194923, 0.76210001920203807, 0.76419431250368375,
+        0.76636416681276109, 0.76858364337223573, 0.77082657381765352, 0.77306681458709137,
+        0.77527849867966958, 0.77743628238413132, 0.77951558466845994, 0.7814928170122003,
+        0.78334560157407229, 0.78505297571731614, 0.78659558106272187, 0.78795583540277836,
+        0.78911808598831834, 0.79006874288946261, 0.79079639133385193, 0.79129188213493218,
+        0.79154839953953027, 0.79156150604490583, 0.79132916395883712, 0.7908517336999259,
+        0.79013194905707052, 0.78917486984491336, 0.78798781260391915, 0.78658026019771166,
+        0.78496375135443974, 0.78315175138154924, 0.7811595054527688, 0.77900387602082066,
+        0.77670316604809575, 0.77427692986894725, 0.771745773600511, 0.76913114710309294,
+        0.76645512955556627, 0.76374021075546827, 0.76100907027724485, 0.75828435662538574,
+        0.75558846850205208, 0.75294334027161325, 0.75037023364777544, 0.74788953755335486,
+        0.74552057800911309, 0.74328143979749295, 0.74118880152063515, 0.73925778553122168,
+        0.73750182406070997, 0.73593254270418595, 0.7345596622458167, 0.73339091962565339,
+        0.73243200865897096, 0.73168654092540775, 0.73115602704867166, 0.73083987839047593,
+        0.73073542898646038, 0.73083797735910605, 0.73114084765474174, 0.73163546937056489,
+        0.73231147476473502, 0.73315681287968915, 0.73415787895731532, 0.73529965788593155,
+        0.73656588019429581, 0.73793918899830913, 0.73940131621250726, 0.74093326626174705,
+        0.74251550546919776, 0.74412815525538267, 0.74575118725977396, 0.74736461849146862,
+        0.74894870462867813, 0.75048412961787481, 0.75195218977208611, 0.75333497063332844,
+        0.75461551494593249, 0.75577798018449482, 0.75680778419144135, 0.75769173760355557,
+        0.75841816188296962, 0.75897699191474044, 0.75935986228866126, 0.75956017654596497,
+        0.75957315884032595, 0.75939588763550636, 0.75902731123738576, 0.75846824513426658,
+        0.75772135129460827, 0.75679109974396952, 0.75568371291137248, 0.75440709339790668,
+        0.75297073597564557, 0.75138562477143567, 0.7496641167264998, 0.7478198125477723,
+        0.74586741647940002, 0.74382258632184639, 0.74170177521071656, 0.73952206673695153,
+        0.73730100504404894, 0.73505642157575146, 0.73280626016924122, 0.73056840219394992,
+        0.72836049342482279, 0.72619977431141869, 0.72410291526097703, 0.72208585849503149,
+        0.72016366796594866, 0.71835038873274193, 0.71665891709554963, 0.71510088267631089,
+        0.71368654351059013, 0.712424695083411, 0.71132259410169607, 0.71038589764890081,
+        0.70961861821502059, 0.70902309493905002, 0.70859998124240442, 0.70834824887262204,
+        0.70826520821817507, 0.7083465445990107, 0.70858637008504399, 0.70897729024763634,
+        0.70951048510848624, 0.7101758034176997, 0.71096186926928295, 0.71185619994905702,
+        0.71284533380806003, 0.71391496686481271, 0.71505009676312137, 0.71623517264911618,
+        0.71745424948241376, 0.71869114526211053, 0.7199295996289824, 0.72115343230083617,
+        0.7223466998084983, 0.72349384902513902, 0.72457986602123692, 0.72559041883106923,
+        0.72651199278347589, 0.72733201712917073, 0.72803898178814941, 0.72862254314290587,
+        0.72907361791504199, 0.72938446428351678, 0.729548749530746, 0.72956160363705458,
+        0.72941965838300848, 0.729121071661746, 0.72866553684806235, 0.72805427721634253,
+        0.72729002554409272, 0.72637698918027271, 0.72532080099676177, 0.72412845677546245,
+        0.72280823971182673, 0.72136963283643674, 0.71982322026889201, 0.71818057832130788,
+        0.71645415756149411, 0.71465715702738597, 0.7128033918538853, 0.7109071556302905,
+        0.70898307885045908, 0.70704598484849634, 0.70511074462966528, 0.70319213200955177,
+        0.70130468046407179, 0.69946254306900357, 0.69767935687065186, 0.69596811297933092,
+        0.6943410336152791, 0.69280945726292265, 0.69138373300494427, 0.69007312501322959,
+        0.68888572807036985, 0.68782839488416347, 0.68690667583944098, 0.68612477170782704,
+        0.68548549970793293, 0.68499027317717531, 0.68463909498329356, 0.68443056466990448,
+        0.68436189919744461, 0.68442896700985323, 0.68462633502963843, 0.68494732806067482,
+        0.68538409996051786, 0.68592771583312573, 0.68656824438984354, 0.68729485953218039,
+        0.6880959501252133, 0.68895923685615978, 0.68987189500941126, 0.69082068193768575,
+        0.69179206796940373, 0.69277236946519949, 0.69374788272187748, 0.69470501742021229,
+        0.69563042832368338, 0.69651114395838987, 0.6973346910397572, 0.69808921345875807,
+        0.69876358469876187, 0.69934751262320349, 0.69983163565322548, 0.70020760944255889,
+        0.70046818325325622, 0.70060726533950612, 0.70061997675654386, 0.70050269312669067,
+        0.70025307401344705, 0.69987007967642867, 0.69935397510327857, 0.69870632133862498,
+        0.69792995425320237, 0.69702895101741658, 0.69600858466168858, 0.6948752672196572,
+        0.69363648205883699, 0.69230070610540373, 0.690877322764613, 0.68937652642496439,
+        0.68780921951183194, 0.68618690312420572, 0.68452156234577299, 0.68282554736834045,
+        0.68111145160109343, 0.67939198796321021, 0.67767986456961993, 0.67598766102017716,
+        0.67432770649133023, 0.67271196080651618, 0.67115189962745259, 0.6696584048634342,
+        0.66824166134030671, 0.66691106070546635, 0.66567511347071762, 0.66454137001193814,
+        0.66351635125397646, 0.66260548967204336, 0.66181308113801218, 0.66114224803246457,
+        0.66059491393217185, 0.66017179006900595, 0.65987237364115625, 0.65969495794213873,
+        0.65963665415850481, 0.65969342457451263, 0.65986012681239437, 0.66013056863129371,
+        0.66049757270746512, 0.66095305072382027, 0.66148808600940812, 0.66209302388953295,
+        0.66275756883590697, 0.66347088744399574, 0.66422171621219095, 0.66499847305509119,
+        0.66578937145135497, 0.66658253610552709, 0.66736611899321785, 0.6681284146599199,
+        0.66885797365566224, 0.6695437130103814, 0.67017502268814477, 0.67074186700171468,
+        0.67123488002209242, 0.67164545407988974, 0.67196582052618381, 0.67218912199903391,
+        0.67230947552742459, 0.67232202589608003, 0.67222298879153619, 0.67200968335103384,
+        0.67168055384028347, 0.6712351802928368, 0.67067427805171942, 0.66999968626203343,
+        0.66921434547038861, 0.66832226459224653, 0.66732847761052549, 0.66623899046717028,
+        0.66506071870284411, 0.66380141648765212, 0.66246959776689784, 0.66107445031971968,
+        0.65962574359416537, 0.65813373123941066, 0.65660904930378616, 0.65506261110563202,
+        0.65350549981246253, 0.65194885978219219, 0.65040378772815777, 0.64888122476731003,
+        0.64739185039830327, 0.64594597943346777, 0.64455346287602366, 0.64322359369177606,
+        0.64196501837337616, 0.64078565513549135, 0.6396926195116508, 0.63869215804862611,
+        0.63778959071292274, 0.63698926253692567, 0.63629450494047612, 0.63570760706793361,
+        0.63522979738217988, 0.63486123565638952, 0.63460101540277403, 0.63444717667591222,
+        0.63439672908763356, 0.63444568477174013, 0.63458910094108056, 0.63482113158754505,
+        0.63513508778827887, 0.63552350599972607, 0.63597822364567136, 0.63649046123708564,
+        0.63705091020079885, 0.63764982554153971, 0.63827712241800527, 0.63892247567892813,
+        0.63957542137972034, 0.64022545928457919, 0.64086215535287472, 0.64147524321244398,
+        0.64205472363576965, 0.6425909610579994, 0.64307477620792963, 0.64349753396418674,
+        0.64385122559843178, 0.64412854462495095, 0.64432295554097263, 0.64442875481366901,
+        0.64444112354752914, 0.64435617134866396, 0.64417097098994069, 0.64388358357169306,
+        0.64349307396629774, 0.6429995164301201, 0.64240399036240958, 0.6417085662866443,
+        0.64091628222465491, 0.64003111072676189, 0.63905791691112457, 0.63800240795176832,
+        0.63687107453644665, 0.63567112489180611, 0.6344104120436338, 0.63309735504346532,
+        0.63174085494907706, 0.63035020639473949, 0.62893500562718452, 0.62750505591467431,
+        0.62607027125904757, 0.62464057935400707, 0.62322582473706833, 0.62183567307753673,
+        0.6204795175286677, 0.61916638804897317, 0.61790486456574334, 0.61670299481353952,
+        0.61556821763218306, 0.61450729245301383, 0.61352623563957498, 0.61263026427998468,
+        0.61182374795375272, 0.61111016891649739, 0.61049209106262803, 0.60997113793946833,
+        0.60954797999728183, 0.60922233116921576, 0.60899295478403881, 0.60885767872371843,
+        0.60881341964819657, 0.60885621602203865, 0.60898126959283427, 0.60918299489007399,
+        0.60945507623657136, 0.60979053169299968, 0.6101817832904729, 0.61062073284698859,
+        0.61109884261141167, 0.61160721993412892, 0.61213670512682372, 0.61267796164546917,
+        0.61322156771073311, 0.61375810846881018, 0.61427826779328387, 0.61477291883490048,
+        0.61523321244118934, 0.61565066259130397, 0.61601722802322845, 0.61632538927011038,
+        0.61656822036962722, 0.61673945456443469, 0.61683354337238028, 0.61684570847162001,
+        0.61677198591746751, 0.61660926228393165, 0.61635530240279801, 0.61600876845590047,
+        0.61556923026118771, 0.61503716667940145, 0.61441395815486854, 0.61370187049019964,
+        0.61290403003970673, 0.61202439058939495, 0.61106769227144664, 0.61003941293770658,
+        0.6089457124887363, 0.60779337072216788, 0.60658971932545502, 0.60534256869327141,
+        0.6040601302981583, 0.60275093538413449, 0.60142375078650323, 0.6000874927066675,
+        0.59875113928818824, 0.59742364284953009, 0.59611384262967981, 0.59483037889535073,
+        0.5935816092426649, 0.59237552790241266, 0.59121968882633424, 0.59012113329276505,
+        0.58908632272380779, 0.5881210773533958, 0.58723052132679443, 0.58641903474769985,
+        0.58569021311998759, 0.58504683455779116, 0.58449083506087529, 0.58402329207285186,
+        0.58364441645845688, 0.5833535529537639, 0.58314918906046997, 0.58302897227327488,
+        0.5829897354484902, 0.58302753004329821, 0.58313766687916269, 0.58331476401061655,
+        0.58355280121261777, 0.58384518053659318, 0.58418479232772547, 0.58456408604457633,
+        0.5849751451772065, 0.58540976552203783, 0.5858595360410761, 0.58631592151012291,
+        0.58677034614541035, 0.58721427739083054, 0.5876393090486608, 0.58803724294535742,
+        0.588400168340526, 0.58872053831135585, 0.58899124237641931, 0.58920567466138751,
+        0.58935779695461654, 0.58944219605210946, 0.58945413484866116, 0.58938959669443769,
+        0.58924532260313545, 0.58901884096868506, 0.58870848952136412, 0.58831342933054898,
+        0.58783365073933092, 0.58726997119515945, 0.58662402501972966, 0.58589824523973244,
+        0.58509583767713635, 0.5842207475725345, 0.58327761908710352, 0.58227174809719029,
+        0.58120902875976854, 0.58009589438643094, 0.57893925321758366, 0.57774641973663554,
+        0.57652504220569523, 0.57528302713933233, 0.57402846146083719, 0.5727695331060656,
+        0.57151445085300578, 0.57027136416073676, 0.56904828379923689, 0.56785300404177375,
+        0.56669302717431747, 0.56557549105186611, 0.56450710039997243, 0.56349406252142231,
+        0.56254202802336506, 0.56165603712966072, 0.5608404720873208, 0.5600990161151902,
+        0.55943461927809646, 0.55884947160123555, 0.558344983668144, 0.55792177487208339,
+        0.55757966941562043, 0.55731770007743231, 0.55713411968962567, 0.55702642019383619,
+        0.55699135907089437, 0.55702499286744744, 0.55712271747451425, 0.55727931474799652,
+        0.5574890050004121, 0.55774550483708518, 0.55804208975927561, 0.55837166091173196,
+        0.55872681531332913, 0.55909991887717092, 0.55948318150109622, 0.55986873349116739,
+        0.56024870256955128, 0.56061529071440741, 0.56096085008290519, 0.56127795727930918,
+        0.56155948524802146, 0.56179867209643297, 0.561989186184082, 0.56212518685265456,
+        0.56220138021539856, 0.5622130694741293, 0.56215619928665383, 0.56202739376660438,
+        0.56182398776077891, 0.56154405111549266, 0.56118640571247391, 0.56075063512587753,
+        0.56023708682427653, 0.55964686691433962, 0.5589818274956303, 0.55824454676782143,
+        0.55743830210191614, 0.55656703635516158, 0.55563531777451536, 0.5546482938952022,
+        0.55361163989845685, 0.55253150194545253, 0.55141443605213536, 0.55026734311182501,
+        0.54909740070852509, 0.54791199239364474, 0.54671863512195951, 0.54552490555893474,
+        0.54433836598081808, 0.54316649049121135, 0.54201659227298349, 0.54089575258262701,
+        0.53981075217548879, 0.53876800582497819, 0.53777350056714512, 0.53683273826420252,
+        0.53595068303707061, 0.53513171406826165, 0.53437958422289789, 0.53369738487786378,
+        0.53308751728768233, 0.53255167075118637, 0.53209080777614026, 0.53170515637029236,
+        0.53139420951752447, 0.53115673182761125, 0.53099077327815158, 0.53089368989829122,
+        0.5308621711764977, 0.53089227390960436, 0.53097946214816294, 0.53111865283450577,
+        0.5313042666753216, 0.53153028374055822, 0.53179030323553733, 0.53207760685372396,
+        0.53238522508403763, 0.53270600581917582, 0.53303268459049769, 0.53335795574063083,
+        0.53367454383742652, 0.53397527463204841, 0.53425314487004083, 0.53450139027691668,
+        0.53471355105916274, 0.53488353428722379, 0.53500567255888831, 0.5350747783790738,
+        0.53508619373506194, 0.53503583439423397, 0.53492022850387433, 0.53473654912909863,
+        0.53448264042490057, 0.53415703720103758, 0.53375897770346536, 0.53328840950255552,
+        0.53274598844580123, 0.53213307070044635, 0.53145169797880432, 0.5307045761053184,
+        0.52989504714900004, 0.5290270554071439, 0.52810510758557438, 0.52713422757651074,
+        0.52611990628697447, 0.52506804701793075, 0.52398490693669586, 0.52287703522203999,
+        0.52175120849264822, 0.52061436415476892, 0.51947353232380433, 0.51833576698711659,
+        0.51720807708128158, 0.51609735815643143, 0.51501032529314938, 0.51395344792376874,
+        0.5129328871899439, 0.51195443644230398, 0.51102346545605193, 0.51014486889893118,
+        0.50932301954535519, 0.50856172668318156, 0.50786420010800359, 0.50723302004452431,
+        0.50667011327603773, 0.50617673570190813, 0.50575346147978484, 0.50540017884472221,
+        0.50511609263206969, 0.50489973346555139, 0.50474897350700598, 0.50466104860049765,
+        0.50463258658145826, 0.50465964146187392, 0.50473773314580739, 0.50486189227631806,
+        0.50502670976559938, 0.50522639051541474, 0.50545481079502197, 0.50570557870921817,
+        0.50597209716013725, 0.50624762868333395, 0.50652536152166672, 0.50679847628970964,
+        0.50706021257698852, 0.50730393484024516, 0.50752319694319081, 0.5077118047167094,
+        0.50786387593303028, 0.50797389711385721, 0.50803677662448588, 0.50804789354327384,
+        0.50800314183806761, 0.50789896942790347, 0.50773241175905348, 0.50750111957872324,
+        0.50720338064695913, 0.50683813518697107, 0.50640498493554542, 0.50590419571795375,
+        0.5053366935350696, 0.50470405421371467, 0.50400848673397913, 0.50325281040867942,
+        0.5024404261497869, 0.50157528211386637, 0.50066183407281994, 0.49970500090702996,
+        0.49871011566479267, 0.49768287267431727, 0.49662927123213879, 0.49555555642416155,
+        0.49446815766245084, 0.49337362554203729, 0.49227856763721911, 0.49118958386599859,
+        0.49011320205427733, 0.48905581432827827, 0.48802361495436203, 0.48702254023009756,
+        0.48605821100927638, 0.48513587841673117, 0.48426037327665744, 0.48343605974087711,
+        0.48266679356160103, 0.48195588540706752, 0.48130606956849381, 0.48071947835348627,
+        0.48019762240504632, 0.47974137712701559, 0.47935097533689242, 0.4790260062059698,
+        0.47876542048527493, 0.47856754195446954, 0.47843008497027273, 0.47835017793168355,
+        0.47832439242189023, 0.47834877773182005, 0.47841890041831753, 0.47852988850147243,
+        0.47867647986107581, 0.47885307435204377, 0.4790537891232407, 0.47927251659383568,
+        0.47950298451641288, 0.47973881753673575, 0.47997359964656133, 0.48020093691829463,
+        0.48041451990864509, 0.48060818512280468, 0.48077597494095031, 0.4809121954249676,
+        0.48101147144504836, 0.48106879859297941, 0.48107959138127815, 0.48103972726446992,
+        0.48094558606042365, 0.48079408439530613, 0.48058270484496129, 0.48030951949785522,
+        0.47997320771967039, 0.47957306795660765, 0.47910902347290357, 0.4785816219774725,
+        0.47799202915427985, 0.47734201617051425, 0.47663394129527253, 0.47587072581869599,
+        0.47505582451677592, 0.47419319095983964, 0.47328723801251932, 0.47234279391929851,
+        0.47136505441212839, 0.47035953131464303, 0.46933199815084897, 0.46828843329451642,
+        0.46723496121853342, 0.46617779242106572, 0.46512316261724213, 0.46407727179124247,
+        0.46304622370397142, 0.46203596644601858, 0.46105223461438383, 0.46010049367458217,
+        0.45918588704744312, 0.45831318643239527, 0.45748674584655219, 0.45671045982181668,
+        0.45598772616089706, 0.45532141360791573, 0.45471383474074784, 0.4541667243407167,
+        0.45368122344138306, 0.45325786920240624, 0.45289659069734256, 0.45259671064638268,
+        0.45235695306696966, 0.45217545675750304, 0.45204979447258664, 0.45197699759293769,
+        0.45195358603980756, 0.45197560313299423, 0.45203865504378798, 0.45213795444993699,
+        0.45226836795937631, 0.45242446683340437, 0.45260058050857999, 0.45279085239014594,
+        0.45298929736848864, 0.45318986049424992, 0.45338647623734557, 0.45357312775039743,
+        0.45374390555801331, 0.453893065099918, 0.45401508256806034, 0.45410470849542806,
+        0.45415701857710999, 0.45416746123204443, 0.45413190144650561, 0.45404666047741882,
+        0.45390855103471683, 0.45371490760668215, 0.45346361164019505, 0.45315311133847369,
+        0.45278243589184836, 0.4523512040117133, 0.45185962669364055, 0.45130850419207852,
+        0.45069921724557549, 0.45003371264754433, 0.44931448331259016, 0.44854454304193819,
+        0.44772739624289293, 0.44686700290609344, 0.44596773919015381, 0.44503435400555547,
+        0.44407192202811413, 0.44308579360647421, 0.4420815420576798, 0.4410649088695564,
+        0.44004174734826279, 0.43901796526366715, 0.43799946705412379, 0.43699209615562629,
+        0.43600157801820022, 0.43503346436481016, 0.43409307923503321, 0.43318546733749136,
+        0.43231534521165477, 0.43148705567143575, 0.43070452597019954, 0.42997123008981963,
+        0.42929015551549471, 0.42866377481372436, 0.42809402228342958, 0.42758227590027925,
+        0.42712934472226421, 0.42673546187100209, 0.4264002831486321, 0.42612289129507203,
+        0.42590180583533627, 0.4257349984121232, 0.42561991344550199, 0.42555349390976699,
+        0.42553221196790497, 0.42555210415709149, 0.42560881077468854, 0.42569761907374526,
+        0.42581350984040095, 0.42595120689325677, 0.42610522901692977, 0.42626994381900618,
+        0.42643962298159843, 0.42660849836590453, 0.42677081842066145, 0.42692090434324592,
+        0.42705320544542397, 0.42716235318434964, 0.42724321333323356, 0.42729093578508559,
+        0.42730100150676897, 0.42726926618916905, 0.42719200017220282, 0.42706592426039092,
+        0.42688824108540835, 0.42665666171600863, 0.42636942726255933, 0.4260253252726674,
+        0.42562370076552564, 0.42516446180517564, 0.42464807956633754, 0.42407558290029906,
+        0.42344854746203914, 0.42276907951275045, 0.42203979456375829, 0.42126379107794643,
+        0.42044461949271572, 0.4195862468738214, 0.41869301755160659, 0.41776961012988101,
+        0.41682099129251976, 0.41585236686352234, 0.41486913060239972, 0.41387681123819431,
+        0.41288101826188278, 0.41188738700829458, 0.41090152356484516, 0.40992895004530283,
+        0.40897505076246377, 0.40804501982407237, 0.40714381066168076, 0.40627608798252579,
+        0.40544618261016729, 0.40465804965073959, 0.40391523038860355, 0.40322081827817269,
+        0.40257742935820556, 0.40198717737118894, 0.40145165382412157, 0.40097191317841496,
+        0.40054846330629473, 0.40018126129947634, 0.39986971466350169, 0.39961268787851101,
+        0.39940851425484014, 0.39925501296025512, 0.39914951104530555, 0.39908887024472217,
+        0.39906951828647536, 0.39908748439645725, 0.39913843864623716, 0.399217734754297,
+        0.39932045591798093, 0.39944146322438495, 0.39957544616386426, 0.39971697474994983,
+        0.3998605527344859, 0.40000067139678769, 0.40013186338075107, 0.400248756054079,
+        0.40034612386919605, 0.40041893921586197, 0.40046242127093351, 0.40047208237093851,
+        0.4004437714579776, 0.40037371417863149, 0.40025854924882359, 0.40009536073455404,
+        0.39988170593878258, 0.39961563862804889, 0.39929572737828772, 0.39892106886724471,
+        0.39849129599046912, 0.39800658072857503, 0.39746763174480226, 0.39687568674339019,
+        0.39623249967039537, 0.39554032288882851, 0.39480188450888992, 0.39402036110113936,
+        0.39319934606522189, 0.39234281396882575, 0.39145508121048289, 0.39054076339524629,
+        0.38960472984386313, 0.38865205568349687, 0.38768797199108074, 0.38671781447877307,
+        0.38574697122458346, 0.38478082995990498, 0.38382472542934132, 0.38288388733683987,
+        0.38196338938574642, 0.38106809990906304, 0.38020263456999759, 0.37937131159208631,
+        0.37857810995284402, 0.37782663094542268, 0.37712006347933158, 0.37646115345429981,
+        0.37585217750114125, 0.37529492134048398, 0.37479066296478825, 0.37434016080173593,
+        0.37394364696822413, 0.373600825674337, 0.37331087678632974, 0.37307246450724268,
+        0.37288375108387029, 0.37274241539982067, 0.37264567626688377, 0.37259032018128108,
+        0.37257273326806062, 0.37258893709636132, 0.37263462801086267, 0.37270521959086045,
+        0.37279588781833595, 0.37290161851047626, 0.37301725655053952, 0.37313755643397784,
+        0.37325723363449309, 0.37337101628731478, 0.37347369668450953, 0.37356018207959896,
+        0.37362554430613143, 0.37366506772704428, 0.37367429504855521, 0.37364907055375063,
+        0.37358558033677397, 0.37348038914833726, 0.3733304734968429, 0.37313325068639153,
+        0.37288660351304531, 0.37258890038343129, 0.37223901066476894, 0.37183631512221305,
+        0.37138071134753686, 0.37087261413222478, 0.37031295078745485, 0.36970315146281163,
+        0.36904513456433319, 0.36834128742023386, 0.367594442388885, 0.36680784864789379,
+        0.36598513994502796, 0.36513029863081575, 0.36424761632858627, 0.36334165163013527,
+        0.36241718523376781, 0.36147917296595761, 0.36053269714801772, 0.35958291678476245,
+        0.35863501706310918, 0.35769415865470594, 0.35676542731801525, 0.3558537842917715,
+        0.35496401796340782, 0.35410069728305482, 0.35326812737608393, 0.35247030778518906,
+        0.3517108937468002, 0.35099316087652427, 0.35031997360457651, 0.34969375766514882,
+        0.34911647690370456, 0.34858961462373395, 0.34811415964989989, 0.34769059723823859,
+        0.34731890491660339, 0.34699855329028173, 0.34672851179919423, 0.34650725936473603,
+        0.34633279981664483, 0.34620268194371945, 0.34611402396723728, 0.34606354219295127,
+        0.34604758355702453, 0.34606216174355264, 0.34610299651680376, 0.3461655558803306,
+        0.3462451006479258, 0.34633673098831863, 0.34643543448672093, 0.34653613525204302,
+        0.34663374358891241, 0.34672320574864812, 0.34679955327313466, 0.34685795145004655,
+        0.34689374640709603, 0.34690251038679887, 0.34688008476154175, 0.34682262037127409,
+        0.34672661479279354, 0.34658894617995267, 0.34640690334805846, 0.34617821181272312,
+        0.34590105553330663, 0.34557409415328055, 0.34519647557407379, 0.34476784374471309,
+        0.34428834159641541, 0.34375860909879863, 0.34317977646203818, 0.34255345255668862,
+        0.34188170866950346, 0.34116705775902517, 0.34041242941848693, 0.33962114079525452,
+        0.3387968637552875, 0.33794358861742352, 0.33706558481547683, 0.33616735887572785,
+        0.33525361012321381, 0.33432918455193972, 0.33339902731161969, 0.33246813427656502,
+        0.33154150317081349, 0.33062408472741861, 0.32972073435897409, 0.32883616481094063,
+        0.32797490025925463, 0.32714123229909325, 0.32633917825272085, 0.32557244220125109,
+        0.32484437911811381, 0.32415796245133527, 0.32351575546767292, 0.3229198866345907,
+        0.32237202927632319, 0.32187338569829071, 0.32142467593026686, 0.32102613119344819,
+        0.32067749215032115, 0.32037801194942911, 0.32012646403032968, 0.31992115460753773,
+        0.31975993970666439, 0.31964024658160151, 0.31955909929902249, 0.31951314823594279,
+        0.31949870319817203, 0.31951176983238128, 0.31954808897270298, 0.31960317853448,
+        0.3196723775432832, 0.31975089186690214, 0.31983384120180636, 0.31991630685378331,
+        0.31999337984516613, 0.32006020887835707, 0.32011204768721702, 0.32014430131436489,
+        0.32015257086336391, 0.32013269629014762, 0.32008079681760609, 0.31999330858090397,
+        0.31986701913853577, 0.31969909851510059, 0.31948712647600463, 0.31922911577137625,
+        0.3189235311261519, 0.31856930379501258, 0.31816584154440281, 0.3177130339686296,
+        0.31721125309272463, 0.31666134926083345, 0.31606464235494847, 0.31542290843436305,
+        0.31473836193087612, 0.31401363357805168, 0.31325174429431613, 0.31245607527901786,
+        0.3116303346172728, 0.31077852072326634, 0.30990488298221908, 0.30901387997825513,
+        0.30811013571860091, 0.30719839428373619, 0.30628347334805639, 0.30537021702623129,
+        0.3044634485065808, 0.30356792293442297, 0.30268828100548023, 0.30182900372203336,
+        0.30099436875273106, 0.30018840882088305, 0.29941487252583493, 0.29867718797787635,
+        0.2979784295992905, 0.2973212884128914, 0.29670804610501866, 0.29614055311283199,
+        0.29562021094618629, 0.29514795891281681, 0.29472426537238772, 0.29434912360060339,
+        0.29402205229947181, 0.29374210074438972, 0.29350785851343369, 0.29331746969954109,
+        0.29316865146254817, 0.29305871673580902, 0.29298460086170758, 0.29294289189218425,
+        0.29292986425487122, 0.29294151545280328, 0.29297360543636319, 0.29302169826033375,
+        0.29308120561697781, 0.29314743181809705, 0.29321561978527638, 0.29328099759806192,
+        0.29333882514477955, 0.29338444042012773, 0.29341330501751883, 0.29342104837244526,
+        0.29340351032572309, 0.293356781592292, 0.29327724174206415, 0.29316159432398498,
+        0.29300689879269831, 0.2928105989287596, 0.29257054747785732, 0.29228502677169133,
+        0.2919527651326243, 0.29157294890557828, 0.29114523000351317, 0.29066972889673931,
+        0.29014703302089934, 0.28957819062322132, 0.28896470011119607, 0.28830849501170103,
+        0.28761192469140084, 0.28687773103049419, 0.28610902128128035, 0.28530923738005065,
+        0.28448212201524448, 0.28363168178622666, 0.28276214781516923, 0.28187793419908874,
+        0.28098359470986317, 0.28008377816679608, 0.27918318291891081, 0.27828651088247952,
+        0.27739842158323713, 0.27652348665231413, 0.27566614522009975, 0.27483066064308787,
+        0.27402107898537764, 0.27324118965898436, 0.27249448860569614, 0.27178414437804527,
+        0.27111296744835323, 0.27048338304297292, 0.26989740776419069, 0.26935663022499556,
+        0.26886219588255406, 0.26841479621505349, 0.26801466234400262, 0.26766156316059464,
+        0.26735480797066602, 0.26709325362863301, 0.26687531608697129, 0.26669898624470662,
+        0.26656184993650717, 0.26646111186362936, 0.26639362322963434, 0.26635591280779386,
+        0.26634422113380435, 0.26635453748713994, 0.26638263929742784, 0.26642413358881017,
+        0.26647450005568823, 0.26652913534762462, 0.2665833981297126, 0.26663265447750489,
+        0.26667232316267725, 0.26669792038703427, 0.26670510352820503, 0.26668971347039783,
+        0.26664781510773355, 0.26657573562587511, 0.26647010018968731, 0.26632786469029951,
+        0.26614634523395425, 0.26592324408710594, 0.26565667182708252, 0.26534516548489728,
+        0.26498770250611342, 0.26458371039666823, 0.26413307196281738, 0.26363612609748027,
+        0.26309366410880891, 0.26250692163037048, 0.261877566195445, 0.26120768060026545,
+        0.26049974222204336, 0.25975659849702826, 0.25898143880120766, 0.25817776301119455,
+        0.25734934705508505, 0.25650020579222871, 0.25563455358668391, 0.25475676296138644,
+        0.2538713217385129, 0.25298278908599359, 0.25209575090049657, 0.25121477496335803,
+        0.25034436630781659, 0.24948892323351313, 0.24865269439755777, 0.24783973740062162,
+        0.24705387927159744, 0.24629867923549828, 0.24557739412668678, 0.24489294678339663,
+        0.2442478977301302, 0.24364442042216936, 0.24308428029141912, 0.24256881779549316,
+        0.24209893563268933, 0.24167509024467013, 0.24129728768669464, 0.24096508390251087,
+        0.24067758939795672, 0.2404334782643465, 0.24023100146026477, 0.24006800421883673,
+        0.23994194740735683, 0.23984993262764784, 0.23978873080914576, 0.23975481401276036,
+        0.23974439013238624, 0.23975344015287395, 0.23977775759852868, 0.23981298978507212,
+        0.23985468047066522, 0.2398983134882097, 0.23993935693186122, 0.23997330746558057,
+        0.23999573432066554, 0.24000232255255868, 0.23998891513476653, 0.23995155347939209,
+        0.2398865159894458, 0.2397903542676145, 0.23965992662932492, 0.23949242859453129,
+        0.23928542006240672, 0.23903684890572657, 0.23874507075691301, 0.23840886479506246,
+        0.23802744538249984, 0.23760046944004704, 0.23712803949191377, 0.23661070235347362,
+        0.23604944347777865, 0.23544567701906804, 0.23480123171333753, 0.23411833271683258,
+        0.23339957958272531, 0.2326479205938442, 0.23186662370477604, 0.23105924437961645,
+        0.23022959064178114, 0.22938168567931119, 0.22851972837275486, 0.22764805213276373,
+        0.22677108245078245, 0.22589329357851928, 0.22501916476011619, 0.22415313644501594,
+        0.22329956690943006, 0.22246268971002953, 0.22164657238506275, 0.22085507680564478,
+        0.2200918215635618, 0.21936014676178825, 0.21866308155018802, 0.21800331472182152,
+        0.21738316865517368, 0.21680457685473031, 0.21626906530700771, 0.21577773783172144,
+        0.21533126556861959, 0.21492988070001087, 0.21457337446756805, 0.21426109949997976,
+        0.21399197642590748, 0.21376450470483968, 0.21357677756726912, 0.21342650091553733,
+        0.21331101599809457, 0.21322732563315824, 0.21317212372323674, 0.21314182776997842,
+        0.21313261406968628, 0.21314045524384925, 0.21316115973644054, 0.21319041289075547,
+        0.21322381920337471, 0.21325694534158524, 0.21328536350339686, 0.21330469469621474,
+        0.21331065151127723, 0.21329907997617586, 0.21326600007702873, 0.21320764455514607,
+        0.21312049560012314, 0.21300131908209044, 0.2128471959901134, 0.21265555077124598,
+        0.2124241762952053, 0.21215125520278594, 0.21183537743160608, 0.21147555375026467,
+        0.21107122517108806, 0.21062226815199903, 0.21012899553923647, 0.20959215324430633,
+        0.20901291269022199, 0.20839285910341643, 0.20773397576825159, 0.20703862440043402,
+        0.20630952183346593, 0.20554971324818277, 0.20476254220905721, 0.20395161780200449,
+        0.20312077919655783, 0.20227405798027007, 0.20141563863475209, 0.20054981754069998,
+        0.19968096091340709, 0.19881346208047532, 0.19795169851961797, 0.19709998907655113,
+        0.1962625517809658, 0.19544346267247859, 0.19464661603835684, 0.19387568645078246,
+        0.19313409297360606, 0.19242496588714172, 0.19175111625473062, 0.19111500862686123,
+        0.1905187371477996, 0.18996400529627991, 0.18945210945617391, 0.18898392647551007,
+        0.18855990533316114, 0.18818006299230278, 0.18784398447880132, 0.18755082718137531,
+        0.18729932932912749, 0.18708782256124795, 0.18691424846375335, 0.18677617890943099,
+        0.18667084000008324, 0.18659513937508423, 0.18654569661749518, 0.18651887645886386,
+        0.1865108244566554, 0.1865175047942807, 0.18653473983313087, 0.18655825102912585,
+        0.18658370081314843, 0.18660673502554537, 0.18662302548968268, 0.18662831230840859,
+        0.18661844547021342, 0.18658942535884596, 0.18653744177107018, 0.18645891106205678,
+        0.18635051105638151, 0.18620921338464794, 0.18603231293108283, 0.18581745410585135,
+        0.18556265368701647, 0.18526632001073501, 0.18492726832406703, 0.18454473215238365,
+        0.18411837057237693, 0.18364827132174258, 0.18313494971732527, 0.1825793433944877,
+        0.18198280292129709, 0.18134707838140374, 0.18067430205882568, 0.17996696739588264,
+        0.17922790443185196, 0.17846025196419521, 0.17766742670611371, 0.17685308974340275,
+        0.17602111061980191, 0.17517552940305525, 0.1743205171034426, 0.1734603348324541,
+        0.17259929210139924, 0.17174170466793875, 0.1708918523427447, 0.17005393716867614,
+        0.16923204238100534, 0.16843009254940394, 0.16765181529063933, 0.16690070492539613,
+        0.16617998843345513, 0.16549259403881963, 0.16484112273052787, 0.16422782299603958,
+        0.16365456901256739, 0.16312284250779988, 0.1626337184655185, 0.16218785481393341,
+        0.16178548619559416, 0.16142642187779024, 0.16111004782186125, 0.16083533288920168,
+        0.16060083912131234, 0.16040473599148811, 0.1602448184869508, 0.16011852884288608,
+        0.16002298171423227, 0.15995499253758139, 0.15991110880449064, 0.1598876439391865,
+        0.1598807134483371, 0.15988627298851898, 0.15990015797843038, 0.15991812436798419,
+        0.15993589016528426, 0.15994917731527059, 0.15995375352056834, 0.15994547359583,
+        0.15992031995160735, 0.15987444181247867, 0.15980419278670818, 0.15970616642100124,
+        0.15957722939377023, 0.15941455202356172, 0.15921563579568529, 0.15897833763934427,
+        0.15870089071945848, 0.15838192154152395, 0.15802046320397725, 0.15761596467026168,
+        0.15716829597173035, 0.15667774929234399, 0.15614503592637169, 0.15557127914065347,
+        0.15495800301297194, 0.15430711735739458, 0.15362089888562008, 0.15290196879009352,
+        0.15215326696953724, 0.15137802315026083, 0.15057972518684049, 0.14976208485320366,
+        0.14892900145953875, 0.14808452365156427, 0.1472328097662923, 0.14637808713237443,
+        0.14552461071326825, 0.14467662149771102, 0.14383830504429407, 0.1430137505852497,
+        0.14220691108892533, 0.14142156467089198, 0.14066127773028431, 0.13992937017095786,
+        0.13922888304652442, 0.13856254894449924, 0.13793276539789642, 0.13734157158290455,
+        0.13679062852905308, 0.13628120303386598, 0.1358141554377148, 0.13538993137679448,
+        0.13500855759322858, 0.13466964184161909, 0.13437237689131504, 0.13411554858364649,
+        0.13389754786375685, 0.13371638666785382, 0.13356971750907973, 0.1334548565691015,
+        0.13336881006835058, 0.13330830365588398, 0.13326981453042791, 0.13324960597759272,
+        0.13324376398475066, 0.13324823557489948, 0.13325886848417365, 0.13327145179467365,
+        0.13328175712510304, 0.13328557997640203, 0.13327878082819836, 0.13325732558449832,
+        0.13321732497353625, 0.13315507251708766, 0.13306708069866247, 0.13295011497774203,
+        0.13280122531840888, 0.13261777492512447, 0.13239746590582749, 0.13213836161264983,
+        0.13183890544311871, 0.13149793591936998, 0.13111469789935543, 0.13068884981187015,
+        0.13022046684612834, 0.12971004006617853, 0.12915847146028245, 0.12856706497511045,
+        0.12793751362382255, 0.12727188279545038, 0.12657258993006335, 0.12584238075967374,
+        0.12508430234831677, 0.12430167319594845, 0.12349805069940234, 0.12267719628937436,
+        0.12184303858500702, 0.1209996349268961, 0.12015113166507135, 0.11930172359053434,
+        0.11845561290717688, 0.11761696814525854, 0.11678988341805537, 0.11597833841980108,
+        0.1151861595556638, 0.11441698258330472, 0.11367421713066478, 0.11296101343616598,
+        0.11228023163567954, 0.11163441389561525, 0.1110257596635689, 0.11045610427741129,
+        0.10992690114079483, 0.10943920763813676, 0.10899367492552776, 0.10859054169609662,
+        0.10822963197948285, 0.10791035699562486, 0.1076317210434402, 0.10739233136554889,
+        0.1071904118913493, 0.10702382072288105, 0.10689007119137993, 0.10678635627757799,
+        0.10670957615599953, 0.10665636859304371, 0.10662314190083892, 0.10660611012396759,
+        0.10660133011443895, 0.1066047401319388, 0.10661219959158809, 0.10661952957034557,
+        0.10662255367589098, 0.10661713887840631, 0.10659923590615047, 0.10656491881011357,
+        0.10651042331126863, 0.10643218355595771, 0.10632686692061601, 0.10619140652620883,
+        0.10602303114523896, 0.10581929220976349, 0.10557808765726928, 0.1052976823822461,
+        0.10497672509453138, 0.10461426142068123, 0.10420974312138148, 0.10376303333591792,
+        0.10327440780356843, 0.10274455205112328, 0.10217455457516067, 0.10156589608684632,
+        0.10092043492548683, 0.10024038878448209, 0.099528312929324486, 0.098787075121526374,
+        0.098019827494490785, 0.097229975657069811, 0.096421145327567043, 0.095597146824999923,
+        0.094761937765289128, 0.093919584327493102, 0.093074221469085019, 0.092230012479436616,
+        0.091391108267041096, 0.090561606778504708, 0.089745512945941311, 0.088946699554138267,
+        0.088168869409770589, 0.087415519182113252, 0.08668990526827082, 0.085995012016067407,
+        0.085333522614605958, 0.084707792936363269, 0.08411982858575949, 0.083571265377740789,
+        0.083063353436334836, 0.082596945067711036, 0.082172486525343674, 0.081790013746814966,
+        0.081449152102948161, 0.081149120160745769, 0.080888737422369739, 0.08066643596355097,
+        0.08048027585672736, 0.08032796422723873, 0.080206877755438472, 0.080114088403948583,
+        0.080046392117811629, 0.08000034021629733, 0.079972273168883612, 0.079958356424693774,
+        0.079954617944686765, 0.079956987069329105, 0.079961334341512813, 0.079963511895232792,
+        0.079959394015095706, 0.079944917470152352, 0.079916121227841364, 0.079869185159977638,
+        0.079800467362655281, 0.079706539725570499, 0.079584221403455932, 0.079430609862899654,
+        0.079243109201590611, 0.079019455463758381, 0.078757738704990546, 0.078456421591438688,
+        0.078114354352337559, 0.077730785940447966, 0.077305371292123462, 0.076838174616847499,
+        0.076329668684909424, 0.07578073012101004, 0.075192630750618467, 0.074567025084479155,
+        0.073905934064390666, 0.073211725229898605, 0.072487089500492707, 0.071735014800939481,
+        0.070958756788194036, 0.070161806966609008, 0.069347858503631093, 0.068520770080591958,
+        0.067684528132335706, 0.066843207845111441, 0.066000933294215844, 0.065161837111217924,
+        0.064330020075111294, 0.063509511022417725, 0.062704227468066989, 0.061917937321864923,
+        0.061154222074578012, 0.06041644181323113, 0.059707702407272363, 0.059030825185977284,
+        0.058388319403059163, 0.057782357757154588, 0.057214755206941116, 0.056686951287395967,
+        0.056199996099451192, 0.055754540109364738, 0.055350827856867235, 0.054988695632923502,
+        0.054667573149135874, 0.054386489181800154, 0.054144081134776201, 0.053938608427046585,
+        0.053767969573459508, 0.053629722791089185, 0.053521109929200776, 0.053439083488364889,
+        0.053380336464102209, 0.053341334722880038, 0.053318351593571185, 0.053307504335886075,
+        0.053304792128990863, 0.053306135208725756, 0.053307414770663572, 0.053304513248823439,
+        0.053293354576242839, 0.05326994403384399, 0.053230407298116837, 0.053171028306026644,
+        0.053088285567171774, 0.052978886568449041, 0.052839799935175714, 0.052668285034599298,
+        0.052461918732765102, 0.052218619043578017, 0.051936665439308645, 0.051614715624455791,
+        0.051251818609474267, 0.050847423957064701, 0.05040138711115065, 0.04991397075696756,
+        0.049385842199491874, 0.048818066786352185, 0.048212097440031659, 0.047569760402185385,
+        0.046893237329909181, 0.046185043919438264, 0.045448005266672746, 0.044685228205795055,
+        0.043900070896756696, 0.043096109959264363, 0.042277105474844617, 0.041446964199366658,
+        0.040609701345850367, 0.03976940131132372, 0.03893017773177191, 0.038096133255737186,
+        0.037271319429846267, 0.036459697088392876, 0.035665097634139359, 0.034891185588744857,
+        0.034141422778778414, 0.03341903450724814, 0.032726978041132518, 0.032067913722729185,
+        0.031444178986955937, 0.030857765538309972, 0.030310299910273449, 0.02980302759687941,
+        0.029336800911208969, 0.028912070689151161, 0.02852888191915718, 0.0281868733403405,
+        0.027885281012480053, 0.027622945822659332, 0.027398324854800288, 0.027209506510597361,
+        0.027054229233701817, 0.026929903653794069, 0.026833637933775176, 0.026762266072015612,
+        0.026712378882734412, 0.026680357351430001, 0.02666240803909271, 0.026654600188928217,
+        0.02665290417271016, 0.026653230900809954, 0.026651471810567075, 0.026643539042035241,
+        0.026625405408337788, 0.026593143769906121, 0.026542965427725947, 0.02647125716033541,
+        0.026374616542600798, 0.02624988520111729, 0.026094179681273692, 0.025904919624387082,
+        0.025679852979626116, 0.025417078004445634, 0.025115061838659292, 0.024772655470783934,
+        0.024389104950564844, 0.02396405873829259, 0.023497571119289053, 0.022990101650407546,
+        0.022442510644180673, 0.021856050734978105, 0.021232354609833824, 0.020573419024083963,
+        0.019881585258271911, 0.019159516207546648, 0.01841017032769433, 0.017636772692655411,
+        0.016842783446602366, 0.016031863959108026, 0.015207841014371851, 0.014374669384675572,
+        0.013536393154017468, 0.01269710617007578, 0.011860912011157411, 0.011031883859516711,
+        0.010214024673324234, 0.0094112280466365026, 0.0086272401399771909, 0.0078656230536622851,
+        0.0071297200018861397, 0.0064226226279725431, 0.0057471407802550788, 0.0051057750439890632,
+        0.0045006922977479285, 0.0039337045331876465, 0.0034062511451564224, 0.0029193848651987535,
+        0.0024737614758863907, 0.0020696334064474924, 0.0017068472722243596, 0.0013848453819371063,
+        0.0011026711979462739, 0.00085897869606611798, 0.00065204553336549757, 0.00047978989516821678,
+        0.00033979085650535565, 0.00022931205892034841, 0.00014532847112002183, 8.4555971825626313e-05,
+        4.3483465591622951e-05, 1.8407217603592306e-05, 5.467071777148474e-06, 6.841980734496999e-07,
+        1.8193102703945193e-16, -6.8419807342703489e-07, -5.4670717770366911e-06, -1.8407217603563354e-05,
+        -4.3483465591640041e-05, -8.4555971825485339e-05, -0.00014532847111996584, -0.00022931205892013672,
+        -0.00033979085650519709, -0.00047978989516811612, -0.00065204553336532388, -0.00085897869606600598,
+        -0.0011026711979462444, -0.0013848453819370057, -0.0017068472722243254, -0.0020696334064475219,
+        -0.002473761475886258, -0.0029193848651986967, -0.0034062511451561951, -0.0039337045331874713,
+        -0.0045006922977478426, -0.0051057750439888533, -0.0057471407802549722, -0.0064226226279725414,
+        -0.0071297200018860096, -0.0078656230536622487, -0.0086272401399772082, -0.0094112280466363638,
+        -0.010214024673324176, -0.011031883859516485, -0.011860912011157276, -0.012697106170075681,
+        -0.013536393154017327, -0.014374669384675491, -0.015207841014371818, -0.016031863959107925,
+        -0.016842783446602332, -0.017636772692655411, -0.018410170327694184, -0.019159516207546586,
+        -0.019881585258271668, -0.020573419024083783, -0.021232354609833706, -0.021856050734977941,
+        -0.022442510644180576, -0.022990101650407518, -0.023497571119288938, -0.023964058738292597,
+        -0.024389104950564875, -0.024772655470783778, -0.025115061838659299, -0.025417078004445422,
+        -0.025679852979625953, -0.025904919624386999, -0.026094179681273512, -0.026249885201117186,
+        -0.026374616542600777, -0.026471257160335274, -0.026542965427725964, -0.026593143769906152,
+        -0.026625405408337677, -0.026643539042035237, -0.026651471810566877, -0.026653230900809732,
+        -0.026652904172710087, -0.02665460018892811, -0.026662408039092568, -0.026680357351429974,
+        -0.026712378882734252, -0.02676226607201557, -0.026833637933775183, -0.026929903653793847,
+        -0.027054229233701824, -0.027209506510597097, -0.027398324854800083, -0.027622945822659319,
+        -0.02788528101247989, -0.028186873340340379, -0.028528881919157097, -0.028912070689151047,
+        -0.029336800911208948, -0.029803027596879441, -0.0303102999102733, -0.030857765538309892,
+        -0.031444178986955701, -0.03206791372272897, -0.032726978041132566, -0.033419034507247952,
+        -0.034141422778778324, -0.034891185588744787, -0.035665097634139276, -0.036459697088392827,
+        -0.037271319429846281, -0.038096133255736991, -0.038930177731771785, -0.039769401311323539,
+        -0.04060970134585018, -0.041446964199366707, -0.042277105474844479, -0.043096109959264273,
+        -0.043900070896756696, -0.044685228205794937, -0.045448005266672607, -0.046185043919438298,
+        -0.046893237329908986, -0.047569760402185364, -0.048212097440031437, -0.048818066786352095,
+        -0.049385842199491846, -0.049913970756967421, -0.050401387111150484, -0.050847423957064701,
+        -0.051251818609474101, -0.051614715624455673, -0.051936665439308645, -0.052218619043577892,
+        -0.052461918732765088, -0.052668285034599131, -0.052839799935175603, -0.052978886568448923,
+        -0.053088285567171628, -0.053171028306026491, -0.053230407298116851, -0.053269944033843775,
+        -0.053293354576242707, -0.053304513248823418, -0.053307414770663399, -0.053306135208725777,
+        -0.053304792128990842, -0.053307504335885894, -0.053318351593571144, -0.053341334722879809,
+        -0.053380336464102132, -0.053439083488364812, -0.05352110992920063, -0.053629722791089109,
+        -0.053767969573459577, -0.053938608427046467, -0.05414408113477634, -0.054386489181800141,
+        -0.054667573149135833, -0.054988695632923475, -0.055350827856866999, -0.055754540109364648,
+        -0.056199996099451151, -0.056686951287395718, -0.057214755206941047, -0.057782357757154547,
+        -0.058388319403058941, -0.059030825185977291, -0.059707702407272405, -0.060416441813231019,
+        -0.061154222074577984, -0.061917937321864729, -0.062704227468066823, -0.063509511022417656,
+        -0.064330020075111127, -0.065161837111217868, -0.066000933294215844, -0.066843207845111316,
+        -0.067684528132335692, -0.068520770080591931, -0.06934785850363101, -0.070161806966608967,
+        -0.070958756788193952, -0.071735014800939356, -0.072487089500492582, -0.073211725229898508,
+        -0.073905934064390583, -0.074567025084479099, -0.075192630750618314, -0.075780730121010012,
+        -0.076329668684909452, -0.076838174616847402, -0.077305371292123448, -0.077730785940447841,
+        -0.078114354352337559, -0.078456421591438646, -0.078757738704990379, -0.079019455463758201,
+        -0.079243109201590695, -0.079430609862899529, -0.079584221403455904, -0.079706539725570527,
+        -0.07980046736265517, -0.079869185159977679, -0.079916121227841155, -0.079944917470152144,
+        -0.079959394015095567, -0.079963511895232639, -0.079961334341512785, -0.079956987069329036,
+        -0.079954617944686598, -0.079958356424693774, -0.079972273168883612, -0.080000340216297317,
+        -0.080046392117811602, -0.080114088403948513, -0.080206877755438361, -0.08032796422723873,
+        -0.080480275856727235, -0.080666435963550873, -0.080888737422369697, -0.081149120160745589,
+        -0.081449152102947994, -0.081790013746814855, -0.082172486525343647, -0.082596945067710939,
+        -0.083063353436334669, -0.083571265377740608, -0.084119828585759518, -0.08470779293636313,
+        -0.085333522614605833, -0.085995012016067268, -0.086689905268270667, -0.087415519182113016,
+        -0.088168869409770409, -0.088946699554138156, -0.089745512945941214, -0.090561606778504597,
+        -0.091391108267041055, -0.092230012479436602, -0.093074221469084922, -0.093919584327493033,
+        -0.094761937765289059, -0.095597146824999743, -0.09642114532756689, -0.097229975657069867,
+        -0.098019827494490716, -0.09878707512152636, -0.099528312929324458, -0.10024038878448192,
+        -0.10092043492548668, -0.1015658960868461, -0.10217455457516056, -0.10274455205112329,
+        -0.10327440780356828, -0.10376303333591783, -0.10420974312138143, -0.1046142614206811,
+        -0.10497672509453143, -0.10529768238224591, -0.1055780876572693, -0.10581929220976351,
+        -0.10602303114523878, -0.10619140652620873, -0.10632686692061601, -0.10643218355595749,
+        -0.10651042331126856, -0.10656491881011358, -0.10659923590615045, -0.10661713887840613,
+        -0.10662255367589082, -0.10661952957034544, -0.10661219959158807, -0.10660474013193857,
+        -0.10660133011443884, -0.10660611012396756, -0.10662314190083876, -0.10665636859304366,
+        -0.10670957615599951, -0.10678635627757779, -0.10689007119137987, -0.1070238207228809,
+        -0.10719041189134923, -0.10739233136554902, -0.10763172104344002, -0.10791035699562471,
+        -0.10822963197948282, -0.10859054169609637, -0.10899367492552774, -0.10943920763813673,
+        -0.10992690114079474, -0.11045610427741111, -0.11102575966356872, -0.11163441389561513,
+        -0.11228023163567973, -0.11296101343616601, -0.11367421713066471, -0.1144169825833047,
+        -0.11518615955566358, -0.11597833841980093, -0.11678988341805541, -0.11761696814525845,
+        -0.11845561290717668, -0.11930172359053413, -0.12015113166507141, -0.1209996349268961,
+        -0.12184303858500682, -0.12267719628937426, -0.12349805069940223, -0.1243016731959482,
+        -0.12508430234831669, -0.12584238075967369, -0.12657258993006326, -0.12727188279545032,
+        -0.12793751362382244, -0.12856706497511028, -0.12915847146028242, -0.12971004006617839,
+        -0.13022046684612831, -0.13068884981187012, -0.13111469789935518, -0.13149793591936984,
+        -0.13183890544311863, -0.13213836161264977, -0.13239746590582735, -0.13261777492512444,
+        -0.13280122531840871, -0.13295011497774206, -0.13306708069866227, -0.13315507251708766,
+        -0.13321732497353614, -0.13325732558449807, -0.13327878082819833, -0.13328557997640189,
+        -0.13328175712510304, -0.13327145179467356, -0.13325886848417348, -0.13324823557489932,
+        -0.13324376398475049, -0.13324960597759244, -0.13326981453042777, -0.13330830365588389,
+        -0.13336881006835047, -0.13345485656910133, -0.13356971750907973, -0.1337163866678536,
+        -0.13389754786375677, -0.13411554858364644, -0.13437237689131484, -0.13466964184161898,
+        -0.13500855759322841, -0.13538993137679436, -0.13581415543771469, -0.13628120303386584,
+        -0.13679062852905302, -0.13734157158290461, -0.13793276539789642, -0.13856254894449924,
+        -0.13922888304652431, -0.13992937017095772, -0.14066127773028411, -0.1414215646708919,
+        -0.14220691108892525, -0.14301375058524965, -0.1438383050442939, -0.14467662149771079,
+        -0.14552461071326828, -0.14637808713237438, -0.14723280976629227, -0.14808452365156421,
+        -0.14892900145953877, -0.14976208485320369, -0.1505797251868406, -0.15137802315026061,
+        -0.15215326696953718, -0.15290196879009324, -0.15362089888561978, -0.15430711735739466,
+        -0.15495800301297194, -0.15557127914065336, -0.15614503592637152, -0.15667774929234374,
+        -0.15716829597173029, -0.15761596467026159, -0.15802046320397706, -0.15838192154152389,
+        -0.15870089071945834, -0.15897833763934421, -0.15921563579568523, -0.15941455202356153,
+        -0.15957722939377011, -0.15970616642100122, -0.15980419278670802, -0.15987444181247865,
+        -0.1599203199516071, -0.15994547359582972, -0.1599537535205682, -0.15994917731527064,
+        -0.15993589016528423, -0.15991812436798419, -0.15990015797843027, -0.1598862729885189,
+        -0.15988071344833696, -0.15988764393918636, -0.15991110880449072, -0.15995499253758128,
+        -0.16002298171423218, -0.16011852884288608, -0.1602448184869508, -0.16040473599148808,
+        -0.16060083912131234, -0.16083533288920149, -0.16111004782186114, -0.16142642187779027,
+        -0.16178548619559413, -0.16218785481393339, -0.16263371846551844, -0.16312284250779976,
+        -0.16365456901256734, -0.16422782299603955, -0.16484112273052773, -0.16549259403881963,
+        -0.16617998843345505, -0.16690070492539602, -0.16765181529063927, -0.16843009254940383,
+        -0.16923204238100548, -0.17005393716867606, -0.17089185234274459, -0.17174170466793878,
+        -0.17259929210139918, -0.17346033483245413, -0.17432051710344271, -0.175175529403055,
+        -0.17602111061980172, -0.17685308974340258, -0.17766742670611366, -0.1784602519641951,
+        -0.17922790443185205, -0.17996696739588258, -0.18067430205882543, -0.18134707838140374,
+        -0.18198280292129701, -0.18257934339448756, -0.18313494971732519, -0.18364827132174244,
+        -0.18411837057237684, -0.18454473215238351, -0.18492726832406689, -0.18526632001073481,
+        -0.18556265368701627, -0.18581745410585113, -0.18603231293108283, -0.18620921338464771,
+        -0.18635051105638151, -0.18645891106205675, -0.18653744177107012, -0.18658942535884582,
+        -0.18661844547021336, -0.1866283123084084, -0.18662302548968263, -0.18660673502554545,
+        -0.18658370081314854, -0.18655825102912568, -0.18653473983313096, -0.18651750479428075,
+        -0.18651082445665546, -0.18651887645886367, -0.18654569661749515, -0.18659513937508423,
+        -0.18667084000008324, -0.18677617890943088, -0.18691424846375337, -0.18708782256124784,
+        -0.18729932932912746, -0.18755082718137525, -0.18784398447880121, -0.18818006299230264,
+        -0.18855990533316105, -0.18898392647551002, -0.18945210945617366, -0.18996400529627983,
+        -0.19051873714779949, -0.19111500862686109, -0.19175111625473043, -0.19242496588714159,
+        -0.19313409297360593, -0.1938756864507824, -0.19464661603835687, -0.19544346267247842,
+        -0.19626255178096574, -0.19709998907655113, -0.19795169851961808, -0.19881346208047523,
+        -0.19968096091340695, -0.20054981754069984, -0.20141563863475195, -0.20227405798026987,
+        -0.20312077919655794, -0.20395161780200433, -0.20476254220905704, -0.20554971324818269,
+        -0.20630952183346588, -0.20703862440043394, -0.20773397576825148, -0.20839285910341618,
+        -0.20901291269022199, -0.20959215324430627, -0.21012899553923634, -0.21062226815199897,
+        -0.21107122517108792, -0.21147555375026464, -0.21183537743160605, -0.21215125520278583,
+        -0.21242417629520521, -0.21265555077124582, -0.2128471959901134, -0.21300131908209025,
+        -0.213120495600123, -0.2132076445551459, -0.2132660000770287, -0.21329907997617567,
+        -0.21331065151127726, -0.21330469469621469, -0.21328536350339675, -0.2132569453415851,
+        -0.2132238192033746, -0.21319041289075524, -0.21316115973644043, -0.21314045524384923,
+        -0.21313261406968628, -0.21314182776997853, -0.21317212372323663, -0.21322732563315805,
+        -0.21331101599809438, -0.21342650091553739, -0.213576777567269, -0.21376450470483965,
+        -0.21399197642590737, -0.21426109949997962, -0.21457337446756794, -0.21492988070001104,
+        -0.21533126556861959, -0.21577773783172122, -0.21626906530700776, -0.2168045768547302,
+        -0.21738316865517349, -0.21800331472182138, -0.21866308155018804, -0.21936014676178819,
+        -0.22009182156356175, -0.22085507680564451, -0.22164657238506269, -0.22246268971002944,
+        -0.2232995669094299, -0.22415313644501583, -0.22501916476011607, -0.22589329357851945,
+        -0.2267710824507824, -0.22764805213276382, -0.22851972837275469, -0.22938168567931111,
+        -0.23022959064178114, -0.23105924437961622, -0.23186662370477609, -0.23264792059384393,
+        -0.23339957958272514, -0.23411833271683236, -0.23480123171333744, -0.23544567701906807,
+        -0.23604944347777873, -0.23661070235347359, -0.23712803949191377, -0.23760046944004676,
+        -0.2380274453824999, -0.23840886479506238, -0.23874507075691295, -0.23903684890572671,
+        -0.23928542006240636, -0.23949242859453124, -0.23965992662932475, -0.23979035426761466,
+        -0.23988651598944591, -0.23995155347939179, -0.23998891513476636, -0.2400023225525586,
+        -0.23999573432066554, -0.23997330746558063, -0.23993935693186103, -0.23989831348820942,
+        -0.23985468047066524, -0.23981298978507201, -0.23977775759852885, -0.23975344015287417,
+        -0.23974439013238599, -0.23975481401276016, -0.23978873080914567, -0.23984993262764787,
+        -0.23994194740735691, -0.24006800421883667, -0.2402310014602643, -0.24043347826434652,
+        -0.24067758939795647, -0.24096508390251109, -0.24129728768669478, -0.24167509024467007,
+        -0.24209893563268928, -0.24256881779549302, -0.24308428029141912, -0.24364442042216941,
+        -0.24424789773013009, -0.24489294678339626, -0.2455773941266868, -0.24629867923549809,
+        -0.24705387927159767, -0.24783973740062173, -0.24865269439755747, -0.24948892323351313,
+        -0.25034436630781659, -0.25121477496335776, -0.25209575090049657, -0.25298278908599331,
+        -0.25387132173851257, -0.25475676296138622, -0.25563455358668374, -0.25650020579222899,
+        -0.257349347055085, -0.25817776301119438, -0.25898143880120783, -0.2597565984970282,
+        -0.26049974222204297, -0.26120768060026561, -0.26187756619544483, -0.26250692163037032,
+        -0.26309366410880913, -0.26363612609747988, -0.26413307196281749, -0.26458371039666828,
+        -0.26498770250611353, -0.26534516548489723, -0.26565667182708252, -0.26592324408710571,
+        -0.26614634523395425, -0.26632786469029929, -0.26647010018968692, -0.26657573562587511,
+        -0.26664781510773333, -0.26668971347039805, -0.2667051035282052, -0.26669792038703405,
+        -0.26667232316267725, -0.26663265447750484, -0.26658339812971249, -0.26652913534762473,
+        -0.26647450005568812, -0.26642413358880984, -0.26638263929742773, -0.26635453748713989,
+        -0.26634422113380424, -0.26635591280779397, -0.26639362322963411, -0.26646111186362914,
+        -0.26656184993650722, -0.26669898624470639, -0.26687531608697135, -0.26709325362863301,
+        -0.26735480797066569, -0.26766156316059447, -0.26801466234400234, -0.26841479621505338,
+        -0.26886219588255417, -0.26935663022499545, -0.26989740776419069, -0.27048338304297292,
+        -0.27111296744835306, -0.2717841443780456, -0.27249448860569592, -0.27324118965898392,
+        -0.27402107898537759, -0.27483066064308787, -0.27566614522009963, -0.27652348665231402,
+        -0.27739842158323691, -0.27828651088247924, -0.27918318291891059, -0.28008377816679569,
+        -0.28098359470986345, -0.2818779341990888, -0.28276214781516867, -0.2836316817862265,
+        -0.28448212201524414, -0.28530923738005037, -0.28610902128128046, -0.28687773103049419,
+        -0.28761192469140051, -0.28830849501170103, -0.28896470011119574, -0.2895781906232216,
+        -0.29014703302089928, -0.29066972889673909, -0.29114523000351322, -0.29157294890557811,
+        -0.29195276513262408, -0.29228502677169138, -0.29257054747785743, -0.29281059892875971,
+        -0.29300689879269809, -0.29316159432398509, -0.29327724174206427, -0.29335678159229178,
+        -0.29340351032572276, -0.29342104837244509, -0.29341330501751872, -0.29338444042012757,
+        -0.2933388251447796, -0.29328099759806175, -0.29321561978527638, -0.29314743181809694,
+        -0.29308120561697792, -0.29302169826033381, -0.29297360543636281, -0.29294151545280311,
+        -0.29292986425487094, -0.29294289189218414, -0.29298460086170758, -0.29305871673580902,
+        -0.29316865146254795, -0.29331746969954142, -0.29350785851343342, -0.29374210074438961,
+        -0.29402205229947204, -0.29434912360060311, -0.29472426537238749, -0.29514795891281687,
+        -0.29562021094618618, -0.29614055311283194, -0.29670804610501866, -0.29732128841289129,
+        -0.2979784295992905, -0.29867718797787624, -0.29941487252583471, -0.30018840882088327,
+        -0.30099436875273072, -0.30182900372203336, -0.30268828100548023, -0.30356792293442297,
+        -0.30446344850658053, -0.30537021702623157, -0.30628347334805611, -0.30719839428373602,
+        -0.3081101357186008, -0.30901387997825519, -0.30990488298221913, -0.31077852072326601,
+        -0.31163033461727252, -0.31245607527901775, -0.31325174429431629, -0.31401363357805145,
+        -0.31473836193087629, -0.31542290843436266, -0.31606464235494847, -0.31666134926083345,
+        -0.31721125309272447, -0.31771303396862943, -0.31816584154440269, -0.31856930379501247,
+        -0.31892353112615196, -0.3192291157713763, -0.31948712647600441, -0.31969909851510087,
+        -0.31986701913853532, -0.31999330858090375, -0.32008079681760576, -0.32013269629014746,
+        -0.32015257086336385, -0.32014430131436467, -0.32011204768721707, -0.32006020887835707,
+        -0.31999337984516613, -0.31991630685378292, -0.31983384120180636, -0.31975089186690203,
+        -0.31967237754328309, -0.31960317853447989, -0.31954808897270298, -0.319511769832381,
+        -0.31949870319817203, -0.31951314823594246, -0.31955909929902221, -0.31964024658160162,
+        -0.31975993970666428, -0.31992115460753784, -0.32012646403032941, -0.32037801194942889,
+        -0.32067749215032115, -0.32102613119344836, -0.32142467593026686, -0.32187338569829083,
+        -0.3223720292763233, -0.32291988663459054, -0.32351575546767303, -0.32415796245133521,
+        -0.32484437911811392, -0.32557244220125092, -0.32633917825272085, -0.32714123229909298,
+        -0.32797490025925463, -0.32883616481094052, -0.32972073435897409, -0.33062408472741855,
+        -0.33154150317081332, -0.33246813427656502, -0.33339902731161952, -0.33432918455193961,
+        -0.33525361012321353, -0.3361673588757278, -0.33706558481547677, -0.33794358861742357,
+        -0.33879686375528734, -0.33962114079525474, -0.34041242941848671, -0.34116705775902506,
+        -0.34188170866950335, -0.34255345255668834, -0.34317977646203823, -0.34375860909879841,
+        -0.34428834159641536, -0.3447678437447132, -0.34519647557407385, -0.34557409415328039,
+        -0.34590105553330686, -0.34617821181272296, -0.34640690334805829, -0.34658894617995256,
+        -0.34672661479279338, -0.34682262037127448, -0.34688008476154164, -0.34690251038679892,
+        -0.34689374640709619, -0.34685795145004683, -0.34679955327313455, -0.3467232057486479,
+        -0.34663374358891225, -0.34653613525204285, -0.34643543448672076, -0.34633673098831869,
+        -0.34624510064792607, -0.34616555588033038, -0.34610299651680371, -0.34606216174355253,
+        -0.3460475835570247, -0.34606354219295121, -0.34611402396723751, -0.34620268194371934,
+        -0.34633279981664467, -0.34650725936473592, -0.34672851179919423, -0.3469985532902819,
+        -0.34731890491660328, -0.34769059723823836, -0.34811415964989983, -0.34858961462373411,
+        -0.3491164769037044, -0.34969375766514899, -0.35031997360457651, -0.35099316087652405,
+        -0.35171089374680004, -0.35247030778518901, -0.35326812737608387, -0.35410069728305449,
+        -0.35496401796340765, -0.35585378429177139, -0.35676542731801564, -0.35769415865470577,
+        -0.35863501706310924, -0.35958291678476229, -0.36053269714801767, -0.36147917296595755,
+        -0.36241718523376748, -0.36334165163013543, -0.36424761632858599, -0.36513029863081575,
+        -0.36598513994502807, -0.36680784864789356, -0.36759444238888489, -0.36834128742023398,
+        -0.36904513456433319, -0.36970315146281119, -0.3703129507874548, -0.37087261413222461,
+        -0.37138071134753686, -0.37183631512221288, -0.37223901066476894, -0.37258890038343129,
+        -0.37288660351304537, -0.37313325068639153, -0.3733304734968429, -0.37348038914833742,
+        -0.37358558033677358, -0.3736490705537508, -0.37367429504855509, -0.37366506772704422,
+        -0.37362554430613121, -0.37356018207959873, -0.37347369668450964, -0.37337101628731451,
+        -0.3732572336344932, -0.37313755643397756, -0.37301725655053952, -0.37290161851047621,
+        -0.37279588781833589, -0.37270521959086056, -0.37263462801086261, -0.37258893709636098,
+        -0.3725727332680604, -0.37259032018128113, -0.37264567626688405, -0.37274241539982073,
+        -0.37288375108387029, -0.37307246450724268, -0.37331087678632957, -0.37360082567433694,
+        -0.37394364696822391, -0.37434016080173588, -0.37479066296478791, -0.37529492134048387,
+        -0.37585217750114125, -0.37646115345429959, -0.37712006347933158, -0.37782663094542263,
+        -0.37857810995284386, -0.37937131159208631, -0.38020263456999748, -0.3810680999090631,
+        -0.38196338938574659, -0.38288388733683965, -0.38382472542934115, -0.38478082995990498,
+        -0.38574697122458346, -0.38671781447877307, -0.38768797199108079, -0.38865205568349659,
+        -0.38960472984386302, -0.3905407633952464, -0.39145508121048261, -0.3923428139688257,
+        -0.39319934606522172, -0.39402036110113953, -0.39480188450889014, -0.39554032288882862,
+        -0.39623249967039531, -0.3968756867433903, -0.39746763174480204, -0.39800658072857498,
+        -0.39849129599046923, -0.39892106886724482, -0.39929572737828767, -0.39961563862804883,
+        -0.39988170593878264, -0.40009536073455393, -0.40025854924882337, -0.40037371417863149,
+        -0.40044377145797755, -0.40047208237093845, -0.40046242127093357, -0.40041893921586214,
+        -0.40034612386919605, -0.400248756054079, -0.40013186338075085, -0.4000006713967878,
+        -0.39986055273448573, -0.39971697474994961, -0.39957544616386398, -0.39944146322438523,
+        -0.39932045591798077, -0.39921773475429684, -0.39913843864623716, -0.39908748439645719,
+        -0.39906951828647536, -0.39908887024472206, -0.39914951104530538, -0.3992550129602549,
+        -0.39940851425483997, -0.39961268787851112, -0.39986971466350196, -0.40018126129947634,
+        -0.40054846330629457, -0.40097191317841491, -0.40145165382412179, -0.40198717737118883,
+        -0.40257742935820534, -0.40322081827817241, -0.40391523038860361, -0.4046580496507397,
+        -0.40544618261016707, -0.40627608798252579, -0.40714381066168087, -0.40804501982407237,
+        -0.40897505076246365, -0.40992895004530305, -0.41090152356484511, -0.4118873870082943,
+        -0.41288101826188267, -0.41387681123819414, -0.41486913060239983, -0.41585236686352223,
+        -0.41682099129251998, -0.41776961012988117, -0.41869301755160654, -0.41958624687382129,
+        -0.42044461949271583, -0.42126379107794631, -0.4220397945637584, -0.42276907951275033,
+        -0.4234485474620393, -0.42407558290029884, -0.42464807956633738, -0.4251644618051757,
+        -0.42562370076552575, -0.42602532527266734, -0.42636942726255928, -0.42665666171600858,
+        -0.42688824108540818, -0.42706592426039053, -0.42719200017220277, -0.42726926618916927,
+        -0.42730100150676903, -0.42729093578508548, -0.42724321333323351, -0.42716235318434942,
+        -0.42705320544542419, -0.42692090434324576, -0.42677081842066139, -0.42660849836590442,
+        -0.42643962298159827, -0.42626994381900613, -0.42610522901692954, -0.42595120689325672,
+        -0.42581350984040101, -0.42569761907374531, -0.42560881077468876, -0.42555210415709122,
+        -0.42553221196790492, -0.42555349390976677, -0.42561991344550204, -0.4257349984121232,
+        -0.42590180583533616, -0.42612289129507208, -0.42640028314863204, -0.42673546187100203,
+        -0.42712934472226377, -0.42758227590027914, -0.42809402228342963, -0.4286637748137242,
+        -0.42929015551549454, -0.42997123008981969, -0.43070452597019954, -0.43148705567143569,
+        -0.43231534521165482, -0.43318546733749136, -0.43409307923503321, -0.43503346436481005,
+        -0.43600157801820022, -0.43699209615562618, -0.43799946705412385, -0.43901796526366704,
+        -0.4400417473482629, -0.44106490886955652, -0.44208154205767969, -0.44308579360647399,
+        -0.44407192202811413, -0.44503435400555541, -0.44596773919015364, -0.44686700290609366,
+        -0.44772739624289271, -0.4485445430419383, -0.44931448331258989, -0.45003371264754438,
+        -0.45069921724557571, -0.45130850419207824, -0.45185962669364049, -0.45235120401171308,
+        -0.4527824358918483, -0.45315311133847352, -0.45346361164019489, -0.45371490760668221,
+        -0.45390855103471661, -0.45404666047741904, -0.45413190144650573, -0.45416746123204454,
+        -0.45415701857710966, -0.45410470849542772, -0.45401508256806028, -0.45389306509991789,
+        -0.45374390555801314, -0.45357312775039726, -0.45338647623734557, -0.45318986049424981,
+        -0.45298929736848853, -0.45279085239014594, -0.45260058050857993, -0.45242446683340443,
+        -0.45226836795937625, -0.45213795444993704, -0.45203865504378765, -0.45197560313299417,
+        -0.45195358603980768, -0.45197699759293763, -0.45204979447258636, -0.45217545675750292,
+        -0.45235695306696944, -0.45259671064638302, -0.45289659069734228, -0.45325786920240613,
+        -0.45368122344138312, -0.45416672434071637, -0.45471383474074795, -0.455321413607916,
+        -0.45598772616089706, -0.45671045982181679, -0.45748674584655225, -0.45831318643239527,
+        -0.45918588704744323, -0.46010049367458206, -0.46105223461438366, -0.46203596644601841,
+        -0.46304622370397142, -0.46407727179124242, -0.46512316261724218, -0.46617779242106572,
+        -0.46723496121853331, -0.46828843329451625, -0.46933199815084892, -0.47035953131464314,
+        -0.47136505441212834, -0.4723427939192984, -0.47328723801251937, -0.47419319095983964,
+        -0.47505582451677558, -0.47587072581869616, -0.47663394129527242, -0.4773420161705143,
+        -0.47799202915427985, -0.47858162197747273, -0.47910902347290352, -0.47957306795660765,
+        -0.47997320771967034, -0.48030951949785522, -0.48058270484496141, -0.48079408439530591,
+        -0.48094558606042354, -0.48103972726446992, -0.48107959138127826, -0.48106879859297919,
+        -0.48101147144504819, -0.4809121954249676, -0.48077597494095031, -0.48060818512280462,
+        -0.48041451990864514, -0.48020093691829452, -0.47997359964656106, -0.47973881753673564,
+        -0.47950298451641288, -0.47927251659383574, -0.4790537891232407, -0.47885307435204416,
+        -0.47867647986107592, -0.47852988850147266, -0.47841890041831758, -0.47834877773182011,
+        -0.47832439242189018, -0.47835017793168322, -0.47843008497027284, -0.47856754195446938,
+        -0.47876542048527504, -0.47902600620596969, -0.47935097533689236, -0.47974137712701564,
+        -0.48019762240504665, -0.48071947835348616, -0.48130606956849381, -0.48195588540706752,
+        -0.48266679356160069, -0.48343605974087739, -0.48426037327665727, -0.48513587841673106,
+        -0.48605821100927626, -0.48702254023009767, -0.48802361495436203, -0.48905581432827838,
+        -0.49011320205427755, -0.49118958386599842, -0.49227856763721911, -0.4933736255420369,
+        -0.494468157662451, -0.49555555642416144, -0.49662927123213874, -0.49768287267431693,
+        -0.49871011566479273, -0.49970500090703002, -0.50066183407281972, -0.50157528211386626,
+        -0.5024404261497869, -0.50325281040867942, -0.50400848673397891, -0.50470405421371489,
+        -0.50533669353506938, -0.50590419571795364, -0.50640498493554542, -0.50683813518697118,
+        -0.50720338064695936, -0.50750111957872324, -0.50773241175905359, -0.50789896942790358,
+        -0.50800314183806738, -0.50804789354327384, -0.50803677662448599, -0.50797389711385743,
+        -0.50786387593303028, -0.50771180471670951, -0.50752319694319104, -0.50730393484024527,
+        -0.50706021257698852, -0.50679847628970964, -0.50652536152166661, -0.50624762868333395,
+        -0.50597209716013736, -0.50570557870921817, -0.50545481079502208, -0.50522639051541485,
+        -0.50502670976559927, -0.50486189227631806, -0.5047377331458075, -0.50465964146187359,
+        -0.50463258658145815, -0.50466104860049776, -0.50474897350700587, -0.50489973346555117,
+        -0.50511609263207002, -0.50540017884472255, -0.50575346147978462, -0.50617673570190813,
+        -0.50667011327603773, -0.5072330200445242, -0.50786420010800348, -0.50856172668318145,
+        -0.50932301954535519, -0.51014486889893107, -0.51102346545605193, -0.51195443644230398,
+        -0.5129328871899439, -0.51395344792376874, -0.51501032529314927, -0.51609735815643143,
+        -0.5172080770812818, -0.51833576698711648, -0.51947353232380444, -0.52061436415476903,
+        -0.52175120849264822, -0.52287703522203965, -0.52398490693669597, -0.52506804701793075,
+        -0.52611990628697403, -0.52713422757651085, -0.52810510758557405, -0.52902705540714412,
+        -0.52989504714900015, -0.53070457610531852, -0.53145169797880421, -0.53213307070044624,
+        -0.53274598844580145, -0.53328840950255529, -0.53375897770346536, -0.53415703720103747,
+        -0.53448264042490035, -0.53473654912909874, -0.53492022850387444, -0.53503583439423386,
+        -0.53508619373506194, -0.53507477837907413, -0.53500567255888831, -0.53488353428722379,
+        -0.53471355105916263, -0.5345013902769169, -0.5342531448700405, -0.5339752746320483,
+        -0.53367454383742652, -0.53335795574063105, -0.53303268459049769, -0.53270600581917593,
+        -0.53238522508403785, -0.53207760685372385, -0.531790303235537, -0.53153028374055833,
+        -0.5313042666753216, -0.53111865283450554, -0.53097946214816283, -0.53089227390960414,
+        -0.5308621711764977, -0.53089368989829133, -0.53099077327815203, -0.53115673182761125,
+        -0.53139420951752458, -0.53170515637029225, -0.53209080777614026, -0.53255167075118626,
+        -0.53308751728768222, -0.53369738487786367, -0.53437958422289789, -0.53513171406826165,
+        -0.53595068303707072, -0.53683273826420275, -0.5377735005671449, -0.53876800582497819,
+        -0.53981075217548868, -0.54089575258262712, -0.54201659227298338, -0.54316649049121157,
+        -0.54433836598081786, -0.54552490555893451, -0.54671863512195984, -0.54791199239364452,
+        -0.54909740070852509, -0.55026734311182501, -0.55141443605213536, -0.55253150194545231,
+        -0.55361163989845708, -0.55464829389520198, -0.55563531777451536, -0.55656703635516136,
+        -0.55743830210191614, -0.55824454676782143, -0.55898182749563075, -0.55964686691433985,
+        -0.56023708682427653, -0.56075063512587764, -0.56118640571247391, -0.56154405111549288,
+        -0.56182398776077891, -0.56202739376660416, -0.56215619928665406, -0.5622130694741293,
+        -0.56220138021539856, -0.56212518685265467, -0.561989186184082, -0.56179867209643275,
+        -0.56155948524802146, -0.56127795727930918, -0.56096085008290542, -0.56061529071440752,
+        -0.5602487025695515, -0.55986873349116739, -0.55948318150109566, -0.55909991887717048,
+        -0.55872681531332957, -0.55837166091173185, -0.55804208975927538, -0.55774550483708496,
+        -0.55748900500041199, -0.55727931474799619, -0.55712271747451403, -0.55702499286744778,
+        -0.55699135907089425, -0.5570264201938363, -0.55713411968962545, -0.55731770007743253,
+        -0.55757966941562087, -0.55792177487208339, -0.55834498366814389, -0.55884947160123588,
+        -0.55943461927809635, -0.5600990161151902, -0.56084047208732102, -0.56165603712966072,
+        -0.56254202802336484, -0.56349406252142231, -0.56450710039997276, -0.56557549105186578,
+        -0.56669302717431769, -0.56785300404177363, -0.56904828379923689, -0.57027136416073676,
+        -0.57151445085300578, -0.5727695331060656, -0.5740284614608373, -0.57528302713933199,
+        -0.57652504220569467, -0.57774641973663576, -0.5789392532175841, -0.58009589438643083,
+        -0.58120902875976854, -0.58227174809719007, -0.58327761908710385, -0.5842207475725345,
+        -0.58509583767713624, -0.58589824523973233, -0.58662402501972954, -0.58726997119515933,
+        -0.58783365073933103, -0.5883134293305492, -0.58870848952136434, -0.58901884096868506,
+        -0.58924532260313556, -0.58938959669443736, -0.58945413484866094, -0.58944219605210957,
+        -0.58935779695461687, -0.58920567466138751, -0.5889912423764192, -0.58872053831135629,
+        -0.58840016834052589, -0.58803724294535775, -0.58763930904866069, -0.58721427739083065,
+        -0.58677034614541035, -0.58631592151012291, -0.58585953604107643, -0.58540976552203816,
+        -0.5849751451772065, -0.58456408604457599, -0.58418479232772536, -0.58384518053659318,
+        -0.58355280121261766, -0.58331476401061655, -0.58313766687916258, -0.58302753004329821,
+        -0.58298973544849031, -0.58302897227327488, -0.58314918906047009, -0.58335355295376345,
+        -0.58364441645845677, -0.58402329207285208, -0.5844908350608754, -0.58504683455779083,
+        -0.58569021311998792, -0.58641903474769996, -0.58723052132679465, -0.58812107735339625,
+        -0.5890863227238079, -0.59012113329276517, -0.59121968882633413, -0.59237552790241244,
+        -0.59358160924266512, -0.59483037889535062, -0.59611384262967981, -0.59742364284952987,
+        -0.59875113928818824, -0.60008749270666772, -0.60142375078650356, -0.60275093538413371,
+        -0.60406013029815842, -0.60534256869327141, -0.60658971932545513, -0.60779337072216799,
+        -0.60894571248873641, -0.61003941293770658, -0.61106769227144686, -0.61202439058939462,
+        -0.61290403003970662, -0.61370187049019964, -0.61441395815486854, -0.61503716667940178,
+        -0.61556923026118771, -0.61600876845590047, -0.61635530240279757, -0.61660926228393176,
+        -0.6167719859174674, -0.6168457084716199, -0.61683354337238039, -0.61673945456443524,
+        -0.616568220369627, -0.6163253892701106, -0.61601722802322845, -0.61565066259130374,
+        -0.61523321244118934, -0.61477291883490071, -0.61427826779328387, -0.61375810846880985,
+        -0.61322156771073311, -0.61267796164546917, -0.61213670512682383, -0.6116072199341287,
+        -0.61109884261141179, -0.61062073284698859, -0.61018178329047268, -0.60979053169299946,
+        -0.60945507623657191, -0.60918299489007399, -0.60898126959283438, -0.60885621602203854,
+        -0.60881341964819646, -0.60885767872371876, -0.60899295478403881, -0.60922233116921587,
+        -0.60954797999728183, -0.60997113793946811, -0.61049209106262803, -0.6111101689164975,
+        -0.61182374795375272, -0.61263026427998502, -0.61352623563957531, -0.61450729245301383,
+        -0.61556821763218328, -0.61670299481353952, -0.61790486456574356, -0.61916638804897317,
+        -0.62047951752866748, -0.62183567307753673, -0.62322582473706867, -0.62464057935400752,
+        -0.62607027125904768, -0.62750505591467465, -0.62893500562718452, -0.63035020639473949,
+        -0.63174085494907706, -0.6330973550434652, -0.63441041204363358, -0.63567112489180611,
+        -0.63687107453644642, -0.63800240795176866, -0.63905791691112468, -0.64003111072676178,
+        -0.6409162822246548, -0.6417085662866443, -0.64240399036241036, -0.64299951643012032,
+        -0.64349307396629796, -0.64388358357169317, -0.64417097098994047, -0.64435617134866374,
+        -0.64444112354752914, -0.6444287548136689, -0.64432295554097263, -0.64412854462495084,
+        -0.64385122559843155, -0.6434975339641873, -0.64307477620792963, -0.64259096105800007,
+        -0.64205472363576976, -0.64147524321244354, -0.64086215535287472, -0.6402254592845793,
+        -0.63957542137972045, -0.63892247567892824, -0.63827712241800538, -0.63764982554153948,
+        -0.63705091020079907, -0.63649046123708541, -0.63597822364567158, -0.63552350599972618,
+        -0.63513508778827865, -0.63482113158754494, -0.63458910094108056, -0.63444568477174013,
+        -0.634396729087634, -0.63444717667591233, -0.63460101540277392, -0.63486123565638974,
+        -0.63522979738217955, -0.63570760706793361, -0.63629450494047635, -0.63698926253692545,
+        -0.63778959071292296, -0.63869215804862656, -0.63969261951165091, -0.64078565513549135,
+        -0.64196501837337594, -0.64322359369177595, -0.64455346287602366, -0.64594597943346843,
+        -0.6473918503983036, -0.64888122476731003, -0.65040378772815788, -0.6519488597821923,
+        -0.65350549981246264, -0.65506261110563191, -0.65660904930378616, -0.6581337312394101,
+        -0.65962574359416504, -0.6610744503197199, -0.66246959776689818, -0.66380141648765212,
+        -0.66506071870284422, -0.66623899046716994, -0.66732847761052549, -0.66832226459224642,
+        -0.66921434547038861, -0.66999968626203332, -0.67067427805171942, -0.6712351802928368,
+        -0.67168055384028358, -0.67200968335103417, -0.6722229887915363, -0.67232202589608003,
+        -0.67230947552742459, -0.67218912199903369, -0.67196582052618392, -0.67164545407989018,
+        -0.67123488002209264, -0.67074186700171479, -0.67017502268814444, -0.6695437130103814,
+        -0.66885797365566224, -0.66812841465991979, -0.66736611899321763, -0.66658253610552698,
+        -0.66578937145135475, -0.66499847305509141, -0.66422171621219095, -0.66347088744399585,
+        -0.6627575688359072, -0.66209302388953295, -0.66148808600940823, -0.66095305072382049,
+        -0.66049757270746501, -0.66013056863129349, -0.6598601268123947, -0.65969342457451263,
+        -0.65963665415850459, -0.65969495794213862, -0.65987237364115603, -0.66017179006900628,
+        -0.6605949139321714, -0.66114224803246513, -0.66181308113801229, -0.66260548967204347,
+        -0.66351635125397646, -0.66454137001193803, -0.66567511347071762, -0.66691106070546635,
+        -0.66824166134030705, -0.6696584048634342, -0.67115189962745236, -0.67271196080651618,
+        -0.67432770649133056, -0.67598766102017738, -0.67767986456961971, -0.67939198796321032,
+        -0.68111145160109321, -0.68282554736834045, -0.6845215623457731, -0.6861869031242056,
+        -0.68780921951183205, -0.68937652642496483, -0.69087732276461278, -0.69230070610540373,
+        -0.6936364820588371, -0.69487526721965742, -0.6960085846616888, -0.69702895101741658,
+        -0.69792995425320214, -0.69870632133862509, -0.6993539751032789, -0.69987007967642834,
+        -0.70025307401344739, -0.70050269312669045, -0.70061997675654453, -0.70060726533950668,
+        -0.7004681832532561, -0.70020760944255855, -0.69983163565322559, -0.69934751262320327,
+        -0.69876358469876187, -0.69808921345875818, -0.69733469103975732, -0.69651114395838976,
+        -0.69563042832368283, -0.69470501742021273, -0.6937478827218776, -0.69277236946519993,
+        -0.69179206796940407, -0.69082068193768542, -0.68987189500941126, -0.68895923685616056,
+        -0.68809595012521352, -0.68729485953218017, -0.68656824438984354, -0.68592771583312562,
+        -0.68538409996051797, -0.68494732806067493, -0.68462633502963854, -0.68442896700985323,
+        -0.68436189919744461, -0.68443056466990471, -0.68463909498329412, -0.68499027317717553,
+        -0.68548549970793327, -0.68612477170782682, -0.68690667583944054, -0.68782839488416347,
+        -0.68888572807037007, -0.69007312501322959, -0.69138373300494427, -0.69280945726292287,
+        -0.69434103361527899, -0.69596811297933137, -0.69767935687065197, -0.69946254306900357,
+        -0.70130468046407191, -0.70319213200955188, -0.70511074462966572, -0.70704598484849634,
+        -0.70898307885045919, -0.71090715563029028, -0.71280339185388553, -0.71465715702738619,
+        -0.71645415756149455, -0.71818057832130811, -0.71982322026889201, -0.72136963283643651,
+        -0.72280823971182684, -0.72412845677546278, -0.72532080099676155, -0.72637698918027316,
+        -0.7272900255440925, -0.72805427721634286, -0.72866553684806179, -0.72912107166174644,
+        -0.72941965838300871, -0.72956160363705469, -0.72954874953074622, -0.72938446428351644,
+        -0.72907361791504222, -0.72862254314290598, -0.72803898178814974, -0.72733201712917073,
+        -0.72651199278347578, -0.72559041883106912, -0.72457986602123681, -0.72349384902513914,
+        -0.72234669980849864, -0.72115343230083606, -0.7199295996289824, -0.71869114526211109,
+        -0.71745424948241399, -0.71623517264911662, -0.71505009676312159, -0.71391496686481237,
+        -0.71284533380805948, -0.71185619994905736, -0.71096186926928318, -0.71017580341770004,
+        -0.70951048510848624, -0.70897729024763623, -0.7085863700850441, -0.70834654459901081,
+        -0.70826520821817507, -0.70834824887262204, -0.7085999812424042, -0.7090230949390498,
+        -0.70961861821502059, -0.7103858976489007, -0.71132259410169618, -0.71242469508341089,
+        -0.71368654351059035, -0.71510088267631089, -0.71665891709554974, -0.71835038873274204,
+        -0.72016366796594888, -0.72208585849503115, -0.72410291526097703, -0.7261997743114188,
+        -0.72836049342482301, -0.73056840219394992, -0.73280626016924111, -0.73505642157575168,
+        -0.73730100504404927, -0.73952206673695187, -0.74170177521071656, -0.74382258632184606,
+        -0.7458674164793998, -0.74781981254777219, -0.74966411672650013, -0.75138562477143567,
+        -0.75297073597564568, -0.75440709339790657, -0.75568371291137204, -0.75679109974396996,
+        -0.75772135129460827, -0.75846824513426669, -0.75902731123738598, -0.75939588763550658,
+        -0.75957315884032617, -0.75956017654596508, -0.7593598622886617, -0.75897699191474077,
+        -0.75841816188296995, -0.75769173760355502, -0.75680778419144223, -0.75577798018449482,
+        -0.75461551494593238, -0.75333497063332877, -0.751952189772086, -0.75048412961787481,
+        -0.74894870462867835, -0.74736461849146918, -0.74575118725977396, -0.74412815525538267,
+        -0.74251550546919787, -0.74093326626174771, -0.73940131621250771, -0.73793918899830924,
+        -0.73656588019429559, -0.73529965788593166, -0.73415787895731532, -0.73315681287968903,
+        -0.73231147476473546, -0.73163546937056501, -0.73114084765474197, -0.73083797735910583,
+        -0.7307354289864606, -0.73083987839047604, -0.73115602704867233, -0.73168654092540786,
+        -0.73243200865897096, -0.73339091962565306, -0.73455966224581704, -0.73593254270418618,
+        -0.73750182406071019, -0.73925778553122201, -0.74118880152063504, -0.74328143979749262,
+        -0.7455205780091132, -0.74788953755335519, -0.75037023364777555, -0.75294334027161347,
+        -0.75558846850205197, -0.75828435662538618, -0.76100907027724507, -0.76374021075546861,
+        -0.76645512955556638, -0.76913114710309283, -0.77174577360051089, -0.77427692986894769,
+        -0.77670316604809619, -0.77900387602082044, -0.78115950545276869, -0.78315175138154924,
+        -0.78496375135443974, -0.78658026019771188, -0.78798781260391937, -0.78917486984491358,
+        -0.79013194905707063, -0.79085173369992567, -0.79132916395883746, -0.79156150604490616,
+        -0.79154839953953016, -0.7912918821349324, -0.79079639133385171, -0.79006874288946316,
+        -0.78911808598831867, -0.78795583540277836, -0.78659558106272154, -0.78505297571731603,
+        -0.78334560157407251, -0.78149281701220086, -0.77951558466846016, -0.77743628238413132,
+        -0.77527849867966958, -0.77306681458709159, -0.77082657381765385, -0.76858364337223617,
+        -0.76636416681276132, -0.76419431250368386, -0.76210001920203829, -0.76010674142194889,
+        -0.75823919702416354, -0.75652111948266065, -0.75497501725857719, -0.75362194266640481,
+        -0.75248127254907493, -0.75157050298743378, -0.75090506015648439, -0.75049812930647575,
+        -0.75036050369252461, -0.75050045510325836, -0.750923627448431, -0.75163295465927327,
+        -0.75262860393519815, -0.7539079451384918, -0.75546554689674494, -0.75729319972326614,
+        -0.75937996621087245, -0.76171225809657905, -0.76427393973627245, -0.76704645727183796,
+        -0.77000899252088562, -0.77313864037363589, -0.77641060824494967, -0.77979843590439957,
+        -0.78327423379575445, -0.78680893776153682, -0.79037257791028215, -0.7939345592057887,
+        -0.79746395122047287, -0.80092978438065976, -0.80430134994132485, -0.80754850086273022,
+        -0.81064195072227918, -0.81355356778248311, -0.81625666135050368, -0.81872625760646689,
+        -0.82093936214652896, -0.82287520658211499, -0.8245154766582371, -0.82584451950047921,
+        -0.82684952777093101, -0.82752069870682277, -0.82785136623014399, -0.82783810455046947,
+        -0.82748080193451679, -0.82678270358241679, -0.82575042283009459, -0.82439392018693747,
+        -0.82272645001553768, -0.82076447496307359, -0.81852754855902199, -0.81603816669863494,
+        -0.81332158903303742, -0.81040563158217704, -0.80732043217333826, -0.80409819058273158,
+        -0.80077288551816617, -0.79737997082446166, -0.79395605351751486, -0.79053855645567506,
+        -0.78716536863602449, -0.78387448625656231, -0.78070364781130253, -0.77768996658256639,
+        -0.77486956396199946, -0.77227720706814851, -0.76994595413311107, -0.76790681110337111,
+        -0.76618840284046952, -0.76481666221564837, -0.76381454026965201, -0.76320174045521272,
+        -0.76299447979633983, -0.76320527958689621, -0.76384278801248029, -0.76491163681636565,
+        -0.76641233384419238, -0.76834119299563486, -0.77069030278691031, -0.77344753438854308,
+        -0.77659658965101386, -0.78011708927003054, -0.78398470087617866, -0.78817130646390487,
+        -0.79264520820554696, -0.79737137133064306, -0.80231170239250904, -0.8074253608962596,
+        -0.81266910192836272, -0.81799764711063105, -0.82336408090425961, -0.82872026901505835,
+        -0.83401729540208835, -0.8392059141710636, -0.84423701244333393, -0.84906208013323992,
+        -0.85363368244267657, -0.85790593079360999, -0.86183494786799797, -0.86537932241116566,
+        -0.86850054947962296, -0.87116345187788413, -0.8733365786309305, -0.87499257647909867,
+        -0.87610853055963678, -0.87666627065277036, -0.87665263961847284, -0.87605972093144358,
+        -0.87488502253399714, -0.87313161456731336, -0.87080821890814031, -0.86792924882766886,
+        -0.86451479749888815, -0.860590574504834, -0.85618778993934652, -0.85134298614062076,
+        -0.84609781755214086, -0.84049877966170927, -0.83459688842335777, -0.82844731201496369,
+        -0.82210895722252819, -0.81564401316641533, -0.80911745549162573, -0.80259651452974512,
+        -0.7961501113009859, -0.78984826555742194, -0.78376148037000626, -0.77796010802924953,
+        -0.77251370226001892, -0.76749036194235232, -0.76295607168048418, -0.75897404466971452,
+        -0.75560407337400293, -0.75290189354519155, -0.75091856708698346, -0.74969988919293606,
+        -0.74928582506798125, -0.74970998137781963, -0.75099911736094049, -0.75317270028527206,
+        -0.75624250963717898, -0.7602122940969136, -0.76507748498381789, -0.77082496944954915,
+        -0.77743292626115046, -0.78487072655142498, -0.79309890142514738, -0.80206917780019638,
+        -0.81172458333650155, -0.82199962076704491, -0.83282051139836766, -0.84410550699739606,
+        -0.85576526873149494, -0.86770331128389744, -0.87981650973156522, -0.89199566625150506,
+        -0.90412613321897628, -0.91608848878105242, -0.92775926053577062, -0.93901169252439809,
+        -0.94971655035589908, -0.95974295893181016, -0.96895926692955847, -0.9772339319355815,
+        -0.98443641989878761, -0.99043811240218171, -0.99511321512733741, -0.99833966081438896,
+        -0.99999999999999989, -0.99998227284800556, -0.99818085547207402, -0.99449727428642498,
+        -0.98884098210865357, -0.98113008997673368, -0.97129204892873189, -0.95926427632664335,
+        -0.94499472168262655, -0.92844236736396712, -0.90957766000930429, -0.88838286897945107,
+        -0.86485236868792514, -0.83899284220495396, -0.81082340410013687, -0.78037564107858437,
+        -0.74769356956871635, -0.71283351003227513, -0.67586387838361239, -0.63686489552122905,
+        -0.59592821658493689, -0.55315648215211244, -0.5086627941715306, -0.46257011999864134,
+        -0.41501062843731795, -0.36612496220582214, -0.31606145172491201, -0.26497527556979328,
+        -0.21302757333153771, -0.16038451699433406, -0.10721634724972053, -0.053696381435168264,
+        0,
+    },
+    /* square */
+    {
+        0, 0.052979908759015079, 0.10578980197034088, 0.15826064588838346,
+        0.21022536362416583, 0.26151979675518161, 0.31198364689404945, 0.36146139076929101,
+        0.40980316256952193, 0.45686559754686978, 0.50251263116459199, 0.54661624840538869,
+        0.58905717822818993, 0.62972552856932973, 0.66852135772580268, 0.70535517843026807,
+        0.74014839142594691, 0.77283364587062509, 0.80335512443859791, 0.83166875154333919,
+        0.85774232366766645, 0.88155556135779034, 0.90310008300852973, 0.92237930113465316,
+        0.93940824238348497, 0.95421329309221903, 0.96683187272565918, 0.97731203804227573,
+        0.98571202132468538, 0.99209970647116252, 0.99655204717424017, 0.99915443180755525,
+        0.99999999999999944, 0.99918891619432137, 0.9968276057633183, 0.99302795948871858,
+        0.98790651239420779, 0.98158360306363002, 0.97418251966726555, 0.96582863896294424,
+        0.95664856453440694, 0.94676927047716086, 0.93631725664279597, 0.925417721407365,
+        0.91419375773944689, 0.90276557811069225, 0.89124977351808377, 0.87975861157527457,
+        0.86839937828291758, 0.85727376770786035, 0.84647732339163717, 0.83609893487338893,
+        0.82622039225470145, 0.81691600125775077, 0.80825226073745482, 0.80028760410706257,
+        0.79307220562883585, 0.78664785201129572, 0.78104787924595931, 0.77629717411366417,
+        0.77241223929741187, 0.76940132055899968, 0.76726459397431335, 0.76599441078052322,
+        0.76557559697097122, 0.76598580438333541, 0.7671959096666735, 0.76917045718570043,
+        0.7718681416285913, 0.77524232582966501, 0.77924158910221031, 0.78381030120092177,
+        0.78888921689881297, 0.79441608607091507, 0.80032627412673685, 0.80655338762547757,
+        0.81302989994188068, 0.81968777192575792, 0.82645906261354507, 0.83327652520438644,
+        0.8400741837045721, 0.84678788587063802, 0.85335582834093637, 0.85971905013538885,
+        0.86582189102088369, 0.87161241158225089, 0.87704277220304916, 0.88206956854308904,
+        0.88665412149744705, 0.89076272003112955, 0.89436681570104393, 0.89744316809893254,
+        0.89997394087183147, 0.90194674839689315, 0.90335465360158262, 0.90419611782488007,
+        0.904474904006907, 0.90419993487022499, 0.90338510811287498, 0.90204907096830567,
+        0.90021495679803443, 0.89791008666687977, 0.89516563910576774, 0.89201629149162909,
+        0.88849983666619226, 0.88465677857427771, 0.88052991082654575, 0.87616388218086572,
+        0.87160475299019557, 0.86689954668308356, 0.86209580032577282, 0.85724111826309657,
+        0.85238273274964216, 0.84756707536418519, 0.8428393628505908, 0.83824320084884896,
+        0.83382020877260155, 0.82960966885648857, 0.82564820214027579, 0.82196947387944663,
+        0.81860393057647818, 0.81557857051607241, 0.81291674936414748, 0.8106380220573155,
+        0.80875802186993895, 0.80728837720270397, 0.80623666629301671, 0.80560640970643893,
+        0.80539710013282695, 0.80560426868364143, 0.80621958657092962, 0.8072310007463146,
+        0.80862290179256546, 0.81037632209317556, 0.81246916205916353, 0.81487644196880149,
+        0.81757057677704836, 0.82052167107850349, 0.82369783126200458, 0.8270654917775403,
+        0.83058975234768373, 0.83423472289673561, 0.8379638729413843, 0.84174038218693159,
+        0.84552748910259556, 0.84928883430762225, 0.85298879568590336, 0.85659281225967876,
+        0.86006769399116301, 0.86338191484322591, 0.86650588661480477, 0.86941221127162749,
+        0.87207590971605209, 0.87447462517916497, 0.87658879967140135, 0.87840182219243235,
+        0.87990014767442915, 0.88107338591243511, 0.88191436001896917, 0.88241913422444473,
+        0.88258701112800886, 0.88242049878238804, 0.88192524826884666, 0.88110996268193931,
+        0.87998627869615131, 0.87856862212553211, 0.87687403911103901, 0.87492200477662452,
+        0.87273421138243579, 0.87033433817029437, 0.8677478052416564, 0.86500151393028868,
+        0.86212357623018288, 0.85914303591298169, 0.85608958401807767, 0.85299327142228099,
+        0.84988422119460616, 0.84679234341555321, 0.84374705508970138, 0.84077700770622421,
+        0.83790982490494881, 0.83517185258695148, 0.83258792366964918, 0.83018113952844175,
+        0.82797266999173769, 0.82598157356548729, 0.82422463935899448, 0.82271625196780773,
+        0.82146828034400221, 0.82048999145128498, 0.81978798926432084, 0.81936617943070822,
+        0.81922575967238742, 0.81936523576314468, 0.81978046268251459, 0.82046471031589874,
+        0.82140875284818304, 0.82260098078555965, 0.82402753433946085, 0.82567245671930345,
+        0.82751786570868435, 0.82954414174423785, 0.8317301305788497, 0.83405335849244733,
+        0.83649025791506593, 0.83901640124907428, 0.84160674062088203, 0.84423585125746503,
+        0.84687817616981298, 0.84950826983381256, 0.85210103858893249, 0.85463197552585157,
+        0.85707738770528152, 0.85941461364083338, 0.86162222908781927, 0.86368023930628601,
+        0.86557025610897398, 0.86727565816181329, 0.86878173317451424, 0.8700758008000119,
+        0.87114731525225053, 0.87198794685021352, 0.87259164190025085, 0.87295466053676152,
+        0.87307559235111876, 0.87295534984846179, 0.87259713997964994, 0.87200641419935365,
+        0.87119079769911278, 0.87015999865439086, 0.86892569850549339, 0.86750142446211298,
+        0.86590240557866061, 0.86414541389112254, 0.86224859223468442, 0.8602312704737044,
+        0.85811377197086069, 0.85591721219976002, 0.85366329146421405, 0.85137408372758905,
+        0.8490718235766519, 0.84677869334627864, 0.84451661241430598, 0.84230703063998213,
+        0.84017072786546854, 0.83812762132816188, 0.83619658274319375, 0.83439526671112652,
+        0.83273995198682749, 0.83124539701286559, 0.82992471097596232, 0.82878924148943833,
+        0.82784847983979504, 0.82710998456309404, 0.82657932393844791, 0.82626003780325652,
+        0.82615361890972283, 0.82625951385626772, 0.82657514344260319, 0.82709594211504733,
+        0.82781541599092523, 0.82872521877922267, 0.82981524475055524, 0.83107373775458737,
+        0.83248741513855806, 0.83404160528787363, 0.83572039739004489, 0.83750680191745419,
+        0.83938292023363115, 0.84133012165247423, 0.84332922622090212, 0.84536069145314463,
+        0.84740480121956241, 0.84944185498473535, 0.85145235559836174, 0.85341719386834325,
+        0.85531782818762403, 0.85713645754469381, 0.85885618632130123, 0.86046117936915023,
+        0.86193680595925071, 0.8632697713120826, 0.86444823454265129, 0.86546191199069022,
+        0.86630216505119406, 0.8669620717729023, 0.86743648165069531, 0.86772205320062734,
+        0.86781727407193021, 0.86772246361724792, 0.8674397580089388, 0.86697307815401359,
+        0.86632808082159585, 0.86551209355321668, 0.86453403407627849, 0.86340431508337889,
+        0.86213473537347196, 0.86073835847391045, 0.85922937997418536, 0.85762298490158051,
+        0.85593519655524486, 0.85418271828751435, 0.85238276977915572, 0.85055291939805067,
+        0.84871091425843437, 0.8468745096098742, 0.84506129918183448, 0.84328854809091724,
+        0.84157302988402949, 0.8399308692422256, 0.83837739180726911, 0.83692698251684516,
+        0.83559295374550124, 0.83438742444781577, 0.83332121138895265, 0.83240373342676577,
+        0.83164292968021269, 0.83104519228223539, 0.83061531427283319, 0.83035645304118044,
+        0.83027010957568004, 0.83035612362931088, 0.83061268475590133, 0.83103635902250839,
+        0.8316221310552907, 0.83236346093257985, 0.83325235530050401, 0.83427945195493036,
+        0.83543411700969417, 0.8367045536564095, 0.83807792141644177, 0.83954046469195875,
+        0.84107764934110463, 0.84267430593300741, 0.84431477828212331, 0.84598307581877397,
+        0.84766302832403262, 0.84933844154250382, 0.85099325218612554, 0.85261168085579642,
+        0.85417838143523106, 0.85567858555261467, 0.85709824075989227, 0.85842414114634147,
+        0.85964404918173243, 0.86074680767402589, 0.8617224408263745, 0.86256224348711252,
+        0.8632588578033622, 0.86380633661279893, 0.86420019303761919, 0.86443743587880084,
+        0.86451659054583219, 0.86443770539607923, 0.86420234349739833, 0.86381355996624964,
+        0.86327586517004817, 0.86259517421558929, 0.86177874327378301, 0.86083509341348297,
+        0.85977392273278386, 0.85860600768363227, 0.8573430945840852, 0.85599778240108559,
+        0.85458339796444682, 0.85311386483915208, 0.85160356713750585, 0.85006720959466398,
+        0.84851967526028771, 0.84697588217525288, 0.84545064040549234, 0.84395851079509177,
+        0.84251366677791129, 0.84112976055155309, 0.83981979486976888, 0.83859600164998682,
+        0.83746972852211388, 0.83645133436384178, 0.83555009477722797, 0.83477411836214965,
+        0.83413027453543742, 0.83362413353100695, 0.83325991909733788, 0.83304047428528893,
+        0.83296724059270177, 0.8330402506037462, 0.83325813413173855, 0.83361813774541482,
+        0.83411615743163725, 0.83474678402341873, 0.83550336090211996, 0.8363780533678894,
+        0.83736192896386419, 0.83844504793842822, 0.83961656293673625, 0.84086482692878262,
+        0.84217750830708293, 0.84354171202337214, 0.84494410558108124, 0.846371048659184,
+        0.84780872511370486, 0.84924327608592443, 0.85066093294123013, 0.85204814876967927,
+        0.85339172719847189, 0.85467894729751814, 0.85589768340172623, 0.85703651872712194,
+        0.8580848517218479, 0.8590329941668664, 0.85987226012401674, 0.86059504492019023,
+        0.86119489345481015, 0.86166655722264873, 0.86200603955417832, 0.8622106286901583,
+        0.86227891842478532, 0.86221081617147599, 0.86200753842594147, 0.86167159372158864,
+        0.86120675329124419, 0.86061800976566982, 0.85991152435213725, 0.85909456304451881,
+        0.85817542251879975, 0.85716334646374648, 0.85606843318476555, 0.85490153539894975,
+        0.85367415321019324, 0.85239832131445692, 0.8510864915361801, 0.84975141183710379,
+        0.84840600296794333, 0.84706323395128946, 0.84573599759064355, 0.84443698719560822,
+        0.8431785756970096, 0.84197269829840737, 0.84083073977224709, 0.83976342746031585,
+        0.83878073097963546, 0.83789176956707678, 0.83710472791949042, 0.83642678130176018,
+        0.83586403060376613, 0.83542144792965756, 0.8351028332000574, 0.83491078214083247,
+        0.83484666592192081, 0.83491062259743221, 0.83510156038498473, 0.83541717270897242,
+        0.83585396482039453, 0.83640729169596795, 0.83707140681256054, 0.83783952129061712,
+        0.83870387280297665, 0.83965580355440617, 0.84068584655303169, 0.84178381931840973,
+        0.84293892410303328, 0.84413985364512212, 0.84537490142121519, 0.84663207532776175,
+        0.84789921369194521, 0.84916410249361107, 0.85041459267254604, 0.85163871639850386,
+        0.85282480119522386, 0.85396158083407614, 0.85503830194763397, 0.85604482535800464,
+        0.85697172116877496, 0.85781035673231476, 0.85855297667532504, 0.85919277424424823,
+        0.85972395331765672, 0.86014178052416501, 0.86044262700091101, 0.8606239994282594,
+        0.86068456008010974, 0.8606241357351041, 0.86044371540101128, 0.86014543691168188,
+        0.85973256256215813, 0.85920944405175648, 0.85858147710628152, 0.85785504624796582,
+        0.85703746027439254, 0.85613687909463809, 0.85516223265138613, 0.85412313273104223,
+        0.85302977852929318, 0.8518928568964077, 0.85072343823448426, 0.84953286905727576,
+        0.84833266225187243, 0.84713438610017489, 0.84594955312655085, 0.8447895098363325,
+        0.84366532839789166, 0.84258770129911276, 0.84156683997736226, 0.8406123783809053,
+        0.8397332823695326, 0.83893776580347235, 0.83823321410301921, 0.83762611598743997,
+        0.83712200402124415, 0.83672540450974686, 0.83643979719472039, 0.8362675851058089,
+        0.83621007482513654, 0.83626746732213142, 0.83643885941399121, 0.8367222558054046,
+        0.83711459156005164, 0.83761176475708143, 0.83820867898903528, 0.83889929526459572,
+        0.8396766927908248, 0.8405331380262161, 0.84146016131852275, 0.84244864037081191,
+        0.84348888971609781, 0.84457075532582482, 0.84568371343093229, 0.84681697259661171,
+        0.84795957806356026, 0.84910051734969605, 0.85022882609718708, 0.85133369315023244,
+        0.8524045638593144, 0.85343124062754039, 0.85440397974386539, 0.85531358358630261,
+        0.85615148732512913, 0.85690983931121789, 0.85758157439737237, 0.85816047951032015,
+        0.85864125086708654, 0.85901954231117617, 0.85929200433044428, 0.85945631340894935,
+        0.85951119145857502, 0.85945641517186955, 0.85929281523446399, 0.85902226543266125,
+        0.85864766178842622, 0.85817289194909596, 0.85760279515181248, 0.85694311317200933,
+        0.85620043275050528, 0.85538212007397452, 0.85449624795810464, 0.85355151645083549,
+        0.85255716763417588, 0.85152289545652338, 0.85045875147277128, 0.84937504740635861,
+        0.84828225547538261, 0.84719090744383596, 0.84611149336869662, 0.84505436101395237,
+        0.84402961689372102, 0.84304702988850821, 0.84211593835155096, 0.84124516158639528,
+        0.84044291653272207, 0.83971674044539835, 0.83907342029232634, 0.8385189295304678,
+        0.83805837284707263, 0.83769593937537856, 0.83743486481159646, 0.83727740277367357,
+        0.8372248056529682, 0.8372773151184163, 0.83743416233994139, 0.8376935779046093,
+        0.83805281130625764, 0.83850815979795956, 0.83905500630751306, 0.83968786603009393,
+        0.84040044123006885, 0.84118568370645852, 0.84203586430450972, 0.84294264878983172,
+        0.84389717934227848, 0.844890160874742, 0.84591195133771357, 0.84695265513433282,
+        0.84800221874293669, 0.84905052762514099, 0.8500875034873927, 0.85110320096273429,
+        0.85208790278731383, 0.85303221256276573, 0.85392714422087701, 0.854764207340589,
+        0.85553548750914588, 0.85623372096853201, 0.85685236284487742, 0.85738564832160047,
+        0.85782864618614685, 0.85817730425454331, 0.85842848625697032, 0.85857999985027855,
+        0.85863061550918385, 0.85858007613580845, 0.85842909731653083, 0.85817935824487035,
+        0.85783348341854604, 0.85739501530694351, 0.85686837827137319, 0.85625883410361547,
+        0.85557242962778779, 0.85481593688561042, 0.85399678649505639, 0.85312299483649612,
+        0.85220308577814263, 0.85124600770336689, 0.85026104664581859, 0.84925773637381008,
+        0.84824576629284854, 0.84723488805420999, 0.84623482176795017, 0.84525516272059142,
+        0.8443052894909745, 0.84339427434244807, 0.84253079674587994, 0.84172306085618243,
+        0.84097871772537314, 0.84030479298820182, 0.83970762070233684, 0.83919278396471564,
+        0.83876506285942565, 0.83842839022105187, 0.83818581562152417, 0.83803947790885303,
+        0.83799058654347647, 0.83803941189314524, 0.83818528456106622, 0.83842660373529754,
+        0.83876085446094228, 0.83918463365138374, 0.83969368457139315, 0.84028293944427823,
+        0.84094656975810478, 0.84167804377301658, 0.84247019066371454, 0.84331527066861933,
+        0.84420505056096395, 0.84513088370736134, 0.84608379393687994, 0.84705456240866284,
+        0.84803381663895194, 0.84901212082932942, 0.84998006662717207, 0.85092836344685052,
+        0.85184792748610738, 0.85272996858620143, 0.85356607410672081, 0.85434828901616644,
+        0.85506919143719118, 0.85572196293041047, 0.85630045285250034, 0.85679923618231923,
+        0.85721366427260415, 0.85753990805357538, 0.85777499328806683, 0.85791682755473098,
+        0.85796421871576456, 0.85791688470771144, 0.85777545457735926, 0.85754146076884719,
+        0.85721732275196472, 0.85680632216446562, 0.85631256972229175, 0.85574096423004087,
+        0.85509714409919035, 0.8543874318526623, 0.85361877216073301, 0.85279866401432469,
+        0.8519350876968631, 0.85103642726458362, 0.85011138928699725, 0.84916891863373567,
+        0.84821811212098763, 0.84726813084979835, 0.84632811207962932, 0.84540708148356247,
+        0.84451386662641392, 0.84365701249384517, 0.84284469987949151, 0.84208466740830856,
+        0.84138413793819089, 0.84074975003863295, 0.84018749519536751, 0.8397026613338906,
+        0.83929978319321341, 0.83898260001458957, 0.83875402093904472, 0.83861609843296236,
+        0.83857000998346076, 0.83861604822558133, 0.83875361958220174, 0.83898125141579194,
+        0.83929660760952463, 0.83969651241452636, 0.84017698232105575, 0.84073326563482786,
+        0.84135988936631845, 0.84205071297137257, 0.84279898841647016, 0.84359742598217335,
+        0.84443826516417952, 0.84531334998352281, 0.84621420797624203, 0.84713213209871152,
+        0.84805826475803359, 0.84898368315774064, 0.84989948513769642, 0.85079687468361131,
+        0.85166724628600254, 0.85250226734074708, 0.8532939578033607, 0.85403476633669517,
+        0.85471764222650726, 0.85533610238106916, 0.8558842927791237, 0.8563570437847311,
+        0.8567499188072305, 0.85705925584913134, 0.85728220155367763, 0.85741673743631519,
+        0.85746169805974126, 0.85741678098984908, 0.85728254844894869, 0.8570604206624195,
+        0.8567526609746301, 0.85636235288881324, 0.855893369262826, 0.85535033396765248,
+        0.85473857638736539, 0.85406407920739902, 0.8533334200017566, 0.8525537071885283,
+        0.85173251097633629, 0.85087778997151187, 0.84999781415650999, 0.84910108498388348,
+        0.84819625335682214, 0.84729203628644068, 0.84639713302765596, 0.84552014149937416,
+        0.84466947579093088, 0.84385328554517791, 0.84307937798960364, 0.8423551433603863,
+        0.84168748443077801, 0.8410827508148766, 0.8405466786711504, 0.84008433637745772,
+        0.83970007669125635, 0.83939749584582457, 0.8391793999661602, 0.83904777911753214,
+        0.8390037892259965, 0.83904774203437915, 0.83917910317990618, 0.8393964984016371,
+        0.83969772780784346, 0.84007978805622352, 0.84053890222411509, 0.84107055707235356,
+        0.84166954733585675, 0.84233002660703771, 0.84304556431544042, 0.84380920824908234,
+        0.84461355201052424, 0.8454508067540355, 0.84631287650996756, 0.84719143636884664,
+        0.84807801277112904, 0.84896406512925238, 0.84984106799677506, 0.85070059299503076,
+        0.85153438971102191, 0.8523344647910438, 0.85309315847275924, 0.85380321782388835,
+        0.85445786598815565, 0.8550508667782093, 0.85557658400068037, 0.8560300349497677,
+        0.85640693756234332, 0.85670375078897354, 0.8569177078008493, 0.85704684172178702,
+        0.85709000364654964, 0.85704687278101388, 0.85691795861550368, 0.85670459511914976,
+        0.85640892701972848, 0.85603388830930227, 0.8555831731904664, 0.85506119975027284,
+        0.85447306671844381, 0.85382450373242624, 0.85312181559373235, 0.85237182105716136,
+        0.85158178674638907, 0.85075935683556936, 0.84991247917656809, 0.84904932858484272,
+        0.84817822802353304, 0.84730756844473598, 0.84644572805904772, 0.84560099180917414,
+        0.84478147182065744, 0.84399502959262618, 0.843249200674004, 0.84255112254603071,
+        0.84190746640045089, 0.8413243734646757, 0.84080739648093406, 0.8403614468963726,
+        0.8399907482657335, 0.83969879630810018, 0.83948832599493439, 0.83936128597878001,
+        0.83931882060125806, 0.8393612596460055, 0.83948811592772199, 0.83969809073319535,
+        0.83998908705478681, 0.84035823048212999, 0.84080189754441126, 0.84131575122426083,
+        0.84189478329573331, 0.84253336307363147, 0.84322529210028618, 0.84396386423931669,
+        0.84474193059448233, 0.84555196862592041, 0.84638615479632717, 0.84723644004635623,
+        0.84809462737191432, 0.84895245075653913, 0.84980165469962154, 0.85063407357619769,
+        0.85144171006628899, 0.85221681190131549, 0.85295194619193104, 0.85364007062542024,
+        0.85427460085145179, 0.85484947341212247, 0.85535920361551621, 0.8557989378010461,
+        0.85616449949910478, 0.85645242904656282, 0.85666001628283406, 0.85678532601792368,
+        0.85682721603352319, 0.8567853474500744, 0.85666018736612304, 0.85645300375055744,
+        0.85616585264270972, 0.85580155778907541, 0.85536368291794795, 0.85485649692376042,
+        0.85428493230081093, 0.85365453723058615, 0.85297142178753116, 0.85224219878424223,
+        0.85147391982813703, 0.85067400720720976, 0.84985018226209197, 0.84901039093489428,
+        0.84816272721192609, 0.847315355197098, 0.84647643056546906, 0.84565402215179852,
+        0.84485603442718205, 0.84409013160779689, 0.84336366412361363, 0.8426835981517764,
+        0.8420564488894956, 0.84148821820489816, 0.84098433726188448, 0.84054961466685751,
+        0.84018819063185546, 0.83990349759051086, 0.83969822764105451, 0.83957430712479197,
+        0.8395328785797711, 0.83957429023842878, 0.83969809316543542, 0.83990304605858734,
+        0.84018712766196912, 0.84054755666758574, 0.84098081890981946, 0.84148270158718397,
+        0.84204833417851133, 0.84267223565664851, 0.84334836754249554, 0.84407019228640268,
+        0.84483073641310069, 0.84562265782089541, 0.8464383165863445, 0.84726984859230026,
+        0.84810924127049947, 0.84894841072994709, 0.84977927952942767, 0.8505938543467052,
+        0.85138430279833299, 0.85214302867257885, 0.85286274485355063, 0.85353654323718087,
+        0.85415796096894447, 0.85472104236886448, 0.85522039595105648, 0.85565124599249021,
+        0.85600947815822814, 0.85629167874771828, 0.85649516718818042, 0.8566180214661393,
+        0.85665909625611003, 0.85661803357567756, 0.85649526586806479, 0.85629201148600853,
+        0.856010262623775, 0.85565276581661731, 0.85522299519829081, 0.85472511877671575,
+        0.85416395805478151, 0.85354494138707226, 0.85287405152325146, 0.85215776784449837,
+        0.85140300385012713, 0.85061704049690001, 0.84980745603312768, 0.84898205300305951,
+        0.84814878312395348, 0.84731567075838821, 0.84649073571757927, 0.84568191613759758,
+        0.84489699216944092, 0.84414351121576559, 0.84342871543202302, 0.84275947218769953,
+        0.84214220815469465, 0.84158284765482261, 0.84108675585728554, 0.84065868737018468,
+        0.84030274071819067, 0.84002231914174785, 0.83982009809239944, 0.83969799973434867,
+        0.83965717469501966, 0.83969799123768452, 0.83982003195789179, 0.84002209803315286,
+        0.84030222098279928, 0.84065768182281697, 0.84108503742947505, 0.84158015385640361,
+        0.84213824628306111, 0.84275392520894521, 0.84342124844802269, 0.84413377842227644,
+        0.84488464420250153, 0.84566660769905211, 0.84647213336550875, 0.84729346074469969,
+        0.84812267915933792, 0.84895180382912683, 0.84977285268266312, 0.85057792312593117,
+        0.85135926802981265, 0.8521093702066459, 0.85282101466058635, 0.85348735791800656,
+        0.85410199377239804, 0.85465901481277684, 0.85515306914522604, 0.8555794117634874,
+        0.85593395007599582, 0.85621328315297462, 0.85641473431758053, 0.85653637676909544,
+        0.85657705199312073, 0.85653638078304162, 0.85641476676803407, 0.85621339241484373,
+        0.85593420754288074, 0.85557991046405257, 0.85515392192957862, 0.85466035213508085,
+        0.85410396110190956, 0.85349011281618803, 0.85282472356701389, 0.85211420498089063,
+        0.85136540230034319, 0.85058552850030322, 0.8497820948757534, 0.84896283876794709,
+        0.84813564912394457, 0.84730849060495594, 0.84648932697284895, 0.84568604449107199,
+        0.84490637607601793, 0.84415782692763675, 0.84344760235381666, 0.8427825384819515,
+        0.84216903652334263, 0.84161300122193561, 0.84111978407865107, 0.84069413189669984,
+        0.84034014114213507, 0.84006121855802407, 0.83986004841055351, 0.83973856668166413,
+        0.83969794245610474, 0.83973856668166413, 0.83986004841055351, 0.84006121855802407,
+        0.84034014114213496, 0.84069413189669984, 0.84111978407865107, 0.84161300122193561,
+        0.84216903652334252, 0.84278253848195139, 0.84344760235381655, 0.84415782692763675,
+        0.84490637607601782, 0.84568604449107232, 0.84648932697284884, 0.84730849060495561,
+        0.84813564912394446, 0.84896283876794698, 0.8497820948757534, 0.85058552850030333,
+        0.85136540230034286, 0.85211420498089052, 0.85282472356701378, 0.85349011281618814,
+        0.85410396110190945, 0.85466035213508063, 0.85515392192957862, 0.85557991046405257,
+        0.85593420754288074, 0.85621339241484351, 0.85641476676803385, 0.85653638078304173,
+        0.85657705199312084, 0.85653637676909566, 0.85641473431758042, 0.85621328315297451,
+        0.85593395007599571, 0.8555794117634874, 0.85515306914522593, 0.85465901481277673,
+        0.85410199377239771, 0.85348735791800656, 0.85282101466058635, 0.8521093702066459,
+        0.85135926802981243, 0.85057792312593117, 0.84977285268266312, 0.84895180382912683,
+        0.8481226791593377, 0.84729346074469924, 0.84647213336550831, 0.84566660769905211,
+        0.84488464420250176, 0.84413377842227622, 0.84342124844802258, 0.84275392520894521,
+        0.84213824628306122, 0.84158015385640361, 0.84108503742947482, 0.84065768182281686,
+        0.84030222098279928, 0.84002209803315264, 0.83982003195789179, 0.83969799123768452,
+        0.83965717469501988, 0.83969799973434867, 0.83982009809239966, 0.84002231914174763,
+        0.84030274071819067, 0.84065868737018468, 0.84108675585728543, 0.84158284765482283,
+        0.84214220815469476, 0.8427594721876992, 0.84342871543202336, 0.8441435112157657,
+        0.84489699216944081, 0.84568191613759758, 0.84649073571757916, 0.84731567075838832,
+        0.84814878312395325, 0.84898205300305918, 0.84980745603312735, 0.85061704049689979,
+        0.85140300385012768, 0.85215776784449837, 0.85287405152325146, 0.85354494138707249,
+        0.85416395805478129, 0.8547251187767152, 0.85522299519829093, 0.85565276581661709,
+        0.85601026262377466, 0.85629201148600798, 0.85649526586806457, 0.85661803357567745,
+        0.85665909625610981, 0.85661802146613952, 0.8564951671881802, 0.85629167874771817,
+        0.85600947815822792, 0.85565124599249021, 0.85522039595105637, 0.85472104236886448,
+        0.85415796096894447, 0.85353654323718064, 0.85286274485355096, 0.85214302867257885,
+        0.85138430279833299, 0.85059385434670476, 0.84977927952942778, 0.84894841072994665,
+        0.84810924127049936, 0.84726984859229981, 0.8464383165863445, 0.84562265782089563,
+        0.84483073641310069, 0.84407019228640279, 0.84334836754249509, 0.84267223565664862,
+        0.84204833417851133, 0.84148270158718375, 0.84098081890981979, 0.84054755666758552,
+        0.84018712766196868, 0.83990304605858734, 0.83969809316543553, 0.83957429023842889,
+        0.8395328785797711, 0.83957430712479197, 0.83969822764105473, 0.83990349759051042,
+        0.84018819063185557, 0.84054961466685818, 0.84098433726188448, 0.84148821820489828,
+        0.8420564488894956, 0.8426835981517764, 0.84336366412361363, 0.84409013160779711,
+        0.84485603442718193, 0.84565402215179852, 0.84647643056546895, 0.84731535519709789,
+        0.84816272721192609, 0.84901039093489405, 0.84985018226209164, 0.85067400720720954,
+        0.8514739198281368, 0.85224219878424223, 0.85297142178753083, 0.85365453723058615,
+        0.85428493230081115, 0.85485649692376009, 0.85536368291794818, 0.85580155778907541,
+        0.85616585264270961, 0.85645300375055722, 0.85666018736612282, 0.85678534745007429,
+        0.85682721603352285, 0.85678532601792345, 0.85666001628283406, 0.85645242904656282,
+        0.85616449949910489, 0.8557989378010461, 0.85535920361551621, 0.85484947341212247,
+        0.85427460085145179, 0.85364007062542013, 0.8529519461919306, 0.85221681190131549,
+        0.85144171006628899, 0.8506340735761978, 0.84980165469962143, 0.84895245075653947,
+        0.84809462737191432, 0.84723644004635612, 0.84638615479632751, 0.84555196862591997,
+        0.84474193059448255, 0.84396386423931624, 0.84322529210028585, 0.84253336307363125,
+        0.84189478329573331, 0.84131575122426083, 0.84080189754441126, 0.84035823048213043,
+        0.83998908705478659, 0.83969809073319523, 0.83948811592772166, 0.8393612596460055,
+        0.83931882060125818, 0.83936128597878024, 0.83948832599493417, 0.83969879630810051,
+        0.83999074826573339, 0.8403614468963726, 0.84080739648093406, 0.84132437346467592,
+        0.84190746640045089, 0.84255112254603048, 0.84324920067400388, 0.84399502959262573,
+        0.84478147182065733, 0.84560099180917414, 0.84644572805904794, 0.84730756844473554,
+        0.84817822802353326, 0.84904932858484272, 0.8499124791765682, 0.85075935683556914,
+        0.85158178674638851, 0.85237182105716158, 0.85312181559373235, 0.85382450373242624,
+        0.85447306671844359, 0.85506119975027273, 0.8555831731904664, 0.85603388830930227,
+        0.85640892701972826, 0.85670459511914987, 0.85691795861550368, 0.85704687278101355,
+        0.85709000364654975, 0.85704684172178702, 0.85691770780084964, 0.85670375078897343,
+        0.85640693756234343, 0.85603003494976782, 0.85557658400068048, 0.85505086677820941,
+        0.85445786598815565, 0.85380321782388824, 0.85309315847275846, 0.85233446479104424,
+        0.8515343897110218, 0.85070059299503065, 0.84984106799677483, 0.8489640651292526,
+        0.84807801277112849, 0.84719143636884664, 0.84631287650996745, 0.84545080675403572,
+        0.84461355201052402, 0.84380920824908201, 0.84304556431544042, 0.84233002660703749,
+        0.84166954733585675, 0.84107055707235345, 0.84053890222411509, 0.84007978805622341,
+        0.83969772780784402, 0.83939649840163721, 0.83917910317990629, 0.83904774203437882,
+        0.8390037892259965, 0.83904777911753259, 0.8391793999661602, 0.83939749584582446,
+        0.83970007669125635, 0.84008433637745761, 0.84054667867115063, 0.84108275081487716,
+        0.84168748443077801, 0.84235514336038608, 0.84307937798960342, 0.84385328554517836,
+        0.84466947579093077, 0.84552014149937449, 0.84639713302765618, 0.84729203628644056,
+        0.84819625335682214, 0.84910108498388348, 0.8499978141565101, 0.85087778997151198,
+        0.85173251097633595, 0.8525537071885283, 0.85333342000175705, 0.85406407920739902,
+        0.85473857638736539, 0.85535033396765248, 0.85589336926282567, 0.85636235288881335,
+        0.8567526609746301, 0.85706042066241972, 0.85728254844894847, 0.85741678098984908,
+        0.85746169805974115, 0.8574167374363153, 0.85728220155367774, 0.85705925584913145,
+        0.85674991880723073, 0.85635704378473143, 0.85588429277912359, 0.85533610238106939,
+        0.85471764222650759, 0.85403476633669462, 0.85329395780336037, 0.85250226734074719,
+        0.85166724628600288, 0.85079687468361131, 0.84989948513769642, 0.84898368315774042,
+        0.84805826475803336, 0.84713213209871185, 0.84621420797624158, 0.8453133499835227,
+        0.84443826516417964, 0.84359742598217302, 0.84279898841647005, 0.84205071297137291,
+        0.84135988936631823, 0.84073326563482798, 0.84017698232105575, 0.83969651241452614,
+        0.83929660760952463, 0.83898125141579172, 0.83875361958220185, 0.83861604822558167,
+        0.8385700099834611, 0.83861609843296259, 0.83875402093904505, 0.83898260001458969,
+        0.83929978319321308, 0.83970266133389082, 0.84018749519536728, 0.84074975003863306,
+        0.84138413793819078, 0.84208466740830856, 0.8428446998794914, 0.84365701249384539,
+        0.84451386662641359, 0.84540708148356258, 0.84632811207962944, 0.84726813084979835,
+        0.84821811212098763, 0.84916891863373567, 0.85011138928699725, 0.85103642726458373,
+        0.8519350876968631, 0.85279866401432491, 0.8536187721607329, 0.85438743185266219,
+        0.85509714409919046, 0.8557409642300412, 0.85631256972229197, 0.85680632216446584,
+        0.85721732275196449, 0.8575414607688473, 0.85777545457735882, 0.85791688470771199,
+        0.85796421871576467, 0.85791682755473098, 0.85777499328806706, 0.85753990805357516,
+        0.85721366427260415, 0.85679923618231923, 0.85630045285250045, 0.85572196293041036,
+        0.85506919143719107, 0.85434828901616688, 0.85356607410672125, 0.85272996858620154,
+        0.85184792748610771, 0.85092836344685097, 0.84998006662717229, 0.84901212082932953,
+        0.84803381663895216, 0.84705456240866284, 0.84608379393687971, 0.84513088370736122,
+        0.84420505056096429, 0.84331527066861944, 0.84247019066371487, 0.84167804377301692,
+        0.84094656975810467, 0.84028293944427801, 0.83969368457139315, 0.83918463365138407,
+        0.83876085446094217, 0.83842660373529754, 0.83818528456106633, 0.83803941189314501,
+        0.83799058654347636, 0.83803947790885303, 0.83818581562152439, 0.83842839022105187,
+        0.83876506285942576, 0.83919278396471575, 0.83970762070233695, 0.84030479298820215,
+        0.84097871772537269, 0.84172306085618231, 0.84253079674587994, 0.84339427434244785,
+        0.84430528949097461, 0.84525516272059165, 0.8462348217679504, 0.84723488805421054,
+        0.84824576629284854, 0.84925773637381008, 0.85026104664581847, 0.85124600770336667,
+        0.85220308577814285, 0.85312299483649623, 0.85399678649505595, 0.85481593688561053,
+        0.85557242962778779, 0.85625883410361603, 0.8568683782713733, 0.8573950153069434,
+        0.85783348341854604, 0.85817935824487046, 0.85842909731653039, 0.85858007613580845,
+        0.85863061550918407, 0.85857999985027833, 0.85842848625697066, 0.85817730425454342,
+        0.85782864618614696, 0.85738564832160058, 0.85685236284487709, 0.85623372096853223,
+        0.85553548750914599, 0.85476420734058911, 0.85392714422087668, 0.85303221256276573,
+        0.85208790278731361, 0.85110320096273473, 0.8500875034873927, 0.84905052762514133,
+        0.8480022187429368, 0.84695265513433293, 0.84591195133771369, 0.84489016087474189,
+        0.84389717934227826, 0.84294264878983183, 0.8420358643045095, 0.8411856837064583,
+        0.84040044123006896, 0.83968786603009427, 0.8390550063075134, 0.83850815979795978,
+        0.83805281130625742, 0.83769357790460963, 0.8374341623399415, 0.83727731511841641,
+        0.83722480565296808, 0.83727740277367324, 0.83743486481159624, 0.83769593937537901,
+        0.83805837284707252, 0.83851892953046792, 0.83907342029232623, 0.83971674044539824,
+        0.84044291653272252, 0.84124516158639573, 0.84211593835155085, 0.84304702988850833,
+        0.84402961689372091, 0.84505436101395204, 0.84611149336869684, 0.84719090744383607,
+        0.84828225547538294, 0.84937504740635894, 0.85045875147277117, 0.85152289545652338,
+        0.85255716763417566, 0.85355151645083505, 0.85449624795810475, 0.85538212007397463,
+        0.85620043275050484, 0.85694311317200955, 0.85760279515181248, 0.85817289194909641,
+        0.85864766178842611, 0.85902226543266147, 0.85929281523446399, 0.85945641517186966,
+        0.85951119145857469, 0.85945631340894968, 0.85929200433044439, 0.85901954231117605,
+        0.85864125086708687, 0.85816047951032026, 0.85758157439737248, 0.85690983931121789,
+        0.85615148732512913, 0.85531358358630283, 0.85440397974386539, 0.85343124062754039,
+        0.8524045638593144, 0.85133369315023244, 0.85022882609718686, 0.84910051734969627,
+        0.84795957806356048, 0.84681697259661204, 0.84568371343093263, 0.84457075532582482,
+        0.84348888971609803, 0.84244864037081224, 0.84146016131852275, 0.8405331380262161,
+        0.83967669279082491, 0.83889929526459539, 0.8382086789890355, 0.8376117647570811,
+        0.83711459156005175, 0.83672225580540449, 0.83643885941399121, 0.83626746732213153,
+        0.83621007482513643, 0.83626758510580868, 0.83643979719472072, 0.83672540450974686,
+        0.83712200402124382, 0.83762611598743986, 0.83823321410301932, 0.83893776580347235,
+        0.8397332823695326, 0.84061237838090519, 0.84156683997736215, 0.84258770129911253,
+        0.84366532839789143, 0.84478950983633272, 0.84594955312655085, 0.84713438610017477,
+        0.84833266225187243, 0.8495328690572761, 0.85072343823448437, 0.8518928568964077,
+        0.85302977852929318, 0.85412313273104257, 0.85516223265138602, 0.85613687909463798,
+        0.85703746027439232, 0.85785504624796571, 0.85858147710628152, 0.8592094440517567,
+        0.85973256256215824, 0.86014543691168233, 0.86044371540101139, 0.8606241357351041,
+        0.86068456008010974, 0.86062399942825951, 0.86044262700091101, 0.86014178052416512,
+        0.85972395331765683, 0.85919277424424811, 0.85855297667532504, 0.85781035673231498,
+        0.85697172116877518, 0.85604482535800441, 0.85503830194763386, 0.85396158083407658,
+        0.85282480119522353, 0.85163871639850386, 0.85041459267254604, 0.84916410249361118,
+        0.84789921369194476, 0.84663207532776164, 0.84537490142121519, 0.84413985364512245,
+        0.84293892410303339, 0.84178381931840962, 0.84068584655303202, 0.8396558035544065,
+        0.83870387280297654, 0.83783952129061734, 0.83707140681256031, 0.83640729169596806,
+        0.83585396482039487, 0.83541717270897231, 0.83510156038498484, 0.83491062259743232,
+        0.83484666592192025, 0.83491078214083259, 0.83510283320005751, 0.83542144792965756,
+        0.83586403060376613, 0.83642678130176007, 0.83710472791949042, 0.83789176956707678,
+        0.83878073097963546, 0.83976342746031618, 0.8408307397722472, 0.84197269829840737,
+        0.84317857569701005, 0.84443698719560822, 0.84573599759064355, 0.84706323395128924,
+        0.84840600296794333, 0.84975141183710357, 0.85108649153618021, 0.85239832131445681,
+        0.85367415321019369, 0.85490153539894953, 0.85606843318476566, 0.85716334646374626,
+        0.85817542251879975, 0.85909456304451881, 0.85991152435213736, 0.86061800976566993,
+        0.86120675329124408, 0.86167159372158864, 0.86200753842594169, 0.86221081617147644,
+        0.86227891842478543, 0.8622106286901583, 0.86200603955417865, 0.86166655722264829,
+        0.86119489345481037, 0.86059504492019012, 0.85987226012401685, 0.85903299416686663,
+        0.85808485172184812, 0.85703651872712194, 0.85589768340172645, 0.85467894729751837,
+        0.85339172719847189, 0.85204814876967971, 0.85066093294123046, 0.8492432760859242,
+        0.84780872511370509, 0.846371048659184, 0.8449441055810808, 0.84354171202337225,
+        0.84217750830708304, 0.84086482692878295, 0.83961656293673659, 0.838445047938428,
+        0.83736192896386463, 0.83637805336788906, 0.8355033609021203, 0.83474678402341906,
+        0.83411615743163736, 0.83361813774541482, 0.83325813413173877, 0.83304025060374631,
+        0.83296724059270177, 0.83304047428528927, 0.83325991909733788, 0.83362413353100728,
+        0.83413027453543764, 0.83477411836214976, 0.83555009477722797, 0.83645133436384211,
+        0.83746972852211377, 0.83859600164998704, 0.83981979486976877, 0.84112976055155297,
+        0.84251366677791129, 0.84395851079509165, 0.84545064040549256, 0.84697588217525277,
+        0.8485196752602876, 0.8500672095946642, 0.85160356713750551, 0.85311386483915197,
+        0.85458339796444704, 0.85599778240108571, 0.85734309458408497, 0.85860600768363249,
+        0.85977392273278397, 0.86083509341348308, 0.86177874327378312, 0.8625951742155894,
+        0.86327586517004817, 0.86381355996624953, 0.86420234349739833, 0.86443770539607967,
+        0.86451659054583219, 0.86443743587880062, 0.86420019303761919, 0.86380633661279893,
+        0.86325885780336264, 0.86256224348711241, 0.8617224408263745, 0.86074680767402623,
+        0.85964404918173276, 0.85842414114634147, 0.85709824075989216, 0.85567858555261467,
+        0.85417838143523062, 0.85261168085579631, 0.85099325218612576, 0.84933844154250415,
+        0.84766302832403262, 0.84598307581877419, 0.84431477828212376, 0.84267430593300718,
+        0.84107764934110407, 0.83954046469195898, 0.83807792141644177, 0.83670455365640883,
+        0.83543411700969417, 0.83427945195493036, 0.83325235530050423, 0.83236346093257974,
+        0.83162213105529104, 0.83103635902250861, 0.83061268475590122, 0.83035612362931077,
+        0.83027010957568026, 0.83035645304118066, 0.83061531427283308, 0.83104519228223539,
+        0.83164292968021269, 0.83240373342676588, 0.83332121138895265, 0.83438742444781566,
+        0.83559295374550147, 0.83692698251684494, 0.83837739180726867, 0.83993086924222571,
+        0.8415730298840296, 0.84328854809091702, 0.84506129918183448, 0.84687450960987387,
+        0.84871091425843503, 0.85055291939805067, 0.85238276977915561, 0.85418271828751458,
+        0.85593519655524475, 0.85762298490158051, 0.85922937997418558, 0.86073835847391034,
+        0.86213473537347174, 0.86340431508337934, 0.8645340340762786, 0.86551209355321679,
+        0.8663280808215964, 0.8669730781540137, 0.86743975800893958, 0.86772246361724781,
+        0.8678172740719301, 0.86772205320062779, 0.86743648165069553, 0.86696207177290185,
+        0.86630216505119428, 0.86546191199069045, 0.86444823454265152, 0.86326977131208271,
+        0.86193680595925071, 0.86046117936915045, 0.8588561863213009, 0.85713645754469392,
+        0.85531782818762425, 0.85341719386834325, 0.85145235559836141, 0.84944185498473501,
+        0.84740480121956252, 0.84536069145314485, 0.84332922622090234, 0.84133012165247423,
+        0.83938292023363148, 0.83750680191745386, 0.83572039739004456, 0.83404160528787386,
+        0.83248741513855795, 0.83107373775458759, 0.82981524475055524, 0.82872521877922267,
+        0.82781541599092534, 0.82709594211504711, 0.82657514344260341, 0.82625951385626817,
+        0.82615361890972283, 0.82626003780325663, 0.82657932393844791, 0.82710998456309404,
+        0.82784847983979482, 0.82878924148943856, 0.82992471097596265, 0.83124539701286626,
+        0.8327399519868276, 0.83439526671112629, 0.83619658274319364, 0.83812762132816232,
+        0.84017072786546887, 0.84230703063998236, 0.84451661241430598, 0.84677869334627853,
+        0.8490718235766519, 0.85137408372758927, 0.85366329146421427, 0.85591721219976025,
+        0.85811377197086047, 0.86023127047370496, 0.86224859223468509, 0.86414541389112232,
+        0.86590240557866072, 0.8675014244621132, 0.86892569850549339, 0.87015999865439098,
+        0.87119079769911323, 0.87200641419935421, 0.87259713997965027, 0.8729553498484619,
+        0.87307559235111898, 0.87295466053676174, 0.87259164190025074, 0.87198794685021375,
+        0.87114731525225042, 0.87007580080001179, 0.86878173317451435, 0.86727565816181362,
+        0.86557025610897431, 0.86368023930628612, 0.86162222908781916, 0.85941461364083382,
+        0.85707738770528186, 0.85463197552585191, 0.85210103858893294, 0.84950826983381234,
+        0.84687817616981276, 0.84423585125746536, 0.84160674062088192, 0.83901640124907484,
+        0.83649025791506593, 0.83405335849244711, 0.83173013057884981, 0.82954414174423841,
+        0.82751786570868413, 0.82567245671930378, 0.82402753433946085, 0.82260098078555954,
+        0.82140875284818338, 0.8204647103158984, 0.81978046268251503, 0.81936523576314468,
+        0.81922575967238742, 0.81936617943070844, 0.81978798926432084, 0.82048999145128509,
+        0.82146828034400243, 0.82271625196780762, 0.82422463935899448, 0.82598157356548751,
+        0.82797266999173746, 0.83018113952844208, 0.83258792366964951, 0.83517185258695159,
+        0.83790982490494925, 0.84077700770622443, 0.84374705508970127, 0.84679234341555332,
+        0.84988422119460649, 0.85299327142228099, 0.85608958401807811, 0.85914303591298158,
+        0.86212357623018332, 0.86500151393028912, 0.86774780524165629, 0.87033433817029449,
+        0.8727342113824359, 0.87492200477662474, 0.87687403911103901, 0.87856862212553222,
+        0.87998627869615131, 0.88110996268193975, 0.88192524826884633, 0.88242049878238837,
+        0.88258701112800886, 0.88241913422444485, 0.8819143600189695, 0.88107338591243556,
+        0.87990014767442915, 0.87840182219243268, 0.87658879967140158, 0.87447462517916486,
+        0.8720759097160522, 0.8694122112716276, 0.8665058866148051, 0.86338191484322635,
+        0.86006769399116312, 0.8565928122596792, 0.85298879568590347, 0.84928883430762214,
+        0.84552748910259568, 0.84174038218693159, 0.8379638729413843, 0.83423472289673584,
+        0.83058975234768384, 0.82706549177754085, 0.82369783126200513, 0.82052167107850349,
+        0.81757057677704859, 0.81487644196880149, 0.81246916205916364, 0.81037632209317578,
+        0.80862290179256546, 0.80723100074631482, 0.80621958657092985, 0.80560426868364188,
+        0.80539710013282728, 0.80560640970643937, 0.80623666629301671, 0.80728837720270452,
+        0.80875802186993928, 0.81063802205731539, 0.81291674936414782, 0.8155785705160723,
+        0.81860393057647818, 0.82196947387944697, 0.82564820214027568, 0.82960966885648812,
+        0.83382020877260155, 0.83824320084884907, 0.84283936285059113, 0.84756707536418552,
+        0.85238273274964205, 0.85724111826309701, 0.86209580032577315, 0.86689954668308356,
+        0.87160475299019557, 0.87616388218086549, 0.88052991082654564, 0.88465677857427816,
+        0.88849983666619248, 0.89201629149162953, 0.8951656391057683, 0.89791008666687966,
+        0.90021495679803476, 0.90204907096830578, 0.90338510811287476, 0.9041999348702251,
+        0.90447490400690711, 0.90419611782487985, 0.90335465360158296, 0.90194674839689326,
+        0.8999739408718318, 0.89744316809893288, 0.89436681570104404, 0.89076272003113,
+        0.88665412149744727, 0.88206956854308871, 0.87704277220304938, 0.87161241158225111,
+        0.86582189102088325, 0.8597190501353893, 0.85335582834093637, 0.84678788587063847,
+        0.84007418370457254, 0.83327652520438644, 0.82645906261354529, 0.81968777192575826,
+        0.8130298999418808, 0.80655338762547812, 0.80032627412673707, 0.79441608607091485,
+        0.78888921689881342, 0.78381030120092177, 0.77924158910221097, 0.77524232582966546,
+        0.7718681416285913, 0.76917045718570065, 0.76719590966667361, 0.76598580438333541,
+        0.76557559697097166, 0.76599441078052344, 0.76726459397431335, 0.76940132055900001,
+        0.77241223929741198, 0.7762971741136645, 0.78104787924595975, 0.78664785201129561,
+        0.79307220562883618, 0.80028760410706257, 0.80825226073745482, 0.81691600125775088,
+        0.82622039225470156, 0.83609893487338882, 0.84647732339163739, 0.85727376770786057,
+        0.86839937828291791, 0.87975861157527457, 0.89124977351808421, 0.90276557811069269,
+        0.914193757739447, 0.925417721407365, 0.93631725664279641, 0.94676927047716097,
+        0.95664856453440661, 0.96582863896294446, 0.97418251966726577, 0.98158360306363046,
+        0.98790651239420801, 0.99302795948871847, 0.99682760576331875, 0.9991889161943216,
+        0.99999999999999967, 0.99915443180755592, 0.9965520471742404, 0.99209970647116241,
+        0.98571202132468549, 0.97731203804227595, 0.96683187272565985, 0.95421329309221947,
+        0.93940824238348508, 0.92237930113465361, 0.90310008300853006, 0.88155556135779034,
+        0.85774232366766678, 0.83166875154333919, 0.80335512443859791, 0.77283364587062531,
+        0.74014839142594713, 0.70535517843026874, 0.66852135772580312, 0.62972552856932995,
+        0.58905717822819037, 0.54661624840538892, 0.50251263116459222, 0.45686559754687017,
+        0.40980316256952209, 0.36146139076929107, 0.31198364689404989, 0.26151979675518189,
+        0.21022536362416647, 0.15826064588838393, 0.10578980197034109, 0.052979908759015572,
+        3.5900245569535384e-16, -0.052979908759014864, -0.10578980197034037, -0.15826064588838321,
+        -0.2102253636241658, -0.26151979675518122, -0.31198364689404917, -0.36146139076929029,
+        -0.40980316256952143, -0.45686559754686945, -0.50251263116459133, -0.54661624840538825,
+        -0.58905717822818993, -0.62972552856932928, -0.66852135772580257, -0.70535517843026818,
+        -0.74014839142594646, -0.77283364587062464, -0.80335512443859702, -0.83166875154333841,
+        -0.85774232366766623, -0.8815555613577899, -0.9031000830085294, -0.92237930113465305,
+        -0.93940824238348464, -0.95421329309221881, -0.9668318727256594, -0.97731203804227551,
+        -0.98571202132468505, -0.99209970647116186, -0.99655204717423984, -0.99915443180755525,
+        -0.99999999999999911, -0.99918891619432093, -0.99682760576331819, -0.99302795948871814,
+        -0.98790651239420757, -0.98158360306362991, -0.97418251966726532, -0.96582863896294402,
+        -0.95664856453440617, -0.94676927047716031, -0.93631725664279575, -0.92541772140736478,
+        -0.91419375773944656, -0.90276557811069225, -0.89124977351808365, -0.87975861157527435,
+        -0.86839937828291758, -0.85727376770786023, -0.84647732339163706, -0.83609893487338827,
+        -0.82622039225470123, -0.81691600125775043, -0.80825226073745449, -0.80028760410706223,
+        -0.79307220562883585, -0.78664785201129517, -0.78104787924595931, -0.77629717411366428,
+        -0.77241223929741165, -0.76940132055899968, -0.76726459397431301, -0.76599441078052311,
+        -0.76557559697097077, -0.7659858043833353, -0.76719590966667361, -0.76917045718570054,
+        -0.77186814162859074, -0.7752423258296649, -0.77924158910221042, -0.78381030120092143,
+        -0.78888921689881297, -0.7944160860709143, -0.80032627412673663, -0.80655338762547768,
+        -0.81302989994188057, -0.8196877719257577, -0.82645906261354485, -0.83327652520438622,
+        -0.84007418370457188, -0.84678788587063814, -0.85335582834093582, -0.85971905013538841,
+        -0.86582189102088292, -0.87161241158225067, -0.87704277220304905, -0.88206956854308849,
+        -0.88665412149744682, -0.89076272003112955, -0.8943668157010437, -0.89744316809893265,
+        -0.89997394087183136, -0.90194674839689293, -0.90335465360158251, -0.90419611782487963,
+        -0.90447490400690678, -0.90419993487022499, -0.90338510811287465, -0.90204907096830556,
+        -0.90021495679803443, -0.89791008666687944, -0.89516563910576763, -0.89201629149162942,
+        -0.88849983666619214, -0.88465677857427771, -0.88052991082654497, -0.87616388218086505,
+        -0.87160475299019546, -0.86689954668308333, -0.86209580032577271, -0.85724111826309646,
+        -0.85238273274964182, -0.84756707536418496, -0.8428393628505908, -0.83824320084884896,
+        -0.83382020877260155, -0.82960966885648801, -0.82564820214027546, -0.8219694738794463,
+        -0.81860393057647773, -0.8155785705160723, -0.8129167493641476, -0.81063802205731506,
+        -0.80875802186993895, -0.80728837720270397, -0.80623666629301638, -0.80560640970643904,
+        -0.80539710013282717, -0.80560426868364154, -0.80621958657092962, -0.80723100074631438,
+        -0.80862290179256524, -0.81037632209317534, -0.8124691620591632, -0.81487644196880149,
+        -0.81757057677704847, -0.82052167107850349, -0.82369783126200502, -0.82706549177754063,
+        -0.83058975234768373, -0.8342347228967355, -0.83796387294138397, -0.84174038218693115,
+        -0.84552748910259556, -0.84928883430762192, -0.85298879568590302, -0.85659281225967876,
+        -0.8600676939911629, -0.86338191484322591, -0.86650588661480488, -0.86941221127162749,
+        -0.87207590971605198, -0.87447462517916463, -0.87658879967140091, -0.87840182219243201,
+        -0.87990014767442903, -0.881073385912435, -0.88191436001896928, -0.88241913422444462,
+        -0.88258701112800897, -0.88242049878238804, -0.88192524826884644, -0.88110996268193931,
+        -0.87998627869615109, -0.87856862212553188, -0.87687403911103856, -0.87492200477662418,
+        -0.87273421138243545, -0.87033433817029437, -0.86774780524165596, -0.86500151393028879,
+        -0.86212357623018321, -0.85914303591298147, -0.85608958401807767, -0.85299327142228087,
+        -0.84988422119460605, -0.84679234341555287, -0.84374705508970116, -0.84077700770622432,
+        -0.83790982490494881, -0.83517185258695115, -0.83258792366964929, -0.83018113952844175,
+        -0.82797266999173746, -0.82598157356548729, -0.82422463935899459, -0.82271625196780762,
+        -0.82146828034400199, -0.82048999145128465, -0.81978798926432073, -0.81936617943070822,
+        -0.81922575967238676, -0.81936523576314479, -0.81978046268251459, -0.8204647103158984,
+        -0.82140875284818304, -0.82260098078555943, -0.82402753433946063, -0.82567245671930367,
+        -0.82751786570868391, -0.82954414174423785, -0.8317301305788497, -0.83405335849244699,
+        -0.8364902579150657, -0.83901640124907439, -0.84160674062088203, -0.84423585125746492,
+        -0.84687817616981265, -0.84950826983381211, -0.85210103858893282, -0.85463197552585135,
+        -0.8570773877052813, -0.85941461364083382, -0.86162222908781883, -0.86368023930628579,
+        -0.86557025610897409, -0.86727565816181329, -0.86878173317451435, -0.87007580080001168,
+        -0.87114731525225042, -0.87198794685021308, -0.87259164190025029, -0.87295466053676163,
+        -0.87307559235111887, -0.87295534984846168, -0.87259713997964994, -0.87200641419935387,
+        -0.87119079769911301, -0.87015999865439064, -0.86892569850549317, -0.86750142446211298,
+        -0.86590240557866083, -0.8641454138911222, -0.86224859223468464, -0.8602312704737044,
+        -0.85811377197086047, -0.85591721219975991, -0.85366329146421427, -0.85137408372758905,
+        -0.8490718235766519, -0.84677869334627798, -0.84451661241430576, -0.84230703063998236,
+        -0.84017072786546843, -0.8381276213281621, -0.83619658274319364, -0.83439526671112574,
+        -0.83273995198682738, -0.83124539701286582, -0.82992471097596199, -0.82878924148943833,
+        -0.82784847983979448, -0.82710998456309381, -0.82657932393844746, -0.82626003780325619,
+        -0.82615361890972283, -0.82625951385626795, -0.82657514344260297, -0.82709594211504711,
+        -0.82781541599092534, -0.82872521877922278, -0.82981524475055501, -0.83107373775458704,
+        -0.83248741513855795, -0.83404160528787363, -0.83572039739004433, -0.83750680191745375,
+        -0.83938292023363104, -0.84133012165247378, -0.84332922622090201, -0.84536069145314463,
+        -0.84740480121956241, -0.84944185498473501, -0.85145235559836163, -0.85341719386834314,
+        -0.85531782818762403, -0.85713645754469359, -0.8588561863213009, -0.86046117936915023,
+        -0.86193680595925048, -0.8632697713120826, -0.86444823454265152, -0.86546191199069011,
+        -0.86630216505119384, -0.86696207177290152, -0.86743648165069542, -0.86772205320062767,
+        -0.8678172740719301, -0.86772246361724736, -0.86743975800893891, -0.86697307815401314,
+        -0.86632808082159607, -0.86551209355321701, -0.86453403407627827, -0.86340431508337878,
+        -0.86213473537347163, -0.86073835847391034, -0.85922937997418547, -0.8576229849015804,
+        -0.85593519655524464, -0.85418271828751424, -0.85238276977915506, -0.85055291939805067,
+        -0.84871091425843415, -0.84687450960987387, -0.84506129918183448, -0.8432885480909168,
+        -0.84157302988402971, -0.83993086924222526, -0.83837739180726867, -0.83692698251684494,
+        -0.83559295374550124, -0.83438742444781555, -0.83332121138895221, -0.83240373342676566,
+        -0.83164292968021258, -0.83104519228223528, -0.83061531427283297, -0.83035645304118044,
+        -0.83027010957568015, -0.83035612362931055, -0.83061268475590111, -0.8310363590225085,
+        -0.83162213105529059, -0.8323634609325794, -0.83325235530050401, -0.83427945195492992,
+        -0.83543411700969383, -0.83670455365640894, -0.83807792141644144, -0.83954046469195864,
+        -0.84107764934110418, -0.84267430593300707, -0.84431477828212331, -0.84598307581877374,
+        -0.84766302832403262, -0.84933844154250382, -0.85099325218612554, -0.85261168085579642,
+        -0.85417838143523028, -0.85567858555261467, -0.85709824075989238, -0.85842414114634125,
+        -0.85964404918173243, -0.86074680767402578, -0.86172244082637417, -0.86256224348711219,
+        -0.86325885780336231, -0.86380633661279893, -0.86420019303761908, -0.86443743587880029,
+        -0.8645165905458323, -0.86443770539607956, -0.86420234349739822, -0.8638135599662492,
+        -0.86327586517004795, -0.86259517421558918, -0.86177874327378301, -0.86083509341348297,
+        -0.85977392273278352, -0.85860600768363227, -0.85734309458408486, -0.85599778240108559,
+        -0.8545833979644466, -0.85311386483915153, -0.8516035671375054, -0.85006720959466364,
+        -0.84851967526028771, -0.84697588217525266, -0.84545064040549256, -0.84395851079509154,
+        -0.8425136667779114, -0.84112976055155286, -0.83981979486976854, -0.83859600164998693,
+        -0.83746972852211343, -0.83645133436384145, -0.83555009477722775, -0.83477411836214976,
+        -0.83413027453543742, -0.83362413353100673, -0.83325991909733765, -0.83304047428528916,
+        -0.83296724059270155, -0.83304025060374587, -0.83325813413173877, -0.83361813774541449,
+        -0.83411615743163714, -0.8347467840234184, -0.83550336090211985, -0.83637805336788917,
+        -0.8373619289638643, -0.83844504793842789, -0.83961656293673614, -0.84086482692878317,
+        -0.84217750830708282, -0.84354171202337214, -0.8449441055810808, -0.84637104865918378,
+        -0.84780872511370486, -0.84924327608592443, -0.85066093294123002, -0.85204814876967949,
+        -0.85339172719847189, -0.85467894729751825, -0.85589768340172656, -0.85703651872712183,
+        -0.85808485172184812, -0.85903299416686607, -0.85987226012401641, -0.86059504492019023,
+        -0.86119489345481004, -0.8616665572226484, -0.86200603955417854, -0.86221062869015808,
+        -0.86227891842478521, -0.86221081617147621, -0.86200753842594147, -0.86167159372158852,
+        -0.86120675329124374, -0.86061800976566971, -0.85991152435213725, -0.8590945630445187,
+        -0.85817542251879975, -0.8571633464637467, -0.85606843318476533, -0.85490153539894953,
+        -0.85367415321019358, -0.8523983213144567, -0.85108649153618021, -0.84975141183710357,
+        -0.84840600296794311, -0.84706323395128924, -0.84573599759064333, -0.84443698719560811,
+        -0.84317857569700994, -0.84197269829840704, -0.84083073977224709, -0.83976342746031629,
+        -0.83878073097963513, -0.83789176956707678, -0.83710472791948987, -0.83642678130175996,
+        -0.83586403060376591, -0.83542144792965733, -0.8351028332000574, -0.83491078214083281,
+        -0.83484666592192025, -0.83491062259743232, -0.83510156038498484, -0.83541717270897209,
+        -0.83585396482039453, -0.83640729169596784, -0.83707140681256031, -0.83783952129061712,
+        -0.83870387280297665, -0.83965580355440617, -0.84068584655303158, -0.8417838193184094,
+        -0.84293892410303328, -0.84413985364512212, -0.84537490142121519, -0.84663207532776164,
+        -0.84789921369194476, -0.84916410249361074, -0.85041459267254615, -0.85163871639850386,
+        -0.85282480119522353, -0.85396158083407647, -0.85503830194763375, -0.85604482535800441,
+        -0.85697172116877496, -0.85781035673231476, -0.85855297667532504, -0.859192774244248,
+        -0.85972395331765639, -0.86014178052416523, -0.86044262700091101, -0.86062399942825929,
+        -0.86068456008010996, -0.8606241357351041, -0.86044371540101128, -0.86014543691168222,
+        -0.85973256256215791, -0.85920944405175648, -0.85858147710628141, -0.85785504624796571,
+        -0.85703746027439243, -0.85613687909463787, -0.85516223265138591, -0.85412313273104257,
+        -0.85302977852929318, -0.85189285689640748, -0.85072343823448449, -0.8495328690572761,
+        -0.84833266225187209, -0.84713438610017455, -0.84594955312655062, -0.8447895098363325,
+        -0.84366532839789166, -0.84258770129911253, -0.84156683997736215, -0.84061237838090519,
+        -0.83973328236953271, -0.83893776580347235, -0.8382332141030191, -0.83762611598743975,
+        -0.83712200402124393, -0.83672540450974664, -0.8364397971947205, -0.83626758510580845,
+        -0.83621007482513654, -0.8362674673221312, -0.83643885941399121, -0.83672225580540471,
+        -0.83711459156005186, -0.8376117647570811, -0.83820867898903517, -0.83889929526459517,
+        -0.83967669279082457, -0.8405331380262161, -0.84146016131852275, -0.84244864037081191,
+        -0.84348888971609792, -0.84457075532582426, -0.84568371343093252, -0.84681697259661193,
+        -0.84795957806356048, -0.84910051734969638, -0.85022882609718675, -0.85133369315023222,
+        -0.85240456385931462, -0.85343124062754017, -0.8544039797438655, -0.85531358358630283,
+        -0.85615148732512913, -0.85690983931121767, -0.85758157439737226, -0.85816047951032026,
+        -0.85864125086708676, -0.85901954231117594, -0.85929200433044417, -0.85945631340894957,
+        -0.85951119145857457, -0.85945641517186933, -0.8592928152344641, -0.85902226543266125,
+        -0.85864766178842611, -0.85817289194909607, -0.85760279515181237, -0.85694311317200933,
+        -0.85620043275050506, -0.85538212007397463, -0.85449624795810464, -0.85355151645083494,
+        -0.85255716763417588, -0.85152289545652338, -0.85045875147277128, -0.84937504740635883,
+        -0.84828225547538261, -0.84719090744383607, -0.84611149336869662, -0.84505436101395259,
+        -0.84402961689372114, -0.84304702988850799, -0.84211593835155074, -0.84124516158639528,
+        -0.8404429165327223, -0.83971674044539824, -0.83907342029232623, -0.83851892953046747,
+        -0.83805837284707263, -0.8376959393753789, -0.83743486481159635, -0.8372774027736738,
+        -0.83722480565296764, -0.83727731511841574, -0.83743416233994128, -0.83769357790460952,
+        -0.83805281130625775, -0.83850815979795956, -0.83905500630751284, -0.83968786603009415,
+        -0.84040044123006874, -0.84118568370645874, -0.84203586430450972, -0.84294264878983149,
+        -0.84389717934227815, -0.84489016087474189, -0.8459119513377138, -0.84695265513433304,
+        -0.84800221874293635, -0.84905052762514088, -0.8500875034873927, -0.85110320096273451,
+        -0.85208790278731361, -0.85303221256276573, -0.85392714422087646, -0.854764207340589,
+        -0.85553548750914588, -0.85623372096853201, -0.85685236284487731, -0.85738564832160047,
+        -0.85782864618614663, -0.85817730425454342, -0.85842848625697021, -0.85857999985027855,
+        -0.85863061550918396, -0.85858007613580822, -0.85842909731653005, -0.85817935824487013,
+        -0.85783348341854571, -0.85739501530694351, -0.85686837827137319, -0.85625883410361547,
+        -0.85557242962778812, -0.85481593688561042, -0.85399678649505628, -0.85312299483649612,
+        -0.85220308577814252, -0.85124600770336645, -0.85026104664581847, -0.84925773637380952,
+        -0.84824576629284854, -0.84723488805420999, -0.8462348217679504, -0.84525516272059131,
+        -0.84430528949097439, -0.84339427434244796, -0.84253079674587994, -0.8417230608561822,
+        -0.8409787177253728, -0.84030479298820215, -0.83970762070233673, -0.83919278396471586,
+        -0.83876506285942565, -0.83842839022105164, -0.83818581562152417, -0.83803947790885303,
+        -0.83799058654347636, -0.83803941189314501, -0.83818528456106611, -0.83842660373529687,
+        -0.8387608544609424, -0.83918463365138407, -0.83969368457139337, -0.84028293944427779,
+        -0.84094656975810456, -0.84167804377301658, -0.84247019066371431, -0.84331527066861955,
+        -0.84420505056096407, -0.84513088370736078, -0.84608379393687949, -0.84705456240866273,
+        -0.84803381663895183, -0.84901212082932975, -0.84998006662717207, -0.85092836344685041,
+        -0.85184792748610794, -0.85272996858620165, -0.85356607410672114, -0.85434828901616677,
+        -0.85506919143719085, -0.85572196293041014, -0.85630045285250034, -0.85679923618231901,
+        -0.85721366427260426, -0.85753990805357538, -0.85777499328806617, -0.85791682755473098,
+        -0.85796421871576434, -0.85791688470771188, -0.85777545457735938, -0.85754146076884685,
+        -0.85721732275196427, -0.85680632216446595, -0.85631256972229153, -0.85574096423004142,
+        -0.85509714409919035, -0.85438743185266186, -0.85361877216073312, -0.85279866401432458,
+        -0.8519350876968631, -0.85103642726458384, -0.85011138928699703, -0.84916891863373556,
+        -0.84821811212098752, -0.84726813084979857, -0.84632811207962955, -0.84540708148356236,
+        -0.84451386662641315, -0.84365701249384528, -0.84284469987949118, -0.84208466740830867,
+        -0.84138413793819089, -0.84074975003863273, -0.84018749519536728, -0.8397026613338906,
+        -0.83929978319321341, -0.8389826000145898, -0.83875402093904439, -0.83861609843296248,
+        -0.83857000998346087, -0.83861604822558122, -0.83875361958220174, -0.83898125141579183,
+        -0.83929660760952429, -0.83969651241452614, -0.84017698232105542, -0.84073326563482809,
+        -0.84135988936631856, -0.84205071297137235, -0.84279898841646994, -0.84359742598217313,
+        -0.84443826516417964, -0.84531334998352292, -0.84621420797624214, -0.8471321320987113,
+        -0.84805826475803359, -0.8489836831577402, -0.84989948513769609, -0.85079687468361143,
+        -0.85166724628600232, -0.85250226734074708, -0.8532939578033607, -0.85403476633669484,
+        -0.85471764222650715, -0.85533610238106961, -0.85588429277912326, -0.8563570437847311,
+        -0.8567499188072305, -0.8570592558491319, -0.85728220155367763, -0.85741673743631508,
+        -0.85746169805974082, -0.85741678098984886, -0.85728254844894847, -0.8570604206624195,
+        -0.85675266097463043, -0.85636235288881268, -0.85589336926282578, -0.85535033396765237,
+        -0.85473857638736561, -0.85406407920739891, -0.8533334200017566, -0.85255370718852796,
+        -0.85173251097633584, -0.85087778997151209, -0.84999781415650999, -0.8491010849838837,
+        -0.84819625335682158, -0.84729203628644045, -0.84639713302765585, -0.8455201414993746,
+        -0.84466947579093088, -0.8438532855451778, -0.84307937798960331, -0.84235514336038619,
+        -0.84168748443077801, -0.8410827508148766, -0.8405466786711504, -0.84008433637745716,
+        -0.83970007669125624, -0.83939749584582402, -0.83917939996616064, -0.83904777911753226,
+        -0.83900378922599639, -0.83904774203437871, -0.83917910317990607, -0.83939649840163733,
+        -0.8396977278078438, -0.84007978805622363, -0.84053890222411476, -0.84107055707235312,
+        -0.84166954733585675, -0.84233002660703793, -0.84304556431544042, -0.84380920824908223,
+        -0.84461355201052413, -0.84545080675403528, -0.84631287650996734, -0.84719143636884664,
+        -0.84807801277112904, -0.84896406512925204, -0.84984106799677495, -0.85070059299503042,
+        -0.85153438971102191, -0.85233446479104413, -0.85309315847275891, -0.85380321782388802,
+        -0.85445786598815543, -0.85505086677820918, -0.85557658400068037, -0.85603003494976782,
+        -0.85640693756234287, -0.85670375078897332, -0.85691770780084975, -0.85704684172178736,
+        -0.85709000364654964, -0.85704687278101388, -0.85691795861550368, -0.85670459511914987,
+        -0.85640892701972826, -0.85603388830930227, -0.85558317319046651, -0.8550611997502725,
+        -0.8544730667184437, -0.85382450373242658, -0.85312181559373268, -0.85237182105716158,
+        -0.85158178674638885, -0.85075935683556903, -0.84991247917656798, -0.84904932858484261,
+        -0.84817822802353315, -0.84730756844473609, -0.84644572805904772, -0.84560099180917403,
+        -0.84478147182065766, -0.84399502959262618, -0.84324920067400411, -0.84255112254603048,
+        -0.84190746640045067, -0.84132437346467592, -0.84080739648093361, -0.84036144689637293,
+        -0.83999074826573383, -0.83969879630810018, -0.83948832599493428, -0.83936128597878001,
+        -0.83931882060125795, -0.83936125964600539, -0.83948811592772199, -0.83969809073319512,
+        -0.83998908705478625, -0.8403582304821301, -0.84080189754441137, -0.84131575122426105,
+        -0.84189478329573308, -0.84253336307363125, -0.84322529210028585, -0.84396386423931657,
+        -0.84474193059448255, -0.84555196862592019, -0.84638615479632762, -0.84723644004635612,
+        -0.84809462737191443, -0.84895245075653936, -0.84980165469962121, -0.85063407357619747,
+        -0.85144171006628877, -0.85221681190131526, -0.85295194619193093, -0.85364007062542024,
+        -0.85427460085145213, -0.85484947341212225, -0.85535920361551621, -0.8557989378010461,
+        -0.85616449949910467, -0.85645242904656282, -0.85666001628283373, -0.85678532601792345,
+        -0.85682721603352308, -0.85678534745007451, -0.85666018736612271, -0.85645300375055744,
+        -0.85616585264270972, -0.85580155778907485, -0.85536368291794795, -0.85485649692375998,
+        -0.85428493230081126, -0.85365453723058604, -0.85297142178753071, -0.85224219878424234,
+        -0.8514739198281368, -0.85067400720720976, -0.84985018226209186, -0.84901039093489417,
+        -0.84816272721192587, -0.847315355197098, -0.84647643056546906, -0.84565402215179863,
+        -0.84485603442718149, -0.84409013160779667, -0.84336366412361363, -0.8426835981517764,
+        -0.8420564488894956, -0.84148821820489816, -0.84098433726188426, -0.84054961466685763,
+        -0.84018819063185579, -0.83990349759051064, -0.83969822764105473, -0.83957430712479153,
+        -0.83953287857977088, -0.83957429023842844, -0.83969809316543575, -0.83990304605858734,
+        -0.84018712766196924, -0.84054755666758574, -0.84098081890981968, -0.84148270158718386,
+        -0.84204833417851133, -0.84267223565664828, -0.84334836754249531, -0.84407019228640279,
+        -0.84483073641310058, -0.84562265782089552, -0.8464383165863445, -0.84726984859229992,
+        -0.84810924127049925, -0.84894841072994676, -0.84977927952942767, -0.85059385434670487,
+        -0.85138430279833299, -0.85214302867257863, -0.85286274485355085, -0.85353654323718064,
+        -0.85415796096894447, -0.85472104236886437, -0.8552203959510567, -0.85565124599248998,
+        -0.85600947815822792, -0.85629167874771839, -0.8564951671881802, -0.85661802146613952,
+        -0.8566590962561097, -0.85661803357567745, -0.85649526586806468, -0.85629201148600831,
+        -0.85601026262377455, -0.85565276581661753, -0.85522299519829081, -0.85472511877671542,
+        -0.85416395805478185, -0.85354494138707226, -0.85287405152325146, -0.85215776784449804,
+        -0.85140300385012768, -0.85061704049689979, -0.84980745603312757, -0.8489820530030594,
+        -0.84814878312395325, -0.84731567075838843, -0.84649073571757927, -0.84568191613759758,
+        -0.84489699216944081, -0.84414351121576547, -0.84342871543202302, -0.84275947218769942,
+        -0.84214220815469443, -0.8415828476548225, -0.84108675585728498, -0.84065868737018501,
+        -0.84030274071819067, -0.84002231914174763, -0.83982009809239944, -0.83969799973434855,
+        -0.83965717469501999, -0.83969799123768418, -0.83982003195789212, -0.84002209803315253,
+        -0.84030222098279916, -0.84065768182281697, -0.84108503742947527, -0.84158015385640361,
+        -0.84213824628306111, -0.84275392520894521, -0.84342124844802302, -0.8441337784222761,
+        -0.84488464420250142, -0.84566660769905178, -0.84647213336550853, -0.84729346074469947,
+        -0.8481226791593377, -0.84895180382912694, -0.84977285268266312, -0.85057792312593128,
+        -0.85135926802981243, -0.8521093702066459, -0.85282101466058635, -0.85348735791800656,
+        -0.85410199377239815, -0.85465901481277673, -0.85515306914522604, -0.85557941176348717,
+        -0.85593395007599593, -0.85621328315297496, -0.85641473431758031, -0.85653637676909544,
+        -0.85657705199312051, -0.85653638078304151, -0.85641476676803385, -0.85621339241484351,
+        -0.85593420754288085, -0.85557991046405268, -0.85515392192957851, -0.85466035213508074,
+        -0.85410396110190956, -0.85349011281618814, -0.85282472356701389, -0.85211420498089063,
+        -0.85136540230034297, -0.850585528500303, -0.8497820948757534, -0.84896283876794709,
+        -0.84813564912394457, -0.84730849060495572, -0.84648932697284884, -0.84568604449107199,
+        -0.84490637607601782, -0.84415782692763675, -0.84344760235381666, -0.84278253848195139,
+        -0.84216903652334263, -0.8416130012219355, -0.84111978407865107, -0.84069413189669995,
+        -0.84034014114213507, -0.84006121855802407, -0.83986004841055351, -0.83973856668166413,
+        -0.83969794245610474, -0.83973856668166413, -0.83986004841055351, -0.84006121855802407,
+        -0.84034014114213507, -0.84069413189669984, -0.84111978407865107, -0.84161300122193561,
+        -0.84216903652334252, -0.84278253848195139, -0.84344760235381666, -0.84415782692763675,
+        -0.84490637607601782, -0.84568604449107199, -0.8464893269728494, -0.84730849060495583,
+        -0.84813564912394468, -0.84896283876794698, -0.8497820948757534, -0.850585528500303,
+        -0.85136540230034297, -0.85211420498089074, -0.85282472356701389, -0.85349011281618803,
+        -0.85410396110191011, -0.85466035213508085, -0.85515392192957873, -0.85557991046405257,
+        -0.85593420754288074, -0.85621339241484362, -0.85641476676803385, -0.85653638078304184,
+        -0.8565770519931204, -0.85653637676909566, -0.85641473431758031, -0.85621328315297485,
+        -0.85593395007599593, -0.85557941176348717, -0.85515306914522593, -0.85465901481277662,
+        -0.85410199377239804, -0.85348735791800656, -0.85282101466058624, -0.8521093702066459,
+        -0.85135926802981243, -0.85057792312593128, -0.849772852682663, -0.84895180382912683,
+        -0.84812267915933781, -0.84729346074469913, -0.84647213336550875, -0.845666607699052,
+        -0.84488464420250142, -0.84413377842227622, -0.84342124844802269, -0.84275392520894521,
+        -0.84213824628306111, -0.84158015385640361, -0.84108503742947505, -0.84065768182281708,
+        -0.84030222098279928, -0.84002209803315286, -0.83982003195789179, -0.83969799123768463,
+        -0.83965717469501988, -0.83969799973434867, -0.83982009809239944, -0.84002231914174785,
+        -0.84030274071819078, -0.84065868737018512, -0.84108675585728543, -0.84158284765482294,
+        -0.84214220815469476, -0.84275947218769942, -0.84342871543202347, -0.84414351121576581,
+        -0.84489699216944092, -0.84568191613759758, -0.84649073571757938, -0.84731567075838843,
+        -0.84814878312395381, -0.8489820530030594, -0.84980745603312768, -0.85061704049689979,
+        -0.85140300385012735, -0.85215776784449826, -0.85287405152325169, -0.85354494138707249,
+        -0.85416395805478151, -0.85472511877671542, -0.8552229951982907, -0.85565276581661764,
+        -0.85601026262377455, -0.85629201148600831, -0.85649526586806468, -0.85661803357567767,
+        -0.85665909625610948, -0.85661802146613986, -0.8564951671881802, -0.85629167874771828,
+        -0.85600947815822792, -0.85565124599249043, -0.85522039595105659, -0.85472104236886459,
+        -0.85415796096894447, -0.85353654323718087, -0.85286274485355051, -0.85214302867257885,
+        -0.85138430279833288, -0.8505938543467052, -0.849779279529428, -0.84894841072994676,
+        -0.84810924127049936, -0.84726984859230026, -0.84643831658634461, -0.84562265782089563,
+        -0.8448307364131008, -0.84407019228640279, -0.84334836754249543, -0.84267223565664839,
+        -0.84204833417851144, -0.84148270158718408, -0.84098081890981957, -0.84054755666758585,
+        -0.84018712766196935, -0.83990304605858768, -0.83969809316543564, -0.839574290238429,
+        -0.83953287857977121, -0.83957430712479142, -0.83969822764105484, -0.83990349759051086,
+        -0.84018819063185568, -0.84054961466685763, -0.84098433726188448, -0.84148821820489861,
+        -0.84205644888949582, -0.84268359815177674, -0.84336366412361363, -0.84409013160779711,
+        -0.84485603442718182, -0.84565402215179875, -0.84647643056546906, -0.84731535519709789,
+        -0.84816272721192587, -0.84901039093489461, -0.84985018226209208, -0.85067400720720976,
+        -0.85147391982813714, -0.85224219878424201, -0.85297142178753083, -0.85365453723058582,
+        -0.85428493230081126, -0.85485649692376031, -0.85536368291794795, -0.85580155778907518,
+        -0.8561658526427095, -0.85645300375055755, -0.85666018736612293, -0.85678534745007473,
+        -0.85682721603352285, -0.85678532601792379, -0.85666001628283373, -0.85645242904656282,
+        -0.85616449949910478, -0.85579893780104577, -0.85535920361551643, -0.85484947341212236,
+        -0.85427460085145235, -0.85364007062542036, -0.85295194619193082, -0.85221681190131537,
+        -0.85144171006628921, -0.85063407357619769, -0.84980165469962132, -0.84895245075653969,
+        -0.84809462737191466, -0.84723644004635634, -0.84638615479632773, -0.84555196862592075,
+        -0.84474193059448266, -0.84396386423931669, -0.84322529210028585, -0.84253336307363147,
+        -0.84189478329573331, -0.84131575122426117, -0.84080189754441137, -0.84035823048213065,
+        -0.83998908705478648, -0.83969809073319535, -0.83948811592772221, -0.83936125964600561,
+        -0.83931882060125818, -0.83936128597878001, -0.83948832599493461, -0.83969879630809996,
+        -0.83999074826573394, -0.84036144689637271, -0.84080739648093394, -0.84132437346467615,
+        -0.84190746640045089, -0.84255112254603071, -0.84324920067400433, -0.84399502959262618,
+        -0.84478147182065766, -0.84560099180917414, -0.84644572805904772, -0.84730756844473598,
+        -0.84817822802353326, -0.8490493285848425, -0.84991247917656798, -0.85075935683556958,
+        -0.85158178674638907, -0.85237182105716169, -0.85312181559373257, -0.85382450373242647,
+        -0.85447306671844381, -0.85506119975027273, -0.85558317319046651, -0.85603388830930216,
+        -0.85640892701972848, -0.85670459511914976, -0.85691795861550357, -0.85704687278101399,
+        -0.85709000364654964, -0.85704684172178736, -0.85691770780084964, -0.85670375078897332,
+        -0.85640693756234343, -0.85603003494976804, -0.85557658400068071, -0.85505086677820941,
+        -0.85445786598815554, -0.85380321782388824, -0.85309315847275902, -0.85233446479104402,
+        -0.85153438971102202, -0.85070059299503087, -0.84984106799677495, -0.8489640651292526,
+        -0.84807801277112926, -0.84719143636884708, -0.84631287650996756, -0.84545080675403539,
+        -0.84461355201052424, -0.84380920824908245, -0.84304556431544064, -0.84233002660703793,
+        -0.84166954733585686, -0.84107055707235356, -0.84053890222411509, -0.84007978805622374,
+        -0.83969772780784402, -0.83939649840163721, -0.83917910317990607, -0.83904774203437893,
+        -0.83900378922599639, -0.83904777911753259, -0.83917939996616053, -0.83939749584582435,
+        -0.83970007669125635, -0.84008433637745772, -0.84054667867115074, -0.8410827508148766,
+        -0.84168748443077812, -0.84235514336038619, -0.84307937798960342, -0.8438532855451778,
+        -0.84466947579093077, -0.84552014149937427, -0.84639713302765562, -0.84729203628644068,
+        -0.84819625335682192, -0.8491010849838837, -0.8499978141565101, -0.85087778997151187,
+        -0.85173251097633584, -0.85255370718852796, -0.85333342000175649, -0.85406407920739891,
+        -0.85473857638736539, -0.85535033396765259, -0.85589336926282611, -0.85636235288881302,
+        -0.85675266097463043, -0.85706042066241972, -0.85728254844894869, -0.85741678098984908,
+        -0.85746169805974115, -0.85741673743631508, -0.85728220155367785, -0.85705925584913167,
+        -0.85674991880723095, -0.85635704378473121, -0.85588429277912359, -0.85533610238106961,
+        -0.85471764222650759, -0.85403476633669528, -0.85329395780336059, -0.85250226734074708,
+        -0.85166724628600221, -0.85079687468361154, -0.84989948513769642, -0.84898368315774075,
+        -0.84805826475803392, -0.84713213209871141, -0.84621420797624225, -0.84531334998352303,
+        -0.84443826516417964, -0.84359742598217302, -0.84279898841646994, -0.84205071297137235,
+        -0.84135988936631878, -0.84073326563482809, -0.84017698232105575, -0.83969651241452647,
+        -0.83929660760952429, -0.83898125141579216, -0.83875361958220174, -0.83861604822558145,
+        -0.83857000998346076, -0.83861609843296248, -0.83875402093904439, -0.8389826000145898,
+        -0.83929978319321374, -0.8397026613338906, -0.84018749519536762, -0.84074975003863317,
+        -0.84138413793819111, -0.84208466740830856, -0.84284469987949118, -0.84365701249384528,
+        -0.84451386662641359, -0.84540708148356258, -0.84632811207962977, -0.84726813084979868,
+        -0.84821811212098763, -0.84916891863373567, -0.85011138928699725, -0.85103642726458406,
+        -0.85193508769686321, -0.85279866401432469, -0.8536187721607329, -0.85438743185266186,
+        -0.85509714409919002, -0.85574096423004153, -0.8563125697222923, -0.85680632216446595,
+        -0.85721732275196472, -0.85754146076884719, -0.85777545457735915, -0.85791688470771166,
+        -0.85796421871576445, -0.85791682755473098, -0.85777499328806672, -0.85753990805357516,
+        -0.85721366427260437, -0.85679923618231923, -0.85630045285250056, -0.85572196293041058,
+        -0.85506919143719085, -0.85434828901616711, -0.85356607410672092, -0.85272996858620176,
+        -0.85184792748610771, -0.85092836344685074, -0.84998006662717207, -0.84901212082932964,
+        -0.84803381663895216, -0.84705456240866306, -0.84608379393687971, -0.84513088370736111,
+        -0.84420505056096451, -0.84331527066861944, -0.84247019066371454, -0.8416780437730168,
+        -0.84094656975810467, -0.8402829394442779, -0.83969368457139371, -0.83918463365138418,
+        -0.83876085446094217, -0.83842660373529743, -0.83818528456106633, -0.83803941189314513,
+        -0.83799058654347636, -0.83803947790885314, -0.83818581562152428, -0.83842839022105187,
+        -0.83876506285942531, -0.83919278396471619, -0.83970762070233684, -0.84030479298820215,
+        -0.84097871772537325, -0.8417230608561822, -0.84253079674588049, -0.84339427434244851,
+        -0.84430528949097472, -0.84525516272059142, -0.84623482176795017, -0.84723488805420988,
+        -0.84824576629284887, -0.84925773637381008, -0.85026104664581847, -0.85124600770336667,
+        -0.85220308577814274, -0.85312299483649678, -0.8539967864950565, -0.85481593688561042,
+        -0.85557242962778779, -0.85625883410361558, -0.85686837827137319, -0.85739501530694384,
+        -0.85783348341854571, -0.85817935824487057, -0.85842909731653028, -0.85858007613580845,
+        -0.85863061550918429, -0.85857999985027877, -0.85842848625697066, -0.85817730425454342,
+        -0.85782864618614663, -0.85738564832160047, -0.85685236284487765, -0.85623372096853223,
+        -0.85553548750914599, -0.85476420734058922, -0.85392714422087668, -0.85303221256276607,
+        -0.85208790278731383, -0.85110320096273451, -0.85008750348739293, -0.84905052762514066,
+        -0.84800221874293635, -0.84695265513433371, -0.84591195133771357, -0.84489016087474189,
+        -0.84389717934227859, -0.84294264878983149, -0.84203586430451016, -0.84118568370645874,
+        -0.84040044123006896, -0.83968786603009415, -0.83905500630751284, -0.83850815979795967,
+        -0.83805281130625764, -0.83769357790460963, -0.8374341623399415, -0.83727731511841608,
+        -0.83722480565296797, -0.83727740277367391, -0.83743486481159668, -0.83769593937537901,
+        -0.83805837284707263, -0.83851892953046792, -0.83907342029232601, -0.83971674044539835,
+        -0.8404429165327223, -0.84124516158639551, -0.84211593835155107, -0.84304702988850833,
+        -0.84402961689372147, -0.8450543610139527, -0.84611149336869673, -0.84719090744383596,
+        -0.84828225547538283, -0.8493750474063585, -0.85045875147277172, -0.85152289545652327,
+        -0.85255716763417588, -0.85355151645083516, -0.85449624795810475, -0.85538212007397507,
+        -0.85620043275050572, -0.85694311317200966, -0.85760279515181237, -0.85817289194909574,
+        -0.858647661788426, -0.85902226543266191, -0.85929281523446421, -0.85945641517186988,
+        -0.85951119145857469, -0.85945631340894924, -0.85929200433044484, -0.8590195423111765,
+        -0.85864125086708698, -0.85816047951032037, -0.85758157439737215, -0.85690983931121745,
+        -0.85615148732512969, -0.85531358358630294, -0.85440397974386584, -0.85343124062754028,
+        -0.85240456385931407, -0.851333693150233, -0.85022882609718753, -0.84910051734969638,
+        -0.84795957806356059, -0.84681697259661193, -0.84568371343093252, -0.84457075532582482,
+        -0.84348888971609803, -0.84244864037081224, -0.84146016131852297, -0.84053313802621588,
+        -0.83967669279082546, -0.83889929526459561, -0.83820867898903573, -0.83761176475708143,
+        -0.83711459156005186, -0.83672225580540427, -0.83643885941399188, -0.83626746732213131,
+        -0.83621007482513676, -0.83626758510580912, -0.83643979719472028, -0.83672540450974719,
+        -0.83712200402124415, -0.83762611598744008, -0.8382332141030191, -0.83893776580347224,
+        -0.83973328236953226, -0.84061237838090541, -0.84156683997736215, -0.84258770129911253,
+        -0.84366532839789166, -0.84478950983633216, -0.8459495531265514, -0.847134386100175,
+        -0.84833266225187232, -0.8495328690572761, -0.85072343823448426, -0.85189285689640748,
+        -0.85302977852929385, -0.85412313273104279, -0.85516223265138613, -0.85613687909463809,
+        -0.85703746027439232, -0.85785504624796605, -0.85858147710628185, -0.8592094440517567,
+        -0.85973256256215824, -0.86014543691168188, -0.8604437154010115, -0.86062413573510466,
+        -0.86068456008010996, -0.86062399942825973, -0.86044262700091123, -0.86014178052416523,
+        -0.85972395331765727, -0.85919277424424878, -0.85855297667532537, -0.85781035673231476,
+        -0.8569717211687744, -0.85604482535800397, -0.85503830194763442, -0.85396158083407658,
+        -0.85282480119522375, -0.85163871639850375, -0.85041459267254582, -0.84916410249361174,
+        -0.84789921369194521, -0.84663207532776186, -0.84537490142121541, -0.84413985364512201,
+        -0.84293892410303317, -0.8417838193184104, -0.84068584655303213, -0.8396558035544065,
+        -0.83870387280297709, -0.83783952129061701, -0.83707140681256076, -0.83640729169596828,
+        -0.83585396482039476, -0.83541717270897231, -0.83510156038498462, -0.83491062259743221,
+        -0.83484666592192092, -0.83491078214083292, -0.83510283320005774, -0.83542144792965767,
+        -0.8358640306037658, -0.83642678130176051, -0.83710472791949087, -0.837891769567077,
+        -0.83878073097963546, -0.83976342746031596, -0.84083073977224698, -0.84197269829840782,
+        -0.84317857569701005, -0.84443698719560811, -0.84573599759064355, -0.84706323395128902,
+        -0.84840600296794388, -0.84975141183710423, -0.85108649153618032, -0.85239832131445692,
+        -0.85367415321019335, -0.85490153539894964, -0.856068433184766, -0.85716334646374648,
+        -0.85817542251879975, -0.8590945630445187, -0.85991152435213702, -0.86061800976567049,
+        -0.86120675329124474, -0.86167159372158875, -0.86200753842594169, -0.86221081617147588,
+        -0.86227891842478532, -0.86221062869015896, -0.86200603955417898, -0.86166655722264851,
+        -0.86119489345481048, -0.8605950449201899, -0.85987226012401741, -0.85903299416686707,
+        -0.85808485172184834, -0.85703651872712217, -0.8558976834017259, -0.85467894729751814,
+        -0.85339172719847223, -0.85204814876967971, -0.85066093294123035, -0.84924327608592454,
+        -0.84780872511370498, -0.84637104865918455, -0.84494410558108146, -0.84354171202337225,
+        -0.84217750830708282, -0.84086482692878273, -0.83961656293673581, -0.83844504793842878,
+        -0.83736192896386485, -0.83637805336788917, -0.83550336090212018, -0.83474678402341873,
+        -0.83411615743163781, -0.83361813774541493, -0.83325813413173877, -0.83304025060374653,
+        -0.83296724059270155, -0.83304047428528893, -0.83325991909733832, -0.83362413353100762,
+        -0.83413027453543764, -0.83477411836214988, -0.83555009477722775, -0.83645133436384256,
+        -0.8374697285221141, -0.83859600164998727, -0.83981979486976888, -0.84112976055155286,
+        -0.84251366677791095, -0.8439585107950921, -0.84545064040549278, -0.8469758821752531,
+        -0.84851967526028782, -0.85006720959466375, -0.85160356713750629, -0.85311386483915252,
+        -0.85458339796444704, -0.85599778240108571, -0.85734309458408531, -0.85860600768363216,
+        -0.85977392273278419, -0.8608350934134833, -0.86177874327378312, -0.86259517421558962,
+        -0.86327586517004806, -0.86381355996624998, -0.86420234349739877, -0.86443770539607989,
+        -0.8645165905458323, -0.86443743587880095, -0.86420019303761919, -0.86380633661279937,
+        -0.86325885780336264, -0.86256224348711252, -0.86172244082637484, -0.86074680767402556,
+        -0.85964404918173309, -0.8584241411463418, -0.85709824075989238, -0.85567858555261478,
+        -0.85417838143523084, -0.85261168085579642, -0.85099325218612631, -0.84933844154250426,
+        -0.84766302832403251, -0.84598307581877408, -0.84431477828212331, -0.84267430593300785,
+        -0.84107764934110463, -0.83954046469195898, -0.838077921416442, -0.83670455365640917,
+        -0.83543411700969372, -0.83427945195493092, -0.83325235530050423, -0.83236346093257985,
+        -0.83162213105529115, -0.83103635902250828, -0.830612684755902, -0.83035612362931144,
+        -0.83027010957568048, -0.83035645304118066, -0.8306153142728333, -0.83104519228223506,
+        -0.83164292968021303, -0.83240373342676588, -0.83332121138895288, -0.83438742444781555,
+        -0.83559295374550102, -0.83692698251684583, -0.83837739180726933, -0.83993086924222582,
+        -0.84157302988402993, -0.84328854809091736, -0.84506129918183404, -0.84687450960987432,
+        -0.84871091425843481, -0.85055291939805078, -0.85238276977915539, -0.85418271828751413,
+        -0.85593519655524553, -0.85762298490158106, -0.85922937997418569, -0.86073835847391034,
+        -0.86213473537347196, -0.86340431508337923, -0.86453403407627893, -0.86551209355321734,
+        -0.86632808082159629, -0.86697307815401359, -0.86743975800893869, -0.86772246361724847,
+        -0.86781727407193088, -0.86772205320062812, -0.86743648165069553, -0.86696207177290208,
+        -0.86630216505119373, -0.86546191199069122, -0.86444823454265174, -0.86326977131208271,
+        -0.86193680595925071, -0.86046117936914979, -0.85885618632130145, -0.85713645754469403,
+        -0.85531782818762447, -0.85341719386834336, -0.85145235559836163, -0.84944185498473468,
+        -0.84740480121956296, -0.84536069145314463, -0.84332922622090234, -0.84133012165247423,
+        -0.8393829202336307, -0.83750680191745464, -0.83572039739004522, -0.83404160528787397,
+        -0.83248741513855828, -0.83107373775458759, -0.82981524475055501, -0.82872521877922356,
+        -0.82781541599092556, -0.82709594211504744, -0.82657514344260352, -0.82625951385626772,
+        -0.82615361890972316, -0.82626003780325696, -0.82657932393844813, -0.82710998456309415,
+        -0.82784847983979526, -0.82878924148943844, -0.82992471097596265, -0.83124539701286615,
+        -0.83273995198682782, -0.83439526671112629, -0.83619658274319353, -0.83812762132816199,
+        -0.84017072786546954, -0.84230703063998291, -0.84451661241430598, -0.84677869334627853,
+        -0.84907182357665156, -0.85137408372758971, -0.85366329146421449, -0.85591721219976002,
+        -0.85811377197086058, -0.8602312704737044, -0.86224859223468442, -0.86414541389112276,
+        -0.86590240557866094, -0.86750142446211298, -0.86892569850549328, -0.87015999865439064,
+        -0.87119079769911389, -0.87200641419935421, -0.87259713997965049, -0.8729553498484619,
+        -0.87307559235111876, -0.87295466053676118, -0.8725916419002514, -0.87198794685021375,
+        -0.87114731525225075, -0.8700758008000119, -0.86878173317451435, -0.86727565816181407,
+        -0.86557025610897453, -0.8636802393062859, -0.86162222908781938, -0.85941461364083349,
+        -0.85707738770528108, -0.85463197552585191, -0.85210103858893316, -0.84950826983381256,
+        -0.84687817616981298, -0.84423585125746492, -0.8416067406208827, -0.83901640124907484,
+        -0.83649025791506604, -0.83405335849244744, -0.83173013057884981, -0.82954414174423774,
+        -0.82751786570868469, -0.825672456719304, -0.8240275343394613, -0.82260098078555977,
+        -0.82140875284818271, -0.8204647103158994, -0.81978046268251503, -0.81936523576314479,
+        -0.81922575967238742, -0.81936617943070822, -0.81978798926432039, -0.82048999145128565,
+        -0.82146828034400243, -0.82271625196780784, -0.82422463935899482, -0.82598157356548718,
+        -0.82797266999173813, -0.83018113952844197, -0.83258792366964962, -0.83517185258695137,
+        -0.83790982490494903, -0.84077700770622399, -0.84374705508970194, -0.84679234341555387,
+        -0.84988422119460627, -0.8529932714222811, -0.85608958401807767, -0.85914303591298224,
+        -0.86212357623018343, -0.86500151393028923, -0.86774780524165629, -0.87033433817029426,
+        -0.87273421138243534, -0.87492200477662507, -0.87687403911103934, -0.87856862212553244,
+        -0.87998627869615176, -0.88110996268193942, -0.88192524826884733, -0.8824204987823886,
+        -0.88258701112800919, -0.88241913422444485, -0.88191436001896906, -0.88107338591243511,
+        -0.87990014767443003, -0.8784018221924329, -0.87658879967140135, -0.87447462517916541,
+        -0.87207590971605198, -0.86941221127162838, -0.8665058866148051, -0.86338191484322635,
+        -0.86006769399116334, -0.85659281225967832, -0.85298879568590291, -0.84928883430762248,
+        -0.84552748910259612, -0.84174038218693159, -0.83796387294138452, -0.83423472289673561,
+        -0.83058975234768473, -0.82706549177754085, -0.82369783126200558, -0.82052167107850382,
+        -0.81757057677704859, -0.81487644196880127, -0.81246916205916397, -0.810376322093176,
+        -0.80862290179256568, -0.80723100074631493, -0.80621958657092985, -0.80560426868364254,
+        -0.80539710013282739, -0.80560640970643971, -0.80623666629301671, -0.8072883772027043,
+        -0.80875802186993839, -0.81063802205731605, -0.81291674936414826, -0.81557857051607263,
+        -0.8186039305764784, -0.82196947387944652, -0.82564820214027645, -0.8296096688564889,
+        -0.83382020877260199, -0.83824320084884907, -0.84283936285059069, -0.84756707536418496,
+        -0.8523827327496426, -0.85724111826309712, -0.86209580032577326, -0.86689954668308389,
+        -0.87160475299019535, -0.87616388218086627, -0.88052991082654608, -0.88465677857427805,
+        -0.88849983666619259, -0.89201629149162909, -0.89516563910576763, -0.89791008666688044,
+        -0.90021495679803498, -0.90204907096830567, -0.90338510811287509, -0.90419993487022488,
+        -0.90447490400690811, -0.90419611782488074, -0.90335465360158329, -0.90194674839689326,
+        -0.89997394087183136, -0.89744316809893232, -0.8943668157010447, -0.89076272003113033,
+        -0.8866541214974476, -0.88206956854308949, -0.87704277220304916, -0.87161241158225189,
+        -0.86582189102088414, -0.8597190501353893, -0.85335582834093671, -0.84678788587063814,
+        -0.84007418370457165, -0.83327652520438722, -0.8264590626135454, -0.81968777192575815,
+        -0.81302989994188113, -0.80655338762547779, -0.80032627412673785, -0.79441608607091552,
+        -0.78888921689881342, -0.78381030120092199, -0.77924158910221053, -0.77524232582966479,
+        -0.77186814162859196, -0.76917045718570087, -0.76719590966667406, -0.76598580438333597,
+        -0.76557559697097111, -0.76599441078052444, -0.76726459397431435, -0.76940132055900023,
+        -0.77241223929741232, -0.77629717411366428, -0.78104787924595909, -0.78664785201129661,
+        -0.79307220562883629, -0.80028760410706279, -0.80825226073745515, -0.81691600125775055,
+        -0.82622039225470245, -0.83609893487338949, -0.84647732339163761, -0.85727376770786057,
+        -0.86839937828291769, -0.87975861157527424, -0.89124977351808465, -0.90276557811069269,
+        -0.91419375773944722, -0.92541772140736545, -0.93631725664279619, -0.94676927047716175,
+        -0.95664856453440761, -0.96582863896294491, -0.97418251966726577, -0.98158360306363024,
+        -0.98790651239420757, -0.99302795948871903, -0.99682760576331886, -0.99918891619432171,
+        -0.99999999999999989, -0.99915443180755559, -0.99655204717424117, -0.9920997064711633,
+        -0.98571202132468616, -0.97731203804227618, -0.96683187272565951, -0.95421329309221903,
+        -0.93940824238348575, -0.92237930113465361, -0.9031000830085304, -0.88155556135779112,
+        -0.85774232366766667, -0.8316687515433403, -0.80335512443859891, -0.77283364587062575,
+        -0.74014839142594735, -0.7053551784302684, -0.66852135772580279, -0.62972552856933084,
+        -0.58905717822819059, -0.54661624840538925, -0.50251263116459266, -0.45686559754687001,
+        -0.4098031625695232, -0.36146139076929196, -0.31198364689405045, -0.26151979675518211,
+        -0.21022536362416627, -0.15826064588838359, -0.10578980197034189, -0.052979908759015808,
+        0,
+    },
+    /* triangle */
+    {
+        0, 0.00097302768703125123, 0.0019461493708030221, 0.0029194581434755112,
+        0.0038930452967450343, 0.0048669994432704554, 0.0058414056638566017, 0.0068163446885942044,
+        0.0077918921198298413, 0.0087681177044374777, 0.0097450846623897396, 0.010722849078086155,
+        0.011701459360292956, 0.012680955775889655, 0.013661370061908904, 0.014642725119603857,
+        0.015625034793489163, 0.016608303737485248, 0.017592527369459252, 0.018577691914605444,
+        0.019563774537255475, 0.020550743559858198, 0.021538558767031292, 0.022527171791769194,
+        0.023516526580101949, 0.024506559929745528, 0.025497202097572443, 0.026488377470069633,
+        0.027480005290344625, 0.028472000434696991, 0.029464274231294548, 0.030456735313088561,
+        0.031449290496771753, 0.032441845679332136, 0.033434306743584705, 0.034426580463975752,
+        0.035418575403951054, 0.036410202796258131, 0.037401377397716123, 0.038392018310230328,
+        0.039382049760151742, 0.040371401828480431, 0.0413600111248838, 0.042347821399037262,
+        0.043334784083399004, 0.04432085876218507, 0.045306013562021963, 0.04629022546050416,
+        0.047273480509672158, 0.048255773972244821, 0.049237110369276568, 0.050217503438761184,
+        0.051196976005560668, 0.052175559763888359, 0.053153294974417259, 0.054130230078905481,
+        0.05510642123602337, 0.05608193178282634, 0.057056831627031485, 0.058031196575923726,
+        0.059005107608328118, 0.059978650096631607, 0.060951912986322181, 0.061924987940922424,
+        0.062897968460528586, 0.063870948982424042, 0.064844023972409487, 0.06581728701558387,
+        0.066790829915319636, 0.067764741809096793, 0.068739108309705116, 0.069714010680077945,
+        0.070689525049704563, 0.071665721680168618, 0.072642664286891354, 0.07362040942362065,
+        0.074599005935605561, 0.075578494486738299, 0.076558907165236625, 0.077540267171686411,
+        0.07852258859247313, 0.079505876260813069, 0.080490125706752458, 0.081475323196648575,
+        0.082461445861787608, 0.083448461914937072, 0.084436330952783606, 0.085425004341383434,
+        0.086414425680950757, 0.087404531345548014, 0.088395251092518015, 0.089386508735827624,
+        0.090378222876874054, 0.091370307685751315, 0.092362673725485692, 0.093355228811332472,
+        0.094347878896887671, 0.095340528978504591, 0.096333084009326733, 0.097325449814152323,
+        0.09831753399633418, 0.099309246827988737, 0.10030050211494738, 0.10129121802812122,
+        0.10228131789326732, 0.1032707309315429, 0.10425939294370284, 0.10524724693133158,
+        0.10623424364910729, 0.10722034208274962, 0.10820550984802124, 0.10918972350690258,
+        0.11017296879785904, 0.11115524077794121, 0.11213654387530426, 0.11311689185159612,
+        0.11409630767452567, 0.11507482330179024, 0.11605247937838958, 0.11702932485019227,
+        0.11800541649742206, 0.11898081839250606, 0.11995560128745685, 0.12092984193663833,
+        0.12190362236139105, 0.12287702906355633, 0.12385015219543022, 0.12482308469410618,
+        0.12579592138850812, 0.12676875808768562, 0.12774169065912752, 0.1287148141059502,
+        0.12968822165183516, 0.13066200384252036, 0.13163624767249493, 0.13261103574531335,
+        0.13358644547562248, 0.13456254834060472, 0.13553940918806523, 0.13651708560785439,
+        0.13749562737271318, 0.13847507595396061, 0.13945546411673337, 0.14043681559872292,
+        0.14141914487555238, 0.14240245701511278, 0.14338674762231524, 0.14437200287485655,
+        0.145358199649714, 0.14634530573921778, 0.14733328015468555, 0.14832207351475982,
+        0.1493116285147755, 0.15030188047270049, 0.15129275794645497, 0.15228418341672334,
+        0.15327607402874255, 0.15426834238597309, 0.1552608973880622, 0.15625364510507012,
+        0.15724648967958182, 0.15823933424804904, 0.15923208187251586, 0.16022463647377649,
+        0.1612169037569921, 0.1622087921208589, 0.16320021354157122, 0.16419108442305869,
+        0.16518132640529504, 0.16617086712287016, 0.16715964090649169, 0.16814758942062322,
+        0.16913466223107501, 0.17012081729703252, 0.1711060213827279, 0.17209025038472905,
+        0.17307348957162935, 0.1740557337337596, 0.17503698724140582, 0.17601726401089704,
+        0.17699658737880963, 0.17797498988542018, 0.17895251296941153, 0.17992920657668934,
+        0.18090512868699984, 0.18188034476282555, 0.1828549271257936, 0.18382895426652821,
+        0.18480251009452547, 0.18577568313521042, 0.18674856568185266, 0.18772125291045316,
+        0.18869384196608313, 0.18966643102943395, 0.19063911837253983, 0.19161200141274007,
+        0.19258517577398315, 0.19355873436450252, 0.1945327664797524, 0.19550735693925464,
+        0.19648258526568854, 0.19745852491416202, 0.19843524255912187, 0.19941279744581886,
+        0.20039124081262674, 0.20137061538984108, 0.20235095497985248, 0.2033322841228139,
+        0.20431461785109986, 0.20529796153501029, 0.20628231082129411, 0.20726765166517575,
+        0.20825396045567368, 0.20924120423309997, 0.21022934099674348, 0.21121832009986949,
+        0.21220808272833203, 0.2131985624582742, 0.214189685887645, 0.21518137333553075,
+        0.21617353960264765, 0.21716609478574886, 0.21815894513816908, 0.21915199396827856,
+        0.22014514256725087, 0.22113829115724778, 0.22213133985092914, 0.2231241896130674,
+        0.22411674321502587, 0.22510890617290791, 0.2261005876603393, 0.2270917013870761,
+        0.2280821664349495, 0.22907190804305788, 0.2300608583346018, 0.23104895697829958,
+        0.23203615177795084, 0.23302239918439474, 0.23400766472484957, 0.23499192334540786,
+        0.23597515966329285, 0.2369573681263463, 0.23793855307810005, 0.2389187287277004,
+        0.23989791902485583, 0.24087615744090332, 0.24185348665798082, 0.24282995816919137,
+        0.24380563179349027, 0.24478057510986417, 0.2457548628161397, 0.24672857601850193,
+        0.24770180145846568, 0.24867463068466128, 0.24964715917733032, 0.25061948543389179,
+        0.25159171002432745, 0.25256393462543203, 0.25353626104318883, 0.25450879023266132,
+        0.25548162132482244, 0.25645485066968787, 0.25742857090498289, 0.25840287005932683,
+        0.25937783069861053, 0.26035352912382881, 0.26133003462815241, 0.26230740882046344,
+        0.26328570502194454, 0.2642649677416255, 0.26524523223603358, 0.26622652415729675,
+        0.26720885929320209, 0.26819224340183168, 0.26917667214249796, 0.27016213110376774,
+        0.2711485959284437, 0.27213603253442842, 0.27312439742948141, 0.27411363811697093,
+        0.27510369358884346, 0.27609449490119004, 0.27708596582699013, 0.2780780235798635,
+        0.27907057960196657, 0.28006354040854969, 0.28105680848112735, 0.28205028320074799,
+        0.2830438618124349, 0.28403744041157569, 0.28503091494280047, 0.2860241822017589,
+        0.28701714083016888, 0.28800969229455431, 0.28900174183923344, 0.28999319940435792,
+        0.29098398050011781, 0.29197400702864151, 0.2929632080456061, 0.29395152045414591,
+        0.29493888962427994, 0.29592526993179213, 0.29691062521125733, 0.29789492911872756,
+        0.2988781654004492, 0.29986032806488994, 0.30084142145626286, 0.30182146022869888,
+        0.30280046922115522, 0.30377848323411194, 0.30475554671005128, 0.30573171332064181,
+        0.30670704546445238, 0.30768161367988422, 0.30865549597883474, 0.30962877710737802,
+        0.31060154774045212, 0.31157390361819515, 0.3125459446321458, 0.31351777387001151,
+        0.31448949662812925, 0.31546121940106153, 0.31643304885800955, 0.3174050908158676,
+        0.31837744921878808, 0.31935022513408468, 0.3203235157741583, 0.32129741355389185,
+        0.32227200519264498, 0.32324737086955641, 0.32422358344036717, 0.32520070772340437,
+        0.32617879986170539, 0.32715790676755113, 0.32813806565488607, 0.32911930366427844,
+        0.33010163758418032, 0.33108507367133766, 0.33206960757224929, 0.33305522434660245,
+        0.33404189859264011, 0.33502959467342863, 0.33601826704203092, 0.33700786066262689,
+        0.33799831152370235, 0.33898954723853431, 0.33998148772734982, 0.34097404597474751,
+        0.34196712885522368, 0.34296063801899607, 0.34395447082970393, 0.34494852134506759,
+        0.34594268133114764, 0.34693684130051317, 0.34793089156437756, 0.34892472328860541,
+        0.34991822954344687, 0.35091130633688267, 0.3519038536216218, 0.35289577626600704,
+        0.353886984979431, 0.35487739718327227, 0.35586693781887629, 0.35685554008468584,
+        0.35784314609530432, 0.35882970745600096, 0.35981518574696897, 0.36079955291251453,
+        0.36178279155124193, 0.36276489510426013, 0.36374586793939939, 0.36472572533043174,
+        0.36570449333128374, 0.36668220854625316, 0.36765891779823195, 0.36863467769792879,
+        0.36960955411803759, 0.37058362157721969, 0.37155696253965237, 0.37252966663670295,
+        0.3735018298180659, 0.37447355344038291, 0.37544494330198597, 0.37641610863293712,
+        0.37738716104999176, 0.3783582134864597, 0.37932937910720993, 0.38030077021922137,
+        0.38127249718814754, 0.38224466737133034, 0.38321738407755895, 0.38419074556362814,
+        0.38516484407743196, 0.38613976495688562, 0.3871155857934635, 0.38809237566853066,
+        0.38907019446996721, 0.39004909229582574, 0.39102910895094756, 0.39201027354156698,
+        0.39299260417202109, 0.39397610774669439, 0.39496077987933326, 0.3959466049108285,
+        0.39693355603553704, 0.39792159553515521, 0.39891067511813411, 0.39990073636160045,
+        0.40089171125175854, 0.40188352281779088, 0.4028760858533692, 0.40386930771902835,
+        0.40486308921786729, 0.40585732553631826, 0.40685190724107939, 0.40784672132275429,
+        0.40884165227625896, 0.40983658320769445, 0.41083139695709675, 0.41182597722630543,
+        0.41282020970110866, 0.41381398315686962, 0.41480719053695364, 0.4157997299935291,
+        0.41679150588064118, 0.4177824296899002, 0.41877242091965222, 0.4197614078691162,
+        0.42074932834967765, 0.42173613030630208, 0.42272177234288388, 0.42370622414624531,
+        0.42468946680447761, 0.42567149301630347, 0.42665230718919234, 0.42763192542501965,
+        0.42861037539313457, 0.42958769609179492, 0.43056393749998112, 0.43153916012268734,
+        0.43251343443379209, 0.43348684022162504, 0.43445946584328349, 0.43543140739464353,
+        0.43640276780384474, 0.43737365585677812, 0.43834418516377288, 0.43931447307728638,
+        0.44028463957087266, 0.44125480609011863, 0.4422250943865263, 0.44319562534551638,
+        0.44416651781980132, 0.44513788747937033, 0.44610984568917883, 0.44708249842541031,
+        0.44805594524083264, 0.44903027828931857, 0.4500055814190651, 0.45098192934341552,
+        0.45195938689744519, 0.45293800838769477, 0.45391783704153821, 0.45489890456174359,
+        0.45588123079078752, 0.4568648234884306, 0.45784967822500283, 0.45883577839172046,
+        0.45982309532825216, 0.46081158856661036, 0.46180120618934367, 0.46279188529888249,
+        0.46378355259382442, 0.46477612504690907, 0.4657695106784317, 0.46676360941791989,
+        0.4677583140460253, 0.46875351120779374, 0.46974908248776237, 0.47074490553671428,
+        0.47174085523940407, 0.47273680491212716, 0.47373262751871215, 0.47472819689328488,
+        0.47572338895807115, 0.4767180829245074, 0.47771216246607412, 0.47870551685147905,
+        0.4796980420271999, 0.48068964163881839, 0.48168022798116122, 0.48266972286790716,
+        0.48365805841206611, 0.48464517770957299, 0.48563103541914637, 0.48661559823253403,
+        0.48759884523031227, 0.4885807681194812, 0.48956137135023431, 0.49054067211042068,
+        0.49151870019740246, 0.49249549776817642, 0.49347111896980278, 0.49444562945335035,
+        0.49541910577567488, 0.49639163469445863, 0.49736331236297077, 0.49833424343198801,
+        0.49930454006723407, 0.50027432089153745, 0.5012437098616378, 0.50221283509026171,
+        0.50318182762460895, 0.50415082019287571, 0.50511994593076193, 0.50608933710014559,
+        0.50705912381222518, 0.50802943276741264, 0.50900038602415221, 0.50997209980858504,
+        0.51094468337663645, 0.51191823793962377, 0.51289285566392173, 0.51386861875452605,
+        0.51484559863159407, 0.51582385520817309, 0.51680343627638237, 0.51778437700828894,
+        0.51876669957664501, 0.51975041289951718, 0.52073551251165329, 0.52172198056424213,
+        0.52270978595346396, 0.52369888457703651, 0.52468921971667959, 0.52568072254325027,
+        0.52667331274008333, 0.52766689923893317, 0.5286613810618106, 0.52965664826097525,
+        0.53065258294835849, 0.53164906040483595, 0.53264595025893147, 0.53364311772386608,
+        0.53464042488124719, 0.53563773199921938, 0.53663489887251581, 0.53763178617160656,
+        0.53862825678800119, 0.53962417716276279, 0.54061941858540519, 0.54161385845057997,
+        0.54260738146034304, 0.54359988076023258, 0.5445912589980374, 0.54558142929478559,
+        0.54657031611833073, 0.54755785605079565, 0.5485439984421201, 0.54952870594304037,
+        0.55051195491194649, 0.55149373569126947, 0.55247405275026873, 0.55345292469239016,
+        0.55443038412662604, 0.55540647740363935, 0.55638126421870016, 0.55735481708477319,
+        0.55832722068035512, 0.55929857107787506, 0.56026897485964533, 0.56123854812944718,
+        0.56220741542887609, 0.56317570856850874, 0.56414356538481714, 0.56511112843450528,
+        0.56607854363857857, 0.567045958889007, 0.56801352263121929, 0.56898138243596941,
+        0.56994968357426501, 0.57091856760905546, 0.57188817101728917, 0.57285862385568698,
+        0.57383004848322994, 0.57480255835284799, 0.57577625688418743, 0.57675123642860049,
+        0.57772757733665914, 0.57870534713754351, 0.57968459983863063, 0.5806653753524702,
+        0.58164769905715763, 0.5826315814948414, 0.58361701821180645, 0.58460398974222127,
+        0.58559246173627133, 0.58658238523202055, 0.58757369706894358, 0.58856632043973878,
+        0.58956016557564472, 0.59055513055923148, 0.59155110225734542, 0.59254795736574639,
+        0.59354556355582844, 0.59454378071283709, 0.59554246225404406, 0.59654145651454327,
+        0.597540608187628, 0.59853975980613494, 0.59953875325068406, 0.60053743127044013,
+        0.60153563900183527, 0.60253322547064248, 0.60353004506291485, 0.60452595895051153,
+        0.6055208364573379, 0.60651455635291363, 0.6075070080605407, 0.60849809276810018,
+        0.60948772443039434, 0.61047583065294042, 0.61146235344822097, 0.6124472498565795,
+        0.61343049242521308, 0.61441206954004857, 0.61539198560668162, 0.61637026107797832,
+        0.61734693232741433, 0.61832205136869012, 0.61929568542363911, 0.62026791634192602,
+        0.62123883987743334, 0.62220856482767839, 0.62317721204389775, 0.6241449133207474,
+        0.62511181017573469, 0.62607805252961879, 0.6270437973000057, 0.62800920692125617,
+        0.62897444780458889, 0.62993968875289708, 0.63090509934529693, 0.63187084830679041,
+        0.63283710187862119, 0.6338040222049931, 0.6347717657517058, 0.63574048177205844,
+        0.63671031083495921, 0.63768138342967862, 0.63865381866099769, 0.63962772304770776,
+        0.64060318943649019, 0.64158029604214972, 0.64255910562401242, 0.64353966480705449,
+        0.64452200355496869, 0.64550613480094754, 0.64649205424050138, 0.64747974028907318,
+        0.6484691542056531, 0.64946024038202144, 0.65045292679563793, 0.65144712562263984,
+        0.65244273400584141, 0.65343963497112645, 0.65443769848416988, 0.65543678263803662,
+        0.65643673496090738, 0.65743739383197708, 0.65843858999247207, 0.65944014813776164,
+        0.66044188857568498, 0.66144362893551034, 0.66244518591138046, 0.66344637702368003,
+        0.6644470223815101, 0.66544694642936031, 0.66644597966112773, 0.6674439602848623,
+        0.66844073582200525, 0.66943616462543121, 0.67043011730129587, 0.67142247802054322,
+        0.67241314570690158, 0.67340203508931595, 0.67438907760800448, 0.67537422216465071,
+        0.67635743570872198, 0.67733870365339321, 0.67831803011617842, 0.67929543798101633,
+        0.68027096878024385, 0.68124468239661939, 0.68221665658726849, 0.683186986333149,
+        0.68415578301932922, 0.68512317345299156, 0.68608929872771018, 0.68705431294403585,
+        0.68801838179785557, 0.68898168104935209, 0.68994439488655923, 0.69090671419863614,
+        0.69186883477490657, 0.69283095544652107, 0.69379327618824138, 0.69475599619832962,
+        0.69571931197482995, 0.696683415406679, 0.69764849189803657, 0.6986147185440188,
+        0.69958226237563081, 0.70055127869112976, 0.70152190949033788, 0.70249428202751107,
+        0.70346850749735557, 0.70444467986756787, 0.70542287486997213, 0.70640314916087499,
+        0.70738553965969875, 0.70837006307330763, 0.70935671561171021, 0.71034547289901928,
+        0.71133629008171584, 0.71232910213437672, 0.71332382436114916, 0.71432035308937003,
+        0.71531856654986381, 0.71631832593663658, 0.71731947663693341, 0.71832184962091994,
+        0.71932526297868327, 0.72032952359073743, 0.7213344289168715, 0.72233976888694817,
+        0.72334532787618255, 0.72435088674650738, 0.72535622493489416, 0.72636112256891994,
+        0.72736536258948048, 0.72836873286036818, 0.72937102824440603, 0.73037205262603833,
+        0.73137162086064045, 0.73236956063140091, 0.73336571419536445, 0.73435994000118143,
+        0.73535211416221347, 0.73634213176990437, 0.73732990803377962, 0.73831537923596646,
+        0.73929850348985049, 0.74027926129425825, 0.74125765587646719, 0.74223371331930332,
+        0.74320748246962454, 0.7441790346275472, 0.74514846301787274, 0.74611588204724411,
+        0.74708142635265518, 0.74804524964893693, 0.74900752338483978, 0.74996843521921852,
+        0.75092818733061006, 0.75188699457520414, 0.75284508250973536, 0.75380268529724037,
+        0.75476004351487791, 0.75571740188406711, 0.75667500694409573, 0.75763310469104073,
+        0.7585919382043339, 0.75955174528358016, 0.76051275611831637, 0.76147519101324179,
+        0.7624392581910916, 0.76340515169475465, 0.76437304940944517, 0.76534311122475829,
+        0.76631547735524375, 0.76729026683678137, 0.76826757621447805, 0.76924747843611907,
+        0.77023002196334045, 0.77121523011072979, 0.77220310062094621, 0.77319360548179072,
+        0.77418669098887838, 0.77518227805527762, 0.7761802627671196, 0.77718051718184333,
+        0.77818289036341448, 0.7791872096465331, 0.7801932821196278, 0.78120089631425205,
+        0.78220982408644402, 0.78321982267367019, 0.78423063690915773, 0.78524200157379087,
+        0.78625364386426189, 0.78726528595489531, 0.78827664762948069, 0.78928744895858571,
+        0.79029741299719092, 0.79130626847707208, 0.79231375246819857, 0.79331961298348586,
+        0.79432361150155795, 0.79532552538275081, 0.79632515015435934, 0.79732230164219842,
+        0.79831681792678133, 0.79930856110389903, 0.80029741883107985, 0.80128330564325101,
+        0.80226616402297757, 0.80324596521285863, 0.80422270975998555, 0.80519642778480494,
+        0.80616717896931045, 0.80713505226205107, 0.80810016530015083, 0.80906266355118273,
+        0.81002271918044644, 0.8109805296518322, 0.81193631607306049, 0.81289032129861738,
+        0.81384280780610418, 0.8147940553640336, 0.81574435851123606, 0.81669402387001977,
+        0.81764336731702503, 0.81859271103725406, 0.81954238048816264, 0.82049270130176655,
+        0.82144399615359021, 0.82239658162790763, 0.82335076510899508, 0.82430684172824087,
+        0.82526509139664694, 0.82622577595182267, 0.82718913644773506, 0.82815539061443422,
+        0.82912473051366187, 0.83009732041464634, 0.8310732949125742, 0.8320527573101858,
+        0.83303577828064224, 0.83402239482739238, 0.83501260955411116, 0.83600639025499812,
+        0.83700366983283692, 0.83800434654919753, 0.83900828460808552, 0.84001531507122573,
+        0.84102523710002408, 0.84203781951613577, 0.84305280266946914, 0.84406990059945275,
+        0.84508880347248561, 0.84610918027569249, 0.84713068174448447, 0.84815294349897297,
+        0.84917558936205251, 0.8501982348299264, 0.85122049066411154, 0.852241966572447,
+        0.85326227494541584, 0.85428103461318072, 0.85529787458812623, 0.85631243775742782,
+        0.8573243844901951, 0.85833339612411785, 0.85933917829724227, 0.860341464091536,
+        0.86134001695623663, 0.86233463338065053, 0.86332514528802584, 0.86431142212436096,
+        0.86529337261853667, 0.86627094619291045, 0.86724413400649991, 0.86821296961608874,
+        0.86917752924392178, 0.87013793164418918, 0.87109433756411592, 0.87204694879917366,
+        0.87299600684570788, 0.87394179115802395, 0.87488461702076159, 0.87582483305107472,
+        0.8767628183487679, 0.87769897931603524, 0.87863374617180423, 0.87956756918885415,
+        0.88050091468481362, 0.88143426080087517, 0.88236809310446318, 0.88330290005425793,
+        0.88423916836777161, 0.88517737833315624, 0.88611799910804101, 0.8870614840489236,
+        0.88800826611501815, 0.88895875339041908, 0.88991332476800322, 0.89087232583767673,
+        0.89183606502033075, 0.89280480998727907, 0.89377878440292446, 0.8947581650260662,
+        0.89574307920252161, 0.89673360277870517, 0.89772975846244218, 0.89873151465365519,
+        0.89973878476365887, 0.90075142703770317, 0.90176924489105392, 0.90279198776446934,
+        0.90381935250032552, 0.90485098523598517, 0.90588648380629333, 0.90692540064239591,
+        0.9079672461493834, 0.90901149254072011, 0.91005757810292187, 0.91110491185970155,
+        0.91215287860065786, 0.91320084423578496, 0.91424816143347776, 0.91529417549647363,
+        0.91633823042725127, 0.91737967513185004, 0.91841786970898964, 0.9194521917695968,
+        0.92048204273062528, 0.92150685402621979, 0.92252609317897927, 0.92353926967419142,
+        0.92454594058057071, 0.9255457158621806, 0.92653826332780675, 0.92752331316617387,
+        0.92850066201795645, 0.92947017653854591, 0.93043179640900775, 0.93138553675650948,
+        0.93233148994973358, 0.93326982673943948, 0.934200796719177, 0.93512472808642733,
+        0.93604202668982661, 0.93695317435381842, 0.93785872647783886, 0.93875930891306369,
+        0.93965561412571996, 0.94054839666194179, 0.94143846793510866, 0.94232669036246319,
+        0.94321397088355274, 0.94410125389860022, 0.94498951367022654, 0.9458797462370071,
+        0.9467729608921015, 0.947670171284554, 0.94857238620485362, 0.94948060011990654,
+        0.95039578352561871, 0.95131887318790043, 0.95225076234495321, 0.95319229094519053,
+        0.95414423599612352, 0.95510730209989181, 0.95608211225090112, 0.95706919897024034,
+        0.95806899585013172, 0.95908182957970278, 0.96010791252079952, 0.96114733589945034,
+        0.96220006367492017, 0.96326592714413439, 0.96434462033457025, 0.96543569623358716,
+        0.96653856389664128, 0.96765248647087743, 0.96877658016432788, 0.9699098141844118,
+        0.97105101166257646, 0.97219885157496244, 0.9733518716618067, 0.97450847234107629,
+        0.9756669216045597, 0.97682536087740013, 0.97798181181489519, 0.97913418400335783,
+        0.98028028352499863, 0.98141782234018016, 0.98254442843411072, 0.98365765666906968,
+        0.98475500027770202, 0.98583390292778494, 0.98689177128422045, 0.98792598798986675,
+        0.9889339249832485, 0.98991295706816873, 0.99086047564783986, 0.99177390253441167,
+        0.99265070374358622, 0.99348840318359521, 0.99428459614794451, 0.99503696252222351,
+        0.99574327961672471, 0.99640143453882812, 0.99700943602183378, 0.99756542563036887,
+        0.99806768826645231, 0.9985146619048717, 0.99890494649160466, 0.9992373119445932,
+        0.99951070520219165, 0.99972425627107742, 0.99987728323216107, 0.9999692961701816,
+        1, 0.9999692961701816, 0.99987728323216107, 0.99972425627107742,
+        0.99951070520219165, 0.9992373119445932, 0.99890494649160466, 0.9985146619048717,
+        0.99806768826645231, 0.99756542563036887, 0.99700943602183378, 0.99640143453882835,
+        0.99574327961672471, 0.99503696252222351, 0.99428459614794451, 0.99348840318359521,
+        0.99265070374358622, 0.99177390253441167, 0.99086047564783986, 0.98991295706816873,
+        0.9889339249832485, 0.98792598798986675, 0.98689177128422045, 0.98583390292778494,
+        0.98475500027770202, 0.98365765666906968, 0.98254442843411072, 0.98141782234018016,
+        0.98028028352499863, 0.97913418400335783, 0.97798181181489519, 0.97682536087740013,
+        0.9756669216045597, 0.97450847234107629, 0.9733518716618067, 0.97219885157496244,
+        0.97105101166257646, 0.9699098141844118, 0.96877658016432788, 0.96765248647087754,
+        0.96653856389664128, 0.96543569623358716, 0.96434462033457025, 0.96326592714413461,
+        0.96220006367492017, 0.96114733589945034, 0.96010791252079952, 0.95908182957970278,
+        0.95806899585013172, 0.95706919897024034, 0.95608211225090112, 0.95510730209989181,
+        0.95414423599612352, 0.95319229094519053, 0.95225076234495321, 0.95131887318790043,
+        0.95039578352561871, 0.94948060011990654, 0.94857238620485362, 0.947670171284554,
+        0.9467729608921015, 0.9458797462370071, 0.94498951367022654, 0.94410125389860022,
+        0.94321397088355308, 0.94232669036246319, 0.94143846793510866, 0.94054839666194179,
+        0.93965561412571996, 0.93875930891306369, 0.93785872647783886, 0.93695317435381864,
+        0.93604202668982661, 0.93512472808642744, 0.93420079671917722, 0.93326982673943948,
+        0.93233148994973358, 0.93138553675650948, 0.93043179640900775, 0.92947017653854613,
+        0.92850066201795645, 0.92752331316617387, 0.92653826332780675, 0.92554571586218082,
+        0.92454594058057071, 0.92353926967419142, 0.92252609317897927, 0.92150685402621979,
+        0.92048204273062528, 0.91945219176959692, 0.91841786970898986, 0.91737967513185004,
+        0.9163382304272516, 0.91529417549647363, 0.91424816143347798, 0.91320084423578507,
+        0.91215287860065786, 0.91110491185970155, 0.91005757810292187, 0.90901149254072011,
+        0.9079672461493834, 0.90692540064239591, 0.90588648380629333, 0.90485098523598506,
+        0.90381935250032552, 0.90279198776446934, 0.90176924489105392, 0.90075142703770317,
+        0.89973878476365898, 0.89873151465365519, 0.89772975846244218, 0.8967336027787054,
+        0.89574307920252161, 0.8947581650260662, 0.89377878440292446, 0.89280480998727907,
+        0.89183606502033075, 0.89087232583767673, 0.88991332476800344, 0.88895875339041908,
+        0.88800826611501815, 0.88706148404892382, 0.88611799910804101, 0.88517737833315624,
+        0.88423916836777161, 0.88330290005425793, 0.88236809310446318, 0.88143426080087539,
+        0.88050091468481362, 0.87956756918885415, 0.87863374617180445, 0.87769897931603524,
+        0.8767628183487679, 0.87582483305107472, 0.87488461702076159, 0.87394179115802417,
+        0.87299600684570811, 0.87204694879917366, 0.87109433756411592, 0.8701379316441894,
+        0.86917752924392178, 0.86821296961608874, 0.86724413400650002, 0.86627094619291045,
+        0.86529337261853667, 0.86431142212436118, 0.86332514528802584, 0.86233463338065053,
+        0.86134001695623663, 0.86034146409153611, 0.85933917829724227, 0.85833339612411785,
+        0.85732438449019532, 0.85631243775742805, 0.85529787458812645, 0.85428103461318072,
+        0.85326227494541595, 0.852241966572447, 0.85122049066411154, 0.8501982348299264,
+        0.84917558936205251, 0.84815294349897297, 0.84713068174448447, 0.84610918027569249,
+        0.84508880347248583, 0.84406990059945275, 0.84305280266946914, 0.84203781951613588,
+        0.84102523710002419, 0.84001531507122573, 0.83900828460808563, 0.83800434654919764,
+        0.83700366983283692, 0.83600639025499834, 0.83501260955411138, 0.8340223948273926,
+        0.83303577828064224, 0.8320527573101858, 0.83107329491257431, 0.83009732041464646,
+        0.82912473051366187, 0.82815539061443422, 0.82718913644773495, 0.82622577595182289,
+        0.82526509139664705, 0.82430684172824087, 0.82335076510899508, 0.82239658162790763,
+        0.82144399615359021, 0.82049270130176655, 0.81954238048816264, 0.81859271103725428,
+        0.81764336731702503, 0.81669402387001977, 0.81574435851123617, 0.8147940553640336,
+        0.81384280780610441, 0.81289032129861738, 0.81193631607306049, 0.8109805296518322,
+        0.81002271918044666, 0.80906266355118273, 0.80810016530015083, 0.80713505226205129,
+        0.80616717896931067, 0.80519642778480516, 0.80422270975998555, 0.80324596521285863,
+        0.80226616402297757, 0.80128330564325112, 0.80029741883107985, 0.79930856110389914,
+        0.79831681792678133, 0.79732230164219842, 0.79632515015435934, 0.79532552538275092,
+        0.79432361150155795, 0.79331961298348586, 0.79231375246819857, 0.79130626847707219,
+        0.79029741299719092, 0.78928744895858571, 0.78827664762948069, 0.78726528595489553,
+        0.78625364386426189, 0.78524200157379098, 0.78423063690915784, 0.78321982267367041,
+        0.78220982408644413, 0.78120089631425194, 0.78019328211962791, 0.7791872096465331,
+        0.77818289036341448, 0.77718051718184333, 0.7761802627671196, 0.77518227805527784,
+        0.77418669098887849, 0.77319360548179072, 0.77220310062094644, 0.77121523011073001,
+        0.77023002196334056, 0.76924747843611907, 0.76826757621447805, 0.76729026683678137,
+        0.76631547735524375, 0.76534311122475829, 0.76437304940944539, 0.76340515169475465,
+        0.7624392581910916, 0.76147519101324179, 0.76051275611831648, 0.75955174528358016,
+        0.75859193820433413, 0.75763310469104073, 0.75667500694409573, 0.75571740188406711,
+        0.75476004351487813, 0.75380268529724048, 0.75284508250973547, 0.75188699457520436,
+        0.75092818733061018, 0.74996843521921852, 0.74900752338483978, 0.74804524964893693,
+        0.74708142635265529, 0.74611588204724399, 0.74514846301787274, 0.74417903462754731,
+        0.74320748246962465, 0.74223371331930355, 0.74125765587646719, 0.74027926129425847,
+        0.73929850348985049, 0.73831537923596646, 0.73732990803377974, 0.7363421317699046,
+        0.73535211416221347, 0.73435994000118165, 0.73336571419536445, 0.73236956063140102,
+        0.73137162086064067, 0.73037205262603833, 0.72937102824440603, 0.7283687328603683,
+        0.72736536258948048, 0.72636112256891994, 0.72535622493489416, 0.72435088674650716,
+        0.72334532787618266, 0.72233976888694829, 0.7213344289168715, 0.72032952359073765,
+        0.71932526297868327, 0.71832184962091994, 0.71731947663693341, 0.7163183259366368,
+        0.71531856654986403, 0.71432035308937003, 0.71332382436114916, 0.71232910213437683,
+        0.71133629008171595, 0.71034547289901939, 0.70935671561171043, 0.70837006307330763,
+        0.70738553965969875, 0.70640314916087499, 0.70542287486997224, 0.70444467986756798,
+        0.70346850749735568, 0.70249428202751096, 0.70152190949033799, 0.70055127869112988,
+        0.69958226237563093, 0.69861471854401913, 0.69764849189803668, 0.696683415406679,
+        0.69571931197482995, 0.69475599619832962, 0.69379327618824149, 0.69283095544652107,
+        0.69186883477490668, 0.69090671419863625, 0.68994439488655923, 0.68898168104935209,
+        0.68801838179785579, 0.68705431294403596, 0.68608929872771018, 0.68512317345299145,
+        0.68415578301932922, 0.68318698633314912, 0.68221665658726849, 0.68124468239661951,
+        0.68027096878024407, 0.67929543798101633, 0.67831803011617842, 0.67733870365339344,
+        0.6763574357087222, 0.67537422216465071, 0.67438907760800471, 0.67340203508931606,
+        0.67241314570690169, 0.67142247802054356, 0.67043011730129609, 0.66943616462543121,
+        0.66844073582200536, 0.6674439602848623, 0.66644597966112795, 0.66544694642936031,
+        0.66444702238150999, 0.66344637702368003, 0.66244518591138057, 0.66144362893551056,
+        0.66044188857568498, 0.65944014813776164, 0.65843858999247218, 0.65743739383197708,
+        0.65643673496090738, 0.65543678263803695, 0.65443769848416999, 0.65343963497112634,
+        0.65244273400584152, 0.65144712562264007, 0.65045292679563815, 0.64946024038202155,
+        0.64846915420565321, 0.64747974028907329, 0.64649205424050149, 0.64550613480094765,
+        0.64452200355496891, 0.64353966480705449, 0.64255910562401242, 0.64158029604214983,
+        0.64060318943649031, 0.63962772304770776, 0.63865381866099791, 0.63768138342967862,
+        0.63671031083495933, 0.63574048177205844, 0.63477176575170591, 0.63380402220499321,
+        0.6328371018786213, 0.63187084830679041, 0.63090509934529704, 0.62993968875289708,
+        0.62897444780458911, 0.62800920692125628, 0.6270437973000057, 0.62607805252961901,
+        0.62511181017573469, 0.62414491332074751, 0.62317721204389798, 0.62220856482767839,
+        0.62123883987743334, 0.62026791634192624, 0.61929568542363911, 0.61832205136869001,
+        0.61734693232741444, 0.61637026107797821, 0.61539198560668196, 0.61441206954004868,
+        0.61343049242521308, 0.61244724985657961, 0.61146235344822097, 0.61047583065294042,
+        0.60948772443039445, 0.6084980927681003, 0.60750700806054081, 0.60651455635291374,
+        0.6055208364573379, 0.60452595895051175, 0.60353004506291497, 0.60253322547064259,
+        0.60153563900183538, 0.60053743127044024, 0.59953875325068395, 0.59853975980613516,
+        0.59754060818762811, 0.59654145651454327, 0.59554246225404417, 0.5945437807128372,
+        0.59354556355582877, 0.5925479573657465, 0.59155110225734542, 0.59055513055923159,
+        0.58956016557564495, 0.58856632043973867, 0.58757369706894369, 0.58658238523202055,
+        0.58559246173627133, 0.5846039897422215, 0.58361701821180645, 0.58263158149484162,
+        0.58164769905715763, 0.5806653753524702, 0.57968459983863074, 0.57870534713754374,
+        0.57772757733665903, 0.5767512364286006, 0.57577625688418754, 0.57480255835284788,
+        0.57383004848323005, 0.57285862385568698, 0.57188817101728939, 0.57091856760905557,
+        0.56994968357426501, 0.56898138243596985, 0.56801352263121929, 0.567045958889007,
+        0.56607854363857857, 0.56511112843450539, 0.56414356538481714, 0.56317570856850885,
+        0.56220741542887609, 0.56123854812944729, 0.56026897485964544, 0.55929857107787517,
+        0.55832722068035523, 0.55735481708477319, 0.55638126421870016, 0.55540647740363946,
+        0.55443038412662615, 0.55345292469239005, 0.55247405275026895, 0.55149373569126947,
+        0.55051195491194649, 0.54952870594304037, 0.5485439984421201, 0.54755785605079577,
+        0.54657031611833085, 0.54558142929478559, 0.54459125899803762, 0.54359988076023269,
+        0.54260738146034293, 0.54161385845058019, 0.54061941858540519, 0.5396241771627629,
+        0.53862825678800119, 0.53763178617160667, 0.53663489887251592, 0.53563773199921938,
+        0.53464042488124719, 0.5336431177238663, 0.53264595025893169, 0.53164906040483584,
+        0.5306525829483586, 0.52965664826097514, 0.52866138106181082, 0.52766689923893328,
+        0.52667331274008322, 0.52568072254325049, 0.52468921971667948, 0.52369888457703662,
+        0.52270978595346407, 0.52172198056424213, 0.52073551251165318, 0.5197504128995174,
+        0.51876669957664501, 0.51778437700828917, 0.51680343627638248, 0.51582385520817309,
+        0.51484559863159418, 0.51386861875452616, 0.51289285566392173, 0.51191823793962388,
+        0.51094468337663668, 0.50997209980858504, 0.50900038602415254, 0.50802943276741264,
+        0.50705912381222529, 0.50608933710014559, 0.50511994593076193, 0.50415082019287594,
+        0.50318182762460917, 0.50221283509026171, 0.50124370986163802, 0.50027432089153745,
+        0.49930454006723396, 0.49833424343198812, 0.49736331236297077, 0.49639163469445885,
+        0.49541910577567488, 0.49444562945335024, 0.49347111896980289, 0.49249549776817642,
+        0.49151870019740246, 0.49054067211042085, 0.48956137135023448, 0.4885807681194812,
+        0.48759884523031233, 0.48661559823253403, 0.48563103541914654, 0.48464517770957311,
+        0.48365805841206611, 0.48266972286790738, 0.48168022798116122, 0.48068964163881828,
+        0.47969804202720029, 0.47870551685147916, 0.47771216246607401, 0.47671808292450751,
+        0.47572338895807104, 0.47472819689328516, 0.47373262751871226, 0.47273680491212711,
+        0.47174085523940423, 0.47074490553671439, 0.46974908248776237, 0.46875351120779396,
+        0.46775831404602536, 0.46676360941791983, 0.46576951067843192, 0.46477612504690907,
+        0.46378355259382459, 0.4627918852988826, 0.46180120618934378, 0.46081158856661042,
+        0.45982309532825216, 0.45883577839172057, 0.45784967822500305, 0.4568648234884306,
+        0.45588123079078741, 0.45489890456174381, 0.45391783704153832, 0.45293800838769493,
+        0.4519593868974453, 0.45098192934341552, 0.45000558141906538, 0.44903027828931869,
+        0.4480559452408327, 0.44708249842541048, 0.44610984568917883, 0.44513788747937022,
+        0.44416651781980143, 0.44319562534551643, 0.44222509438652646, 0.44125480609011875,
+        0.44028463957087266, 0.43931447307728655, 0.43834418516377288, 0.43737365585677812,
+        0.43640276780384479, 0.43543140739464342, 0.43445946584328338, 0.43348684022162509,
+        0.43251343443379209, 0.43153916012268773, 0.43056393749998123, 0.42958769609179492,
+        0.42861037539313473, 0.42763192542501971, 0.42665230718919234, 0.42567149301630364,
+        0.42468946680447767, 0.42370622414624531, 0.42272177234288394, 0.42173613030630208,
+        0.42074932834967788, 0.41976140786911631, 0.41877242091965222, 0.41778242968990037,
+        0.41679150588064129, 0.4157997299935291, 0.41480719053695381, 0.41381398315686962,
+        0.41282020970110855, 0.41182597722630543, 0.41083139695709692, 0.40983658320769467,
+        0.40884165227625907, 0.40784672132275429, 0.40685190724107956, 0.40585732553631826,
+        0.40486308921786729, 0.40386930771902835, 0.40287608585336926, 0.40188352281779088,
+        0.40089171125175865, 0.39990073636160045, 0.39891067511813427, 0.39792159553515538,
+        0.39693355603553704, 0.39594660491082878, 0.39496077987933337, 0.39397610774669439,
+        0.39299260417202114, 0.39201027354156709, 0.39102910895094745, 0.39004909229582591,
+        0.38907019446996721, 0.388092375668531, 0.38711558579346367, 0.38613976495688562,
+        0.38516484407743223, 0.38419074556362809, 0.38321738407755895, 0.38224466737133045,
+        0.3812724971881476, 0.38030077021922126, 0.37932937910721015, 0.3783582134864597,
+        0.3773871610499917, 0.37641610863293734, 0.37544494330198602, 0.37447355344038313,
+        0.37350182981806601, 0.37252966663670289, 0.37155696253965254, 0.37058362157721986,
+        0.36960955411803753, 0.36863467769792896, 0.36765891779823195, 0.36668220854625311,
+        0.36570449333128385, 0.36472572533043174, 0.36374586793939967, 0.36276489510426013,
+        0.36178279155124193, 0.36079955291251464, 0.35981518574696902, 0.3588297074560009,
+        0.35784314609530449, 0.35685554008468584, 0.35586693781887629, 0.35487739718327249,
+        0.35388698497943105, 0.35289577626600721, 0.35190385362162191, 0.35091130633688267,
+        0.34991822954344698, 0.34892472328860552, 0.34793089156437751, 0.34693684130051333,
+        0.34594268133114775, 0.34494852134506759, 0.3439544708297041, 0.34296063801899607,
+        0.34196712885522396, 0.34097404597474762, 0.33998148772734982, 0.33898954723853436,
+        0.33799831152370247, 0.33700786066262678, 0.33601826704203108, 0.33502959467342869,
+        0.33404189859264, 0.33305522434660262, 0.33206960757224929, 0.33108507367133788,
+        0.33010163758418037, 0.32911930366427844, 0.32813806565488629, 0.32715790676755124,
+        0.32617879986170534, 0.32520070772340448, 0.32422358344036717, 0.32324737086955629,
+        0.32227200519264515, 0.32129741355389185, 0.32032351577415852, 0.31935022513408484,
+        0.31837744921878802, 0.31740509081586782, 0.31643304885800966, 0.31546121940106153,
+        0.31448949662812942, 0.31351777387001151, 0.31254594463214574, 0.31157390361819537,
+        0.31060154774045212, 0.30962877710737824, 0.30865549597883485, 0.30768161367988417,
+        0.3067070454644526, 0.30573171332064192, 0.30475554671005134, 0.30377848323411216,
+        0.30280046922115522, 0.30182146022869877, 0.30084142145626297, 0.29986032806488994,
+        0.29887816540044948, 0.29789492911872761, 0.29691062521125733, 0.2959252699317923,
+        0.29493888962428005, 0.2939515204541458, 0.29296320804560627, 0.29197400702864157,
+        0.29098398050011781, 0.28999319940435797, 0.28900174183923355, 0.28800969229455459,
+        0.28701714083016905, 0.2860241822017589, 0.28503091494280069, 0.2840374404115758,
+        0.2830438618124349, 0.2820502832007481, 0.28105680848112741, 0.28006354040854958,
+        0.27907057960196674, 0.2780780235798635, 0.27708596582699041, 0.27609449490119026,
+        0.27510369358884351, 0.27411363811697109, 0.27312439742948147, 0.27213603253442836,
+        0.27114859592844387, 0.27016213110376774, 0.26917667214249785, 0.26819224340183184,
+        0.26720885929320221, 0.26622652415729703, 0.26524523223603369, 0.2642649677416255,
+        0.26328570502194482, 0.26230740882046344, 0.26133003462815241, 0.26035352912382892,
+        0.25937783069861065, 0.25840287005932688, 0.25742857090498306, 0.25645485066968787,
+        0.25548162132482272, 0.25450879023266143, 0.25353626104318877, 0.25256393462543225,
+        0.25159171002432751, 0.25061948543389179, 0.24964715917733046, 0.24867463068466139,
+        0.24770180145846557, 0.24672857601850204, 0.24575486281613981, 0.24478057510986445,
+        0.24380563179349035, 0.24282995816919137, 0.24185348665798104, 0.2408761574409034,
+        0.23989791902485583, 0.23891872872770048, 0.23793855307810008, 0.23695736812634624,
+        0.23597515966329308, 0.23499192334540792, 0.2340076647248498, 0.23302239918439488,
+        0.23203615177795087, 0.23104895697829975, 0.23006085833460191, 0.22907190804305783,
+        0.22808216643494969, 0.2270917013870761, 0.22610058766033919, 0.22510890617290805,
+        0.22411674321502589, 0.22312418961306768, 0.22213133985092928, 0.22113829115724781,
+        0.2201451425672511, 0.21915199396827864, 0.21815894513816908, 0.21716609478574903,
+        0.21617353960264768, 0.21518137333553072, 0.21418968588764517, 0.21319856245827429,
+        0.21220808272833233, 0.2112183200998696, 0.21022934099674348, 0.20924120423310019,
+        0.20825396045567376, 0.20726765166517569, 0.20628231082129431, 0.20529796153501031,
+        0.20431461785109978, 0.20333228412281409, 0.2023509549798525, 0.2013706153898413,
+        0.20039124081262683, 0.19941279744581886, 0.19843524255912209, 0.1974585249141621,
+        0.19648258526568846, 0.19550735693925481, 0.19453276647975246, 0.19355873436450241,
+        0.19258517577398332, 0.1916120014127401, 0.19063911837254011, 0.18966643102943409,
+        0.1886938419660831, 0.18772125291045338, 0.18674856568185269, 0.18577568313521037,
+        0.18480251009452561, 0.18382895426652826, 0.18285492712579357, 0.18188034476282572,
+        0.18090512868699996, 0.17992920657668965, 0.17895251296941167, 0.17797498988542018,
+        0.17699658737880986, 0.17601726401089712, 0.17503698724140582, 0.17405573373375977,
+        0.17307348957162946, 0.172090250384729, 0.1711060213827281, 0.17012081729703263,
+        0.16913466223107526, 0.16814758942062333, 0.16715964090649166, 0.16617086712287038,
+        0.16518132640529515, 0.16419108442305863, 0.16320021354157138, 0.16220879212085895,
+        0.16121690375699205, 0.16022463647377666, 0.15923208187251589, 0.15823933424804928,
+        0.15724648967958196, 0.15625364510507006, 0.15526089738806242, 0.15426834238597317,
+        0.15327607402874247, 0.15228418341672353, 0.151292757946455, 0.15030188047270049,
+        0.14931162851477567, 0.14832207351475984, 0.1473332801546858, 0.14634530573921792,
+        0.14535819964971397, 0.1443720028748568, 0.14338674762231535, 0.14240245701511278,
+        0.14141914487555257, 0.14043681559872298, 0.13945546411673329, 0.13847507595396077,
+        0.13749562737271331, 0.13651708560785467, 0.13553940918806534, 0.13456254834060472,
+        0.13358644547562273, 0.13261103574531344, 0.1316362476724949, 0.13066200384252058,
+        0.12968822165183524, 0.12871481410595018, 0.12774169065912777, 0.12676875808768565,
+        0.1257959213885084, 0.1248230846941063, 0.12385015219543025, 0.12287702906355655,
+        0.12190362236139117, 0.12092984193663829, 0.11995560128745707, 0.11898081839250613,
+        0.11800541649742201, 0.1170293248501925, 0.11605247937838964, 0.1150748233017902,
+        0.11409630767452579, 0.11311689185159612, 0.11213654387530451, 0.11115524077794132,
+        0.11017296879785904, 0.10918972350690276, 0.10820550984802134, 0.1072203420827496,
+        0.10623424364910745, 0.10524724693133164, 0.10425939294370277, 0.10327073093154304,
+        0.10228131789326733, 0.10129121802812147, 0.10030050211494748, 0.099309246827988668,
+        0.098317533996334375, 0.097325449814152393, 0.096333084009326692, 0.095340528978504771,
+        0.094347878896887769, 0.093355228811332375, 0.092362673725485803, 0.091370307685751342,
+        0.09037822287687429, 0.089386508735827722, 0.088395251092517987, 0.087404531345548209,
+        0.08641442568095084, 0.085425004341383393, 0.084436330952783786, 0.083448461914937141,
+        0.082461445861787538, 0.081475323196648713, 0.080490125706752458, 0.079505876260813318,
+        0.078522588592473214, 0.07754026717168637, 0.07655890716523682, 0.075578494486738396,
+        0.074599005935605534, 0.073620409423620845, 0.072642664286891423, 0.071665721680168562,
+        0.070689525049704688, 0.069714010680077973, 0.068739108309705352, 0.067764741809096876,
+        0.066790829915319594, 0.065817287015584078, 0.064844023972409584, 0.063870948982424014,
+        0.06289796846052878, 0.06192498794092248, 0.060951912986322111, 0.059978650096631732,
+        0.059005107608328132, 0.058031196575923968, 0.057056831627031596, 0.056081931782826333,
+        0.055106421236023564, 0.054130230078905557, 0.05315329497441721, 0.052175559763888539,
+        0.051196976005560738, 0.050217503438761114, 0.049237110369276693, 0.048255773972244835,
+        0.047273480509672394, 0.046290225460504264, 0.045306013562021956, 0.044320858762185271,
+        0.043334784083399094, 0.042347821399037235, 0.041360011124884001, 0.040371401828480515,
+        0.039382049760151666, 0.038392018310230508, 0.03740137739771613, 0.036410202796258374,
+        0.035418575403951179, 0.034426580463975745, 0.033434306743584913, 0.032441845679332212,
+        0.031449290496771698, 0.030456735313088758, 0.029464274231294638, 0.028472000434696935,
+        0.027480005290344795, 0.02648837747006964, 0.025497202097572686, 0.024506559929745663,
+        0.023516526580101935, 0.022527171791769416, 0.021538558767031386, 0.02055074355985816,
+        0.019563774537255677, 0.018577691914605496, 0.017592527369459193, 0.016608303737485414,
+        0.015625034793489177, 0.014642725119604108, 0.013661370061909024, 0.012680955775889629,
+        0.011701459360293175, 0.010722849078086245, 0.0097450846623897032, 0.0087681177044376755,
+        0.0077918921198299037, 0.0068163446885941455, 0.0058414056638567699, 0.0048669994432704667,
+        0.0038930452967452771, 0.0029194581434756331, 0.0019461493708030026, 0.00097302768703147133,
+        9.1491581716933261e-17, -0.0009730276870312882, -0.00194614937080282, -0.00291945814347545,
+        -0.0038930452967450937, -0.0048669994432702828, -0.0058414056638565895, -0.0068163446885939625,
+        -0.007791892119829719, -0.0087681177044374968, -0.0097450846623895176, -0.010722849078086063,
+        -0.011701459360292992, -0.01268095577588944, -0.013661370061908842, -0.014642725119603923,
+        -0.015625034793488982, -0.016608303737485241, -0.017592527369459005, -0.018577691914605319,
+        -0.019563774537255493, -0.020550743559857969, -0.021538558767031205, -0.022527171791769222,
+        -0.02351652658010174, -0.024506559929745458, -0.025497202097572506, -0.026488377470069463,
+        -0.027480005290344615, -0.028472000434696741, -0.029464274231294448, -0.030456735313088582,
+        -0.031449290496771518, -0.032441845679332046, -0.033434306743584732, -0.034426580463975558,
+        -0.035418575403950991, -0.036410202796258201, -0.03740137739771595, -0.038392018310230321,
+        -0.039382049760151486, -0.04037140182848032, -0.041360011124883807, -0.042347821399037054,
+        -0.043334784083398914, -0.044320858762185084, -0.045306013562021762, -0.046290225460504091,
+        -0.047273480509672228, -0.048255773972244655, -0.049237110369276506, -0.050217503438760927,
+        -0.051196976005560536, -0.052175559763888366, -0.05315329497441703, -0.05413023007890537,
+        -0.055106421236023398, -0.056081931782826125, -0.057056831627031415, -0.058031196575923795,
+        -0.059005107608327959, -0.059978650096631544, -0.060951912986321945, -0.061924987940922299,
+        -0.062897968460528586, -0.063870948982423834, -0.064844023972409376, -0.065817287015583897,
+        -0.066790829915319413, -0.067764741809096696, -0.068739108309705171, -0.069714010680077765,
+        -0.070689525049704507, -0.071665721680168368, -0.072642664286891229, -0.073620409423620678,
+        -0.074599005935605353, -0.075578494486738187, -0.076558907165236639, -0.077540267171686189,
+        -0.078522588592473033, -0.079505876260813138, -0.08049012570675225, -0.081475323196648505,
+        -0.082461445861787344, -0.083448461914936961, -0.08443633095278362, -0.085425004341383198,
+        -0.086414425680950688, -0.087404531345548028, -0.088395251092517793, -0.089386508735827555,
+        -0.090378222876874095, -0.091370307685751176, -0.092362673725485622, -0.093355228811332208,
+        -0.094347878896887616, -0.095340528978504618, -0.09633308400932647, -0.097325449814152212,
+        -0.098317533996334208, -0.099309246827988501, -0.1003005021149473, -0.10129121802812131,
+        -0.10228131789326714, -0.10327073093154283, -0.10425939294370257, -0.10524724693133146,
+        -0.10623424364910729, -0.10722034208274941, -0.10820550984802116, -0.10918972350690258,
+        -0.11017296879785886, -0.11115524077794114, -0.11213654387530431, -0.11311689185159594,
+        -0.11409630767452561, -0.11507482330178999, -0.11605247937838946, -0.11702932485019232,
+        -0.11800541649742183, -0.11898081839250597, -0.11995560128745686, -0.12092984193663811,
+        -0.121903622361391, -0.12287702906355637, -0.12385015219543008, -0.12482308469410618,
+        -0.1257959213885082, -0.12676875808768548, -0.12774169065912758, -0.12871481410594998,
+        -0.12968822165183505, -0.13066200384252039, -0.13163624767249477, -0.13261103574531327,
+        -0.13358644547562254, -0.13456254834060455, -0.13553940918806517, -0.1365170856078545,
+        -0.13749562737271309, -0.13847507595396058, -0.13945546411673315, -0.14043681559872273,
+        -0.14141914487555238, -0.14240245701511259, -0.14338674762231518, -0.14437200287485658,
+        -0.14535819964971383, -0.1463453057392177, -0.14733328015468561, -0.14832207351475968,
+        -0.1493116285147755, -0.15030188047270024, -0.15129275794645483, -0.15228418341672337,
+        -0.1532760740287423, -0.15426834238597303, -0.1552608973880622, -0.15625364510506992,
+        -0.1572464896795818, -0.15823933424804909, -0.15923208187251572, -0.16022463647377652,
+        -0.16121690375699188, -0.16220879212085881, -0.16320021354157119, -0.16419108442305846,
+        -0.16518132640529498, -0.16617086712287016, -0.16715964090649152, -0.16814758942062316,
+        -0.16913466223107512, -0.17012081729703241, -0.1711060213827279, -0.17209025038472883,
+        -0.1730734895716293, -0.1740557337337596, -0.17503698724140559, -0.17601726401089696,
+        -0.17699658737880966, -0.17797498988542004, -0.1789525129694115, -0.17992920657668943,
+        -0.18090512868699973, -0.18188034476282555, -0.1828549271257934, -0.18382895426652807,
+        -0.18480251009452536, -0.18577568313521023, -0.18674856568185255, -0.18772125291045322,
+        -0.18869384196608296, -0.1896664310294339, -0.19063911837253997, -0.19161200141273993,
+        -0.19258517577398315, -0.19355873436450224, -0.19453276647975229, -0.19550735693925458,
+        -0.19648258526568832, -0.19745852491416199, -0.19843524255912193, -0.19941279744581866,
+        -0.20039124081262666, -0.20137061538984116, -0.20235095497985237, -0.20333228412281396,
+        -0.20431461785109958, -0.20529796153501015, -0.20628231082129408, -0.20726765166517552,
+        -0.20825396045567357, -0.20924120423310008, -0.21022934099674334, -0.21121832009986946,
+        -0.21220808272833205, -0.21319856245827401, -0.214189685887645, -0.2151813733355305,
+        -0.21617353960264757, -0.21716609478574886, -0.21815894513816891, -0.21915199396827853,
+        -0.22014514256725093, -0.22113829115724765, -0.22213133985092912, -0.22312418961306751,
+        -0.22411674321502573, -0.22510890617290791, -0.22610058766033903, -0.22709170138707596,
+        -0.22808216643494944, -0.22907190804305766, -0.23006085833460177, -0.23104895697829958,
+        -0.23203615177795064, -0.23302239918439474, -0.23400766472484963, -0.23499192334540772,
+        -0.23597515966329291, -0.23695736812634602, -0.23793855307809991, -0.23891872872770034,
+        -0.23989791902485566, -0.24087615744090324, -0.24185348665798084, -0.24282995816919123,
+        -0.24380563179349019, -0.24478057510986426, -0.24575486281613962, -0.2467285760185019,
+        -0.24770180145846535, -0.24867463068466117, -0.24964715917733032, -0.25061948543389162,
+        -0.2515917100243274, -0.25256393462543208, -0.2535362610431886, -0.25450879023266126,
+        -0.25548162132482255, -0.25645485066968771, -0.25742857090498283, -0.25840287005932666,
+        -0.25937783069861042, -0.26035352912382875, -0.26133003462815219, -0.26230740882046327,
+        -0.26328570502194465, -0.26426496774162533, -0.26524523223603347, -0.26622652415729692,
+        -0.26720885929320198, -0.26819224340183168, -0.26917667214249774, -0.27016213110376758,
+        -0.2711485959284437, -0.2721360325344282, -0.2731243974294813, -0.27411363811697087,
+        -0.27510369358884329, -0.27609449490119004, -0.2770859658269903, -0.27807802357986333,
+        -0.27907057960196652, -0.28006354040854942, -0.28105680848112724, -0.28205028320074799,
+        -0.28304386181243468, -0.28403744041157558, -0.28503091494280058, -0.28602418220175874,
+        -0.28701714083016888, -0.28800969229455442, -0.28900174183923333, -0.28999319940435786,
+        -0.29098398050011759, -0.29197400702864135, -0.2929632080456061, -0.29395152045414563,
+        -0.29493888962427983, -0.29592526993179213, -0.29691062521125716, -0.29789492911872739,
+        -0.29887816540044937, -0.29986032806488971, -0.30084142145626286, -0.3018214602286986,
+        -0.30280046922115506, -0.30377848323411194, -0.30475554671005106, -0.30573171332064175,
+        -0.30670704546445238, -0.307681613679884, -0.30865549597883463, -0.30962877710737807,
+        -0.31060154774045201, -0.31157390361819515, -0.31254594463214558, -0.31351777387001134,
+        -0.31448949662812931, -0.31546121940106125, -0.31643304885800949, -0.31740509081586765,
+        -0.31837744921878791, -0.31935022513408468, -0.32032351577415841, -0.32129741355389169,
+        -0.32227200519264498, -0.32324737086955613, -0.32422358344036706, -0.32520070772340431,
+        -0.32617879986170517, -0.32715790676755102, -0.32813806565488607, -0.32911930366427833,
+        -0.33010163758418021, -0.33108507367133772, -0.33206960757224913, -0.33305522434660245,
+        -0.33404189859263983, -0.33502959467342858, -0.33601826704203092, -0.33700786066262667,
+        -0.3379983115237023, -0.33898954723853425, -0.33998148772734965, -0.34097404597474745,
+        -0.34196712885522373, -0.3429606380189959, -0.34395447082970393, -0.34494852134506743,
+        -0.34594268133114758, -0.34693684130051317, -0.3479308915643774, -0.3489247232886053,
+        -0.34991822954344687, -0.3509113063368825, -0.35190385362162169, -0.35289577626600704,
+        -0.35388698497943083, -0.35487739718327227, -0.35586693781887613, -0.35685554008468567,
+        -0.35784314609530432, -0.35882970745600073, -0.35981518574696886, -0.36079955291251453,
+        -0.36178279155124182, -0.36276489510425997, -0.3637458679393995, -0.36472572533043163,
+        -0.36570449333128374, -0.366682208546253, -0.36765891779823195, -0.36863467769792879,
+        -0.36960955411803731, -0.37058362157721958, -0.37155696253965231, -0.37252966663670278,
+        -0.37350182981806584, -0.37447355344038297, -0.37544494330198586, -0.37641610863293712,
+        -0.37738716104999159, -0.37835821348645948, -0.37932937910720999, -0.3803007702192211,
+        -0.38127249718814749, -0.38224466737133023, -0.38321738407755879, -0.38419074556362803,
+        -0.38516484407743201, -0.38613976495688546, -0.3871155857934635, -0.38809237566853083,
+        -0.38907019446996716, -0.39004909229582579, -0.39102910895094734, -0.39201027354156692,
+        -0.39299260417202103, -0.39397610774669428, -0.3949607798793332, -0.39594660491082856,
+        -0.39693355603553682, -0.39792159553515521, -0.39891067511813422, -0.39990073636160028,
+        -0.40089171125175854, -0.40188352281779066, -0.40287608585336909, -0.40386930771902829,
+        -0.40486308921786712, -0.40585732553631809, -0.40685190724107939, -0.40784672132275412,
+        -0.4088416522762589, -0.40983658320769445, -0.41083139695709664, -0.41182597722630543,
+        -0.41282020970110839, -0.41381398315686946, -0.41480719053695364, -0.41579972999352899,
+        -0.41679150588064107, -0.41778242968990009, -0.418772420919652, -0.41976140786911603,
+        -0.42074932834967765, -0.42173613030630197, -0.42272177234288388, -0.42370622414624515,
+        -0.4246894668044775, -0.42567149301630347, -0.42665230718919211, -0.42763192542501954,
+        -0.42861037539313446, -0.42958769609179492, -0.43056393749998101, -0.4315391601226875,
+        -0.43251343443379203, -0.43348684022162504, -0.43445946584328327, -0.43543140739464342,
+        -0.43640276780384474, -0.43737365585677795, -0.43834418516377277, -0.43931447307728644,
+        -0.44028463957087249, -0.44125480609011863, -0.44222509438652641, -0.44319562534551621,
+        -0.44416651781980132, -0.44513788747937016, -0.44610984568917872, -0.44708249842541031,
+        -0.44805594524083264, -0.44903027828931852, -0.4500055814190651, -0.45098192934341536,
+        -0.45195938689744508, -0.45293800838769477, -0.45391783704153804, -0.45489890456174359,
+        -0.45588123079078735, -0.45686482348843055, -0.45784967822500283, -0.45883577839172035,
+        -0.459823095328252, -0.46081158856661025, -0.46180120618934356, -0.46279188529888232,
+        -0.46378355259382442, -0.46477612504690902, -0.4657695106784317, -0.46676360941791961,
+        -0.46775831404602519, -0.46875351120779374, -0.4697490824877622, -0.47074490553671422,
+        -0.47174085523940407, -0.47273680491212711, -0.47373262751871204, -0.47472819689328499,
+        -0.47572338895807098, -0.4767180829245074, -0.4777121624660739, -0.478705516851479,
+        -0.47969804202720012, -0.48068964163881828, -0.48168022798116111, -0.48266972286790716,
+        -0.48365805841206594, -0.48464517770957283, -0.48563103541914654, -0.48661559823253397,
+        -0.48759884523031227, -0.48858076811948098, -0.48956137135023431, -0.49054067211042068,
+        -0.49151870019740224, -0.4924954977681763, -0.49347111896980278, -0.49444562945335024,
+        -0.49541910577567477, -0.49639163469445874, -0.49736331236297054, -0.49833424343198801,
+        -0.4993045400672339, -0.50027432089153745, -0.50124370986163791, -0.5022128350902616,
+        -0.50318182762460895, -0.50415082019287571, -0.50511994593076182, -0.50608933710014559,
+        -0.50705912381222518, -0.50802943276741264, -0.50900038602415232, -0.50997209980858482,
+        -0.51094468337663645, -0.51191823793962377, -0.51289285566392162, -0.51386861875452605,
+        -0.51484559863159407, -0.51582385520817287, -0.51680343627638226, -0.51778437700828894,
+        -0.5187666995766449, -0.51975041289951718, -0.52073551251165295, -0.52172198056424213,
+        -0.52270978595346396, -0.52369888457703639, -0.52468921971667948, -0.52568072254325027,
+        -0.52667331274008311, -0.52766689923893295, -0.52866138106181071, -0.52965664826097503,
+        -0.53065258294835849, -0.53164906040483573, -0.53264595025893136, -0.53364311772386608,
+        -0.53464042488124708, -0.53563773199921938, -0.53663489887251581, -0.53763178617160645,
+        -0.53862825678800097, -0.53962417716276279, -0.54061941858540508, -0.54161385845057997,
+        -0.54260738146034271, -0.54359988076023258, -0.5445912589980374, -0.54558142929478537,
+        -0.54657031611833073, -0.54755785605079554, -0.54854399844211987, -0.54952870594304026,
+        -0.55051195491194627, -0.55149373569126936, -0.55247405275026873, -0.55345292469239016,
+        -0.55443038412662626, -0.55540647740363902, -0.55638126421869993, -0.55735481708477308,
+        -0.55832722068035512, -0.55929857107787517, -0.56026897485964511, -0.56123854812944696,
+        -0.56220741542887587, -0.56317570856850874, -0.56414356538481725, -0.56511112843450539,
+        -0.56607854363857824, -0.56704595888900677, -0.56801352263121929, -0.56898138243596952,
+        -0.56994968357426512, -0.57091856760905513, -0.57188817101728906, -0.57285862385568687,
+        -0.57383004848322994, -0.5748025583528481, -0.57577625688418765, -0.57675123642860038,
+        -0.57772757733665892, -0.5787053471375434, -0.57968459983863052, -0.5806653753524702,
+        -0.58164769905715719, -0.58263158149484129, -0.58361701821180645, -0.58460398974222127,
+        -0.58559246173627133, -0.58658238523202078, -0.58757369706894336, -0.58856632043973856,
+        -0.58956016557564472, -0.59055513055923148, -0.59155110225734542, -0.59254795736574606,
+        -0.59354556355582844, -0.59454378071283687, -0.59554246225404406, -0.59654145651454327,
+        -0.59754060818762822, -0.59853975980613483, -0.59953875325068384, -0.60053743127044001,
+        -0.60153563900183527, -0.60253322547064259, -0.60353004506291452, -0.60452595895051142,
+        -0.60552083645733767, -0.60651455635291374, -0.60750700806054081, -0.6084980927681003,
+        -0.60948772443039412, -0.61047583065294031, -0.61146235344822086, -0.61244724985657939,
+        -0.61343049242521308, -0.61441206954004823, -0.61539198560668162, -0.6163702610779781,
+        -0.61734693232741433, -0.61832205136869012, -0.61929568542363922, -0.6202679163419258,
+        -0.62123883987743334, -0.62220856482767839, -0.62317721204389775, -0.62414491332074762,
+        -0.62511181017573436, -0.62607805252961857, -0.62704379730000548, -0.62800920692125617,
+        -0.62897444780458889, -0.62993968875289719, -0.6309050993452967, -0.6318708483067903,
+        -0.63283710187862119, -0.6338040222049931, -0.63477176575170591, -0.63574048177205833,
+        -0.63671031083495899, -0.63768138342967862, -0.63865381866099769, -0.63962772304770765,
+        -0.64060318943649042, -0.6415802960421495, -0.64255910562401231, -0.64353966480705438,
+        -0.64452200355496869, -0.64550613480094765, -0.64649205424050116, -0.64747974028907296,
+        -0.6484691542056531, -0.64946024038202144, -0.65045292679563804, -0.65144712562264018,
+        -0.65244273400584119, -0.65343963497112634, -0.65443769848416977, -0.65543678263803695,
+        -0.65643673496090749, -0.65743739383197675, -0.65843858999247196, -0.65944014813776142,
+        -0.66044188857568498, -0.66144362893551034, -0.66244518591138069, -0.66344637702367981,
+        -0.66444702238150988, -0.66544694642936031, -0.66644597966112784, -0.66744396028486241,
+        -0.66844073582200492, -0.6694361646254311, -0.67043011730129587, -0.67142247802054311,
+        -0.67241314570690158, -0.67340203508931618, -0.67438907760800448, -0.67537422216465059,
+        -0.67635743570872209, -0.67733870365339321, -0.67831803011617853, -0.6792954379810161,
+        -0.68027096878024373, -0.68124468239661939, -0.68221665658726849, -0.68318698633314912,
+        -0.68415578301932933, -0.68512317345299123, -0.68608929872771007, -0.68705431294403585,
+        -0.68801838179785557, -0.68898168104935231, -0.6899443948865589, -0.69090671419863603,
+        -0.69186883477490657, -0.69283095544652096, -0.69379327618824138, -0.69475599619832962,
+        -0.69571931197482983, -0.69668341540667877, -0.69764849189803646, -0.69861471854401902,
+        -0.69958226237563093, -0.70055127869112954, -0.70152190949033766, -0.70249428202751096,
+        -0.70346850749735557, -0.70444467986756787, -0.70542287486997235, -0.70640314916087465,
+        -0.70738553965969864, -0.70837006307330752, -0.70935671561171032, -0.7103454728990195,
+        -0.71133629008171573, -0.71232910213437672, -0.71332382436114916, -0.71432035308936992,
+        -0.71531856654986392, -0.7163183259366368, -0.71731947663693307, -0.71832184962091983,
+        -0.71932526297868316, -0.72032952359073754, -0.7213344289168715, -0.72233976888694795,
+        -0.72334532787618233, -0.72435088674650727, -0.72535622493489404, -0.72636112256891994,
+        -0.72736536258948048, -0.72836873286036796, -0.72937102824440603, -0.73037205262603822,
+        -0.73137162086064056, -0.73236956063140102, -0.73336571419536423, -0.73435994000118143,
+        -0.73535211416221336, -0.73634213176990437, -0.73732990803377974, -0.73831537923596646,
+        -0.73929850348985027, -0.74027926129425814, -0.74125765587646697, -0.74223371331930355,
+        -0.74320748246962465, -0.74417903462754698, -0.74514846301787263, -0.74611588204724399,
+        -0.74708142635265518, -0.74804524964893693, -0.74900752338483978, -0.7499684352192183,
+        -0.75092818733060995, -0.75188699457520414, -0.75284508250973536, -0.75380268529724048,
+        -0.75476004351487791, -0.755717401884067, -0.75667500694409551, -0.75763310469104084,
+        -0.75859193820433413, -0.75955174528358027, -0.76051275611831626, -0.76147519101324157,
+        -0.7624392581910916, -0.76340515169475465, -0.76437304940944517, -0.7653431112247584,
+        -0.76631547735524363, -0.76729026683678125, -0.76826757621447805, -0.76924747843611907,
+        -0.77023002196334056, -0.77121523011072979, -0.7722031006209461, -0.77319360548179061,
+        -0.77418669098887838, -0.77518227805527784, -0.77618026276711971, -0.77718051718184322,
+        -0.77818289036341437, -0.77918720964653299, -0.78019328211962791, -0.78120089631425205,
+        -0.78220982408644402, -0.78321982267367007, -0.78423063690915773, -0.78524200157379098,
+        -0.78625364386426189, -0.78726528595489542, -0.78827664762948046, -0.78928744895858549,
+        -0.7902974129971907, -0.79130626847707208, -0.7923137524681988, -0.79331961298348563,
+        -0.79432361150155784, -0.79532552538275092, -0.79632515015435934, -0.79732230164219842,
+        -0.79831681792678133, -0.79930856110389914, -0.80029741883107963, -0.80128330564325101,
+        -0.80226616402297757, -0.80324596521285885, -0.80422270975998533, -0.80519642778480494,
+        -0.80616717896931045, -0.80713505226205107, -0.80810016530015072, -0.80906266355118273,
+        -0.81002271918044644, -0.81098052965183198, -0.81193631607306049, -0.81289032129861738,
+        -0.81384280780610441, -0.81479405536403338, -0.81574435851123583, -0.81669402387001977,
+        -0.81764336731702492, -0.81859271103725428, -0.81954238048816264, -0.82049270130176633,
+        -0.82144399615358998, -0.82239658162790763, -0.82335076510899508, -0.82430684172824065,
+        -0.82526509139664672, -0.82622577595182267, -0.82718913644773495, -0.82815539061443422,
+        -0.82912473051366187, -0.83009732041464646, -0.83107329491257431, -0.83205275731018558,
+        -0.83303577828064213, -0.8340223948273926, -0.83501260955411138, -0.83600639025499812,
+        -0.83700366983283669, -0.83800434654919753, -0.83900828460808552, -0.84001531507122573,
+        -0.84102523710002419, -0.84203781951613577, -0.84305280266946891, -0.84406990059945275,
+        -0.84508880347248561, -0.84610918027569249, -0.84713068174448425, -0.84815294349897274,
+        -0.84917558936205251, -0.8501982348299264, -0.85122049066411154, -0.852241966572447,
+        -0.85326227494541562, -0.8542810346131805, -0.85529787458812623, -0.85631243775742805,
+        -0.85732438449019532, -0.85833339612411752, -0.85933917829724227, -0.86034146409153611,
+        -0.86134001695623663, -0.86233463338065053, -0.86332514528802606, -0.86431142212436096,
+        -0.86529337261853667, -0.86627094619291045, -0.86724413400649991, -0.86821296961608874,
+        -0.86917752924392178, -0.87013793164418918, -0.87109433756411592, -0.87204694879917355,
+        -0.87299600684570811, -0.87394179115802417, -0.87488461702076137, -0.87582483305107472,
+        -0.8767628183487679, -0.87769897931603524, -0.87863374617180445, -0.87956756918885393,
+        -0.88050091468481362, -0.88143426080087517, -0.88236809310446318, -0.88330290005425793,
+        -0.88423916836777161, -0.88517737833315624, -0.88611799910804101, -0.8870614840489236,
+        -0.88800826611501815, -0.88895875339041908, -0.88991332476800322, -0.8908723258376765,
+        -0.89183606502033075, -0.89280480998727907, -0.89377878440292446, -0.8947581650260662,
+        -0.89574307920252161, -0.89673360277870517, -0.89772975846244218, -0.89873151465365519,
+        -0.89973878476365887, -0.90075142703770317, -0.90176924489105392, -0.90279198776446934,
+        -0.9038193525003253, -0.90485098523598506, -0.90588648380629333, -0.90692540064239591,
+        -0.9079672461493834, -0.90901149254072011, -0.91005757810292187, -0.91110491185970155,
+        -0.91215287860065775, -0.91320084423578496, -0.91424816143347776, -0.91529417549647363,
+        -0.91633823042725138, -0.91737967513185004, -0.91841786970898986, -0.9194521917695968,
+        -0.92048204273062528, -0.92150685402622001, -0.92252609317897927, -0.92353926967419142,
+        -0.92454594058057071, -0.92554571586218082, -0.92653826332780675, -0.92752331316617387,
+        -0.92850066201795645, -0.92947017653854591, -0.93043179640900775, -0.93138553675650948,
+        -0.93233148994973369, -0.93326982673943948, -0.934200796719177, -0.93512472808642733,
+        -0.93604202668982639, -0.93695317435381842, -0.93785872647783886, -0.93875930891306369,
+        -0.93965561412571996, -0.94054839666194179, -0.94143846793510866, -0.94232669036246319,
+        -0.94321397088355308, -0.94410125389860022, -0.94498951367022654, -0.9458797462370071,
+        -0.9467729608921015, -0.947670171284554, -0.94857238620485362, -0.94948060011990654,
+        -0.95039578352561871, -0.95131887318790043, -0.95225076234495321, -0.95319229094519053,
+        -0.95414423599612352, -0.95510730209989181, -0.95608211225090112, -0.95706919897024012,
+        -0.95806899585013172, -0.95908182957970278, -0.96010791252079952, -0.96114733589945034,
+        -0.96220006367492017, -0.96326592714413439, -0.96434462033457025, -0.96543569623358716,
+        -0.96653856389664128, -0.96765248647087743, -0.96877658016432766, -0.9699098141844118,
+        -0.97105101166257646, -0.97219885157496244, -0.9733518716618067, -0.97450847234107629,
+        -0.9756669216045597, -0.97682536087740013, -0.97798181181489519, -0.97913418400335761,
+        -0.98028028352499863, -0.98141782234018016, -0.98254442843411072, -0.98365765666906968,
+        -0.98475500027770202, -0.98583390292778494, -0.98689177128422045, -0.98792598798986675,
+        -0.9889339249832485, -0.98991295706816873, -0.99086047564783986, -0.99177390253441167,
+        -0.99265070374358622, -0.99348840318359521, -0.99428459614794451, -0.99503696252222351,
+        -0.99574327961672471, -0.99640143453882812, -0.99700943602183378, -0.99756542563036887,
+        -0.99806768826645231, -0.9985146619048717, -0.99890494649160466, -0.9992373119445932,
+        -0.99951070520219165, -0.99972425627107742, -0.99987728323216107, -0.9999692961701816,
+        -1, -0.9999692961701816, -0.99987728323216107, -0.99972425627107742,
+        -0.99951070520219165, -0.9992373119445932, -0.99890494649160466, -0.9985146619048717,
+        -0.99806768826645231, -0.99756542563036887, -0.99700943602183378, -0.99640143453882835,
+        -0.99574327961672471, -0.99503696252222351, -0.99428459614794451, -0.99348840318359521,
+        -0.99265070374358622, -0.99177390253441167, -0.99086047564783986, -0.98991295706816873,
+        -0.9889339249832485, -0.98792598798986697, -0.98689177128422045, -0.98583390292778494,
+        -0.98475500027770202, -0.98365765666906968, -0.98254442843411072, -0.98141782234018016,
+        -0.98028028352499863, -0.97913418400335783, -0.97798181181489519, -0.97682536087740013,
+        -0.9756669216045597, -0.97450847234107629, -0.9733518716618067, -0.97219885157496244,
+        -0.97105101166257646, -0.9699098141844118, -0.96877658016432788, -0.96765248647087754,
+        -0.96653856389664128, -0.96543569623358716, -0.96434462033457025, -0.96326592714413439,
+        -0.96220006367492017, -0.96114733589945034, -0.96010791252079952, -0.95908182957970278,
+        -0.95806899585013172, -0.95706919897024034, -0.95608211225090112, -0.95510730209989181,
+        -0.95414423599612352, -0.95319229094519065, -0.95225076234495321, -0.95131887318790043,
+        -0.95039578352561871, -0.94948060011990676, -0.94857238620485373, -0.947670171284554,
+        -0.9467729608921015, -0.9458797462370071, -0.94498951367022654, -0.94410125389860022,
+        -0.94321397088355308, -0.94232669036246319, -0.94143846793510866, -0.94054839666194179,
+        -0.93965561412571996, -0.93875930891306369, -0.93785872647783897, -0.93695317435381864,
+        -0.93604202668982661, -0.93512472808642744, -0.934200796719177, -0.93326982673943959,
+        -0.93233148994973369, -0.93138553675650948, -0.93043179640900775, -0.92947017653854613,
+        -0.92850066201795645, -0.92752331316617387, -0.92653826332780675, -0.92554571586218082,
+        -0.92454594058057071, -0.92353926967419142, -0.92252609317897927, -0.92150685402622001,
+        -0.92048204273062528, -0.91945219176959692, -0.91841786970898986, -0.91737967513185004,
+        -0.9163382304272516, -0.91529417549647363, -0.91424816143347776, -0.91320084423578507,
+        -0.91215287860065775, -0.91110491185970155, -0.91005757810292187, -0.90901149254072011,
+        -0.9079672461493834, -0.90692540064239591, -0.90588648380629333, -0.90485098523598517,
+        -0.90381935250032575, -0.90279198776446978, -0.90176924489105392, -0.90075142703770317,
+        -0.89973878476365921, -0.89873151465365542, -0.89772975846244218, -0.89673360277870517,
+        -0.89574307920252161, -0.89475816502606631, -0.89377878440292469, -0.89280480998727907,
+        -0.89183606502033075, -0.89087232583767673, -0.88991332476800344, -0.88895875339041908,
+        -0.88800826611501826, -0.88706148404892382, -0.88611799910804101, -0.88517737833315624,
+        -0.88423916836777183, -0.88330290005425816, -0.88236809310446329, -0.88143426080087517,
+        -0.88050091468481362, -0.87956756918885415, -0.87863374617180445, -0.87769897931603535,
+        -0.87676281834876812, -0.87582483305107472, -0.87488461702076159, -0.87394179115802417,
+        -0.87299600684570811, -0.87204694879917366, -0.87109433756411614, -0.87013793164418918,
+        -0.86917752924392178, -0.86821296961608896, -0.86724413400650024, -0.86627094619291045,
+        -0.86529337261853667, -0.86431142212436118, -0.86332514528802606, -0.86233463338065053,
+        -0.86134001695623641, -0.86034146409153611, -0.85933917829724227, -0.85833339612411785,
+        -0.85732438449019532, -0.85631243775742805, -0.85529787458812645, -0.85428103461318072,
+        -0.85326227494541584, -0.85224196657244711, -0.85122049066411154, -0.8501982348299264,
+        -0.84917558936205251, -0.84815294349897297, -0.84713068174448447, -0.8461091802756926,
+        -0.84508880347248583, -0.84406990059945275, -0.84305280266946914, -0.84203781951613588,
+        -0.84102523710002441, -0.84001531507122573, -0.83900828460808552, -0.83800434654919764,
+        -0.83700366983283692, -0.83600639025499812, -0.83501260955411138, -0.8340223948273926,
+        -0.83303577828064224, -0.83205275731018591, -0.83107329491257431, -0.83009732041464668,
+        -0.82912473051366198, -0.82815539061443422, -0.82718913644773506, -0.82622577595182289,
+        -0.82526509139664694, -0.82430684172824087, -0.82335076510899508, -0.82239658162790763,
+        -0.82144399615359021, -0.82049270130176655, -0.81954238048816264, -0.81859271103725428,
+        -0.81764336731702503, -0.81669402387001977, -0.81574435851123606, -0.8147940553640336,
+        -0.81384280780610441, -0.81289032129861738, -0.81193631607306049, -0.8109805296518322,
+        -0.81002271918044677, -0.80906266355118273, -0.80810016530015105, -0.80713505226205129,
+        -0.80616717896931067, -0.80519642778480494, -0.80422270975998555, -0.80324596521285885,
+        -0.80226616402297757, -0.80128330564325101, -0.80029741883107985, -0.79930856110389914,
+        -0.79831681792678144, -0.79732230164219864, -0.79632515015435934, -0.79532552538275092,
+        -0.79432361150155795, -0.79331961298348563, -0.7923137524681988, -0.79130626847707231,
+        -0.79029741299719092, -0.78928744895858571, -0.78827664762948069, -0.78726528595489564,
+        -0.78625364386426189, -0.78524200157379098, -0.78423063690915784, -0.78321982267367019,
+        -0.78220982408644402, -0.78120089631425227, -0.78019328211962813, -0.7791872096465331,
+        -0.77818289036341448, -0.77718051718184333, -0.77618026276711982, -0.77518227805527795,
+        -0.77418669098887849, -0.77319360548179072, -0.77220310062094633, -0.77121523011073001,
+        -0.77023002196334067, -0.76924747843611918, -0.76826757621447805, -0.76729026683678137,
+        -0.76631547735524375, -0.76534311122475851, -0.76437304940944528, -0.76340515169475487,
+        -0.7624392581910916, -0.76147519101324179, -0.76051275611831626, -0.75955174528358038,
+        -0.75859193820433424, -0.75763310469104073, -0.75667500694409562, -0.75571740188406711,
+        -0.75476004351487791, -0.75380268529724059, -0.75284508250973559, -0.75188699457520425,
+        -0.75092818733061006, -0.74996843521921852, -0.74900752338483989, -0.74804524964893704,
+        -0.7470814263526554, -0.74611588204724411, -0.74514846301787274, -0.74417903462754709,
+        -0.74320748246962476, -0.74223371331930366, -0.74125765587646708, -0.74027926129425836,
+        -0.73929850348985038, -0.73831537923596657, -0.73732990803377985, -0.73634213176990448,
+        -0.73535211416221347, -0.73435994000118154, -0.73336571419536456, -0.73236956063140113,
+        -0.73137162086064067, -0.73037205262603833, -0.72937102824440603, -0.72836873286036818,
+        -0.72736536258948059, -0.72636112256892005, -0.72535622493489427, -0.72435088674650738,
+        -0.72334532787618244, -0.72233976888694806, -0.72133442891687172, -0.72032952359073765,
+        -0.71932526297868327, -0.71832184962091994, -0.7173194766369333, -0.71631832593663691,
+        -0.71531856654986403, -0.71432035308937025, -0.71332382436114927, -0.71232910213437672,
+        -0.71133629008171573, -0.7103454728990195, -0.70935671561171043, -0.70837006307330763,
+        -0.70738553965969875, -0.70640314916087499, -0.70542287486997235, -0.7044446798675682,
+        -0.70346850749735568, -0.70249428202751107, -0.70152190949033788, -0.70055127869112988,
+        -0.69958226237563104, -0.69861471854401913, -0.69764849189803668, -0.696683415406679,
+        -0.69571931197482995, -0.69475599619832984, -0.69379327618824171, -0.69283095544652107,
+        -0.69186883477490668, -0.69090671419863603, -0.68994439488655912, -0.68898168104935231,
+        -0.68801838179785579, -0.68705431294403596, -0.6860892987277103, -0.68512317345299134,
+        -0.68415578301932956, -0.68318698633314923, -0.68221665658726849, -0.68124468239661962,
+        -0.68027096878024396, -0.67929543798101633, -0.67831803011617864, -0.67733870365339344,
+        -0.6763574357087222, -0.67537422216465071, -0.67438907760800448, -0.67340203508931618,
+        -0.6724131457069018, -0.67142247802054345, -0.67043011730129598, -0.6694361646254311,
+        -0.66844073582200514, -0.66744396028486253, -0.66644597966112806, -0.66544694642936031,
+        -0.6644470223815101, -0.66344637702368003, -0.6624451859113808, -0.66144362893551056,
+        -0.66044188857568509, -0.65944014813776164, -0.65843858999247207, -0.65743739383197697,
+        -0.65643673496090771, -0.65543678263803695, -0.65443769848416999, -0.65343963497112645,
+        -0.65244273400584141, -0.65144712562264018, -0.65045292679563826, -0.64946024038202155,
+        -0.64846915420565332, -0.64747974028907318, -0.64649205424050138, -0.64550613480094776,
+        -0.64452200355496891, -0.6435396648070546, -0.64255910562401242, -0.64158029604214972,
+        -0.64060318943649053, -0.63962772304770799, -0.63865381866099791, -0.63768138342967884,
+        -0.63671031083495921, -0.63574048177205844, -0.63477176575170602, -0.63380402220499321,
+        -0.6328371018786213, -0.63187084830679052, -0.63090509934529682, -0.62993968875289741,
+        -0.62897444780458911, -0.62800920692125628, -0.62704379730000581, -0.6260780525296189,
+        -0.62511181017573458, -0.62414491332074762, -0.62317721204389798, -0.62220856482767861,
+        -0.62123883987743345, -0.62026791634192602, -0.61929568542363944, -0.61832205136869034,
+        -0.61734693232741478, -0.61637026107797821, -0.61539198560668174, -0.61441206954004857,
+        -0.61343049242521319, -0.61244724985657961, -0.61146235344822109, -0.61047583065294053,
+        -0.60948772443039434, -0.60849809276810052, -0.60750700806054092, -0.60651455635291385,
+        -0.60552083645733801, -0.60452595895051164, -0.60353004506291485, -0.60253322547064281,
+        -0.60153563900183538, -0.60053743127044024, -0.59953875325068406, -0.59853975980613494,
+        -0.59754060818762844, -0.59654145651454371, -0.59554246225404417, -0.5945437807128372,
+        -0.59354556355582855, -0.59254795736574628, -0.59155110225734575, -0.59055513055923148,
+        -0.58956016557564495, -0.58856632043973878, -0.58757369706894347, -0.58658238523202089,
+        -0.58559246173627144, -0.5846039897422215, -0.58361701821180656, -0.5826315814948414,
+        -0.58164769905715752, -0.58066537535247054, -0.57968459983863085, -0.57870534713754362,
+        -0.57772757733665914, -0.57675123642860049, -0.57577625688418788, -0.57480255835284833,
+        -0.57383004848323005, -0.57285862385568698, -0.57188817101728928, -0.57091856760905535,
+        -0.56994968357426534, -0.56898138243596974, -0.56801352263121951, -0.567045958889007,
+        -0.56607854363857846, -0.56511112843450562, -0.56414356538481747, -0.56317570856850896,
+        -0.56220741542887609, -0.56123854812944729, -0.56026897485964533, -0.55929857107787551,
+        -0.55832722068035534, -0.55735481708477341, -0.55638126421870016, -0.55540647740363935,
+        -0.55443038412662637, -0.55345292469239038, -0.55247405275026906, -0.55149373569126947,
+        -0.5505119549119466, -0.54952870594304037, -0.54854399844212032, -0.54755785605079588,
+        -0.54657031611833096, -0.54558142929478559, -0.5445912589980374, -0.54359988076023291,
+        -0.54260738146034315, -0.54161385845058019, -0.5406194185854053, -0.53962417716276279,
+        -0.53862825678800097, -0.53763178617160701, -0.53663489887251603, -0.53563773199921949,
+        -0.53464042488124719, -0.53364311772386608, -0.53264595025893191, -0.53164906040483617,
+        -0.5306525829483586, -0.52965664826097525, -0.5286613810618106, -0.52766689923893306,
+        -0.52667331274008355, -0.52568072254325049, -0.52468921971667959, -0.52369888457703662,
+        -0.52270978595346385, -0.52172198056424257, -0.52073551251165351, -0.51975041289951751,
+        -0.51876669957664512, -0.51778437700828894, -0.51680343627638226, -0.51582385520817342,
+        -0.51484559863159429, -0.51386861875452616, -0.51289285566392184, -0.51191823793962365,
+        -0.5109446833766369, -0.50997209980858527, -0.50900038602415243, -0.50802943276741264,
+        -0.50705912381222518, -0.50608933710014548, -0.50511994593076226, -0.50415082019287605,
+        -0.50318182762460928, -0.50221283509026171, -0.50124370986163791, -0.50027432089153778,
+        -0.49930454006723435, -0.49833424343198818, -0.49736331236297093, -0.49639163469445863,
+        -0.49541910577567477, -0.4944456294533508, -0.49347111896980295, -0.49249549776817653,
+        -0.49151870019740251, -0.49054067211042068, -0.48956137135023486, -0.48858076811948148,
+        -0.48759884523031255, -0.48661559823253414, -0.48563103541914648, -0.48464517770957283,
+        -0.48365805841206649, -0.48266972286790744, -0.48168022798116128, -0.48068964163881839,
+        -0.47969804202720018, -0.4787055168514795, -0.47771216246607434, -0.47671808292450768,
+        -0.47572338895807115, -0.47472819689328499, -0.47373262751871204, -0.47273680491212755,
+        -0.47174085523940434, -0.4707449055367145, -0.46974908248776248, -0.46875351120779374,
+        -0.4677583140460258, -0.46676360941792017, -0.46576951067843209, -0.46477612504690918,
+        -0.46378355259382442, -0.46279188529888232, -0.46180120618934412, -0.46081158856661064,
+        -0.45982309532825227, -0.45883577839172057, -0.45784967822500283, -0.45686482348843105,
+        -0.45588123079078779, -0.45489890456174381, -0.45391783704153832, -0.45293800838769477,
+        -0.45195938689744508, -0.45098192934341597, -0.45000558141906538, -0.44903027828931874,
+        -0.44805594524083281, -0.44708249842541026, -0.44610984568917916, -0.44513788747937061,
+        -0.44416651781980149, -0.44319562534551643, -0.4422250943865263, -0.44125480609011858,
+        -0.44028463957087299, -0.43931447307728666, -0.43834418516377299, -0.43737365585677823,
+        -0.43640276780384474, -0.43543140739464387, -0.43445946584328382, -0.4334868402216252,
+        -0.4325134344337922, -0.43153916012268745, -0.43056393749998101, -0.42958769609179537,
+        -0.42861037539313473, -0.42763192542501982, -0.4266523071891925, -0.42567149301630347,
+        -0.42468946680447806, -0.4237062241462457, -0.42272177234288405, -0.42173613030630219,
+        -0.4207493283496776, -0.41976140786911614, -0.41877242091965255, -0.41778242968990043,
+        -0.41679150588064129, -0.41579972999352921, -0.41480719053695364, -0.41381398315687001,
+        -0.41282020970110894, -0.4118259772263056, -0.41083139695709681, -0.40983658320769445,
+        -0.4088416522762589, -0.40784672132275462, -0.40685190724107967, -0.40585732553631831,
+        -0.4048630892178674, -0.40386930771902818, -0.4028760858533697, -0.40188352281779122,
+        -0.40089171125175871, -0.39990073636160051, -0.39891067511813416, -0.39792159553515521,
+        -0.39693355603553737, -0.39594660491082884, -0.39496077987933348, -0.39397610774669439,
+        -0.39299260417202098, -0.39201027354156748, -0.39102910895094795, -0.39004909229582602,
+        -0.38907019446996727, -0.38809237566853072, -0.38711558579346339, -0.38613976495688601,
+        -0.38516484407743229, -0.38419074556362814, -0.38321738407755901, -0.38224466737133023,
+        -0.38127249718814804, -0.38030077021922165, -0.37932937910721026, -0.37835821348645976,
+        -0.37738716104999176, -0.37641610863293712, -0.37544494330198641, -0.37447355344038324,
+        -0.37350182981806612, -0.37252966663670301, -0.37155696253965226, -0.37058362157722019,
+        -0.36960955411803786, -0.36863467769792901, -0.36765891779823201, -0.36668220854625322,
+        -0.36570449333128369, -0.36472572533043213, -0.36374586793939978, -0.36276489510426024,
+        -0.3617827915512421, -0.36079955291251448, -0.35981518574696952, -0.35882970745600135,
+        -0.3578431460953046, -0.35685554008468595, -0.35586693781887641, -0.35487739718327221,
+        -0.35388698497943133, -0.35289577626600732, -0.35190385362162191, -0.35091130633688278,
+        -0.34991822954344676, -0.34892472328860585, -0.34793089156437795, -0.34693684130051339,
+        -0.34594268133114781, -0.34494852134506776, -0.34395447082970393, -0.34296063801899646,
+        -0.34196712885522401, -0.34097404597474767, -0.33998148772734987, -0.33898954723853414,
+        -0.3379983115237028, -0.33700786066262722, -0.33601826704203114, -0.33502959467342874,
+        -0.33404189859264011, -0.3330552243466024, -0.33206960757224968, -0.33108507367133799,
+        -0.33010163758418037, -0.32911930366427855, -0.32813806565488601, -0.32715790676755158,
+        -0.32617879986170578, -0.32520070772340454, -0.32422358344036734, -0.32324737086955641,
+        -0.32227200519264493, -0.3212974135538923, -0.32032351577415863, -0.3193502251340849,
+        -0.31837744921878819, -0.3174050908158676, -0.31643304885801005, -0.31546121940106192,
+        -0.31448949662812947, -0.31351777387001162, -0.3125459446321458, -0.31157390361819504,
+        -0.31060154774045257, -0.30962877710737835, -0.30865549597883496, -0.30768161367988428,
+        -0.30670704546445238, -0.30573171332064231, -0.30475554671005173, -0.30377848323411222,
+        -0.30280046922115533, -0.30182146022869888, -0.30084142145626275, -0.29986032806489038,
+        -0.29887816540044959, -0.29789492911872767, -0.29691062521125744, -0.29592526993179208,
+        -0.29493888962428044, -0.29395152045414613, -0.29296320804560633, -0.29197400702864168,
+        -0.29098398050011787, -0.2899931994043578, -0.28900174183923383, -0.2880096922945547,
+        -0.2870171408301691, -0.28602418220175907, -0.28503091494280036, -0.28403744041157619,
+        -0.28304386181243529, -0.28205028320074821, -0.28105680848112746, -0.28006354040854969,
+        -0.27907057960196646, -0.27807802357986394, -0.27708596582699052, -0.27609449490119026,
+        -0.27510369358884357, -0.27411363811697087, -0.27312439742948197, -0.27213603253442875,
+        -0.27114859592844398, -0.27016213110376797, -0.26917667214249791, -0.26819224340183156,
+        -0.26720885929320248, -0.26622652415729714, -0.26524523223603375, -0.26426496774162561,
+        -0.26328570502194454, -0.26230740882046388, -0.26133003462815285, -0.26035352912382898,
+        -0.2593778306986107, -0.25840287005932699, -0.25742857090498283, -0.25645485066968832,
+        -0.25548162132482283, -0.25450879023266149, -0.25353626104318888, -0.25256393462543197,
+        -0.25159171002432801, -0.25061948543389218, -0.24964715917733049, -0.2486746306846615,
+        -0.24770180145846568, -0.24672857601850179, -0.24575486281614017, -0.24478057510986453,
+        -0.24380563179349046, -0.24282995816919145, -0.24185348665798076, -0.24087615744090318,
+        -0.23989791902485624, -0.23891872872770062, -0.23793855307810019, -0.2369573681263463,
+        -0.23597515966329272, -0.2349919233454083, -0.23400766472484991, -0.23302239918439502,
+        -0.23203615177795092, -0.2310489569782995, -0.23006085833460171, -0.2290719080430583,
+        -0.22808216643494972, -0.22709170138707624, -0.22610058766033925, -0.2251089061729078,
+        -0.22411674321502631, -0.22312418961306776, -0.22213133985092937, -0.2211382911572479,
+        -0.22014514256725085, -0.21915199396827842, -0.2181589451381695, -0.21716609478574911,
+        -0.21617353960264779, -0.21518137333553075, -0.21418968588764492, -0.21319856245827462,
+        -0.21220808272833239, -0.21121832009986968, -0.21022934099674356, -0.20924120423309997,
+        -0.20825396045567349, -0.20726765166517613, -0.20628231082129439, -0.20529796153501043,
+        -0.20431461785109992, -0.20333228412281387, -0.20235095497985298, -0.20137061538984144,
+        -0.20039124081262691, -0.19941279744581894, -0.19843524255912182, -0.19745852491416185,
+        -0.19648258526568893, -0.19550735693925483, -0.19453276647975254, -0.19355873436450252,
+        -0.19258517577398312, -0.19161200141274057, -0.19063911837254019, -0.18966643102943417,
+        -0.18869384196608324, -0.18772125291045311, -0.18674856568185252, -0.18577568313521084,
+        -0.1848025100945257, -0.18382895426652834, -0.18285492712579368, -0.18188034476282547,
+        -0.18090512868700032, -0.17992920657668973, -0.17895251296941178, -0.17797498988542035,
+        -0.17699658737880963, -0.1760172640108969, -0.17503698724140623, -0.17405573373375988,
+        -0.17307348957162949, -0.17209025038472908, -0.17110602138272787, -0.17012081729703299,
+        -0.1691346622310754, -0.16814758942062338, -0.1671596409064918, -0.16617086712287013,
+        -0.1651813264052949, -0.16419108442305907, -0.16320021354157144, -0.16220879212085904,
+        -0.16121690375699213, -0.16022463647377641, -0.15923208187251633, -0.15823933424804937,
+        -0.15724648967958205, -0.15625364510507023, -0.15526089738806217, -0.15426834238597298,
+        -0.15327607402874296, -0.15228418341672359, -0.15129275794645508, -0.15030188047270054,
+        -0.14931162851477542, -0.14832207351476026, -0.14733328015468591, -0.146345305739218,
+        -0.14535819964971411, -0.14437200287485649, -0.1433867476223151, -0.14240245701511323,
+        -0.14141914487555265, -0.14043681559872306, -0.13945546411673337, -0.1384750759539605,
+        -0.13749562737271367, -0.1365170856078548, -0.13553940918806545, -0.13456254834060488,
+        -0.13358644547562248, -0.13261103574531322, -0.13163624767249535, -0.13066200384252061,
+        -0.12968822165183536, -0.1287148141059502, -0.12774169065912749, -0.12676875808768606,
+        -0.12579592138850848, -0.12482308469410644, -0.12385015219543037, -0.12287702906355626,
+        -0.12190362236139092, -0.12092984193663875, -0.11995560128745707, -0.11898081839250622,
+        -0.11800541649742206, -0.11702932485019218, -0.11605247937839006, -0.11507482330179064,
+        -0.11409630767452589, -0.11311689185159626, -0.11213654387530422, -0.11115524077794108,
+        -0.11017296879785948, -0.10918972350690283, -0.10820550984802142, -0.10722034208274968,
+        -0.10623424364910718, -0.10524724693133207, -0.10425939294370323, -0.10327073093154313,
+        -0.10228131789326747, -0.10129121802812119, -0.10030050211494727, -0.099309246827989112,
+        -0.09831753399633443, -0.097325449814152504, -0.096333084009326761, -0.095340528978504535,
+        -0.094347878896888199, -0.093355228811332847, -0.092362673725485886, -0.091370307685751481,
+        -0.090378222876874012, -0.0893865087358275, -0.088395251092518418, -0.087404531345548278,
+        -0.086414425680950951, -0.085425004341383434, -0.084436330952783509, -0.083448461914937558,
+        -0.08246144586178801, -0.081475323196648783, -0.080490125706752569, -0.079505876260813027,
+        -0.078522588592472992, -0.0775402671716868, -0.076558907165236958, -0.075578494486738465,
+        -0.074599005935605603, -0.073620409423620567, -0.072642664286891825, -0.07166572168016902,
+        -0.070689525049704799, -0.069714010680078098, -0.068739108309705088, -0.067764741809096654,
+        -0.066790829915320024, -0.065817287015584217, -0.064844023972409667, -0.063870948982424083,
+        -0.062897968460528489, -0.061924987940922896, -0.060951912986322597, -0.059978650096631822,
+        -0.059005107608328264, -0.058031196575923684, -0.05705683162703136, -0.056081931782826798,
+        -0.055106421236023689, -0.054130230078905647, -0.053153294974417294, -0.052175559763888268,
+        -0.051196976005561154, -0.050217503438761579, -0.049237110369276797, -0.048255773972244953,
+        -0.047273480509672131, -0.046290225460504014, -0.045306013562022393, -0.044320858762185396,
+        -0.043334784083399171, -0.042347821399037297, -0.041360011124883717, -0.040371401828480945,
+        -0.039382049760152152, -0.038392018310230577, -0.037401377397716248, -0.03641020279625809,
+        -0.035418575403950936, -0.034426580463976196, -0.033434306743585045, -0.032441845679332316,
+        -0.03144929049677176, -0.030456735313088488, -0.029464274231295044, -0.028472000434697387,
+        -0.027480005290344875, -0.026488377470069751, -0.025497202097572398, -0.024506559929745406,
+        -0.023516526580102382, -0.022527171791769537, -0.021538558767031469, -0.020550743559858212,
+        -0.019563774537255395, -0.01857769191460593, -0.017592527369459661, -0.016608303737485491,
+        -0.015625034793489277, -0.014642725119603815, -0.013661370061908774, -0.012680955775890086,
+        -0.011701459360293298, -0.010722849078086337, -0.0097450846623897622, -0.0087681177044374049,
+        -0.0077918921198303253, -0.0068163446885946069, -0.0058414056638568419, -0.0048669994432705777,
+        -0.003893045296744994, -0.002919458143475388, -0.0019461493708034636, -0.00097302768703159384,
+        0,
+    },
+    /* hann */
+    {
+        0, 5.882741490603749e-07, 2.3530952119044102e-06, 5.2944590357983934e-06,
+        9.4123586994454556e-06, 1.470678451293006e-05, 2.117772401805107e-05, 2.882516198804419e-05,
+        3.7649080427748505e-05, 4.7649458573550962e-05, 5.8826272893719445e-05, 7.1179497088069699e-05,
+        8.4709102088298405e-05, 9.9415056057872153e-05, 0.00011529732439236051, 0.00013235586971915847,
+        0.00015059065189787502, 0.00017000162802038865, 0.00019058875241068085, 0.00021235197662539118,
+        0.00023529124945342872, 0.00025940651691652716, 0.00028469772226913381, 0.0003111648059985761,
+        0.00033880770582522812, 0.0003676263567027882, 0.00039762069081805684, 0.00042879063759154734,
+        0.00046113612367731927, 0.00049465707296331152, 0.00052935340657156438, 0.00056522504285821951,
+        0.0006022718974137975, 0.00064049388306353094, 0.00067989090986736445, 0.00072046288512034318,
+        0.00076220971335261289, 0.00080513129632991953, 0.0008492275330535537, 0.00089449831976090577,
+        0.00094094354992541041, 0.00098856311425687959, 0.0010373569007020023, 0.0010873247944441777,
+        0.0011384666779041819, 0.0011907824307402226, 0.001244271929848273, 0.0012989350493623486,
+        0.0013547716606548965, 0.0014117816323369059, 0.0014699648302585189, 0.0015293211175089194,
+        0.001589850354417166, 0.0016515523985519698, 0.0017144271047225823, 0.001778474324978685,
+        0.0018436939086109994, 0.0019100857021515094, 0.0019776495493740165, 0.0020463852912941394,
+        0.0021162927661700914, 0.0021873718095028472, 0.0022596222540365307, 0.0023330439297588601,
+        0.0024076366639015356, 0.0024834002809406841, 0.0025603346025971918, 0.0026384394478371487,
+        0.0027177146328722923, 0.0027981599711604521, 0.0028797752734060489, 0.0029625603475603168,
+        0.0030465149988219697, 0.0031316390296377006, 0.003217932239702348, 0.0033053944259596735,
+        0.00339402538260275, 0.003483824901074295, 0.0035747927700674476, 0.0036669287755259905,
+        0.0037602327006450165, 0.0038547043258713165, 0.0039503434289041017, 0.0040471497846953364,
+        0.0041451231654502374, 0.0042442633406280517, 0.0043445700769422779, 0.0044460431383615551,
+        0.0045486822861099951, 0.004652487278667683, 0.0047574578717714533, 0.0048635938184154459,
+        0.0049708948688514387, 0.0050793607705897359, 0.0051889912683995565, 0.0052997861043098116,
+        0.0054117450176094928, 0.0055248677448485051, 0.0056391540198381107, 0.0057546035736517065,
+        0.0058712161346252678, 0.0059889914283582368, 0.0061079291777139111, 0.0062280291028203871,
+        0.0063492909210707826, 0.0064717143471245131, 0.0065952990929072364, 0.0067200448676122959,
+        0.0068459513777006653, 0.0069730183269022805, 0.0071012454162162619, 0.0072306323439119691,
+        0.0073611788055293892, 0.0074928844938800809, 0.007625749099047896, 0.0077597723083895342,
+        0.0078949538065354874, 0.0080312932753905386, 0.0081687903941348727, 0.0083074448392244093,
+        0.0084472562843918575, 0.0085882244006473818, 0.0087303488562793796, 0.0088736293168553138,
+        0.0090180654452223785, 0.0091636569015084435, 0.0093104033431227196, 0.0094583044247566472,
+        0.0096073597983847847, 0.0097575691132653075, 0.0099089320159412853, 0.010061448150241181,
+        0.010215117157279741, 0.01036993867545899, 0.010525912340468901, 0.010683037785288396,
+        0.010841314640186173, 0.01100074253272143, 0.011161321087745035, 0.01132304992740002,
+        0.011485928671122803, 0.011649956935644079, 0.01181513433498943, 0.011981460480480488,
+        0.012148934980735715, 0.012317557441671512, 0.01248732746650294, 0.012658244655744666,
+        0.012830308607212071, 0.013003518916022083, 0.013177875174594011, 0.013353376972650877,
+        0.013530023897219912, 0.013707815532633894, 0.013886751460531865, 0.014066831259860302,
+        0.014248054506874108, 0.014430420775137454, 0.014613929635524825, 0.014798580656222249,
+        0.014984373402728013, 0.015171307437853776, 0.015359382321725734, 0.015548597611785564,
+        0.015738952862791311, 0.015930447626818778, 0.016123081453262245, 0.016316853888835747,
+        0.016511764477573965, 0.01670781276083344, 0.016904998277293748, 0.017103320562958158,
+        0.017302779151155301, 0.017503373572539838, 0.017705103355093621, 0.017907968024127086,
+        0.01811196710228008, 0.018317100109522977, 0.018523366563158061, 0.018730765977820418,
+        0.01893929786547921, 0.01914896173543873, 0.01935975709433968, 0.019571683446160171,
+        0.019784740292217107, 0.019998927131167021, 0.020214243459007741, 0.020430688769079053,
+        0.0206482625520642, 0.020866964295991164, 0.021086793486233546, 0.021307749605512072,
+        0.021529832133895588, 0.021753040548802449, 0.021977374325001797, 0.022202832934614447,
+        0.022429415847114609, 0.022657122529330831, 0.022885952445447166, 0.023115905057004837,
+        0.023346979822903069, 0.023579176199400642, 0.023812493640117061, 0.024046931596033827,
+        0.024282489515495831, 0.024519166844212459, 0.024756963025259149, 0.0249958774990785,
+        0.025235909703481663, 0.025477059073649722, 0.025719325042134866, 0.025962707038861887,
+        0.026207204491129454, 0.026452816823611391, 0.026699543458358233, 0.026947383814798276,
+        0.02719633730973936, 0.027446403357369697, 0.027697581369259872, 0.02794987075436367,
+        0.028203270919019807, 0.028457781266953253, 0.028713401199276567, 0.028970130114491344,
+        0.029227967408489597, 0.029486912474555371, 0.029746964703365852, 0.030008123482992977,
+        0.030270388198905041, 0.030533758233967701, 0.030798232968445971, 0.031063811780005057,
+        0.03133049404371252, 0.03159827913203922, 0.03186716641486087, 0.032137155259459815,
+        0.032408245030526195, 0.03268043509015961, 0.032953724797870509, 0.033228113510581914,
+        0.033503600582630522, 0.033780185365768822, 0.034057867209165926, 0.034336645459409787,
+        0.034616519460508144, 0.034897488553890466, 0.035179552078409337, 0.035462709370342071,
+        0.035746959763392205, 0.036032302588691056, 0.036318737174799443, 0.036606262847709126,
+        0.03689487893084431, 0.037184584745063642, 0.037475379608661208, 0.037767262837368698,
+        0.038060233744356631, 0.038354291640236182, 0.038649435833060686, 0.038945665628327408,
+        0.039242980328978994, 0.039541379235405238, 0.039840861645444703, 0.04014142685438632,
+        0.040443074154971115, 0.040745802837393874, 0.041049612189304752, 0.041354501495811047,
+        0.041660470039478648, 0.04196751710033414, 0.042275641955866083, 0.042584843881026901,
+        0.042895122148234655, 0.043206476027374596, 0.043518904785800894, 0.043832407688338626,
+        0.044146983997285061, 0.04446263297241182, 0.044779353870966376, 0.045097145947673889,
+        0.04541600845473881, 0.045735940641846939, 0.046056941756166869, 0.046379011042352092,
+        0.046702147742542333, 0.04702635109636577, 0.047351620340940592, 0.04767795471087688,
+        0.048005353438278331, 0.048333815752744091, 0.048663340881370587, 0.04899392804875341,
+        0.049325576476988986, 0.049658285385676515, 0.04999205399191986, 0.050326881510329213,
+        0.050662767153023092, 0.05099971012963006, 0.051337709647290841, 0.051676764910659923,
+        0.052016875121907391, 0.052358039480721208, 0.052700257184308652, 0.053043527427398374,
+        0.053387849402242338, 0.053733222298617711, 0.054079645303828638, 0.054427117602708408,
+        0.054775638377621061, 0.055125206808463612, 0.055475822072667713, 0.055827483345201823,
+        0.056180189798573033, 0.056533940602828903, 0.056888734925559681, 0.057244571931900023,
+        0.057601450784531105, 0.057959370643682506, 0.058318330667134211, 0.058678330010218605,
+        0.059039367825822475, 0.059401443264388953, 0.059764555473919623, 0.060128703599976296,
+        0.060493886785683237, 0.060860104171729212, 0.061227354896369324, 0.061595638095427174,
+        0.061964952902296699, 0.062335298447944554, 0.062706673860911943, 0.063079078267316568,
+        0.063452510790854955, 0.06382697055280423, 0.06420245667202451, 0.064578968264960512,
+        0.06495650444564427, 0.065335064325696579, 0.065714647014329552, 0.066095251618348339,
+        0.066476877242153676, 0.066859522987743503, 0.067243187954715455, 0.067627871240268811,
+        0.068013571939206596, 0.06840028914393792, 0.068788021944479694, 0.06917676942845935,
+        0.069566530681116345, 0.06995730478530493, 0.070349090821495763, 0.07074188786777863,
+        0.071135694999863941, 0.071530511291085619, 0.071926335812402764, 0.072323167632401986,
+        0.072721005817299733, 0.073119849430944295, 0.073519697534818185, 0.073920549188040086,
+        0.074322403447367402, 0.07472525936719826, 0.075129115999573726, 0.075533972394180193,
+        0.075939827598351384, 0.076346680657070842, 0.076754530612973937, 0.077163376506350467,
+        0.077573217375146442, 0.077984052254966796, 0.078395880179077282, 0.078808700178407076,
+        0.079222511281550778, 0.079637312514770964, 0.080053102902000239, 0.080469881464843629,
+        0.080887647222580961, 0.081306399192169032, 0.081726136388243997, 0.082146857823123698,
+        0.082568562506809995, 0.082991249446990933, 0.083414917649043407, 0.083839566116035158,
+        0.084265193848727382, 0.084691799845576843, 0.085119383102738477, 0.085547942614067563,
+        0.085977477371122102, 0.086407986363165434, 0.086839468577168233, 0.087271922997811224,
+        0.087705348607487355, 0.088139744386304286, 0.088575109312086786, 0.089011442360379223,
+        0.089448742504447676, 0.089887008715282657, 0.090326239961601551, 0.090766435209850671,
+        0.091207593424208144, 0.091649713566586077, 0.09209279459663311, 0.092536835471736689,
+        0.092981835147025793, 0.093427792575373203, 0.093874706707398059, 0.094322576491468135,
+        0.094771400873702616, 0.095221178797974371, 0.095671909205912509, 0.096123591036904821,
+        0.096576223228100333, 0.09702980471441186, 0.097484334428518171, 0.097939811300867097,
+        0.098396234259677529, 0.098853602230942139, 0.09931191413842988, 0.09977116890368859,
+        0.10023136544604749, 0.10069250268261959, 0.10115457952830442, 0.10161759489579059,
+        0.10208154769555822, 0.10254643683588149, 0.10301226122283141, 0.10347901976027818,
+        0.10394671134989381, 0.1044153348911549, 0.10488488928134498, 0.10535537341555717,
+        0.10582678618669683, 0.10629912648548429, 0.10677239320045712, 0.10724658521797303,
+        0.10772170142221238, 0.1081977406951809, 0.10867470191671214, 0.10915258396447031,
+        0.10963138571395276, 0.11011110603849272, 0.11059174380926201, 0.11107329789527343,
+        0.11155576716338378, 0.11203915047829616, 0.11252344670256303, 0.11300865469658855,
+        0.1134947733186315, 0.11398180142480774, 0.11446973786909309, 0.11495858150332605,
+        0.11544833117721015, 0.11593898573831729, 0.1164305440320898, 0.11692300490184354,
+        0.11741636718877052, 0.11791062973194166, 0.11840579136830937, 0.11890185093271055,
+        0.11939880725786911, 0.11989665917439879, 0.12039540551080596, 0.12089504509349236,
+        0.12139557674675772, 0.12189699929280273, 0.12239931155173173, 0.12290251234155541,
+        0.12340660047819374, 0.12391157477547859, 0.12441743404515676, 0.12492417709689246,
+        0.12543180273827031, 0.1259403097747982, 0.12644969700990993, 0.12695996324496811,
+        0.12747110727926697, 0.12798312791003535, 0.12849602393243914, 0.12900979413958447,
+        0.12952443732252045, 0.1300399522702419, 0.13055633776969244, 0.13107359260576701,
+        0.13159171556131505, 0.1321107054171432, 0.13263056095201825, 0.13315128094266981,
+        0.13367286416379359, 0.13419530938805369, 0.1347186153860862, 0.13524278092650149,
+        0.1357678047758874, 0.13629368569881212, 0.136820422457827, 0.13734801381346962,
+        0.1378764585242665, 0.13840575534673627, 0.13893590303539233, 0.13946690034274595,
+        0.13999874601930917, 0.14053143881359775, 0.14106497747213415, 0.14159936073945023,
+        0.1421345873580907, 0.14267065606861545, 0.14320756560960318, 0.14374531471765384,
+        0.14428390212739178, 0.14482332657146879, 0.14536358678056716, 0.1459046814834023,
+        0.14644660940672621, 0.14698936927533013, 0.1475329598120475, 0.14807737973775753,
+        0.14862262777138735, 0.14916870262991572, 0.14971560302837578, 0.15026332767985812,
+        0.15081187529551354, 0.15136124458455669, 0.15191143425426851, 0.15246244300999956,
+        0.153014269555173, 0.15356691259128763, 0.15412037081792113, 0.15467464293273264,
+        0.15522972763146653, 0.15578562360795473, 0.15634232955412042, 0.15689984415998065,
+        0.15745816611364982, 0.15801729410134224, 0.15857722680737596, 0.15913796291417509,
+        0.15969950110227343, 0.16026184005031746, 0.16082497843506921, 0.16138891493140978,
+        0.16195364821234198, 0.16251917694899398, 0.16308549981062193, 0.16365261546461352,
+        0.16422052257649083, 0.16478921980991346, 0.165358705826682, 0.16592897928674072,
+        0.16650003884818126, 0.16707188316724514, 0.16764451089832755, 0.16821792069398006,
+        0.16879211120491411, 0.16936708108000387, 0.16994282896628976, 0.17051935350898134,
+        0.17109665335146068, 0.17167472713528548, 0.17225357350019227, 0.17283319108409972,
+        0.17341357852311162, 0.17399473445152025, 0.17457665750180951, 0.1751593463046584,
+        0.17574279948894372, 0.17632701568174397, 0.1769119935083418, 0.17749773159222798,
+        0.17808422855510425, 0.17867148301688657, 0.17925949359570842, 0.17984825890792416,
+        0.18043777756811213, 0.18102804818907792, 0.1816190693818579, 0.18221083975572189,
+        0.18280335791817726, 0.1833966224749714, 0.18399063203009547, 0.18458538518578776,
+        0.18518088054253645, 0.18577711669908364, 0.1863740922524279, 0.18697180579782824,
+        0.18757025592880677, 0.18816944123715268, 0.18876936031292496, 0.18937001174445617,
+        0.1899713941183554, 0.19057350601951184, 0.19117634603109801, 0.19177991273457318,
+        0.19238420470968659, 0.19298922053448075, 0.19359495878529515, 0.19420141803676899,
+        0.19480859686184526, 0.1954164938317734, 0.19602510751611313, 0.19663443648273776,
+        0.19724447929783723, 0.19785523452592196, 0.19846670072982586, 0.19907887647070999,
+        0.19969176030806551, 0.20030535079971773, 0.20091964650182881, 0.20153464596890175,
+        0.20215034775378327, 0.20276675040766773, 0.2033838524801001, 0.2040016525189795,
+        0.20462014907056286, 0.20523934067946803, 0.20585922588867733, 0.20647980323954096,
+        0.20710107127178057, 0.20772302852349234, 0.20834567353115085, 0.20896900482961223,
+        0.20959302095211774, 0.21021772043029713, 0.21084310179417221, 0.21146916357216022,
+        0.21209590429107733, 0.21272332247614212, 0.21335141665097884, 0.21398018533762148,
+        0.21460962705651632, 0.21523974032652637, 0.21587052366493426, 0.21650197558744566,
+        0.21713409460819338, 0.21776687923974025, 0.21840032799308295, 0.21903443937765527,
+        0.21966921190133198, 0.22030464407043193, 0.22094073438972195, 0.22157748136241995,
+        0.22221488349019886, 0.22285293927318994, 0.22349164720998621, 0.22413100579764628,
+        0.22477101353169759, 0.22541166890614012, 0.22605297041344991, 0.22669491654458257,
+        0.22733750578897677, 0.22798073663455803, 0.228624607567742, 0.22926911707343822,
+        0.22991426363505352, 0.23056004573449579, 0.23120646185217725, 0.23185351046701841,
+        0.23250119005645137, 0.23314949909642352, 0.23379843606140099, 0.2344479994243725,
+        0.23509818765685259, 0.23574899922888576, 0.2364004326090493, 0.23705248626445763,
+        0.23770515866076558, 0.23835844826217178, 0.23901235353142281, 0.23966687292981637,
+        0.24032200491720523, 0.24097774795200033, 0.24163410049117501, 0.24229106099026843,
+        0.24294862790338917, 0.24360679968321847, 0.24426557478101474, 0.24492495164661665,
+        0.24558492872844651, 0.24624550447351456, 0.24690667732742227, 0.24756844573436626,
+        0.24823080813714121, 0.24889376297714455, 0.24955730869437953, 0.25022144372745903,
+        0.25088616651360907, 0.25155147548867268, 0.25221736908711379, 0.25288384574202016,
+        0.25355090388510793, 0.254218541946725, 0.25488675835585445, 0.25555555154011839,
+        0.256224919925782, 0.25689486193775674, 0.25756537599960444, 0.25823646053354066,
+        0.25890811396043856, 0.25958033469983305, 0.2602531211699235, 0.26092647178757844,
+        0.26160038496833887, 0.26227485912642207, 0.26294989267472502, 0.26362548402482855,
+        0.2643016315870011, 0.26497833377020219, 0.26565558898208602, 0.26633339562900571,
+        0.26701175211601691, 0.26769065684688109, 0.26837010822406987, 0.26905010464876855,
+        0.26973064452088003, 0.27041172623902793, 0.27109334820056136, 0.2717755088015581,
+        0.27245820643682805, 0.27314143949991804, 0.27382520638311447, 0.27450950547744812,
+        0.2751943351726967, 0.27587969385738997, 0.27656557991881281, 0.27725199174300913,
+        0.27793892771478534, 0.27862638621771496, 0.27931436563414169, 0.2800028643451834,
+        0.28069188073073614, 0.2813814131694779, 0.28207146003887229, 0.28276201971517212,
+        0.28345309057342399, 0.28414467098747132, 0.28483675932995867, 0.28552935397233525,
+        0.2862224532848589, 0.28691605563660016, 0.2876101593954456, 0.28830476292810192,
+        0.28899986460010008, 0.28969546277579872, 0.29039155581838805, 0.29108814208989381,
+        0.29178521995118134, 0.29248278776195918, 0.29318084388078269, 0.29387938666505853,
+        0.29457841447104804, 0.29527792565387123, 0.29597791856751066, 0.29667839156481546,
+        0.29737934299750507, 0.29808077121617294, 0.29878267457029073, 0.29948505140821213,
+        0.30018790007717661, 0.30089121892331316, 0.30159500629164482, 0.30229926052609185,
+        0.30300397996947592, 0.30370916296352424, 0.30441480784887298, 0.30512091296507182,
+        0.30582747665058685, 0.30653449724280568, 0.30724197307804046, 0.30794990249153248,
+        0.30865828381745508, 0.30936711538891876, 0.31007639553797445, 0.31078612259561722,
+        0.31149629489179087, 0.31220691075539131, 0.31291796851427101, 0.31362946649524209,
+        0.3143414030240812, 0.31505377642553289, 0.31576658502331384, 0.31647982714011635,
+        0.31719350109761302, 0.31790760521646011, 0.31862213781630139, 0.31933709721577286,
+        0.32005248173250589, 0.32076828968313176, 0.32148451938328498, 0.32220116914760799,
+        0.32291823728975477, 0.32363572212239466, 0.3243536219572164, 0.32507193510493249,
+        0.32579065987528277, 0.32650979457703816, 0.32722933751800543, 0.32794928700503051,
+        0.32866964134400278, 0.32939039883985877, 0.33011155779658652, 0.33083311651722935,
+        0.33155507330389, 0.33227742645773417, 0.33300017427899525, 0.33372331506697789,
+        0.33444684712006179, 0.33517076873570623, 0.33589507821045367, 0.33661977383993413,
+        0.33734485391886848, 0.33807031674107352, 0.33879616059946499, 0.33952238378606237,
+        0.34024898459199215, 0.34097596130749247, 0.34170331222191708, 0.34243103562373878,
+        0.34315912980055419, 0.34388759303908745, 0.34461642362519429, 0.34534561984386558,
+        0.34607517997923254, 0.34680510231456946, 0.34753538513229876, 0.34826602671399431,
+        0.3489970253403859, 0.3497283792913633, 0.35046008684597973, 0.35119214628245687,
+        0.35192455587818805, 0.35265731390974286, 0.35339041865287069, 0.35412386838250531,
+        0.35485766137276886, 0.35559179589697526, 0.35632627022763519, 0.35706108263645964,
+        0.35779623139436412, 0.35853171477147228, 0.35926753103712095, 0.36000367845986331,
+        0.3607401553074735, 0.36147695984695005, 0.3622140903445209, 0.36295154506564686,
+        0.36368932227502548, 0.36442742023659597, 0.3651658372135424, 0.36590457146829841,
+        0.36664362126255079, 0.36738298485724408, 0.36812266051258424, 0.36886264648804323,
+        0.36960294104236224, 0.37034354243355683, 0.37108444891892056, 0.37182565875502854,
+        0.37256717019774266, 0.37330898150221486, 0.37405109092289157, 0.37479349671351736,
+        0.37553619712713987, 0.3762791904161133, 0.37702247483210272, 0.37776604862608787,
+        0.37850991004836798, 0.37925405734856532, 0.37999848877562925, 0.38074320257784078,
+        0.38148819700281633, 0.38223347029751226, 0.38297902070822826, 0.38372484648061234,
+        0.38447094585966435, 0.38521731708974055, 0.38596395841455711, 0.38671086807719496,
+        0.38745804432010361, 0.38820548538510502, 0.38895318951339819, 0.38970115494556318,
+        0.39044937992156514, 0.39119786268075818, 0.3919466014618902, 0.39269559450310654,
+        0.39344484004195435, 0.3941943363153862, 0.39494408155976513, 0.39569407401086826,
+        0.39644431190389073, 0.39719479347345032, 0.39794551695359148, 0.39869648057778945,
+        0.39944768257895402, 0.40019912118943446, 0.40095079464102312, 0.40170270116495987,
+        0.40245483899193585, 0.40320720635209811, 0.40395980147505384, 0.40471262258987362,
+        0.40546566792509686, 0.40621893570873513, 0.40697242416827667, 0.40772613153069015,
+        0.40848005602242948, 0.40923419586943743, 0.40998854929715023, 0.41074311453050122,
+        0.41149788979392554, 0.41225287331136429, 0.41300806330626805, 0.41376345800160197,
+        0.41451905561984931, 0.41527485438301603, 0.41603085251263439, 0.41678704822976786,
+        0.41754343975501496, 0.4183000253085134, 0.41905680310994409, 0.41981377137853582,
+        0.4205709283330693, 0.42132827219188085, 0.42208580117286731, 0.42284351349348986,
+        0.42360140737077828, 0.42435948102133486, 0.42511773266133918, 0.42587616050655192,
+        0.42663476277231915, 0.42739353767357624, 0.42815248342485268, 0.42891159824027603,
+        0.42967088033357537, 0.43043032791808689, 0.43118993920675691, 0.43194971241214691,
+        0.43270964574643689, 0.43346973742143041, 0.43422998564855836, 0.43499038863888334,
+        0.43575094460310337, 0.43651165175155704, 0.43727250829422692, 0.4380335124407439,
+        0.43879466240039189, 0.43955595638211137, 0.44031739259450431, 0.4410789692458375,
+        0.44184068454404757, 0.44260253669674487, 0.44336452391121783, 0.44412664439443666,
+        0.44488889635305839, 0.44565127799343068, 0.44641378752159555, 0.44717642314329464,
+        0.44793918306397262, 0.44870206548878189, 0.44946506862258606, 0.45022819066996528,
+        0.45099142983521961, 0.4517547843223737, 0.45251825233518045, 0.45328183207712602,
+        0.45404552175143365, 0.45480931956106752, 0.45557322370873765, 0.45633723239690388,
+        0.45710134382778006, 0.45786555620333791, 0.45862986772531211, 0.45939427659520382,
+        0.46015878101428492, 0.46092337918360282, 0.46168806930398421, 0.46245284957603938,
+        0.46321771820016627, 0.4639826733765553, 0.46474771330519299, 0.46551283618586664,
+        0.46627804021816793, 0.46704332360149803, 0.4678086845350713, 0.4685741212179193,
+        0.46933963184889566, 0.47010521462667998, 0.47087086774978215, 0.47163658941654613,
+        0.47240237782515498, 0.47316823117363466, 0.47393414765985836, 0.47470012548155033,
+        0.47546616283629095, 0.47623225792152035, 0.47699840893454271, 0.47776461407253062,
+        0.47853087153252954, 0.47929717951146167, 0.48006353620613007, 0.48082993981322358,
+        0.48159638852932052, 0.48236288055089305, 0.4831294140743112, 0.48389598729584765,
+        0.48466259841168169, 0.48542924561790313, 0.48619592711051707, 0.48696264108544796,
+        0.48772938573854385, 0.48849615926558032, 0.4892629598622652, 0.49002978572424272,
+        0.49079663504709758, 0.49156350602635912, 0.4923303968575059, 0.49309730573596983,
+        0.49386423085714004, 0.49463117041636773, 0.49539812260897004, 0.49616508563023448,
+        0.49693205767542276, 0.49769903693977569, 0.49846602161851694, 0.49923300990685759,
+        0.49999999999999994, 0.50076699009314229, 0.50153397838148306, 0.50230096306022431,
+        0.50306794232457719, 0.50383491436976546, 0.50460187739102991, 0.50536882958363227,
+        0.50613576914285996, 0.50690269426403012, 0.5076696031424941, 0.50843649397364088,
+        0.5092033649529023, 0.50997021427575728, 0.51073704013773469, 0.51150384073441968,
+        0.51227061426145604, 0.51303735891455193, 0.51380407288948282, 0.51457075438209676,
+        0.5153374015883182, 0.51610401270415229, 0.5168705859256888, 0.51763711944910695,
+        0.51840361147067948, 0.51917006018677636, 0.51993646379386982, 0.52070282048853833,
+        0.5214691284674704, 0.52223538592746932, 0.52300159106545729, 0.52376774207847954,
+        0.52453383716370905, 0.52529987451844962, 0.52606585234014158, 0.52683176882636529,
+        0.52759762217484496, 0.52836341058345382, 0.52912913225021785, 0.52989478537331991,
+        0.53066036815110429, 0.5314258787820807, 0.53219131546492859, 0.53295667639850186,
+        0.53372195978183201, 0.5344871638141333, 0.53525228669480696, 0.5360173266234447,
+        0.53678228179983367, 0.53754715042396062, 0.53831193069601579, 0.53907662081639707,
+        0.53984121898571502, 0.54060572340479618, 0.54137013227468789, 0.54213444379666198,
+        0.54289865617221988, 0.54366276760309606, 0.54442677629126224, 0.54519068043893248,
+        0.54595447824856624, 0.54671816792287387, 0.5474817476648195, 0.5482452156776263,
+        0.54900857016478033, 0.54977180933003467, 0.55053493137741383, 0.55129793451121811,
+        0.55206081693602727, 0.55282357685670525, 0.55358621247840434, 0.55434872200656926,
+        0.55511110364694149, 0.55587335560556328, 0.55663547608878217, 0.55739746330325501,
+        0.55815931545595232, 0.55892103075416244, 0.55968260740549558, 0.56044404361788858,
+        0.56120533759960811, 0.56196648755925604, 0.56272749170577308, 0.56348834824844296,
+        0.56424905539689652, 0.5650096113611166, 0.56577001435144159, 0.56653026257856953,
+        0.567290354253563, 0.56805028758785303, 0.56881006079324303, 0.56956967208191311,
+        0.57032911966642452, 0.57108840175972397, 0.57184751657514721, 0.57260646232642376,
+        0.57336523722768085, 0.57412383949344803, 0.57488226733866077, 0.57564051897866508,
+        0.57639859262922166, 0.57715648650651008, 0.57791419882713257, 0.57867172780811904,
+        0.57942907166693058, 0.58018622862146407, 0.58094319689005591, 0.5816999746914866,
+        0.58245656024498493, 0.58321295177023202, 0.5839691474873655, 0.58472514561698397,
+        0.58548094438015064, 0.58623654199839792, 0.58699193669373184, 0.5877471266886356,
+        0.58850211020607435, 0.58925688546949873, 0.59001145070284966, 0.59076580413056257,
+        0.59151994397757046, 0.59227386846930974, 0.59302757583172327, 0.59378106429126476,
+        0.59453433207490303, 0.59528737741012638, 0.59604019852494616, 0.59679279364790183,
+        0.5975451610080641, 0.59829729883504001, 0.59904920535897677, 0.59980087881056543,
+        0.60055231742104587, 0.6013035194222105, 0.60205448304640841, 0.60280520652654956,
+        0.60355568809610927, 0.60430592598913169, 0.60505591844023476, 0.60580566368461375,
+        0.60655515995804565, 0.60730440549689346, 0.6080533985381098, 0.60880213731924182,
+        0.60955062007843486, 0.61029884505443677, 0.6110468104866017, 0.61179451461489498,
+        0.61254195567989633, 0.61328913192280499, 0.61403604158544289, 0.61478268291025939,
+        0.61552905414033554, 0.61627515351938755, 0.61702097929177169, 0.61776652970248769,
+        0.61851180299718367, 0.61925679742215922, 0.62000151122437064, 0.62074594265143457,
+        0.62149008995163191, 0.62223395137391202, 0.62297752516789728, 0.62372080958388665,
+        0.62446380287286007, 0.62520650328648264, 0.62594890907710843, 0.62669101849778508,
+        0.62743282980225723, 0.6281743412449714, 0.62891555108107944, 0.62965645756644317,
+        0.63039705895763776, 0.63113735351195677, 0.63187733948741576, 0.63261701514275592,
+        0.63335637873744921, 0.63409542853170153, 0.63483416278645755, 0.63557257976340398,
+        0.63631067772497441, 0.63704845493435314, 0.6377859096554791, 0.63852304015304995,
+        0.6392598446925265, 0.63999632154013664, 0.64073246896287894, 0.64146828522852761,
+        0.64220376860563588, 0.64293891736354025, 0.6436737297723647, 0.64440820410302468,
+        0.64514233862723103, 0.64587613161749458, 0.64660958134712931, 0.64734268609025714,
+        0.64807544412181195, 0.64880785371754313, 0.64953991315402015, 0.65027162070863664,
+        0.65100297465961399, 0.65173397328600569, 0.65246461486770113, 0.65319489768543049,
+        0.65392482002076746, 0.65465438015613431, 0.65538357637480571, 0.65611240696091244,
+        0.6568408701994457, 0.65756896437626122, 0.65829668777808292, 0.65902403869250747,
+        0.65975101540800785, 0.66047761621393752, 0.66120383940053495, 0.66192968325892643,
+        0.66265514608113141, 0.66338022616006587, 0.66410492178954628, 0.66482923126429372,
+        0.6655531528799381, 0.66627668493302206, 0.66699982572100469, 0.66772257354226583,
+        0.66844492669611, 0.66916688348277065, 0.66988844220341348, 0.67060960116014112,
+        0.67133035865599711, 0.67205071299496943, 0.67277066248199446, 0.67349020542296179,
+        0.67420934012471723, 0.67492806489506751, 0.67564637804278349, 0.67636427787760534,
+        0.67708176271024523, 0.6777988308523919, 0.67851548061671496, 0.67923171031686824,
+        0.67994751826749411, 0.68066290278422714, 0.68137786218369856, 0.68209239478353989,
+        0.68280649890238698, 0.68352017285988353, 0.68423341497668611, 0.68494622357446711,
+        0.6856585969759188, 0.68637053350475785, 0.68708203148572888, 0.68779308924460858,
+        0.68850370510820913, 0.68921387740438278, 0.6899236044620255, 0.69063288461108119,
+        0.69134171618254481, 0.69205009750846747, 0.69275802692195942, 0.69346550275719432,
+        0.69417252334941315, 0.69487908703492818, 0.69558519215112691, 0.69629083703647576,
+        0.69699602003052397, 0.69770073947390809, 0.69840499370835518, 0.69910878107668672,
+        0.69981209992282334, 0.70051494859178787, 0.70121732542970916, 0.70191922878382695,
+        0.70262065700249487, 0.70332160843518454, 0.70402208143248934, 0.70472207434612877,
+        0.70542158552895184, 0.70612061333494147, 0.7068191561192172, 0.70751721223804076,
+        0.70821478004881855, 0.70891185791010614, 0.70960844418161206, 0.71030453722420117,
+        0.71100013539989981, 0.71169523707189786, 0.71238984060455435, 0.71308394436339984,
+        0.71377754671514093, 0.71447064602766475, 0.71516324067004133, 0.71585532901252857,
+        0.71654690942657595, 0.71723798028482788, 0.71792853996112771, 0.71861858683052204,
+        0.71930811926926363, 0.7199971356548166, 0.72068563436585831, 0.72137361378228493,
+        0.72206107228521454, 0.72274800825699093, 0.72343442008118697, 0.72412030614260992,
+        0.72480566482730335, 0.72549049452255188, 0.72617479361688542, 0.7268585605000818,
+        0.72754179356317183, 0.72822449119844201, 0.72890665179943848, 0.72958827376097202,
+        0.73026935547911997, 0.73094989535123123, 0.73162989177593007, 0.73230934315311891,
+        0.73298824788398298, 0.73366660437099418, 0.73434441101791381, 0.7350216662297977,
+        0.73569836841299885, 0.73637451597517134, 0.73705010732527498, 0.73772514087357799,
+        0.73839961503166096, 0.73907352821242145, 0.7397468788300765, 0.7404196653001669,
+        0.74109188603956133, 0.74176353946645923, 0.7424346240003955, 0.74310513806224321,
+        0.74377508007421789, 0.74444444845988156, 0.74511324164414561, 0.74578145805327489,
+        0.74644909611489196, 0.74711615425797995, 0.74778263091288621, 0.74844852451132726,
+        0.74911383348639082, 0.74977855627254086, 0.75044269130562036, 0.75110623702285528,
+        0.75176919186285873, 0.7524315542656338, 0.75309332267257756, 0.75375449552648544,
+        0.75441507127155361, 0.75507504835338324, 0.75573442521898526, 0.75639320031678137,
+        0.75705137209661078, 0.75770893900973157, 0.75836589950882483, 0.75902225204799967,
+        0.75967799508279477, 0.76033312707018341, 0.76098764646857719, 0.76164155173782833,
+        0.76229484133923431, 0.76294751373554237, 0.76359956739095058, 0.76425100077111419,
+        0.76490181234314736, 0.76555200057562733, 0.76620156393859895, 0.76685050090357643,
+        0.76749880994354847, 0.76814648953298148, 0.76879353814782281, 0.76943995426550416,
+        0.77008573636494648, 0.77073088292656156, 0.77137539243225794, 0.77201926336544191,
+        0.77266249421102318, 0.77330508345541737, 0.77394702958655004, 0.77458833109385972,
+        0.77522898646830241, 0.77586899420235378, 0.77650835279001362, 0.77714706072681006,
+        0.77778511650980098, 0.77842251863757994, 0.77905926561027805, 0.77969535592956785,
+        0.78033078809866796, 0.78096556062234468, 0.78159967200691693, 0.78223312076025975,
+        0.78286590539180656, 0.78349802441255423, 0.78412947633506569, 0.78476025967347363,
+        0.78539037294348357, 0.78601981466237847, 0.78664858334902099, 0.78727667752385788,
+        0.78790409570892272, 0.78853083642783961, 0.78915689820582768, 0.78978227956970293,
+        0.79040697904788226, 0.79103099517038777, 0.79165432646884915, 0.79227697147650766,
+        0.79289892872821943, 0.79352019676045882, 0.79414077411132267, 0.79476065932053197,
+        0.79537985092943697, 0.79599834748102039, 0.79661614751989995, 0.79723324959233222,
+        0.79784965224621662, 0.79846535403109831, 0.79908035349817108, 0.79969464920028233,
+        0.80030823969193432, 0.8009211235292899, 0.80153329927017414, 0.80214476547407787,
+        0.80275552070216272, 0.80336556351726229, 0.80397489248388676, 0.8045835061682266,
+        0.80519140313815485, 0.80579858196323095, 0.8064050412147048, 0.80701077946551902,
+        0.80761579529031335, 0.80822008726542682, 0.80882365396890188, 0.80942649398048805,
+        0.8100286058816446, 0.81062998825554367, 0.81123063968707498, 0.81183055876284738,
+        0.81242974407119317, 0.81302819420217176, 0.81362590774757193, 0.8142228833009163,
+        0.81481911945746355, 0.81541461481421218, 0.81600936796990453, 0.81660337752502865,
+        0.81719664208182263, 0.81778916024427806, 0.81838093061814221, 0.81897195181092197,
+        0.81956222243188792, 0.82015174109207578, 0.82074050640429153, 0.82132851698311349,
+        0.82191577144489569, 0.82250226840777196, 0.82308800649165814, 0.82367298431825597,
+        0.82425720051105622, 0.82484065369534165, 0.82542334249819038, 0.82600526554847975,
+        0.82658642147688832, 0.82716680891590022, 0.82774642649980779, 0.82832527286471436,
+        0.82890334664853937, 0.82948064649101871, 0.83005717103371013, 0.83063291891999613,
+        0.831207888795086, 0.83178207930601977, 0.83235548910167245, 0.83292811683275469,
+        0.83349996115181868, 0.83407102071325934, 0.83464129417331789, 0.83521078019008654,
+        0.83577947742350922, 0.83634738453538637, 0.83691450018937807, 0.83748082305100602,
+        0.83804635178765796, 0.83861108506859017, 0.83917502156493062, 0.83973815994968248,
+        0.84030049889772651, 0.84086203708582485, 0.84142277319262404, 0.84198270589865776,
+        0.84254183388635018, 0.84310015584001929, 0.84365767044587958, 0.84421437639204511,
+        0.84477027236853353, 0.84532535706726719, 0.84587962918207882, 0.84643308740871237,
+        0.84698573044482695, 0.84753755699000033, 0.84808856574573155, 0.8486387554154432,
+        0.84918812470448635, 0.84973667232014194, 0.85028439697162406, 0.85083129737008423,
+        0.85137737222861254, 0.85192262026224241, 0.85246704018795239, 0.85301063072466987,
+        0.85355339059327373, 0.8540953185165977, 0.85463641321943273, 0.8551766734285311,
+        0.85571609787260827, 0.85625468528234605, 0.85679243439039676, 0.85732934393138449,
+        0.8578654126419093, 0.85840063926054977, 0.8589350225278658, 0.85946856118640214,
+        0.86000125398069083, 0.860533099657254, 0.86106409696460762, 0.86159424465326373,
+        0.86212354147573333, 0.86265198618653038, 0.86317957754217289, 0.86370631430118783,
+        0.86423219522411254, 0.86475721907349845, 0.8652813846139138, 0.86580469061194631,
+        0.86632713583620635, 0.86684871905733019, 0.86736943904798181, 0.86788929458285669,
+        0.8684082844386849, 0.86892640739423288, 0.86944366223030745, 0.8699600477297581,
+        0.87047556267747939, 0.87099020586041553, 0.87150397606756091, 0.87201687208996459,
+        0.87252889272073297, 0.87304003675503195, 0.87355030299008996, 0.8740596902252018,
+        0.87456819726172963, 0.87507582290310748, 0.87558256595484329, 0.87608842522452124,
+        0.87659339952180626, 0.87709748765844453, 0.87760068844826822, 0.87810300070719727,
+        0.87860442325324228, 0.87910495490650753, 0.87960459448919404, 0.88010334082560115,
+        0.88060119274213089, 0.88109814906728945, 0.88159420863169058, 0.88208937026805834,
+        0.88258363281122953, 0.88307699509815629, 0.88356945596791014, 0.88406101426168271,
+        0.88455166882278968, 0.88504141849667395, 0.8855302621309068, 0.88601819857519226,
+        0.88650522668136844, 0.88699134530341128, 0.88747655329743691, 0.88796084952170384,
+        0.88844423283661622, 0.88892670210472646, 0.88940825619073793, 0.88988889396150717,
+        0.89036861428604719, 0.89084741603552953, 0.89132529808328775, 0.89180225930481916,
+        0.89227829857778751, 0.89275341478202697, 0.89322760679954283, 0.89370087351451555,
+        0.89417321381330317, 0.89464462658444288, 0.89511511071865502, 0.89558466510884505,
+        0.89605328865010603, 0.89652098023972182, 0.89698773877716853, 0.8974535631641184,
+        0.89791845230444167, 0.89838240510420941, 0.89884542047169547, 0.89930749731738047,
+        0.89976863455395262, 0.90022883109631135, 0.90068808586157012, 0.90114639776905769,
+        0.90160376574032242, 0.90206018869913285, 0.90251566557148166, 0.9029701952855882,
+        0.90342377677189967, 0.90387640896309507, 0.90432809079408749, 0.90477882120202568,
+        0.90522859912629738, 0.90567742350853186, 0.90612529329260183, 0.90657220742462674,
+        0.90701816485297426, 0.90746316452826314, 0.90790720540336678, 0.90835028643341387,
+        0.90879240657579174, 0.90923356479014927, 0.9096737600383985, 0.91011299128471723,
+        0.91055125749555232, 0.91098855763962061, 0.9114248906879131, 0.91186025561369566,
+        0.91229465139251253, 0.91272807700218872, 0.91316053142283171, 0.91359201363683451,
+        0.91402252262887784, 0.91445205738593249, 0.91488061689726141, 0.91530820015442316,
+        0.91573480615127267, 0.91616043388396484, 0.91658508235095659, 0.91700875055300901,
+        0.91743143749319001, 0.9178531421768763, 0.918273863611756, 0.91869360080783091,
+        0.91911235277741898, 0.91953011853515632, 0.91994689709799982, 0.92036268748522909,
+        0.92077748871844922, 0.92119129982159298, 0.92160411982092261, 0.92201594774503315,
+        0.92242678262485356, 0.92283662349364948, 0.92324546938702601, 0.92365331934292927,
+        0.92406017240164862, 0.92446602760581986, 0.92487088400042627, 0.92527474063280168,
+        0.9256775965526326, 0.92607945081195986, 0.92648030246518176, 0.92688015056905571,
+        0.92727899418270021, 0.9276768323675979, 0.92807366418759729, 0.92846948870891433,
+        0.92886430500013595, 0.92925811213222143, 0.92965090917850413, 0.93004269521469507,
+        0.9304334693188836, 0.93082323057154071, 0.93121197805552025, 0.93159971085606208,
+        0.93198642806079335, 0.93237212875973119, 0.93275681204528449, 0.93314047701225644,
+        0.93352312275784644, 0.93390474838165161, 0.9342853529856705, 0.93466493567430331,
+        0.93504349555435562, 0.93542103173503954, 0.93579754332797549, 0.93617302944719571,
+        0.93654748920914499, 0.93692092173268338, 0.93729332613908811, 0.93766470155205539,
+        0.93803504709770325, 0.93840436190457277, 0.93877264510363057, 0.93913989582827073,
+        0.93950611321431676, 0.93987129640002365, 0.94023544452608032, 0.94059855673561099,
+        0.94096063217417747, 0.9413216699897814, 0.94168166933286579, 0.94204062935631749,
+        0.94239854921546895, 0.94275542806809987, 0.94311126507444021, 0.9434660593971711,
+        0.94381981020142691, 0.94417251665479807, 0.94452417792733234, 0.94487479319153633,
+        0.94522436162237899, 0.94557288239729165, 0.94592035469617131, 0.94626677770138223,
+        0.94661215059775761, 0.94695647257260163, 0.94729974281569129, 0.94764196051927874,
+        0.94798312487809255, 0.94832323508934013, 0.9486622903527091, 0.94900028987036988,
+        0.94933723284697691, 0.94967311848967073, 0.95000794600808014, 0.95034171461432337,
+        0.9506744235230109, 0.95100607195124653, 0.95133665911862941, 0.95166618424725591,
+        0.95199464656172172, 0.95232204528912301, 0.95264837965905935, 0.95297364890363423,
+        0.95329785225745767, 0.95362098895764791, 0.95394305824383308, 0.95426405935815306,
+        0.95458399154526119, 0.95490285405232611, 0.95522064612903357, 0.95553736702758818,
+        0.95585301600271488, 0.95616759231166137, 0.95648109521419911, 0.9567935239726254,
+        0.95710487785176535, 0.95741515611897299, 0.95772435804413392, 0.9580324828996658,
+        0.9583395299605213, 0.95864549850418901, 0.9589503878106953, 0.95925419716260607,
+        0.95955692584502894, 0.95985857314561374, 0.96015913835455524, 0.96045862076459465,
+        0.9607570196710209, 0.96105433437167254, 0.96135056416693931, 0.96164570835976382,
+        0.96193976625564337, 0.96223273716263136, 0.96252462039133868, 0.96281541525493641,
+        0.96310512106915569, 0.96339373715229093, 0.9636812628252005, 0.96396769741130894,
+        0.96425304023660774, 0.96453729062965787, 0.96482044792159061, 0.96510251144610959,
+        0.96538348053949186, 0.96566335454059016, 0.96594213279083396, 0.96621981463423123,
+        0.96649639941736942, 0.96677188648941814, 0.96704627520212938, 0.96731956490984028,
+        0.96759175496947381, 0.96786284474054018, 0.96813283358513913, 0.96840172086796084,
+        0.96866950595628742, 0.96893618821999494, 0.96920176703155403, 0.96946624176603224,
+        0.96972961180109496, 0.96999187651700691, 0.97025303529663409, 0.97051308752544463,
+        0.97077203259151035, 0.97102986988550866, 0.97128659880072343, 0.97154221873304669,
+        0.97179672908098014, 0.97205012924563627, 0.97230241863074007, 0.9725535966426303,
+        0.97280366269026053, 0.97305261618520167, 0.97330045654164177, 0.97354718317638855,
+        0.97379279550887055, 0.97403729296113806, 0.97428067495786519, 0.97452294092635028,
+        0.97476409029651834, 0.9750041225009215, 0.97524303697474091, 0.97548083315578749,
+        0.97571751048450417, 0.97595306840396612, 0.97618750635988283, 0.97642082380059936,
+        0.97665302017709688, 0.97688409494299511, 0.97711404755455278, 0.97734287747066917,
+        0.97757058415288534, 0.97779716706538555, 0.9780226256749982, 0.97824695945119755,
+        0.97847016786610441, 0.97869225039448793, 0.97891320651376645, 0.97913303570400889,
+        0.97935173744793569, 0.97956931123092095, 0.9797857565409922, 0.98000107286883287,
+        0.98021525970778289, 0.98042831655383977, 0.98064024290566032, 0.98085103826456121,
+        0.98106070213452079, 0.98126923402217958, 0.98147663343684188, 0.98168289989047697,
+        0.98188803289771998, 0.98209203197587291, 0.98229489664490632, 0.98249662642746016,
+        0.9826972208488447, 0.98289667943704173, 0.98309500172270625, 0.98329218723916645,
+        0.98348823552242604, 0.98368314611116425, 0.98387691854673776, 0.98406955237318117,
+        0.98426104713720863, 0.98445140238821449, 0.98464061767827427, 0.98482869256214611,
+        0.98501562659727204, 0.9852014193437777, 0.98538607036447512, 0.98556957922486255,
+        0.98575194549312584, 0.98593316874013959, 0.98611324853946813, 0.98629218446736611,
+        0.98646997610277998, 0.98664662302734918, 0.98682212482540588, 0.98699648108397797,
+        0.98716969139278787, 0.98734175534425539, 0.98751267253349706, 0.98768244255832849,
+        0.98785106501926423, 0.98801853951951957, 0.98818486566501051, 0.98835004306435592,
+        0.98851407132887714, 0.98867695007260004, 0.98883867891225496, 0.98899925746727857,
+        0.98915868535981377, 0.98931696221471155, 0.98947408765953115, 0.98963006132454101,
+        0.98978488284272026, 0.98993855184975876, 0.99009106798405866, 0.99024243088673469,
+        0.99039264020161522, 0.9905416955752433, 0.99068959665687728, 0.99083634309849156,
+        0.99098193455477768, 0.99112637068314469, 0.99126965114372068, 0.99141177559935256,
+        0.9915527437156082, 0.99169255516077559, 0.99183120960586513, 0.99196870672460946,
+        0.99210504619346451, 0.99224022769161047, 0.9923742509009521, 0.99250711550611992,
+        0.99263882119447056, 0.99276936765608803, 0.99289875458378374, 0.99302698167309766,
+        0.99315404862229928, 0.99327995513238765, 0.99340470090709276, 0.99352828565287554,
+        0.99365070907892927, 0.99377197089717961, 0.99389207082228603, 0.99401100857164182,
+        0.99412878386537473, 0.99424539642634824, 0.99436084598016183, 0.99447513225515149,
+        0.99458825498239056, 0.99470021389569019, 0.99481100873160044, 0.99492063922941032,
+        0.99502910513114851, 0.99513640618158461, 0.99524254212822849, 0.99534751272133226,
+        0.99545131771388995, 0.9955539568616385, 0.99565542992305778, 0.99575573665937189,
+        0.99585487683454976, 0.99595285021530466, 0.9960496565710959, 0.99614529567412857,
+        0.99623976729935504, 0.99633307122447401, 0.99642520722993255, 0.99651617509892576,
+        0.99660597461739719, 0.99669460557404033, 0.99678206776029765, 0.99686836097036235,
+        0.99695348500117809, 0.99703743965243974, 0.99712022472659401, 0.9972018400288396,
+        0.99728228536712771, 0.99736156055216285, 0.99743966539740281, 0.99751659971905937,
+        0.99759236333609835, 0.99766695607024114, 0.99774037774596347, 0.9978126281904971,
+        0.99788370723382991, 0.99795361470870581, 0.99802235045062604, 0.99808991429784855,
+        0.99815630609138895, 0.99822152567502132, 0.99828557289527742, 0.99834844760144803,
+        0.99841014964558283, 0.99847067888249108, 0.99853003516974148, 0.99858821836766309,
+        0.9986452283393451, 0.9987010649506376, 0.99875572807015178, 0.99880921756925978,
+        0.99886153332209582, 0.99891267520555582, 0.99896264309929794, 0.99901143688574312,
+        0.99905905645007453, 0.99910550168023904, 0.99915077246694639, 0.99919486870367002,
+        0.99923779028664739, 0.99927953711487971, 0.99932010909013258, 0.99935950611693647,
+        0.9993977281025862, 0.99943477495714172, 0.99947064659342844, 0.99950534292703663,
+        0.99953886387632274, 0.99957120936240851, 0.99960237930918194, 0.99963237364329727,
+        0.99966119229417472, 0.99968883519400142, 0.99971530227773087, 0.99974059348308342,
+        0.99976470875054657, 0.99978764802337461, 0.99980941124758926, 0.99982999837197961,
+        0.99984940934810207, 0.99986764413028084, 0.99988470267560769, 0.99990058494394218,
+        0.99991529089791165, 0.99992882050291199, 0.99994117372710623, 0.99995235054142639,
+        0.99996235091957231, 0.99997117483801201, 0.999978822275982, 0.99998529321548713,
+        0.99999058764130055, 0.99999470554096415, 0.9999976469047881, 0.99999941172585094,
+        1, 0.99999941172585094, 0.9999976469047881, 0.99999470554096415,
+        0.99999058764130055, 0.99998529321548713, 0.999978822275982, 0.99997117483801201,
+        0.99996235091957231, 0.9999523505414265, 0.99994117372710623, 0.99992882050291199,
+        0.99991529089791165, 0.99990058494394218, 0.99988470267560769, 0.99986764413028084,
+        0.99984940934810207, 0.99982999837197961, 0.99980941124758926, 0.99978764802337461,
+        0.99976470875054657, 0.99974059348308342, 0.99971530227773087, 0.99968883519400142,
+        0.99966119229417472, 0.99963237364329727, 0.99960237930918194, 0.99957120936240851,
+        0.99953886387632274, 0.99950534292703663, 0.99947064659342844, 0.99943477495714172,
+        0.9993977281025862, 0.99935950611693647, 0.99932010909013269, 0.99927953711487971,
+        0.99923779028664739, 0.99919486870367002, 0.99915077246694639, 0.99910550168023904,
+        0.99905905645007453, 0.99901143688574312, 0.99896264309929794, 0.99891267520555582,
+        0.99886153332209582, 0.99880921756925978, 0.99875572807015178, 0.9987010649506376,
+        0.9986452283393451, 0.99858821836766309, 0.99853003516974148, 0.99847067888249108,
+        0.99841014964558283, 0.99834844760144803, 0.99828557289527742, 0.99822152567502132,
+        0.99815630609138895, 0.99808991429784855, 0.99802235045062604, 0.99795361470870581,
+        0.99788370723382991, 0.9978126281904971, 0.99774037774596347, 0.99766695607024114,
+        0.99759236333609846, 0.99751659971905937, 0.99743966539740281, 0.99736156055216285,
+        0.99728228536712771, 0.9972018400288396, 0.99712022472659401, 0.99703743965243974,
+        0.99695348500117809, 0.99686836097036235, 0.99678206776029765, 0.99669460557404033,
+        0.99660597461739731, 0.99651617509892576, 0.99642520722993255, 0.99633307122447401,
+        0.99623976729935504, 0.99614529567412868, 0.9960496565710959, 0.99595285021530466,
+        0.99585487683454976, 0.995755736659372, 0.99565542992305778, 0.9955539568616385,
+        0.99545131771388995, 0.99534751272133226, 0.99524254212822849, 0.99513640618158461,
+        0.99502910513114862, 0.99492063922941032, 0.99481100873160044, 0.99470021389569019,
+        0.99458825498239056, 0.99447513225515149, 0.99436084598016183, 0.99424539642634835,
+        0.99412878386537473, 0.99401100857164182, 0.99389207082228603, 0.99377197089717961,
+        0.99365070907892927, 0.99352828565287554, 0.99340470090709276, 0.99327995513238776,
+        0.99315404862229939, 0.99302698167309766, 0.99289875458378374, 0.99276936765608803,
+        0.99263882119447067, 0.99250711550611992, 0.9923742509009521, 0.99224022769161047,
+        0.99210504619346462, 0.99196870672460946, 0.99183120960586513, 0.99169255516077559,
+        0.9915527437156082, 0.99141177559935267, 0.99126965114372068, 0.9911263706831448,
+        0.99098193455477768, 0.99083634309849156, 0.99068959665687739, 0.9905416955752433,
+        0.99039264020161522, 0.99024243088673469, 0.99009106798405866, 0.98993855184975887,
+        0.98978488284272026, 0.98963006132454101, 0.98947408765953115, 0.98931696221471155,
+        0.98915868535981377, 0.98899925746727857, 0.98883867891225496, 0.98867695007260004,
+        0.98851407132887714, 0.98835004306435592, 0.98818486566501063, 0.98801853951951957,
+        0.98785106501926423, 0.98768244255832849, 0.98751267253349706, 0.98734175534425539,
+        0.98716969139278787, 0.98699648108397797, 0.98682212482540588, 0.98664662302734918,
+        0.98646997610278009, 0.98629218446736622, 0.98611324853946813, 0.9859331687401397,
+        0.98575194549312595, 0.98556957922486266, 0.98538607036447512, 0.9852014193437777,
+        0.98501562659727204, 0.98482869256214622, 0.98464061767827427, 0.98445140238821449,
+        0.98426104713720863, 0.98406955237318128, 0.98387691854673776, 0.98368314611116436,
+        0.98348823552242615, 0.98329218723916656, 0.98309500172270625, 0.98289667943704184,
+        0.9826972208488447, 0.98249662642746016, 0.98229489664490632, 0.98209203197587291,
+        0.98188803289771998, 0.98168289989047697, 0.98147663343684199, 0.98126923402217958,
+        0.98106070213452079, 0.98085103826456121, 0.98064024290566032, 0.98042831655383977,
+        0.98021525970778289, 0.98000107286883298, 0.97978575654099231, 0.97956931123092095,
+        0.9793517374479358, 0.97913303570400889, 0.97891320651376645, 0.97869225039448793,
+        0.97847016786610452, 0.97824695945119755, 0.9780226256749982, 0.97779716706538555,
+        0.97757058415288545, 0.97734287747066917, 0.97711404755455278, 0.97688409494299511,
+        0.97665302017709699, 0.97642082380059936, 0.97618750635988294, 0.97595306840396612,
+        0.97571751048450417, 0.9754808331557876, 0.97524303697474091, 0.9750041225009215,
+        0.97476409029651845, 0.97452294092635028, 0.97428067495786519, 0.97403729296113817,
+        0.97379279550887055, 0.97354718317638866, 0.97330045654164188, 0.97305261618520178,
+        0.97280366269026064, 0.9725535966426303, 0.97230241863074007, 0.97205012924563639,
+        0.97179672908098014, 0.97154221873304669, 0.97128659880072354, 0.97102986988550866,
+        0.97077203259151035, 0.97051308752544463, 0.9702530352966342, 0.96999187651700702,
+        0.96972961180109496, 0.96946624176603224, 0.96920176703155414, 0.96893618821999494,
+        0.96866950595628754, 0.96840172086796084, 0.96813283358513913, 0.96786284474054018,
+        0.96759175496947392, 0.96731956490984039, 0.96704627520212938, 0.96677188648941814,
+        0.96649639941736942, 0.96621981463423123, 0.96594213279083407, 0.96566335454059016,
+        0.96538348053949186, 0.96510251144610959, 0.96482044792159061, 0.96453729062965787,
+        0.96425304023660785, 0.96396769741130894, 0.9636812628252005, 0.96339373715229093,
+        0.96310512106915569, 0.96281541525493641, 0.96252462039133879, 0.96223273716263136,
+        0.96193976625564348, 0.96164570835976382, 0.96135056416693931, 0.96105433437167265,
+        0.9607570196710209, 0.96045862076459476, 0.96015913835455535, 0.95985857314561374,
+        0.95955692584502894, 0.95925419716260607, 0.9589503878106953, 0.95864549850418901,
+        0.9583395299605213, 0.95803248289966592, 0.95772435804413392, 0.95741515611897299,
+        0.95710487785176535, 0.9567935239726254, 0.95648109521419911, 0.95616759231166149,
+        0.95585301600271499, 0.95553736702758818, 0.95522064612903357, 0.95490285405232611,
+        0.95458399154526119, 0.95426405935815306, 0.95394305824383308, 0.95362098895764791,
+        0.95329785225745778, 0.95297364890363423, 0.95264837965905946, 0.95232204528912312,
+        0.95199464656172172, 0.95166618424725602, 0.95133665911862941, 0.95100607195124665,
+        0.95067442352301101, 0.95034171461432337, 0.95000794600808014, 0.94967311848967073,
+        0.94933723284697702, 0.94900028987037, 0.9486622903527091, 0.94832323508934024,
+        0.94798312487809255, 0.94764196051927874, 0.9472997428156914, 0.94695647257260163,
+        0.94661215059775761, 0.94626677770138234, 0.94592035469617142, 0.94557288239729176,
+        0.94522436162237899, 0.94487479319153644, 0.94452417792733234, 0.94417251665479818,
+        0.94381981020142702, 0.9434660593971711, 0.94311126507444032, 0.94275542806809998,
+        0.94239854921546895, 0.94204062935631749, 0.9416816693328659, 0.94132166998978151,
+        0.94096063217417747, 0.9405985567356111, 0.94023544452608043, 0.93987129640002376,
+        0.93950611321431676, 0.93913989582827084, 0.93877264510363068, 0.93840436190457288,
+        0.93803504709770325, 0.9376647015520555, 0.93729332613908811, 0.93692092173268349,
+        0.9365474892091451, 0.93617302944719571, 0.93579754332797549, 0.93542103173503954,
+        0.93504349555435573, 0.93466493567430331, 0.9342853529856705, 0.93390474838165161,
+        0.93352312275784644, 0.93314047701225655, 0.93275681204528449, 0.9323721287597313,
+        0.93198642806079346, 0.93159971085606208, 0.93121197805552036, 0.93082323057154071,
+        0.9304334693188836, 0.93004269521469518, 0.92965090917850424, 0.92925811213222143,
+        0.92886430500013606, 0.92846948870891444, 0.92807366418759729, 0.92767683236759813,
+        0.92727899418270021, 0.92688015056905582, 0.92648030246518187, 0.92607945081195986,
+        0.92567759655263271, 0.92527474063280168, 0.92487088400042627, 0.92446602760581986,
+        0.92406017240164862, 0.92365331934292927, 0.92324546938702601, 0.92283662349364959,
+        0.92242678262485356, 0.92201594774503326, 0.92160411982092272, 0.92119129982159298,
+        0.92077748871844922, 0.92036268748522909, 0.91994689709799982, 0.91953011853515632,
+        0.91911235277741909, 0.91869360080783102, 0.918273863611756, 0.9178531421768763,
+        0.91743143749319001, 0.91700875055300912, 0.9165850823509567, 0.91616043388396484,
+        0.91573480615127267, 0.91530820015442327, 0.91488061689726152, 0.91445205738593249,
+        0.91402252262887784, 0.91359201363683451, 0.91316053142283182, 0.91272807700218883,
+        0.91229465139251265, 0.91186025561369577, 0.91142489068791321, 0.91098855763962083,
+        0.91055125749555232, 0.91011299128471734, 0.90967376003839862, 0.90923356479014938,
+        0.90879240657579186, 0.90835028643341398, 0.907907205403367, 0.90746316452826337,
+        0.90701816485297426, 0.90657220742462674, 0.90612529329260194, 0.90567742350853186,
+        0.90522859912629738, 0.9047788212020258, 0.9043280907940876, 0.90387640896309518,
+        0.90342377677189978, 0.9029701952855882, 0.90251566557148177, 0.90206018869913296,
+        0.90160376574032242, 0.90114639776905792, 0.90068808586157023, 0.90022883109631135,
+        0.89976863455395262, 0.89930749731738047, 0.89884542047169558, 0.89838240510420952,
+        0.89791845230444178, 0.89745356316411851, 0.89698773877716864, 0.89652098023972182,
+        0.89605328865010614, 0.89558466510884516, 0.89511511071865502, 0.89464462658444299,
+        0.89417321381330317, 0.89370087351451577, 0.89322760679954305, 0.89275341478202708,
+        0.89227829857778762, 0.89180225930481916, 0.89132529808328798, 0.89084741603552975,
+        0.8903686142860473, 0.88988889396150728, 0.88940825619073816, 0.88892670210472657,
+        0.88844423283661622, 0.88796084952170395, 0.88747655329743691, 0.88699134530341139,
+        0.88650522668136855, 0.88601819857519226, 0.88553026213090691, 0.88504141849667406,
+        0.8845516688227899, 0.88406101426168282, 0.88356945596791026, 0.88307699509815651,
+        0.88258363281122953, 0.88208937026805834, 0.88159420863169058, 0.88109814906728956,
+        0.88060119274213089, 0.88010334082560115, 0.87960459448919415, 0.87910495490650764,
+        0.87860442325324239, 0.87810300070719727, 0.87760068844826833, 0.87709748765844475,
+        0.87659339952180626, 0.87608842522452135, 0.87558256595484329, 0.87507582290310748,
+        0.87456819726172963, 0.8740596902252018, 0.87355030299009007, 0.87304003675503195,
+        0.87252889272073308, 0.87201687208996459, 0.87150397606756091, 0.87099020586041553,
+        0.87047556267747961, 0.86996004772975821, 0.86944366223030767, 0.86892640739423299,
+        0.86840828443868501, 0.8678892945828568, 0.86736943904798181, 0.86684871905733019,
+        0.86632713583620635, 0.86580469061194631, 0.8652813846139138, 0.86475721907349845,
+        0.86423219522411276, 0.86370631430118794, 0.86317957754217289, 0.8626519861865305,
+        0.86212354147573356, 0.86159424465326384, 0.86106409696460773, 0.860533099657254,
+        0.86000125398069094, 0.85946856118640225, 0.8589350225278658, 0.85840063926054988,
+        0.85786541264190941, 0.85732934393138449, 0.85679243439039687, 0.85625468528234616,
+        0.85571609787260838, 0.85517667342853121, 0.85463641321943284, 0.85409531851659781,
+        0.85355339059327384, 0.85301063072466987, 0.85246704018795261, 0.85192262026224252,
+        0.85137737222861265, 0.85083129737008434, 0.85028439697162428, 0.84973667232014205,
+        0.84918812470448657, 0.84863875541544331, 0.84808856574573155, 0.84753755699000055,
+        0.84698573044482695, 0.84643308740871248, 0.84587962918207893, 0.8453253570672673,
+        0.84477027236853353, 0.84421437639204533, 0.84365767044587969, 0.84310015584001929,
+        0.84254183388635018, 0.84198270589865776, 0.84142277319262404, 0.84086203708582485,
+        0.84030049889772662, 0.83973815994968248, 0.83917502156493073, 0.83861108506859028,
+        0.83804635178765796, 0.83748082305100613, 0.83691450018937807, 0.83634738453538648,
+        0.83577947742350933, 0.83521078019008654, 0.83464129417331812, 0.83407102071325934,
+        0.83349996115181879, 0.83292811683275481, 0.83235548910167245, 0.83178207930601999,
+        0.831207888795086, 0.83063291891999613, 0.83005717103371024, 0.82948064649101871,
+        0.82890334664853937, 0.82832527286471458, 0.82774642649980779, 0.82716680891590033,
+        0.82658642147688854, 0.82600526554847986, 0.82542334249819049, 0.82484065369534154,
+        0.82425720051105611, 0.8236729843182562, 0.82308800649165836, 0.82250226840777207,
+        0.82191577144489569, 0.82132851698311338, 0.82074050640429186, 0.820151741092076,
+        0.81956222243188792, 0.81897195181092208, 0.8183809306181421, 0.81778916024427795,
+        0.81719664208182297, 0.81660337752502876, 0.81600936796990453, 0.81541461481421229,
+        0.81481911945746344, 0.81422288330091663, 0.81362590774757226, 0.81302819420217187,
+        0.81242974407119317, 0.81183055876284727, 0.81123063968707487, 0.810629988255544,
+        0.81002860588164471, 0.80942649398048827, 0.80882365396890199, 0.80822008726542682,
+        0.80761579529031358, 0.80701077946551936, 0.80640504121470502, 0.80579858196323095,
+        0.80519140313815463, 0.80458350616822649, 0.80397489248388698, 0.8033655635172624,
+        0.80275552070216283, 0.80214476547407809, 0.80153329927017403, 0.80092112352929024,
+        0.80030823969193465, 0.79969464920028233, 0.79908035349817119, 0.7984653540310982,
+        0.79784965224621662, 0.79723324959233244, 0.79661614751990006, 0.79599834748102061,
+        0.79537985092943719, 0.79476065932053186, 0.79414077411132289, 0.79352019676045915,
+        0.79289892872821954, 0.79227697147650766, 0.79165432646884915, 0.79103099517038766,
+        0.79040697904788249, 0.78978227956970293, 0.78915689820582791, 0.78853083642783983,
+        0.78790409570892261, 0.78727667752385821, 0.78664858334902132, 0.78601981466237869,
+        0.78539037294348368, 0.78476025967347351, 0.78412947633506569, 0.78349802441255445,
+        0.78286590539180678, 0.78223312076025975, 0.78159967200691705, 0.78096556062234468,
+        0.78033078809866829, 0.77969535592956829, 0.77905926561027816, 0.77842251863758005,
+        0.77778511650980109, 0.77714706072680995, 0.77650835279001396, 0.77586899420235378,
+        0.77522898646830241, 0.77458833109385994, 0.77394702958655004, 0.77330508345541771,
+        0.7726624942110234, 0.77201926336544213, 0.77137539243225794, 0.77073088292656178,
+        0.77008573636494637, 0.76943995426550438, 0.76879353814782281, 0.7681464895329817,
+        0.76749880994354869, 0.76685050090357643, 0.76620156393859928, 0.76555200057562767,
+        0.76490181234314747, 0.7642510007711143, 0.76359956739095058, 0.76294751373554226,
+        0.76229484133923475, 0.76164155173782833, 0.76098764646857719, 0.76033312707018363,
+        0.75967799508279477, 0.75902225204799989, 0.75836589950882516, 0.75770893900973157,
+        0.75705137209661089, 0.75639320031678148, 0.75573442521898504, 0.75507504835338368,
+        0.75441507127155361, 0.75375449552648544, 0.75309332267257767, 0.75243155426563368,
+        0.75176919186285907, 0.75110623702285562, 0.75044269130562058, 0.74977855627254097,
+        0.74911383348639093, 0.74844852451132715, 0.74778263091288655, 0.74711615425798006,
+        0.74644909611489207, 0.745781458053275, 0.7451132416441455, 0.74444444845988189,
+        0.74377508007421822, 0.74310513806224332, 0.74243462400039562, 0.74176353946645934,
+        0.74109188603956122, 0.74041966530016723, 0.73974687883007673, 0.73907352821242167,
+        0.73839961503166107, 0.73772514087357788, 0.73705010732527532, 0.73637451597517156,
+        0.73569836841299896, 0.73502166622979792, 0.73434441101791392, 0.73366660437099407,
+        0.73298824788398331, 0.73230934315311913, 0.73162989177593019, 0.73094989535123145,
+        0.73026935547911997, 0.72958827376097235, 0.72890665179943881, 0.72822449119844213,
+        0.72754179356317195, 0.72685856050008191, 0.72617479361688531, 0.72549049452255221,
+        0.72480566482730346, 0.72412030614261003, 0.72343442008118708, 0.72274800825699081,
+        0.72206107228521488, 0.72137361378228526, 0.72068563436585853, 0.71999713565481671,
+        0.71930811926926386, 0.71861858683052193, 0.71792853996112793, 0.71723798028482799,
+        0.71654690942657606, 0.71585532901252868, 0.71516324067004122, 0.71447064602766508,
+        0.71377754671514126, 0.71308394436339995, 0.71238984060455446, 0.71169523707189797,
+        0.71100013539989981, 0.7103045372242015, 0.70960844418161217, 0.70891185791010625,
+        0.70821478004881855, 0.70751721223804076, 0.70681915611921753, 0.70612061333494158,
+        0.70542158552895207, 0.70472207434612888, 0.70402208143248934, 0.70332160843518443,
+        0.70262065700249521, 0.70191922878382718, 0.70121732542970938, 0.70051494859178787,
+        0.69981209992282334, 0.69910878107668706, 0.6984049937083554, 0.69770073947390832,
+        0.69699602003052408, 0.69629083703647576, 0.69558519215112691, 0.69487908703492851,
+        0.69417252334941337, 0.69346550275719443, 0.69275802692195942, 0.69205009750846747,
+        0.69134171618254514, 0.69063288461108141, 0.68992360446202572, 0.68921387740438289,
+        0.68850370510820913, 0.68779308924460847, 0.68708203148572922, 0.68637053350475807,
+        0.68565859697591891, 0.68494622357446711, 0.68423341497668611, 0.68352017285988342,
+        0.6828064989023872, 0.68209239478354011, 0.68137786218369867, 0.68066290278422714,
+        0.679947518267494, 0.67923171031686858, 0.67851548061671518, 0.67779883085239201,
+        0.67708176271024523, 0.67636427787760534, 0.67564637804278349, 0.67492806489506774,
+        0.67420934012471745, 0.6734902054229619, 0.67277066248199446, 0.67205071299496932,
+        0.67133035865599744, 0.67060960116014134, 0.66988844220341348, 0.66916688348277065,
+        0.66844492669611, 0.66772257354226572, 0.66699982572100491, 0.66627668493302228,
+        0.66555315287993833, 0.66482923126429372, 0.66410492178954617, 0.66338022616006609,
+        0.66265514608113163, 0.66192968325892654, 0.66120383940053495, 0.66047761621393763,
+        0.65975101540800773, 0.6590240386925077, 0.65829668777808314, 0.65756896437626122,
+        0.6568408701994457, 0.65611240696091233, 0.65538357637480604, 0.65465438015613453,
+        0.65392482002076757, 0.65319489768543049, 0.65246461486770113, 0.65173397328600546,
+        0.65100297465961421, 0.65027162070863687, 0.64953991315402027, 0.64880785371754313,
+        0.64807544412181184, 0.64734268609025747, 0.64660958134712954, 0.6458761316174948,
+        0.64514233862723125, 0.64440820410302468, 0.6436737297723647, 0.64293891736354047,
+        0.6422037686056361, 0.64146828522852772, 0.64073246896287894, 0.63999632154013653,
+        0.63925984469252684, 0.63852304015305017, 0.63778590965547921, 0.63704845493435325,
+        0.63631067772497441, 0.63557257976340387, 0.63483416278645777, 0.63409542853170175,
+        0.63335637873744921, 0.63261701514275592, 0.63187733948741565, 0.6311373535119571,
+        0.63039705895763798, 0.62965645756644317, 0.62891555108107955, 0.6281743412449714,
+        0.62743282980225712, 0.6266910184977853, 0.62594890907710865, 0.62520650328648264,
+        0.62446380287286007, 0.62372080958388654, 0.62297752516789762, 0.62223395137391224,
+        0.62149008995163202, 0.62074594265143468, 0.62000151122437064, 0.61925679742215911,
+        0.61851180299718389, 0.61776652970248791, 0.6170209792917718, 0.61627515351938755,
+        0.61552905414033543, 0.61478268291025973, 0.61403604158544312, 0.6132891319228051,
+        0.61254195567989644, 0.61179451461489498, 0.61104681048660159, 0.61029884505443699,
+        0.60955062007843508, 0.60880213731924193, 0.6080533985381098, 0.60730440549689335,
+        0.60655515995804599, 0.60580566368461397, 0.60505591844023487, 0.6043059259891318,
+        0.60355568809610927, 0.60280520652654945, 0.60205448304640863, 0.60130351942221072,
+        0.60055231742104609, 0.59980087881056554, 0.59904920535897666, 0.59829729883504035,
+        0.59754516100806432, 0.59679279364790194, 0.59604019852494627, 0.59528737741012638,
+        0.59453433207490303, 0.59378106429126509, 0.5930275758317235, 0.59227386846930985,
+        0.59151994397757046, 0.59076580413056246, 0.59001145070284999, 0.58925688546949895,
+        0.58850211020607446, 0.58774712668863571, 0.58699193669373184, 0.58623654199839792,
+        0.58548094438015086, 0.58472514561698419, 0.58396914748736561, 0.58321295177023202,
+        0.58245656024498493, 0.58169997469148693, 0.58094319689005613, 0.58018622862146429,
+        0.57942907166693081, 0.57867172780811904, 0.57791419882713246, 0.5771564865065103,
+        0.57639859262922188, 0.57564051897866519, 0.57488226733866077, 0.57412383949344792,
+        0.57336523722768118, 0.57260646232642398, 0.57184751657514732, 0.57108840175972408,
+        0.57032911966642463, 0.569569672081913, 0.56881006079324326, 0.56805028758785325,
+        0.56729035425356322, 0.56653026257856953, 0.56577001435144147, 0.56500961136111694,
+        0.56424905539689685, 0.56348834824844307, 0.56272749170577319, 0.56196648755925604,
+        0.561205337599608, 0.5604440436178888, 0.5596826074054958, 0.55892103075416255,
+        0.55815931545595243, 0.55739746330325501, 0.5566354760887825, 0.5558733556055635,
+        0.55511110364694161, 0.55434872200656937, 0.55358621247840434, 0.55282357685670513,
+        0.55206081693602749, 0.55129793451121833, 0.55053493137741394, 0.54977180933003467,
+        0.54900857016478022, 0.54824521567762663, 0.54748174766481972, 0.54671816792287398,
+        0.54595447824856635, 0.54519068043893248, 0.54442677629126224, 0.54366276760309629,
+        0.54289865617222011, 0.54213444379666209, 0.54137013227468789, 0.54060572340479618,
+        0.53984121898571535, 0.53907662081639729, 0.53831193069601591, 0.53754715042396073,
+        0.53678228179983367, 0.53601732662344459, 0.53525228669480718, 0.53448716381413353,
+        0.53372195978183212, 0.53295667639850186, 0.5321913154649287, 0.53142587878208103,
+        0.53066036815110451, 0.52989478537332002, 0.52912913225021796, 0.52836341058345382,
+        0.52759762217484485, 0.52683176882636551, 0.5260658523401418, 0.52529987451844973,
+        0.52453383716370905, 0.52376774207847954, 0.52300159106545763, 0.52223538592746954,
+        0.52146912846747051, 0.52070282048853844, 0.51993646379386993, 0.51917006018677625,
+        0.5184036114706797, 0.51763711944910717, 0.51687058592568891, 0.51610401270415229,
+        0.5153374015883182, 0.51457075438209721, 0.51380407288948304, 0.51303735891455204,
+        0.51227061426145615, 0.51150384073441968, 0.51073704013773469, 0.50997021427575751,
+        0.50920336495290264, 0.50843649397364099, 0.5076696031424941, 0.50690269426403012,
+        0.50613576914286029, 0.5053688295836325, 0.50460187739103002, 0.50383491436976557,
+        0.50306794232457719, 0.5023009630602242, 0.50153397838148328, 0.50076699009314252,
+        0.50000000000000011, 0.49923300990685765, 0.49846602161851694, 0.49769903693977602,
+        0.49693205767542298, 0.49616508563023459, 0.49539812260897015, 0.49463117041636773,
+        0.49386423085713993, 0.49309730573597005, 0.49233039685750613, 0.49156350602635923,
+        0.49079663504709758, 0.49002978572424272, 0.48926295986226553, 0.48849615926558054,
+        0.48772938573854396, 0.48696264108544812, 0.48619592711051712, 0.48542924561790302,
+        0.48466259841168197, 0.48389598729584787, 0.48312941407431131, 0.48236288055089305,
+        0.48159638852932052, 0.48082993981322397, 0.48006353620613029, 0.47929717951146178,
+        0.47853087153252966, 0.47776461407253062, 0.47699840893454259, 0.47623225792152063,
+        0.47546616283629117, 0.47470012548155044, 0.47393414765985836, 0.47316823117363466,
+        0.47240237782515532, 0.47163658941654635, 0.47087086774978226, 0.47010521462668009,
+        0.46933963184889571, 0.46857412121791919, 0.46780868453507152, 0.46704332360149825,
+        0.46627804021816804, 0.46551283618586664, 0.46474771330519299, 0.46398267337655563,
+        0.4632177182001665, 0.46245284957603949, 0.46168806930398432, 0.46092337918360288,
+        0.46015878101428481, 0.45939427659520404, 0.45862986772531233, 0.45786555620333808,
+        0.45710134382778006, 0.45633723239690388, 0.45557322370873798, 0.45480931956106774,
+        0.45404552175143376, 0.45328183207712619, 0.4525182523351805, 0.45175478432237359,
+        0.45099142983521995, 0.4502281906699655, 0.44946506862258617, 0.44870206548878189,
+        0.44793918306397262, 0.44717642314329498, 0.44641378752159577, 0.44565127799343079,
+        0.44488889635305851, 0.44412664439443666, 0.44336452391121772, 0.44260253669674521,
+        0.44184068454404779, 0.44107896924583762, 0.44031739259450431, 0.43955595638211142,
+        0.43879466240039222, 0.43803351244074412, 0.43727250829422704, 0.43651165175155715,
+        0.43575094460310337, 0.43499038863888323, 0.43422998564855869, 0.43346973742143063,
+        0.432709645746437, 0.43194971241214691, 0.43118993920675691, 0.43043032791808722,
+        0.42967088033357559, 0.42891159824027614, 0.42815248342485285, 0.42739353767357624,
+        0.42663476277231904, 0.42587616050655225, 0.42511773266133945, 0.42435948102133503,
+        0.42360140737077834, 0.42284351349348992, 0.4220858011728677, 0.42132827219188107,
+        0.42057092833306942, 0.41981377137853593, 0.41905680310994409, 0.41830002530851329,
+        0.41754343975501529, 0.41678704822976814, 0.4160308525126345, 0.41527485438301603,
+        0.41451905561984936, 0.4137634580016023, 0.41300806330626832, 0.4122528733113644,
+        0.41149788979392565, 0.41074311453050122, 0.40998854929715012, 0.40923419586943777,
+        0.40848005602242971, 0.40772613153069026, 0.40697242416827673, 0.40621893570873513,
+        0.4054656679250972, 0.40471262258987384, 0.40395980147505395, 0.40320720635209828,
+        0.40245483899193585, 0.40170270116495976, 0.40095079464102346, 0.40019912118943468,
+        0.39944768257895413, 0.39869648057778945, 0.39794551695359148, 0.39719479347345066,
+        0.39644431190389096, 0.39569407401086842, 0.39494408155976524, 0.3941943363153862,
+        0.39344484004195424, 0.39269559450310687, 0.39194660146189042, 0.39119786268075829,
+        0.39044937992156514, 0.38970115494556318, 0.38895318951339852, 0.38820548538510524,
+        0.38745804432010372, 0.38671086807719507, 0.38596395841455711, 0.3852173170897405,
+        0.38447094585966468, 0.38372484648061256, 0.38297902070822842, 0.38223347029751226,
+        0.38148819700281633, 0.38074320257784111, 0.37999848877562947, 0.37925405734856549,
+        0.37850991004836809, 0.37776604862608792, 0.37702247483210261, 0.37627919041611363,
+        0.37553619712714009, 0.37479349671351747, 0.37405109092289157, 0.37330898150221486,
+        0.37256717019774299, 0.37182565875502877, 0.37108444891892067, 0.37034354243355694,
+        0.36960294104236224, 0.36886264648804312, 0.36812266051258458, 0.3673829848572443,
+        0.3666436212625509, 0.36590457146829847, 0.3651658372135424, 0.3644274202365963,
+        0.36368932227502571, 0.36295154506564697, 0.36221409034452101, 0.36147695984695005,
+        0.36074015530747339, 0.36000367845986364, 0.35926753103712117, 0.35853171477147244,
+        0.35779623139436412, 0.35706108263645964, 0.35632627022763552, 0.35559179589697548,
+        0.35485766137276897, 0.35412386838250542, 0.35339041865287069, 0.35265731390974275,
+        0.35192455587818838, 0.3511921462824571, 0.35046008684597985, 0.3497283792913633,
+        0.3489970253403859, 0.34826602671399465, 0.34753538513229898, 0.34680510231456968,
+        0.34607517997923265, 0.34534561984386564, 0.34461642362519418, 0.34388759303908778,
+        0.34315912980055441, 0.34243103562373889, 0.34170331222191708, 0.34097596130749253,
+        0.34024898459199249, 0.33952238378606259, 0.33879616059946521, 0.33807031674107363,
+        0.33734485391886854, 0.33661977383993402, 0.335895078210454, 0.33517076873570639,
+        0.3344468471200619, 0.33372331506697794, 0.33300017427899525, 0.3322774264577345,
+        0.33155507330389022, 0.33083311651722958, 0.33011155779658663, 0.32939039883985877,
+        0.32866964134400273, 0.32794928700503084, 0.32722933751800565, 0.32650979457703827,
+        0.32579065987528277, 0.32507193510493249, 0.32435362195721673, 0.32363572212239489,
+        0.32291823728975499, 0.3222011691476081, 0.32148451938328498, 0.32076828968313165,
+        0.32005248173250622, 0.31933709721577308, 0.3186221378163015, 0.31790760521646011,
+        0.31719350109761302, 0.31647982714011669, 0.31576658502331406, 0.31505377642553312,
+        0.31434140302408131, 0.31362946649524209, 0.31291796851427089, 0.31220691075539164,
+        0.31149629489179109, 0.31078612259561733, 0.31007639553797445, 0.30936711538891881,
+        0.30865828381745497, 0.3079499024915327, 0.30724197307804069, 0.30653449724280579,
+        0.30582747665058685, 0.30512091296507171, 0.30441480784887331, 0.30370916296352446,
+        0.30300397996947603, 0.30229926052609191, 0.30159500629164482, 0.30089121892331305,
+        0.30018790007717677, 0.29948505140821235, 0.29878267457029084, 0.29808077121617294,
+        0.29737934299750501, 0.29667839156481579, 0.29597791856751088, 0.29527792565387134,
+        0.29457841447104804, 0.29387938666505853, 0.29318084388078258, 0.29248278776195941,
+        0.29178521995118156, 0.29108814208989392, 0.29039155581838805, 0.28969546277579866,
+        0.28899986460010041, 0.28830476292810214, 0.28761015939544571, 0.28691605563660022,
+        0.28622245328485896, 0.28552935397233514, 0.28483675932995889, 0.28414467098747154,
+        0.2834530905734241, 0.28276201971517212, 0.28207146003887218, 0.28138141316947818,
+        0.28069188073073637, 0.28000286434518351, 0.27931436563414169, 0.27862638621771496,
+        0.27793892771478529, 0.27725199174300935, 0.27656557991881303, 0.27587969385739008,
+        0.2751943351726967, 0.27450950547744801, 0.27382520638311481, 0.27314143949991826,
+        0.27245820643682817, 0.2717755088015581, 0.27109334820056136, 0.27041172623902782,
+        0.26973064452088025, 0.26905010464876877, 0.26837010822406998, 0.26769065684688109,
+        0.26701175211601685, 0.26633339562900604, 0.26565558898208619, 0.2649783337702023,
+        0.26430163158700121, 0.26362548402482855, 0.26294989267472491, 0.26227485912642223,
+        0.26160038496833904, 0.26092647178757855, 0.2602531211699235, 0.25958033469983299,
+        0.25890811396043889, 0.25823646053354082, 0.25756537599960455, 0.25689486193775685,
+        0.256224919925782, 0.25555555154011833, 0.25488675835585461, 0.25421854194672516,
+        0.25355090388510804, 0.25288384574202016, 0.25221736908711367, 0.25155147548867296,
+        0.25088616651360929, 0.25022144372745914, 0.24955730869437964, 0.24889376297714455,
+        0.2482308081371411, 0.24756844573436643, 0.2469066773274225, 0.24624550447351468,
+        0.24558492872844651, 0.24492495164661654, 0.24426557478101507, 0.24360679968321869,
+        0.24294862790338922, 0.24229106099026854, 0.24163410049117501, 0.24097774795200022,
+        0.2403220049172054, 0.23966687292981659, 0.23901235353142292, 0.23835844826217178,
+        0.23770515866076547, 0.23705248626445791, 0.23640043260904953, 0.23574899922888587,
+        0.2350981876568527, 0.2344479994243725, 0.23379843606140094, 0.23314949909642374,
+        0.23250119005645153, 0.23185351046701852, 0.23120646185217725, 0.23056004573449573,
+        0.22991426363505379, 0.22926911707343844, 0.22862460756774217, 0.22798073663455809,
+        0.22733750578897677, 0.22669491654458246, 0.22605297041345013, 0.22541166890614028,
+        0.22477101353169765, 0.22413100579764628, 0.22349164720998616, 0.22285293927319016,
+        0.22221488349019908, 0.22157748136242006, 0.220940734389722, 0.22030464407043193,
+        0.21966921190133187, 0.21903443937765549, 0.21840032799308307, 0.21776687923974036,
+        0.21713409460819344, 0.21650197558744561, 0.21587052366493448, 0.2152397403265266,
+        0.21460962705651648, 0.21398018533762153, 0.2133514166509789, 0.21272332247614201,
+        0.21209590429107755, 0.21146916357216039, 0.21084310179417232, 0.21021772043029713,
+        0.20959302095211768, 0.20896900482961245, 0.20834567353115102, 0.20772302852349245,
+        0.20710107127178062, 0.20647980323954096, 0.20585922588867728, 0.20523934067946825,
+        0.20462014907056303, 0.20400165251897961, 0.2033838524801001, 0.20276675040766773,
+        0.20215034775378354, 0.20153464596890192, 0.20091964650182897, 0.20030535079971779,
+        0.19969176030806551, 0.19907887647070988, 0.19846670072982608, 0.19785523452592213,
+        0.19724447929783734, 0.19663443648273776, 0.19602510751611313, 0.19541649383177367,
+        0.19480859686184543, 0.19420141803676916, 0.1935949587852952, 0.19298922053448075,
+        0.19238420470968648, 0.1917799127345734, 0.19117634603109818, 0.1905735060195119,
+        0.18997139411835545, 0.18937001174445617, 0.18876936031292524, 0.1881694412371529,
+        0.18757025592880694, 0.18697180579782829, 0.1863740922524279, 0.18577711669908359,
+        0.18518088054253667, 0.18458538518578788, 0.18399063203009558, 0.1833966224749714,
+        0.1828033579181772, 0.18221083975572216, 0.18161906938185807, 0.18102804818907808,
+        0.18043777756811219, 0.17984825890792416, 0.17925949359570836, 0.17867148301688679,
+        0.17808422855510442, 0.17749773159222809, 0.17691199350834186, 0.17632701568174391,
+        0.175742799488944, 0.17515934630465857, 0.17457665750180967, 0.17399473445152025,
+        0.17341357852311162, 0.17283319108409967, 0.17225357350019249, 0.17167472713528564,
+        0.17109665335146074, 0.17051935350898134, 0.16994282896628971, 0.16936708108000414,
+        0.16879211120491427, 0.16821792069398023, 0.1676445108983276, 0.16707188316724514,
+        0.16650003884818115, 0.16592897928674094, 0.16535870582668211, 0.16478921980991351,
+        0.16422052257649083, 0.16365261546461352, 0.1630854998106222, 0.16251917694899415,
+        0.16195364821234215, 0.16138891493140983, 0.16082497843506927, 0.16026184005031741,
+        0.15969950110227366, 0.15913796291417526, 0.15857722680737601, 0.1580172941013423,
+        0.15745816611364977, 0.15689984415998093, 0.15634232955412058, 0.15578562360795489,
+        0.15522972763146659, 0.15467464293273264, 0.15412037081792107, 0.15356691259128785,
+        0.15301426955517311, 0.15246244300999962, 0.15191143425426856, 0.15136124458455669,
+        0.15081187529551382, 0.15026332767985828, 0.14971560302837594, 0.14916870262991577,
+        0.14862262777138735, 0.14807737973775748, 0.14753295981204773, 0.14698936927533024,
+        0.14644660940672632, 0.14590468148340235, 0.14536358678056716, 0.14482332657146907,
+        0.14428390212739195, 0.14374531471765395, 0.14320756560960324, 0.14267065606861545,
+        0.14213458735809059, 0.14159936073945045, 0.14106497747213426, 0.14053143881359786,
+        0.13999874601930923, 0.13946690034274589, 0.13893590303539255, 0.13840575534673644,
+        0.13787645852426667, 0.13734801381346967, 0.136820422457827, 0.13629368569881206,
+        0.13576780477588757, 0.1352427809265016, 0.13471861538608632, 0.13419530938805374,
+        0.13367286416379354, 0.13315128094267009, 0.13263056095201842, 0.13211070541714331,
+        0.1315917155613151, 0.13107359260576701, 0.13055633776969239, 0.13003995227024212,
+        0.12952443732252056, 0.12900979413958458, 0.1284960239324392, 0.12798312791003535,
+        0.12747110727926725, 0.12695996324496828, 0.12644969700991004, 0.12594030977479825,
+        0.12543180273827031, 0.12492417709689241, 0.12441743404515698, 0.12391157477547876,
+        0.12340660047819385, 0.12290251234155547, 0.12239931155173173, 0.12189699929280295,
+        0.12139557674675788, 0.12089504509349247, 0.12039540551080602, 0.11989665917439879,
+        0.11939880725786906, 0.11890185093271072, 0.11840579136830948, 0.11791062973194172,
+        0.11741636718877058, 0.11692300490184354, 0.11643054403209002, 0.11593898573831746,
+        0.11544833117721026, 0.11495858150332605, 0.11446973786909309, 0.11398180142480768,
+        0.11349477331863167, 0.11300865469658872, 0.11252344670256315, 0.11203915047829621,
+        0.11155576716338372, 0.11107329789527365, 0.11059174380926218, 0.11011110603849283,
+        0.10963138571395281, 0.10915258396447031, 0.10867470191671208, 0.10819774069518107,
+        0.10772170142221249, 0.10724658521797309, 0.10677239320045712, 0.10629912648548429,
+        0.10582678618669705, 0.10535537341555729, 0.1048848892813451, 0.10441533489115495,
+        0.10394671134989381, 0.10347901976027812, 0.10301226122283158, 0.10254643683588166,
+        0.10208154769555833, 0.10161759489579064, 0.10115457952830442, 0.10069250268261976,
+        0.1002313654460476, 0.099771168903688701, 0.099311914138429935, 0.098853602230942139,
+        0.098396234259677473, 0.097939811300867319, 0.097484334428518338, 0.097029804714411916,
+        0.096576223228100389, 0.096123591036904821, 0.095671909205912675, 0.095221178797974482,
+        0.094771400873702671, 0.094322576491468191, 0.093874706707398059, 0.093427792575373203,
+        0.09298183514702596, 0.0925368354717368, 0.092092794596633165, 0.091649713566586133,
+        0.091207593424208144, 0.090766435209850838, 0.090326239961601662, 0.089887008715282768,
+        0.089448742504447731, 0.089011442360379223, 0.088575109312086786, 0.088139744386304453,
+        0.087705348607487466, 0.087271922997811335, 0.086839468577168288, 0.086407986363165434,
+        0.085977477371122324, 0.085547942614067674, 0.085119383102738588, 0.084691799845576898,
+        0.084265193848727382, 0.083839566116035158, 0.083414917649043574, 0.082991249446991044,
+        0.08256856250681005, 0.082146857823123753, 0.081726136388243997, 0.081306399192169199,
+        0.080887647222581127, 0.08046988146484374, 0.080053102902000295, 0.079637312514770964,
+        0.079222511281550778, 0.078808700178407243, 0.078395880179077393, 0.077984052254966851,
+        0.077573217375146497, 0.077163376506350467, 0.076754530612974159, 0.076346680657070953,
+        0.075939827598351439, 0.075533972394180249, 0.075129115999573781, 0.07472525936719826,
+        0.074322403447367569, 0.073920549188040197, 0.07351969753481824, 0.07311984943094435,
+        0.072721005817299733, 0.072323167632402152, 0.071926335812402875, 0.07153051129108573,
+        0.071135694999863996, 0.07074188786777863, 0.070349090821495763, 0.069957304785305041,
+        0.069566530681116456, 0.069176769428459406, 0.068788021944479749, 0.06840028914393792,
+        0.068013571939206818, 0.067627871240268922, 0.067243187954715566, 0.066859522987743558,
+        0.066476877242153676, 0.066095251618348339, 0.065714647014329719, 0.06533506432569669,
+        0.064956504445644325, 0.064578968264960568, 0.064202456672024455, 0.063826970552804396,
+        0.063452510790855066, 0.063079078267316679, 0.062706673860911999, 0.062335298447944554,
+        0.061964952902296644, 0.061595638095427285, 0.061227354896369435, 0.060860104171729323,
+        0.060493886785683293, 0.060128703599976241, 0.059764555473919789, 0.05940144326438912,
+        0.059039367825822586, 0.05867833001021866, 0.058318330667134211, 0.057959370643682451,
+        0.057601450784531272, 0.057244571931900134, 0.056888734925559736, 0.056533940602828958,
+        0.056180189798573033, 0.055827483345201989, 0.055475822072667824, 0.055125206808463667,
+        0.054775638377621116, 0.054427117602708408, 0.054079645303828583, 0.053733222298617822,
+        0.053387849402242449, 0.053043527427398429, 0.052700257184308708, 0.052358039480721208,
+        0.052016875121907558, 0.051676764910660034, 0.051337709647290952, 0.050999710129630116,
+        0.050662767153023092, 0.050326881510329213, 0.049992053991920027, 0.049658285385676626,
+        0.049325576476989041, 0.04899392804875341, 0.048663340881370587, 0.048333815752744202,
+        0.048005353438278442, 0.047677954710876991, 0.047351620340940648, 0.04702635109636577,
+        0.046702147742542277, 0.046379011042352203, 0.04605694175616698, 0.045735940641846995,
+        0.04541600845473881, 0.045097145947673889, 0.044779353870966543, 0.044462632972411931,
+        0.044146983997285172, 0.043832407688338682, 0.043518904785800949, 0.043206476027374541,
+        0.042895122148234766, 0.042584843881027012, 0.042275641955866139, 0.041967517100334195,
+        0.041660470039478648, 0.041354501495811158, 0.041049612189304863, 0.04074580283739393,
+        0.04044307415497117, 0.04014142685438632, 0.039840861645444703, 0.039541379235405405,
+        0.039242980328979105, 0.038945665628327519, 0.038649435833060741, 0.038354291640236182,
+        0.038060233744356742, 0.037767262837368754, 0.037475379608661263, 0.037184584745063642,
+        0.03689487893084431, 0.03660626284770907, 0.036318737174799554, 0.036032302588691167,
+        0.035746959763392261, 0.035462709370342127, 0.035179552078409337, 0.03489748855389041,
+        0.034616519460508255, 0.034336645459409842, 0.034057867209165982, 0.033780185365768822,
+        0.033503600582630522, 0.033228113510582025, 0.03295372479787062, 0.032680435090159665,
+        0.03240824503052625, 0.032137155259459815, 0.031867166414860815, 0.031598279132039275,
+        0.031330494043712576, 0.031063811780005113, 0.030798232968445971, 0.030533758233967701,
+        0.030270388198905152, 0.030008123482993088, 0.029746964703365908, 0.029486912474555371,
+        0.029227967408489597, 0.028970130114491288, 0.028713401199276622, 0.028457781266953308,
+        0.028203270919019863, 0.02794987075436367, 0.027697581369259872, 0.027446403357369809,
+        0.027196337309739416, 0.026947383814798331, 0.026699543458358233, 0.026452816823611391,
+        0.026207204491129399, 0.025962707038861943, 0.025719325042134922, 0.025477059073649722,
+        0.025235909703481663, 0.024995877499078445, 0.02475696302525926, 0.024519166844212514,
+        0.024282489515495831, 0.024046931596033883, 0.023812493640117061, 0.023579176199400642,
+        0.02334697982290318, 0.023115905057004893, 0.022885952445447222, 0.022657122529330831,
+        0.022429415847114609, 0.022202832934614558, 0.021977374325001853, 0.021753040548802505,
+        0.021529832133895588, 0.021307749605512072, 0.021086793486233546, 0.020866964295991275,
+        0.020648262552064256, 0.020430688769079053, 0.020214243459007741, 0.019998927131167021,
+        0.019784740292217162, 0.019571683446160226, 0.019359757094339736, 0.01914896173543873,
+        0.01893929786547921, 0.018730765977820418, 0.018523366563158117, 0.018317100109523032,
+        0.01811196710228008, 0.017907968024127141, 0.017705103355093621, 0.017503373572539893,
+        0.017302779151155356, 0.017103320562958213, 0.016904998277293748, 0.01670781276083344,
+        0.016511764477573909, 0.016316853888835803, 0.0161230814532623, 0.015930447626818833,
+        0.015738952862791367, 0.015548597611785564, 0.015359382321725845, 0.015171307437853832,
+        0.014984373402728013, 0.014798580656222304, 0.014613929635524825, 0.014430420775137398,
+        0.014248054506874164, 0.014066831259860357, 0.013886751460531865, 0.013707815532633894,
+        0.013530023897219912, 0.013353376972650932, 0.013177875174594067, 0.013003518916022083,
+        0.012830308607212071, 0.012658244655744666, 0.012487327466502884, 0.012317557441671567,
+        0.01214893498073577, 0.011981460480480488, 0.01181513433498943, 0.011649956935644079,
+        0.011485928671122914, 0.01132304992740002, 0.011161321087745035, 0.011000742532721486,
+        0.010841314640186173, 0.010683037785288396, 0.010525912340468957, 0.01036993867545899,
+        0.010215117157279741, 0.010061448150241181, 0.0099089320159412853, 0.009757569113265363,
+        0.0096073597983848402, 0.0094583044247567027, 0.0093104033431227196, 0.0091636569015084435,
+        0.009018065445222323, 0.0088736293168553693, 0.0087303488562794351, 0.0085882244006473818,
+        0.0084472562843918575, 0.0083074448392244093, 0.0081687903941349282, 0.0080312932753905941,
+        0.0078949538065354874, 0.0077597723083895342, 0.007625749099047896, 0.0074928844938800809,
+        0.0073611788055294447, 0.0072306323439120246, 0.0071012454162163174, 0.0069730183269022805,
+        0.0068459513777006653, 0.0067200448676123514, 0.0065952990929072919, 0.0064717143471245131,
+        0.0063492909210708381, 0.0062280291028203871, 0.0061079291777139111, 0.0059889914283582368,
+        0.0058712161346252678, 0.0057546035736517065, 0.0056391540198381107, 0.0055248677448485051,
+        0.0054117450176095483, 0.0052997861043098671, 0.005188991268399612, 0.0050793607705897359,
+        0.0049708948688514387, 0.0048635938184154459, 0.0047574578717715088, 0.004652487278667683,
+        0.0045486822861099951, 0.0044460431383616106, 0.0043445700769422779, 0.0042442633406280517,
+        0.0041451231654502929, 0.0040471497846953364, 0.0039503434289041572, 0.0038547043258713165,
+        0.0037602327006450165, 0.003666928775526046, 0.0035747927700675031, 0.003483824901074295,
+        0.00339402538260275, 0.0033053944259596735, 0.003217932239702348, 0.0031316390296377006,
+        0.0030465149988219697, 0.0029625603475603168, 0.0028797752734060489, 0.0027981599711604521,
+        0.0027177146328722923, 0.0026384394478371487, 0.0025603346025971918, 0.0024834002809406841,
+        0.0024076366639015356, 0.0023330439297589156, 0.0022596222540365307, 0.0021873718095028472,
+        0.0021162927661700914, 0.0020463852912941394, 0.0019776495493740165, 0.0019100857021515649,
+        0.0018436939086109994, 0.001778474324978685, 0.0017144271047225823, 0.0016515523985519698,
+        0.001589850354417166, 0.0015293211175089749, 0.0014699648302585189, 0.0014117816323369614,
+        0.0013547716606548965, 0.0012989350493623486, 0.001244271929848273, 0.0011907824307402226,
+        0.0011384666779041819, 0.0010873247944441777, 0.0010373569007020023, 0.0009885631142569351,
+        0.00094094354992541041, 0.00089449831976090577, 0.00084922753305360921, 0.00080513129632991953,
+        0.00076220971335261289, 0.00072046288512034318, 0.00067989090986741996, 0.00064049388306353094,
+        0.0006022718974137975, 0.00056522504285821951, 0.00052935340657156438, 0.00049465707296336703,
+        0.00046113612367731927, 0.00042879063759154734, 0.00039762069081805684, 0.0003676263567027882,
+        0.00033880770582528363, 0.0003111648059985761, 0.00028469772226913381, 0.00025940651691652716,
+        0.00023529124945342872, 0.00021235197662539118, 0.00019058875241068085, 0.00017000162802038865,
+        0.00015059065189787502, 0.00013235586971915847, 0.00011529732439236051, 9.9415056057872153e-05,
+        8.4709102088298405e-05, 7.1179497088069699e-05, 5.8826272893719445e-05, 4.7649458573550962e-05,
+        3.7649080427748505e-05, 2.882516198804419e-05, 2.117772401805107e-05, 1.470678451293006e-05,
+        9.4123586994454556e-06, 5.2944590357983934e-06, 2.3530952119044102e-06, 5.882741490603749e-07,
+        0,
+    },
+    /* hamming */
+    {
+        0.080000000000000016, 0.080000541212217169, 0.080002164847594981, 0.080004870902312952,
+        0.08000865937000351, 0.080013530241751896, 0.080019483506096611, 0.08002651914902903,
+        0.08003463715399356, 0.080043837501887705, 0.080054120171062226, 0.080065485137321035,
+        0.080077932373921246, 0.080091461851573231, 0.080106073538441014, 0.080121767400141652,
+        0.080138543399746076, 0.080156401497778751, 0.080175341652217846, 0.080195363818495402,
+        0.080216467949497161, 0.080238653995563236, 0.08026192190448761, 0.08028627162151869,
+        0.080311703089359199, 0.080338216248166561, 0.080365811035552626, 0.080394487386584224,
+        0.080424245233783165, 0.08045508450712624, 0.08048700513404583, 0.080520007039429575,
+        0.080554090145620705, 0.080589254372418484, 0.080625499637077991, 0.080662825854310727,
+        0.080701232936284395, 0.080740720792623566, 0.080781289330409289, 0.080822938454180038,
+        0.080865668065931373, 0.080909478065116336, 0.080954368348645833, 0.081000338810888639,
+        0.081047389343671838, 0.081095519836280994, 0.081144730175460422, 0.081195020245413363,
+        0.081246389927802531, 0.081298839101749953, 0.081352367643837853, 0.081406975428108208,
+        0.081462662326063806, 0.081519428206667854, 0.081577272936344813, 0.081636196378980397,
+        0.081696198395922126, 0.081757278845979386, 0.081819437585424093, 0.081882674467990635,
+        0.081946989344876486, 0.08201238206474265, 0.082078852473713604, 0.082146400415378185,
+        0.082215025730789426, 0.082284728258465445, 0.082355507834389441, 0.082427364292010197,
+        0.082500297462242522, 0.082574307173467643, 0.082649393251533587, 0.082725555519755523,
+        0.082802793798916252, 0.082881107907266716, 0.082960497660526156, 0.083040962871882895,
+        0.083122503351994559, 0.083205118908988351, 0.083288809348462056, 0.083373574473483925,
+        0.083459414084593453, 0.083546327979801605, 0.083634315954591809, 0.083723377801919741,
+        0.083813513312214261, 0.083904722273377808, 0.083997004470786896, 0.084090359687292671,
+        0.084184787703221187, 0.084280288296374295, 0.084376861242029755, 0.084474506312942232,
+        0.084573223279343357, 0.084673011908942553, 0.084773871966927594, 0.084875803215965051,
+        0.084978805416200731, 0.085082878325260625, 0.085188021698251071, 0.08529423528775959,
+        0.085401518843855273, 0.085509872114089613, 0.08561929484349684, 0.085729786774594752,
+        0.085841347647385158, 0.085953977199354548, 0.0860676751654747, 0.086182441278203348,
+        0.086298275267484625, 0.08641517686075012, 0.086533145782918985, 0.086652181756399049,
+        0.086772284501087038, 0.086893453734369686, 0.087015689171124067, 0.087138990523718374,
+        0.08726335750201264, 0.087388789813359291, 0.087515287162604094, 0.087642849252086485,
+        0.087771475781640518, 0.08790116644859558, 0.088031920947777065, 0.088163738971506922,
+        0.088296620209604604, 0.088430564349387786, 0.088565571075672922, 0.088701640070776133,
+        0.08883877101451404, 0.088976963584204094, 0.089116217454666025, 0.089256532298221891,
+        0.089397907784697361, 0.089540343581422266, 0.089683839353231432, 0.089828394762465347,
+        0.089974009468971272, 0.09012068313010374, 0.090268415400725444, 0.090417205933208011,
+        0.090567054377433009, 0.090717960380792551, 0.090869923588190293, 0.091022943642042053,
+        0.091177020182276858, 0.091332152846337833, 0.091488341269182705, 0.09164558508328513,
+        0.091803883918635143, 0.091963237402740317, 0.092123645160626488, 0.092285106814838813,
+        0.092447621985442319, 0.092611190290023182, 0.092775811343689341, 0.092941484759071491,
+        0.0931082101463242, 0.093275987113126457, 0.093444815264682846, 0.09361469420372448,
+        0.093785623530509787, 0.093957602842825505, 0.09413063173598768, 0.094304709802842723,
+        0.094479836633768022, 0.094656011816673269, 0.094833234937001298, 0.095011505577728916,
+        0.095190823319368068, 0.095371187739966778, 0.095552598415110268, 0.095735054917921503,
+        0.095918556819062917, 0.096103103686736691, 0.096288695086686138, 0.096475330582196928,
+        0.096663009734097693, 0.096851732100761145, 0.097041497238105456, 0.097232304699594818,
+        0.097424154036240884, 0.097617044796603658, 0.097810976526792548, 0.098005948770467366,
+        0.098201961068839771, 0.09839901296067366, 0.09859710398228716, 0.098796233667552746,
+        0.098996401547899071, 0.099197607152311906, 0.099399850007334867, 0.099603129637071131,
+        0.099807445563183939, 0.10001279730489826, 0.10021918437900168, 0.10042660629984529,
+        0.10063506257934546, 0.10084455272698439, 0.10105507624981142, 0.10126663265244445,
+        0.10147922143707083, 0.10169284210344859, 0.10190749414890771, 0.10212317706835111,
+        0.10233989035425617, 0.10255763349667546, 0.10277640598323845, 0.10299620729915221,
+        0.10321703692720313, 0.10343889434775777, 0.10366177903876411, 0.10388569047575297,
+        0.10411062813183913, 0.10433659147772251, 0.10456357998168958, 0.10479159310961444,
+        0.10502063032496023, 0.10525069108878016, 0.1054817748597191, 0.10571388109401458,
+        0.10594700924549821, 0.10618115876559703, 0.10641632910333448, 0.10665251970533207,
+        0.10688973001581042, 0.10712795947659098, 0.10736720752709661, 0.10760747360435358,
+        0.10784875714299264, 0.10809105757525028, 0.10833437433097032, 0.10857870683760468,
+        0.10882405452021554, 0.10907041680147611, 0.109317793101672, 0.10956618283870306,
+        0.10981558542808412, 0.11006600028294689, 0.11031742681404089, 0.11056986442973538,
+        0.11082331253602012, 0.11107777053650736, 0.11133323783243265, 0.11158971382265703,
+        0.11184719790366748, 0.11210568946957927, 0.11236518791213662, 0.1126256926207147,
+        0.11288720298232086, 0.11314971838159577, 0.1134132382008155, 0.11367776181989242,
+        0.11394328861637676, 0.11420981796545859, 0.11447734923996833, 0.1147458818103792,
+        0.11501541504480811, 0.11528594830901728, 0.11555748096641583, 0.11583001237806123,
+        0.1161035419026607, 0.11637806889657282, 0.11665359271380915, 0.11693011270603543,
+        0.11720762822257347, 0.11748613861040236, 0.11776564321416039, 0.11804614137614616,
+        0.11832763243632038, 0.11861011573230745, 0.1188935905993968, 0.11917805637054479,
+        0.11946351237637592, 0.11974995794518467, 0.12003739240293682, 0.12032581507327156,
+        0.12061522527750229, 0.12090562233461888, 0.1211970055612891, 0.12148937427186002,
+        0.12178272777835975, 0.12207706539049923, 0.12237238641567355, 0.12266869015896392,
+        0.12296597592313896, 0.12326424300865652, 0.12356349071366535, 0.12386371833400672,
+        0.12416492516321609, 0.12446711049252457, 0.12477027361086096, 0.12507441380485318,
+        0.12537953035882987, 0.12568562255482241, 0.12599268967256627, 0.1263007309895029,
+        0.12660974578078127, 0.12691973331925965, 0.12723069287550759, 0.12754262371780717,
+        0.12785552511215481, 0.12816939632226354, 0.12848423660956398, 0.12880004523320654,
+        0.12911682145006298, 0.12943456451472829, 0.12975327367952239, 0.13007294819449178,
+        0.13039358730741141, 0.13071519026378653, 0.13103775630685432, 0.13136128467758568,
+        0.13168577461468722, 0.13201122535460263, 0.13233763613151495, 0.13266500617734805,
+        0.13299333472176861, 0.13332262099218795, 0.13365286421376349, 0.13398406360940113,
+        0.13431621839975671, 0.13464932780323785, 0.1349833910360061, 0.13531840731197819,
+        0.13565437584282858, 0.13599129583799091, 0.13632916650465982, 0.13666798704779304,
+        0.137007756670113, 0.13734847457210902, 0.13769013995203899, 0.13803275200593124,
+        0.13837630992758659, 0.1387208129085799, 0.13906626013826257, 0.13941265080376369,
+        0.13975998408999274, 0.14010825917964087, 0.14045747525318319, 0.14080763148888048,
+        0.14115872706278138, 0.14151076114872402, 0.14186373291833826, 0.14221764154104732,
+        0.14257248618407009, 0.14292826601242292, 0.14328498018892133, 0.14364262787418264,
+        0.14400120822662704, 0.14436072040248055, 0.14472116355577613, 0.14508253683835637,
+        0.14544483939987485, 0.1458080703877988, 0.14617222894741055, 0.14653731422180982,
+        0.14690332535191575, 0.14727026147646877, 0.14763812173203272, 0.14800690525299692,
+        0.14837661117157802, 0.14874723861782241, 0.14911878671960782, 0.14949125460264578,
+        0.14986464139048328, 0.15023894620450517, 0.15061416816393602, 0.15099030638584243,
+        0.15136735998513473, 0.15174532807456947, 0.15212420976475111, 0.15250400416413451,
+        0.15288471037902673, 0.15326632751358932, 0.15364885466984024, 0.15403229094765614,
+        0.15441663544477452, 0.1548018872567955, 0.15518804547718451, 0.1555751091972738,
+        0.1559630775062652, 0.15635194949123166, 0.15674172423711996, 0.15713240082675234,
+        0.15752397834082921, 0.15791645585793074, 0.15830983245451941, 0.15870410720494216,
+        0.15909927918143235, 0.1594953474541122, 0.15989231109099478, 0.16029016915798633,
+        0.16068892071888841, 0.16108856483539996, 0.16148910056711985, 0.16189052697154893,
+        0.16229284310409187, 0.16269604801806009, 0.16310014076467344, 0.16350512039306264,
+        0.16391098595027154, 0.16431773648125919, 0.1647253710289025, 0.16513388863399775,
+        0.16554328833526377, 0.16595356916934334, 0.16636473017080622, 0.16677677037215072,
+        0.16718968880380641, 0.16760348449413642, 0.16801815646943952, 0.16843370375395245,
+        0.16885012536985233, 0.16926742033725894, 0.16968558767423675, 0.17010462639679774,
+        0.17052453551890334, 0.17094531405246677, 0.17136696100735549, 0.1717894753913935,
+        0.1722128562103637, 0.17263710246801006, 0.17306221316604009, 0.17348818730412735,
+        0.17391502387991359, 0.17434272188901101, 0.17477128032500494, 0.17520069817945594,
+        0.17563097444190234, 0.1760621080998625, 0.17649409813883743, 0.17692694354231264,
+        0.1773606432917611, 0.17779519636664554, 0.17823060174442057, 0.1786668584005352,
+        0.17910396530843542, 0.17954192143956643, 0.1799807257633752, 0.18042037724731269,
+        0.18086087485683655, 0.18130221755541331, 0.18174440430452105, 0.18218743406365157,
+        0.18263130579031311, 0.18307601844003246, 0.18352157096635802, 0.18396796232086149,
+        0.184415191453141, 0.18486325731082315, 0.18531215883956564, 0.18576189498306001,
+        0.18621246468303337, 0.18666386687925191, 0.18711610050952265, 0.18756916450969607,
+        0.1880230578136689, 0.18847777935338633, 0.18893332805884466, 0.1893897028580937,
+        0.18984690267723958, 0.19030492644044689, 0.19076377306994152, 0.191223441486013,
+        0.19168393060701711, 0.19214523934937855, 0.1926073666275932, 0.19307031135423103,
+        0.19353407243993825, 0.19399864879344031, 0.19446403932154421, 0.19493024292914107,
+        0.19539725851920869, 0.19586508499281435, 0.19633372124911713, 0.19680316618537069,
+        0.19727341869692561, 0.19774447767723252, 0.19821634201784405, 0.1986890106084177,
+        0.19916248233671885, 0.19963675608862258, 0.20011183074811706, 0.20058770519730568,
+        0.20106437831640989, 0.20154184898377175, 0.20202011607585679, 0.20249917846725624,
+        0.20297903503069015, 0.20345968463700942, 0.20394112615519933, 0.20442335845238141,
+        0.20490638039381642, 0.20539019084290716, 0.20587478866120085, 0.20636017270839208,
+        0.2068463418423252, 0.20733329491899738, 0.20782103079256098, 0.20830954831532628,
+        0.20879884633776447, 0.20928892370850993, 0.20977977927436342, 0.21027141188029425,
+        0.21076382036944347, 0.21125700358312621, 0.21175096036083496, 0.21224568954024153,
+        0.21274118995720048, 0.21323746044575131, 0.21373449983812182, 0.21423230696473011,
+        0.21473088065418816, 0.21523021973330375, 0.21573032302708373, 0.21623118935873697,
+        0.21673281754967638, 0.21723520641952249, 0.21773835478610576, 0.21824226146546949,
+        0.21874692527187251, 0.21925234501779217, 0.21975851951392705, 0.22026544756919963,
+        0.22077312799075915, 0.22128155958398465, 0.22179074115248748, 0.22230067149811406,
+        0.22281134942094921, 0.22332277371931836, 0.2238349431897908, 0.22434785662718221,
+        0.22486151282455785, 0.22537591057323486, 0.22589104866278592, 0.22640692588104111,
+        0.22692354101409157, 0.2274408928462921, 0.22795898016026367, 0.22847780173689702,
+        0.22899735635535462, 0.22951764279307446, 0.23003865982577221, 0.23056040622744445,
+        0.23108288077037159, 0.23160608222512041, 0.23213000936054745, 0.23265466094380149,
+        0.23318003574032681, 0.23370613251386557, 0.23423295002646138, 0.2347604870384617,
+        0.23528874230852098, 0.23581771459360357, 0.23634740264898663, 0.23687780522826285,
+        0.23740892108334383, 0.23794074896446266, 0.23847328762017689, 0.23900653579737174,
+        0.23954049224126273, 0.24007515569539867, 0.24061052490166479, 0.24114659860028576,
+        0.24168337552982827, 0.24222085442720448, 0.24275903402767446, 0.24329791306484977,
+        0.24383749027069596, 0.24437776437553566, 0.24491873410805176, 0.24546039819529025,
+        0.24600275536266319, 0.24654580433395168, 0.24708954383130927, 0.24763397257526415,
+        0.2481790892847231, 0.24872489267697373, 0.24927138146768785, 0.24981855437092476,
+        0.25036641009913357, 0.25091494736315695, 0.25146416487223372, 0.252014061334002,
+        0.25256463545450225, 0.25311588593818046, 0.25366781148789097, 0.25422041080489971,
+        0.254773682588887, 0.25532762553795091, 0.25588223834861018, 0.25643751971580736,
+        0.2569934683329117, 0.25755008289172232, 0.25810736208247154, 0.25866530459382747,
+        0.25922390911289767, 0.25978317432523157, 0.2603430989148241, 0.26090368156411875,
+        0.26146492095401025, 0.26202681576384823, 0.26258936467143984, 0.26315256635305323,
+        0.26371641948342028, 0.26428092273574033, 0.26484607478168254, 0.26541187429138963,
+        0.26597831993348064, 0.26654541037505436, 0.26711314428169214, 0.26768152031746117,
+        0.26825053714491787, 0.2688201934251106, 0.26939048781758318, 0.26996141898037773,
+        0.27053298557003813, 0.27110518624161295, 0.27167801964865879, 0.27225148444324326,
+        0.27282557927594836, 0.27340030279587341, 0.27397565365063847, 0.27455163048638742,
+        0.27512823194779118, 0.2757054566780508, 0.27628330331890055, 0.27686177051061178,
+        0.27744085689199505, 0.2780205611004043, 0.27860088177173953, 0.27918181754045002,
+        0.27976336703953791, 0.28034552890056108, 0.28092830175363637, 0.28151168422744288,
+        0.28209567494922544, 0.28268027254479738, 0.28326547563854421, 0.28385128285342637,
+        0.28443769281098297, 0.28502470413133479, 0.28561231543318732, 0.28620052533383461,
+        0.28678933244916183, 0.28737873539364894, 0.28796873278037394, 0.28855932322101596,
+        0.28915050532585868, 0.2897422777037934, 0.2903346389623227, 0.29092758770756322,
+        0.29152112254424922, 0.29211524207573614, 0.29270994490400309, 0.29330522962965699,
+        0.29390109485193527, 0.29449753916870969, 0.29509456117648891, 0.29569215947042271,
+        0.29629033264430438, 0.29688907929057495, 0.29748839800032539, 0.29808828736330106,
+        0.2986887459679044, 0.29928977240119803, 0.29989136524890903, 0.30049352309543109,
+        0.30109624452382888, 0.30169952811584033, 0.30230337245188099, 0.30290777611104697,
+        0.30351273767111808, 0.30411825570856099, 0.30472432879853362, 0.30533095551488731,
+        0.30593813443017082, 0.30654586411563345, 0.30715414314122852, 0.30776297007561698,
+        0.30837234348616993, 0.30898226193897305, 0.3095927239988292, 0.31020372822926234,
+        0.31081527319252034, 0.31142735744957889, 0.31203997956014468, 0.31265313808265854,
+        0.31326683157429935, 0.31388105859098703, 0.3144958176873861, 0.31511110741690895,
+        0.31572692633171945, 0.31634327298273623, 0.31696014591963612, 0.31757754369085744,
+        0.3181954648436035, 0.31881390792384645, 0.31943287147632965, 0.32005235404457222,
+        0.32067235417087181, 0.32129287039630833, 0.32191390126074704, 0.32253544530284228,
+        0.32315750106004104, 0.32378006706858603, 0.32440314186351915, 0.32502672397868532,
+        0.32565081194673562, 0.3262754042991306, 0.32690049956614431, 0.32752609627686713,
+        0.32815219295920961, 0.32877878813990569, 0.32940588034451646, 0.33003346809743345,
+        0.3306615499218819, 0.33129012433992461, 0.33191918987246538, 0.33254874503925225,
+        0.33317878835888098, 0.33380931834879879, 0.33444033352530783, 0.33507183240356841,
+        0.33570381349760259, 0.33633627532029775, 0.33696921638341037, 0.33760263519756872,
+        0.33823653027227729, 0.33887090011591969, 0.33950574323576255, 0.34014105813795836,
+        0.34077684332755009, 0.34141309730847363, 0.34204981858356204, 0.34268700565454846,
+        0.34332465702207021, 0.3439627711856722, 0.34460134664380998, 0.34524038189385381,
+        0.34587987543209209, 0.34651982575373486, 0.34716023135291701, 0.34780109072270232,
+        0.34844240235508683, 0.34908416474100246, 0.34972637637032011, 0.35036903573185385,
+        0.35101214131336422, 0.35165569160156152, 0.35229968508210979, 0.35294412023963023,
+        0.35358899555770473, 0.35423430951887913, 0.35488006060466748, 0.35552624729555515,
+        0.35617286807100251, 0.35681992140944818, 0.35746740578831326, 0.35811531968400456,
+        0.35876366157191791, 0.35941242992644229, 0.36006162322096319, 0.36071123992786608,
+        0.36136127851853994, 0.36201173746338122, 0.36266261523179727, 0.36331391029220994,
+        0.36396562111205871, 0.36461774615780529, 0.36527028389493654, 0.36592323278796784,
+        0.36657659130044762, 0.36723035789496006, 0.36788453103312935, 0.36853910917562271,
+        0.3691940907821547, 0.36984947431149029, 0.37050525822144875, 0.37116144096890713,
+        0.37181802100980399, 0.37247499679914331, 0.37313236679099732, 0.37379012943851103,
+        0.37444828319390544, 0.37510682650848126, 0.37576575783262223, 0.37642507561579941,
+        0.37708477830657439, 0.37774486435260313, 0.3784053322006391, 0.37906618029653794,
+        0.37972740708526015, 0.38038901101087513, 0.38105099051656499, 0.38171334404462809,
+        0.38237607003648261, 0.38303916693267015, 0.38370263317285963, 0.38436646719585105,
+        0.38503066743957881, 0.38569523234111547, 0.38636016033667564, 0.38702544986161969,
+        0.38769109935045687, 0.3883571072368498, 0.38902347195361742, 0.3896901919327394,
+        0.39035726560535905, 0.39102469140178764, 0.39169246775150779, 0.39236059308317739,
+        0.39302906582463282, 0.39369788440289311, 0.39436704724416372, 0.3950365527738397,
+        0.39570639941650987, 0.39637658559596051, 0.39704710973517876, 0.39771797025635636,
+        0.39838916558089393, 0.39906069412940393, 0.39973255432171495, 0.4004047445768748,
+        0.40107726331315507, 0.4017501089480543, 0.4024232798983014, 0.40309677457986032,
+        0.40377059140793303, 0.40444472879696347, 0.40511918516064105, 0.40579395891190495,
+        0.40646904846294735, 0.40714445222521728, 0.40782016860942444, 0.40849619602554288,
+        0.40917253288281497, 0.40984917758975459, 0.41052612855415133, 0.41120338418307428,
+        0.41188094288287563, 0.41255880305919401, 0.41323696311695923, 0.41391542146039512,
+        0.41459417649302349, 0.4152732266176683, 0.41595257023645904, 0.41663220575083459,
+        0.41731213156154678, 0.41799234606866453, 0.41867284767157753, 0.41935363476899978,
+        0.42003470575897328, 0.42071605903887233, 0.42139769300540691, 0.4220796060546263,
+        0.42276179658192331, 0.42344426298203769, 0.42412700364906025, 0.424810016976436,
+        0.42549330135696872, 0.42617685518282422, 0.42686067684553453, 0.42754476473600089,
+        0.42822911724449858, 0.42891373276068012, 0.42959860967357894, 0.43028374637161354,
+        0.43096914124259106, 0.43165479267371132, 0.43234069905157002, 0.4330268587621634,
+        0.43371327019089123, 0.43439993172256136, 0.43508684174139256, 0.4357739986310194,
+        0.43646140077449536, 0.43714904655429665, 0.4378369343523264, 0.43852506254991819,
+        0.43921342952783993, 0.43990203366629754, 0.44059087334493902, 0.44127994694285805,
+        0.441969252838598, 0.44265878941015535, 0.44334855503498394, 0.44403854808999887,
+        0.44472876695157948, 0.44541920999557433, 0.4461098755973042, 0.44680076213156633,
+        0.44749186797263774, 0.44818319149427976, 0.4488747310697413, 0.44956648507176311,
+        0.45025845187258101, 0.45095062984393031, 0.45164301735704954, 0.45233561278268375,
+        0.45302841449108916, 0.45372142085203637, 0.4544146302348146, 0.45510804100823499,
+        0.45580165154063512, 0.45649546019988246, 0.45718946535337823, 0.45788366536806113,
+        0.45857805861041157, 0.45927264344645519, 0.45996741824176668, 0.46066238136147386,
+        0.4613575311702614, 0.46205286603237478, 0.46274838431162368, 0.46344408437138651,
+        0.46413996457461382, 0.46483602328383233, 0.46553225886114857, 0.46622866966825294,
+        0.46692525406642382, 0.4676220104165304, 0.46831893707903799, 0.46901603241401069,
+        0.46971329478111606, 0.47041072253962812, 0.47110831404843212, 0.47180606766602778,
+        0.47250398175053365, 0.47320205465969017, 0.47390028475086454, 0.47459867038105397,
+        0.4752972099068894, 0.47599590168463995, 0.47669474407021639, 0.47739373541917518,
+        0.47809287408672196, 0.478792158427716, 0.4794915867966737, 0.4801911575477727,
+        0.48089086903485517, 0.48159071961143246, 0.48229070763068876, 0.48299083144548444,
+        0.48369108940836053, 0.48439147987154252, 0.48509200118694401, 0.48579265170617053,
+        0.48649342978052379, 0.48719433376100529, 0.4878953619983204, 0.48859651284288175,
+        0.48929778464481377, 0.48999917575395624, 0.49070068451986792, 0.4914023092918311,
+        0.49210404841885486, 0.49280590024967935, 0.49350786313277922, 0.4942099354163681,
+        0.49491211544840208, 0.49561440157658382, 0.49631679214836605, 0.49701928551095598,
+        0.49772188001131901, 0.49842457399618212, 0.4991273658120387, 0.49983025380515161,
+        0.50053323632155766, 0.50123631170707095, 0.50193947830728713, 0.50264273446758756,
+        0.50334607853314217, 0.50404950884891464, 0.50475302375966546, 0.50545662160995619,
+        0.50616030074415297, 0.50686405950643088, 0.50756789624077758, 0.50827180929099736,
+        0.50897579700071449, 0.5096798577133782, 0.51038398977226562, 0.51108819152048579,
+        0.5117924613009841, 0.51249679745654564, 0.5132011983297996, 0.51390566226322243,
+        0.51461018759914268, 0.5153147726797439, 0.51601941584706967, 0.51672411544302632,
+        0.51742886980938774, 0.5181336772877988, 0.51883853621977927, 0.51954344494672822,
+        0.52024840180992715, 0.52095340515054478, 0.52165845330963967, 0.5223635446281657,
+        0.52306867744697494, 0.52377385010682165, 0.52447906094836627, 0.52518430831217988,
+        0.52588959053874718, 0.52659490596847092, 0.52730025294167571, 0.52800562979861221,
+        0.52871103487946036, 0.52941646652433394, 0.53012192307328398, 0.53082740286630337,
+        0.53153290424332977, 0.53223842554425038, 0.5329439651089054, 0.53364952127709231,
+        0.53435509238856882, 0.53506067678305835, 0.53576627280025246, 0.53647187877981573,
+        0.53717749306138896, 0.53788311398459365, 0.53858873988903566, 0.53929436911430906,
+        0.54000000000000004, 0.54070563088569101, 0.54141126011096441, 0.54211688601540642,
+        0.542822506938611, 0.54352812122018423, 0.54423372719974761, 0.54493932321694172,
+        0.54564490761143114, 0.54635047872290776, 0.54705603489109456, 0.54776157445574958,
+        0.54846709575667019, 0.5491725971336967, 0.54987807692671598, 0.55058353347566613,
+        0.5512889651205396, 0.55199437020138786, 0.55269974705832425, 0.55340509403152915,
+        0.55411040946125278, 0.55481569168782019, 0.55552093905163369, 0.55622614989317842,
+        0.55693132255302513, 0.55763645537183426, 0.55834154669036029, 0.55904659484945529,
+        0.55975159819007281, 0.56045655505327185, 0.56116146378022069, 0.56186632271220127,
+        0.56257113019061233, 0.56327588455697364, 0.56398058415293029, 0.56468522732025606,
+        0.56538981240085739, 0.56609433773677753, 0.56679880167020047, 0.56750320254345443,
+        0.56820753869901597, 0.56891180847951428, 0.56961601022773434, 0.57032014228662176,
+        0.57102420299928547, 0.57172819070900271, 0.57243210375922238, 0.57313594049356908,
+        0.57383969925584699, 0.57454337839004377, 0.5752469762403345, 0.57595049115108532,
+        0.57665392146685779, 0.57735726553241251, 0.57806052169271283, 0.57876368829292912,
+        0.5794667636784423, 0.5801697461948484, 0.58087263418796131, 0.58157542600381784,
+        0.58227811998868106, 0.58298071448904398, 0.58368320785163397, 0.5843855984234162,
+        0.58508788455159788, 0.58579006458363192, 0.58649213686722079, 0.58719409975032066,
+        0.58789595158114516, 0.58859769070816892, 0.58929931548013204, 0.59000082424604372,
+        0.59070221535518619, 0.59140348715711821, 0.59210463800167956, 0.59280566623899467,
+        0.59350657021947617, 0.59420734829382948, 0.594907998813056, 0.59560852012845755,
+        0.59630891059163948, 0.59700916855451558, 0.59770929236931125, 0.59840928038856755,
+        0.59910913096514484, 0.59980884245222732, 0.60050841320332626, 0.60120784157228402,
+        0.601907125913278, 0.60260626458082478, 0.60330525592978357, 0.60400409831536006,
+        0.60470279009311068, 0.6054013296189461, 0.60609971524913553, 0.60679794534030984,
+        0.60749601824946642, 0.60819393233397223, 0.60889168595156795, 0.60958927746037195,
+        0.61028670521888395, 0.61098396758598927, 0.61168106292096203, 0.61237798958346956,
+        0.61307474593357625, 0.61377133033174702, 0.6144677411388515, 0.61516397671616763,
+        0.61586003542538625, 0.61655591562861356, 0.61725161568837639, 0.61794713396762524,
+        0.61864246882973861, 0.61933761863852621, 0.62003258175823339, 0.62072735655354483,
+        0.62142194138958851, 0.62211633463193883, 0.62281053464662173, 0.62350453980011755,
+        0.62419834845936484, 0.62489195899176497, 0.62558536976518542, 0.6262785791479637,
+        0.62697158550891086, 0.62766438721731621, 0.62835698264295048, 0.62904937015606965,
+        0.629741548127419, 0.63043351492823685, 0.63112526893025866, 0.63181680850572031,
+        0.63250813202736222, 0.63319923786843368, 0.63389012440269576, 0.63458079000442569,
+        0.63527123304842048, 0.6359614519100012, 0.63665144496501602, 0.63734121058984472,
+        0.63803074716140196, 0.63872005305714197, 0.639409126655061, 0.64009796633370253,
+        0.64078657047216003, 0.64147493745008188, 0.64216306564767367, 0.64285095344570342,
+        0.64353859922550471, 0.64422600136898067, 0.6449131582586074, 0.64560006827743865,
+        0.64628672980910873, 0.64697314123783667, 0.64765930094842994, 0.64834520732628875,
+        0.64903085875740896, 0.64971625362838648, 0.65040139032642108, 0.65108626723931984,
+        0.65177088275550144, 0.65245523526399918, 0.65313932315446555, 0.65382314481717574,
+        0.65450669864303124, 0.65518998302356402, 0.65587299635093976, 0.65655573701796233,
+        0.65723820341807671, 0.65792039394537372, 0.6586023069945931, 0.65928394096112775,
+        0.65996529424102679, 0.66064636523100029, 0.66132715232842254, 0.66200765393133543,
+        0.66268786843845329, 0.66336779424916537, 0.66404742976354103, 0.66472677338233166,
+        0.66540582350697652, 0.6660845785396049, 0.66676303688304084, 0.66744119694080595,
+        0.66811905711712438, 0.66879661581692573, 0.66947387144584869, 0.67015082241024548,
+        0.67082746711718499, 0.67150380397445719, 0.67217983139057558, 0.67285554777478274,
+        0.67353095153705267, 0.67420604108809512, 0.67488081483935902, 0.6755552712030366,
+        0.67622940859206704, 0.6769032254201397, 0.67757672010169867, 0.67824989105194577,
+        0.678922736686845, 0.67959525542312527, 0.68026744567828512, 0.68093930587059615,
+        0.68161083441910608, 0.6822820297436436, 0.68295289026482131, 0.68362341440403951,
+        0.68429360058349009, 0.68496344722616032, 0.68563295275583624, 0.68630211559710697,
+        0.68697093417536725, 0.68763940691682257, 0.68830753224849217, 0.68897530859821232,
+        0.68964273439464097, 0.69030980806726061, 0.69097652804638265, 0.69164289276315027,
+        0.69230890064954309, 0.69297455013838027, 0.69363983966332432, 0.69430476765888449,
+        0.69496933256042115, 0.69563353280414897, 0.69629736682714038, 0.69696083306732992,
+        0.69762392996351741, 0.69828665595537198, 0.69894900948343497, 0.69961098898912488,
+        0.70027259291473987, 0.70093381970346214, 0.70159466779936086, 0.70225513564739694,
+        0.70291522169342557, 0.70357492438420066, 0.70423424216737784, 0.70489317349151881,
+        0.70555171680609463, 0.70620987056148898, 0.7068676332090027, 0.70752500320085665,
+        0.70818197899019597, 0.70883855903109294, 0.70949474177855132, 0.71015052568850978,
+        0.71080590921784526, 0.71146089082437725, 0.71211546896687072, 0.71276964210504001,
+        0.71342340869955245, 0.71407676721203217, 0.71472971610506353, 0.71538225384219478,
+        0.7160343788879413, 0.71668608970779013, 0.71733738476820275, 0.71798826253661874,
+        0.71863872148146013, 0.71928876007213394, 0.71993837677903683, 0.72058757007355767,
+        0.7212363384280821, 0.72188468031599551, 0.72253259421168681, 0.72318007859055189,
+        0.7238271319289975, 0.72447375270444492, 0.72511993939533248, 0.72576569048112094,
+        0.72641100444229534, 0.72705587976036978, 0.72770031491789022, 0.72834430839843844,
+        0.72898785868663585, 0.72963096426814622, 0.73027362362967985, 0.7309158352589975,
+        0.73155759764491302, 0.73219890927729769, 0.73283976864708311, 0.7334801742462651,
+        0.73412012456790787, 0.7347596181061461, 0.73539865335619004, 0.73603722881432787,
+        0.73667534297792969, 0.73731299434545161, 0.73795018141643809, 0.73858690269152627,
+        0.73922315667244987, 0.73985894186204171, 0.74049425676423752, 0.74112909988408027,
+        0.74176346972772267, 0.74239736480243135, 0.7430307836165897, 0.74366372467970221,
+        0.74429618650239748, 0.74492816759643166, 0.74555966647469207, 0.74619068165120117,
+        0.74682121164111914, 0.74745125496074771, 0.74808081012753469, 0.7487098756600753,
+        0.74933845007811817, 0.74996653190256668, 0.7505941196554835, 0.75122121186009427,
+        0.75184780704079046, 0.75247390372313283, 0.75309950043385565, 0.75372459570086947,
+        0.75434918805326445, 0.7549732760213147, 0.75559685813648081, 0.75621993293141399,
+        0.75684249893995892, 0.75746455469715768, 0.75808609873925303, 0.7587071296036918,
+        0.75932764582912815, 0.75994764595542785, 0.76056712852367048, 0.76118609207615362,
+        0.76180453515639646, 0.76242245630914252, 0.7630398540803639, 0.76365672701726384,
+        0.76427307366828046, 0.76488889258309112, 0.76550418231261397, 0.76611894140901293,
+        0.76673316842570072, 0.76734686191734158, 0.76796002043985534, 0.76857264255042113,
+        0.76918472680747962, 0.76979627177073762, 0.77040727600117087, 0.77101773806102691,
+        0.77162765651383003, 0.77223702992438314, 0.77284585685877139, 0.77345413588436662,
+        0.77406186556982925, 0.77466904448511265, 0.77527567120146645, 0.77588174429143897,
+        0.77648726232888199, 0.77709222388895305, 0.77769662754811886, 0.77830047188415974,
+        0.7789037554761713, 0.77950647690456887, 0.78010863475109105, 0.78071022759880204,
+        0.78131125403209567, 0.78191171263669901, 0.78251160199967451, 0.78311092070942512,
+        0.78370966735569558, 0.78430784052957725, 0.78490543882351105, 0.78550246083129038,
+        0.78609890514806469, 0.78669477037034308, 0.78729005509599703, 0.78788475792426382,
+        0.78847887745575074, 0.78907241229243674, 0.78966536103767737, 0.79025772229620661,
+        0.79084949467414134, 0.79144067677898411, 0.79203126721962613, 0.79262126460635107,
+        0.79321066755083813, 0.79379947466616541, 0.79438768456681264, 0.79497529586866533,
+        0.79556230718901699, 0.79614871714657365, 0.79673452436145586, 0.79731972745520252,
+        0.79790432505077458, 0.79848831577255719, 0.7990716982463637, 0.79965447109943899,
+        0.80023663296046221, 0.80081818245954994, 0.80139911822826049, 0.80197943889959578,
+        0.80255914310800491, 0.80313822948938829, 0.80371669668109935, 0.80429454332194927,
+        0.80487176805220884, 0.80544836951361254, 0.80602434634936149, 0.80659969720412672,
+        0.80717442072405166, 0.80774851555675675, 0.80832198035134128, 0.80889481375838712,
+        0.80946701442996194, 0.81003858101962223, 0.81060951218241684, 0.81117980657488942,
+        0.81174946285508209, 0.8123184796825389, 0.81288685571830799, 0.81345458962494566,
+        0.81402168006651943, 0.8145881257086105, 0.81515392521831742, 0.81571907726425974,
+        0.81628358051657968, 0.81684743364694679, 0.81741063532856018, 0.81797318423615173,
+        0.81853507904598977, 0.81909631843588138, 0.81965690108517586, 0.8202168256747685,
+        0.82077609088710246, 0.82133469540617243, 0.82189263791752853, 0.82244991710827753,
+        0.82300653166708826, 0.82356248028419277, 0.82411776165138972, 0.82467237446204911,
+        0.82522631741111308, 0.82577958919510031, 0.8263321885121091, 0.82688411406181961,
+        0.82743536454549771, 0.82798593866599801, 0.8285358351277663, 0.82908505263684307,
+        0.82963358990086644, 0.83018144562907525, 0.83072861853231217, 0.83127510732302645,
+        0.83182091071527697, 0.83236602742473587, 0.83291045616869086, 0.83345419566604828,
+        0.83399724463733693, 0.83453960180470976, 0.8350812658919482, 0.83562223562446447,
+        0.83616250972930406, 0.83670208693515025, 0.83724096597232567, 0.83777914557279554,
+        0.83831662447017175, 0.83885340139971443, 0.83938947509833528, 0.83992484430460146,
+        0.84045950775873723, 0.84099346420262822, 0.84152671237982313, 0.84205925103553736,
+        0.84259107891665619, 0.84312219477173733, 0.84365259735101339, 0.8441822854063965,
+        0.84471125769147914, 0.84523951296153821, 0.84576704997353869, 0.84629386748613444,
+        0.84681996425967321, 0.84734533905619858, 0.84786999063945256, 0.8483939177748796,
+        0.84891711922962854, 0.84943959377255551, 0.84996134017422786, 0.85048235720692555,
+        0.8510026436446454, 0.85152219826310305, 0.85204101983973624, 0.85255910715370797,
+        0.85307645898590845, 0.85359307411895879, 0.8541089513372141, 0.85462408942676515,
+        0.85513848717544216, 0.85565214337281781, 0.85616505681020927, 0.85667722628068166,
+        0.85718865057905091, 0.8576993285018859, 0.85820925884751253, 0.85871844041601542,
+        0.85922687200924086, 0.85973455243080044, 0.86024148048607296, 0.86074765498220773,
+        0.86125307472812751, 0.86175773853453064, 0.86226164521389426, 0.86276479358047753,
+        0.86326718245032352, 0.8637688106412631, 0.86426967697291635, 0.86476978026669626,
+        0.86526911934581185, 0.86576769303527001, 0.8662655001618782, 0.86676253955424865,
+        0.86725881004279959, 0.86775431045975848, 0.86824903963916511, 0.8687429964168738,
+        0.86923617963055655, 0.86972858811970588, 0.87022022072563665, 0.87071107629149003,
+        0.87120115366223561, 0.87169045168467374, 0.87217896920743909, 0.87266670508100264,
+        0.87315365815767476, 0.87363982729160794, 0.87412521133879917, 0.87460980915709285,
+        0.87509361960618359, 0.87557664154761849, 0.87605887384480075, 0.87654031536299071,
+        0.87702096496930992, 0.87750082153274378, 0.87797988392414328, 0.87845815101622815,
+        0.87893562168359018, 0.87941229480269434, 0.87988816925188296, 0.88036324391137755,
+        0.88083751766328111, 0.88131098939158226, 0.88178365798215608, 0.88225552232276749,
+        0.88272658130307446, 0.88319683381462943, 0.88366627875088288, 0.88413491500718577,
+        0.88460274148079132, 0.885069757070859, 0.88553596067845586, 0.88600135120655965,
+        0.88646592756006171, 0.88692968864576904, 0.88739263337240681, 0.88785476065062152,
+        0.88831606939298302, 0.88877655851398707, 0.88923622693005855, 0.88969507355955302,
+        0.89015309732276049, 0.89061029714190632, 0.8910666719411553, 0.89152222064661379,
+        0.89197694218633117, 0.89243083549030389, 0.89288389949047731, 0.89333613312074811,
+        0.89378753531696664, 0.89423810501694012, 0.89468784116043432, 0.89513674268917687,
+        0.89558480854685907, 0.89603203767913842, 0.89647842903364205, 0.89692398155996766,
+        0.8973686942096869, 0.89781256593634851, 0.89825559569547897, 0.89869778244458665,
+        0.89913912514316352, 0.89957962275268732, 0.90001927423662487, 0.90045807856043369,
+        0.90089603469156454, 0.90133314159946487, 0.90176939825557945, 0.90220480363335442,
+        0.90263935670823892, 0.90307305645768743, 0.90350590186116264, 0.90393789190013751,
+        0.90436902555809762, 0.90479930182054402, 0.90522871967499507, 0.90565727811098895,
+        0.90608497612008643, 0.90651181269587267, 0.90693778683395987, 0.90736289753199006,
+        0.90778714378963643, 0.90821052460860652, 0.90863303899264458, 0.90905468594753325,
+        0.90947546448109673, 0.90989537360320227, 0.91031441232576316, 0.91073257966274113,
+        0.91114987463014774, 0.91156629624604757, 0.91198184353056055, 0.91239651550586376,
+        0.9128103111961936, 0.9132232296278493, 0.91363526982919385, 0.91404643083065662,
+        0.9144567116647363, 0.91486611136600215, 0.91527462897109757, 0.91568226351874094,
+        0.91608901404972853, 0.91649487960693743, 0.91689985923532669, 0.91730395198193992,
+        0.9177071568959082, 0.91810947302845114, 0.91851089943288011, 0.91891143516460017,
+        0.91931107928111166, 0.91970983084201374, 0.92010768890900529, 0.92050465254588776,
+        0.92090072081856766, 0.92129589279505797, 0.92169016754548061, 0.92208354414206939,
+        0.92247602165917097, 0.92286759917324768, 0.92325827576288011, 0.9236480505087683,
+        0.92403692249373481, 0.92442489080272627, 0.9248119545228155, 0.92519811274320451,
+        0.92558336455522561, 0.92596770905234393, 0.92635114533015983, 0.92673367248641081,
+        0.92711528962097334, 0.92749599583586551, 0.92787579023524891, 0.92825467192543054,
+        0.92863264001486534, 0.92900969361415764, 0.92938583183606394, 0.92976105379549501,
+        0.93013535860951668, 0.93050874539735429, 0.93088121328039231, 0.93125276138217761,
+        0.93162338882842199, 0.93199309474700309, 0.93236187826796735, 0.93272973852353136,
+        0.93309667464808421, 0.93346268577819025, 0.93382777105258952, 0.93419192961220121,
+        0.93455516060012522, 0.9349174631616437, 0.93527883644422394, 0.93563927959751947,
+        0.93599879177337297, 0.93635737212581738, 0.93671501981107874, 0.93707173398757715,
+        0.93742751381592992, 0.93778235845895275, 0.93813626708166176, 0.938489238851276,
+        0.93884127293721864, 0.93919236851111954, 0.93954252474681688, 0.93989174082035909,
+        0.94024001591000728, 0.94058734919623643, 0.94093373986173745, 0.94127918709142011,
+        0.94162369007241353, 0.94196724799406883, 0.94230986004796113, 0.9426515254278911,
+        0.94299224332988696, 0.94333201295220703, 0.9436708334953402, 0.9440087041620091,
+        0.94434562415717149, 0.94468159268802188, 0.94501660896399398, 0.94535067219676217,
+        0.94568378160024325, 0.94601593639059889, 0.94634713578623664, 0.94667737900781201,
+        0.94700666527823141, 0.94733499382265196, 0.94766236386848512, 0.94798877464539744,
+        0.94831422538531274, 0.94863871532241428, 0.94896224369314575, 0.94928480973621343,
+        0.94960641269258872, 0.94992705180550829, 0.95024672632047769, 0.95056543548527173,
+        0.95088317854993698, 0.95119995476679353, 0.95151576339043609, 0.95183060367773642,
+        0.95214447488784515, 0.95245737628219296, 0.95276930712449248, 0.95308026668074031,
+        0.95339025421921886, 0.95369926901049706, 0.9540073103274338, 0.95431437744517755,
+        0.9546204696411702, 0.95492558619514689, 0.95522972638913906, 0.9555328895074755,
+        0.95583507483678398, 0.95613628166599329, 0.95643650928633472, 0.9567357569913435,
+        0.95703402407686111, 0.95733130984103609, 0.95762761358432646, 0.95792293460950084,
+        0.95821727222164033, 0.95851062572813994, 0.95880299443871086, 0.95909437766538119,
+        0.95938477472249772, 0.95967418492672851, 0.95996260759706331, 0.96025004205481546,
+        0.9605364876236242, 0.96082194362945517, 0.96110640940060321, 0.96138988426769267,
+        0.96167236756367958, 0.96195385862385385, 0.96223435678583968, 0.9625138613895976,
+        0.9627923717774266, 0.9630698872939647, 0.96334640728619081, 0.9636219311034272,
+        0.96389645809733926, 0.96416998762193873, 0.96444251903358424, 0.96471405169098268,
+        0.9649845849551919, 0.96525411818962081, 0.96552265076003163, 0.96579018203454148,
+        0.96605671138362337, 0.96632223818010765, 0.96658676179918457, 0.96685028161840425,
+        0.96711279701767916, 0.96737430737928531, 0.96763481208786339, 0.96789431053042074,
+        0.96815280209633259, 0.96841028617734293, 0.96866676216756731, 0.96892222946349271,
+        0.96917668746398, 0.96943013557026469, 0.96968257318595907, 0.96993399971705319,
+        0.97018441457191595, 0.97043381716129695, 0.97068220689832807, 0.97092958319852407,
+        0.97117594547978447, 0.97142129316239534, 0.97166562566902981, 0.97190894242474979,
+        0.97215124285700738, 0.97239252639564644, 0.97263279247290346, 0.97287204052340903,
+        0.97311026998418959, 0.973347480294668, 0.97358367089666564, 0.97381884123440299,
+        0.97405299075450191, 0.97428611890598549, 0.97451822514028086, 0.97474930891121991,
+        0.97497936967503973, 0.97520840689038557, 0.97543642001831055, 0.97566340852227751,
+        0.97588937186816094, 0.97611430952424705, 0.9763382209612359, 0.9765611056522423,
+        0.97678296307279688, 0.97700379270084792, 0.97722359401676162, 0.9774423665033245,
+        0.9776601096457439, 0.97787682293164901, 0.97809250585109231, 0.97830715789655143,
+        0.97852077856292929, 0.97873336734755556, 0.9789449237501886, 0.97915544727301573,
+        0.97936493742065456, 0.97957339370015473, 0.97978081562099839, 0.97998720269510176,
+        0.98019255443681619, 0.98039687036292889, 0.9806001499926652, 0.98080239284768811,
+        0.98100359845210094, 0.98120376633244732, 0.98140289601771291, 0.9816009870393263,
+        0.98179803893116024, 0.98199405122953265, 0.98218902347320758, 0.98238295520339647,
+        0.98257584596375913, 0.9827676953004052, 0.98295850276189456, 0.98314826789923893,
+        0.98333699026590238, 0.98352466941780314, 0.98371130491331393, 0.98389689631326338,
+        0.98408144318093715, 0.98426494508207851, 0.98444740158488986, 0.98462881226003329,
+        0.98480917668063195, 0.9849884944222711, 0.98516676506299872, 0.9853439881833268,
+        0.98552016336623205, 0.9856952901971574, 0.98586936826401228, 0.98604239715717457,
+        0.98621437646949028, 0.98638530579627559, 0.98655518473531711, 0.98672401288687361,
+        0.98689178985367587, 0.98705851524092858, 0.98722418865631067, 0.98738880970997689,
+        0.98755237801455764, 0.98771489318516126, 0.98787635483937353, 0.9880367625972597,
+        0.98819611608136493, 0.98835441491671494, 0.98851165873081737, 0.98866784715366229,
+        0.98882297981772316, 0.98897705635795807, 0.98913007641180983, 0.98928203961920747,
+        0.98943294562256701, 0.98958279406679206, 0.98973158459927468, 0.98987931686989628,
+        0.99002599053102869, 0.99017160523753467, 0.99031616064676864, 0.99045965641857781,
+        0.99060209221530271, 0.99074346770177812, 0.99088378254533405, 0.99102303641579592,
+        0.99116122898548609, 0.99129835992922388, 0.99143442892432709, 0.99156943565061229,
+        0.99170337979039547, 0.9918362610284932, 0.99196807905222295, 0.99209883355140449,
+        0.9922285242183595, 0.99235715074791364, 0.99248471283739592, 0.99261121018664078,
+        0.99273664249798743, 0.99286100947628175, 0.99298431082887606, 0.99310654626563033,
+        0.99322771549891309, 0.99334781824360108, 0.99346685421708103, 0.9935848231392499,
+        0.99370172473251539, 0.99381755872179678, 0.99393232483452532, 0.99404602280064558,
+        0.99415865235261491, 0.99427021322540532, 0.99438070515650323, 0.9944901278859104,
+        0.9945984811561448, 0.99470576471224048, 0.99481197830174906, 0.99491712167473945,
+        0.99502119458379934, 0.99512419678403496, 0.99522612803307242, 0.99532698809105757,
+        0.9954267767206566, 0.99552549368705789, 0.99562313875797037, 0.99571971170362583,
+        0.99581521229677894, 0.99590964031270746, 0.99600299552921312, 0.99609527772662232,
+        0.99618648668778587, 0.99627662219808033, 0.99636568404540826, 0.99645367202019841,
+        0.99654058591540662, 0.99662642552651615, 0.99671119065153801, 0.99679488109101166,
+        0.99687749664800551, 0.99695903712811718, 0.99703950233947392, 0.99711889209273341,
+        0.99719720620108387, 0.9972744444802446, 0.99735060674846654, 0.99742569282653237,
+        0.99749970253775755, 0.99757263570798993, 0.99764449216561069, 0.99771527174153463,
+        0.99778497426921064, 0.99785359958462183, 0.99792114752628647, 0.99798761793525737,
+        0.99805301065512353, 0.99811732553200949, 0.99818056241457598, 0.99824272115402068,
+        0.99830380160407794, 0.99836380362101962, 0.9984227270636552, 0.99848057179333227,
+        0.99853733767393626, 0.99859302457189192, 0.99864763235616216, 0.99870116089825012,
+        0.99875361007219754, 0.99880497975458671, 0.99885526982453965, 0.99890448016371902,
+        0.99895261065632823, 0.99899966118911143, 0.99904563165135429, 0.99909052193488379,
+        0.99913433193406864, 0.99917706154581998, 0.99921871066959078, 0.99925927920737645,
+        0.99929876706371568, 0.99933717414568934, 0.99937450036292197, 0.99941074562758159,
+        0.99944590985437931, 0.99947999296057044, 0.99951299486595424, 0.99954491549287383,
+        0.99957575476621696, 0.99960551261341579, 0.99963418896444745, 0.99966178375183357,
+        0.99968829691064087, 0.99971372837848138, 0.99973807809551252, 0.99976134600443678,
+        0.99978353205050285, 0.99980463618150472, 0.99982465834778222, 0.99984359850222138,
+        0.99986145660025394, 0.99987823259985842, 0.99989392646155906, 0.99990853814842684,
+        0.99992206762607883, 0.99993451486267904, 0.99994587982893779, 0.99995616249811237,
+        0.99996536284600657, 0.99997348085097104, 0.99998051649390352, 0.99998646975824812,
+        0.99999134062999651, 0.99999512909768717, 0.99999783515240503, 0.99999945878778296,
+        1, 0.99999945878778296, 0.99999783515240503, 0.99999512909768717,
+        0.99999134062999651, 0.99998646975824812, 0.99998051649390352, 0.99997348085097104,
+        0.99996536284600657, 0.99995616249811237, 0.99994587982893779, 0.99993451486267904,
+        0.99992206762607883, 0.99990853814842684, 0.99989392646155906, 0.99987823259985842,
+        0.99986145660025394, 0.99984359850222138, 0.99982465834778222, 0.99980463618150472,
+        0.99978353205050285, 0.99976134600443678, 0.99973807809551252, 0.99971372837848138,
+        0.99968829691064087, 0.99966178375183357, 0.99963418896444745, 0.99960551261341579,
+        0.99957575476621696, 0.99954491549287383, 0.99951299486595424, 0.99947999296057044,
+        0.99944590985437931, 0.99941074562758159, 0.99937450036292208, 0.99933717414568934,
+        0.99929876706371568, 0.99925927920737645, 0.99921871066959078, 0.99917706154581998,
+        0.99913433193406864, 0.99909052193488379, 0.99904563165135429, 0.99899966118911143,
+        0.99895261065632823, 0.99890448016371902, 0.99885526982453965, 0.99880497975458671,
+        0.99875361007219754, 0.99870116089825012, 0.99864763235616216, 0.99859302457189192,
+        0.99853733767393638, 0.99848057179333227, 0.9984227270636552, 0.99836380362101962,
+        0.99830380160407794, 0.99824272115402068, 0.99818056241457598, 0.99811732553200949,
+        0.99805301065512353, 0.99798761793525737, 0.99792114752628647, 0.99785359958462183,
+        0.99778497426921064, 0.99771527174153463, 0.99764449216561069, 0.99757263570798993,
+        0.99749970253775766, 0.99742569282653237, 0.99735060674846654, 0.9972744444802446,
+        0.99719720620108387, 0.99711889209273341, 0.99703950233947392, 0.99695903712811718,
+        0.99687749664800562, 0.99679488109101166, 0.99671119065153801, 0.99662642552651615,
+        0.99654058591540662, 0.99645367202019841, 0.99636568404540826, 0.99627662219808033,
+        0.99618648668778587, 0.99609527772662232, 0.99600299552921312, 0.99590964031270746,
+        0.99581521229677894, 0.99571971170362583, 0.99562313875797037, 0.99552549368705789,
+        0.99542677672065671, 0.99532698809105757, 0.99522612803307253, 0.99512419678403496,
+        0.99502119458379934, 0.99491712167473945, 0.99481197830174906, 0.99470576471224059,
+        0.9945984811561448, 0.99449012788591051, 0.99438070515650323, 0.99427021322540532,
+        0.99415865235261491, 0.99404602280064558, 0.99393232483452532, 0.99381755872179678,
+        0.9937017247325155, 0.9935848231392499, 0.99346685421708103, 0.99334781824360108,
+        0.99322771549891309, 0.99310654626563033, 0.99298431082887606, 0.99286100947628175,
+        0.99273664249798743, 0.99261121018664078, 0.99248471283739592, 0.99235715074791364,
+        0.99222852421835961, 0.99209883355140449, 0.99196807905222295, 0.9918362610284932,
+        0.99170337979039547, 0.99156943565061229, 0.9914344289243272, 0.99129835992922399,
+        0.99116122898548609, 0.99102303641579592, 0.99088378254533405, 0.99074346770177824,
+        0.99060209221530271, 0.99045965641857781, 0.99031616064676864, 0.99017160523753467,
+        0.9900259905310288, 0.98987931686989628, 0.98973158459927468, 0.98958279406679206,
+        0.98943294562256701, 0.98928203961920747, 0.98913007641180983, 0.98897705635795807,
+        0.98882297981772327, 0.98866784715366229, 0.98851165873081737, 0.98835441491671494,
+        0.98819611608136493, 0.98803676259725981, 0.98787635483937353, 0.98771489318516126,
+        0.98755237801455775, 0.987388809709977, 0.98722418865631079, 0.98705851524092858,
+        0.98689178985367598, 0.98672401288687372, 0.98655518473531711, 0.98638530579627559,
+        0.98621437646949028, 0.98604239715717457, 0.98586936826401239, 0.9856952901971574,
+        0.98552016336623205, 0.9853439881833268, 0.98516676506299872, 0.98498849442227121,
+        0.98480917668063206, 0.98462881226003329, 0.98444740158488986, 0.98426494508207862,
+        0.98408144318093715, 0.98389689631326349, 0.98371130491331393, 0.98352466941780314,
+        0.98333699026590238, 0.98314826789923893, 0.98295850276189467, 0.9827676953004052,
+        0.98257584596375924, 0.98238295520339647, 0.98218902347320758, 0.98199405122953265,
+        0.98179803893116036, 0.98160098703932641, 0.98140289601771302, 0.98120376633244732,
+        0.98100359845210106, 0.98080239284768822, 0.9806001499926652, 0.98039687036292889,
+        0.98019255443681619, 0.97998720269510176, 0.97978081562099839, 0.97957339370015473,
+        0.97936493742065456, 0.97915544727301573, 0.9789449237501886, 0.97873336734755556,
+        0.97852077856292929, 0.97830715789655143, 0.97809250585109231, 0.97787682293164901,
+        0.97766010964574401, 0.97744236650332461, 0.97722359401676173, 0.97700379270084792,
+        0.97678296307279699, 0.9765611056522423, 0.9763382209612359, 0.97611430952424716,
+        0.97588937186816094, 0.97566340852227751, 0.97543642001831055, 0.97520840689038568,
+        0.97497936967503984, 0.97474930891121991, 0.97451822514028097, 0.97428611890598549,
+        0.97405299075450191, 0.9738188412344031, 0.97358367089666564, 0.973347480294668,
+        0.97311026998418959, 0.97287204052340914, 0.97263279247290346, 0.97239252639564644,
+        0.97215124285700749, 0.97190894242474979, 0.97166562566902992, 0.97142129316239534,
+        0.97117594547978459, 0.97092958319852407, 0.97068220689832807, 0.97043381716129695,
+        0.97018441457191607, 0.96993399971705319, 0.96968257318595907, 0.96943013557026481,
+        0.96917668746398, 0.96892222946349271, 0.96866676216756742, 0.96841028617734304,
+        0.96815280209633259, 0.96789431053042074, 0.96763481208786339, 0.96737430737928531,
+        0.96711279701767916, 0.96685028161840425, 0.96658676179918457, 0.96632223818010776,
+        0.96605671138362337, 0.96579018203454159, 0.96552265076003174, 0.96525411818962092,
+        0.96498458495519202, 0.96471405169098279, 0.96444251903358424, 0.96416998762193884,
+        0.96389645809733926, 0.96362193110342731, 0.96334640728619092, 0.9630698872939647,
+        0.9627923717774266, 0.96251386138959771, 0.9622343567858398, 0.96195385862385396,
+        0.96167236756367969, 0.96138988426769267, 0.96110640940060321, 0.96082194362945528,
+        0.9605364876236242, 0.96025004205481546, 0.95996260759706331, 0.95967418492672851,
+        0.95938477472249772, 0.9590943776653813, 0.95880299443871098, 0.95851062572814005,
+        0.95821727222164044, 0.95792293460950084, 0.95762761358432646, 0.9573313098410362,
+        0.95703402407686111, 0.95673575699134361, 0.95643650928633472, 0.95613628166599329,
+        0.95583507483678409, 0.9555328895074755, 0.95522972638913917, 0.95492558619514689,
+        0.9546204696411702, 0.95431437744517766, 0.9540073103274338, 0.95369926901049717,
+        0.95339025421921897, 0.95308026668074042, 0.95276930712449248, 0.95245737628219307,
+        0.95214447488784526, 0.95183060367773642, 0.95151576339043609, 0.95119995476679353,
+        0.95088317854993709, 0.95056543548527184, 0.95024672632047769, 0.9499270518055084,
+        0.94960641269258872, 0.94928480973621354, 0.94896224369314575, 0.94863871532241439,
+        0.94831422538531285, 0.94798877464539744, 0.94766236386848512, 0.94733499382265207,
+        0.94700666527823141, 0.94667737900781213, 0.94634713578623675, 0.946015936390599,
+        0.94568378160024336, 0.94535067219676228, 0.94501660896399398, 0.94468159268802188,
+        0.94434562415717149, 0.9440087041620091, 0.9436708334953402, 0.94333201295220714,
+        0.94299224332988707, 0.9426515254278911, 0.94230986004796113, 0.94196724799406883,
+        0.94162369007241353, 0.94127918709142011, 0.94093373986173745, 0.94058734919623643,
+        0.94024001591000728, 0.93989174082035909, 0.93954252474681699, 0.93919236851111965,
+        0.93884127293721875, 0.93848923885127611, 0.93813626708166176, 0.93778235845895286,
+        0.93742751381593004, 0.93707173398757715, 0.93671501981107874, 0.93635737212581749,
+        0.93599879177337297, 0.93563927959751958, 0.93527883644422394, 0.93491746316164381,
+        0.93455516060012522, 0.93419192961220121, 0.93382777105258963, 0.93346268577819025,
+        0.93309667464808432, 0.93272973852353136, 0.93236187826796735, 0.9319930947470032,
+        0.93162338882842211, 0.93125276138217772, 0.93088121328039231, 0.9305087453973544,
+        0.93013535860951679, 0.92976105379549501, 0.92938583183606405, 0.92900969361415764,
+        0.92863264001486545, 0.92825467192543065, 0.92787579023524902, 0.92749599583586562,
+        0.92711528962097334, 0.92673367248641081, 0.92635114533015983, 0.92596770905234393,
+        0.92558336455522561, 0.92519811274320451, 0.9248119545228155, 0.92442489080272638,
+        0.92403692249373492, 0.92364805050876841, 0.92325827576288022, 0.92286759917324779,
+        0.92247602165917097, 0.92208354414206939, 0.92169016754548072, 0.92129589279505797,
+        0.92090072081856778, 0.92050465254588787, 0.92010768890900541, 0.91970983084201374,
+        0.91931107928111166, 0.91891143516460017, 0.91851089943288022, 0.91810947302845114,
+        0.91770715689590832, 0.91730395198193992, 0.9168998592353268, 0.91649487960693743,
+        0.91608901404972853, 0.91568226351874094, 0.91527462897109757, 0.91486611136600238,
+        0.91445671166473641, 0.91404643083065673, 0.91363526982919385, 0.91322322962784941,
+        0.9128103111961936, 0.91239651550586376, 0.91198184353056067, 0.91156629624604757,
+        0.91114987463014785, 0.91073257966274124, 0.91031441232576327, 0.90989537360320238,
+        0.90947546448109673, 0.90905468594753325, 0.90863303899264469, 0.90821052460860652,
+        0.90778714378963654, 0.90736289753199006, 0.90693778683395998, 0.90651181269587278,
+        0.90608497612008643, 0.90565727811098906, 0.90522871967499519, 0.90479930182054424,
+        0.90436902555809762, 0.90393789190013751, 0.90350590186116264, 0.90307305645768754,
+        0.90263935670823892, 0.90220480363335454, 0.90176939825557967, 0.90133314159946498,
+        0.90089603469156465, 0.90045807856043369, 0.90001927423662487, 0.89957962275268732,
+        0.89913912514316352, 0.89869778244458676, 0.89825559569547908, 0.89781256593634851,
+        0.89736869420968701, 0.89692398155996766, 0.89647842903364205, 0.89603203767913853,
+        0.89558480854685918, 0.89513674268917698, 0.89468784116043443, 0.89423810501694012,
+        0.89378753531696664, 0.89333613312074822, 0.89288389949047753, 0.892430835490304,
+        0.89197694218633128, 0.89152222064661379, 0.89106667194115541, 0.89061029714190643,
+        0.89015309732276049, 0.88969507355955324, 0.88923622693005866, 0.88877655851398707,
+        0.88831606939298302, 0.88785476065062152, 0.88739263337240692, 0.88692968864576915,
+        0.88646592756006193, 0.88600135120655965, 0.88553596067845586, 0.885069757070859,
+        0.88460274148079132, 0.88413491500718577, 0.88366627875088288, 0.88319683381462943,
+        0.88272658130307446, 0.88225552232276749, 0.88178365798215608, 0.88131098939158237,
+        0.88083751766328122, 0.88036324391137755, 0.87988816925188307, 0.87941229480269434,
+        0.87893562168359018, 0.87845815101622837, 0.87797988392414339, 0.87750082153274378,
+        0.87702096496930992, 0.87654031536299071, 0.87605887384480075, 0.87557664154761872,
+        0.87509361960618381, 0.87460980915709297, 0.87412521133879917, 0.87363982729160805,
+        0.87315365815767487, 0.87266670508100286, 0.87217896920743909, 0.87169045168467374,
+        0.87120115366223572, 0.87071107629149014, 0.87022022072563665, 0.86972858811970588,
+        0.86923617963055666, 0.8687429964168738, 0.86824903963916511, 0.86775431045975848,
+        0.8672588100427997, 0.86676253955424876, 0.8662655001618782, 0.86576769303527001,
+        0.86526911934581197, 0.86476978026669626, 0.86426967697291635, 0.8637688106412631,
+        0.86326718245032374, 0.86276479358047764, 0.86226164521389426, 0.86175773853453075,
+        0.86125307472812762, 0.86074765498220795, 0.86024148048607318, 0.85973455243080044,
+        0.85922687200924086, 0.85871844041601553, 0.85820925884751265, 0.8576993285018859,
+        0.85718865057905091, 0.85667722628068166, 0.85616505681020938, 0.85565214337281792,
+        0.85513848717544216, 0.85462408942676515, 0.85410895133721421, 0.85359307411895902,
+        0.85307645898590856, 0.85255910715370797, 0.85204101983973635, 0.85152219826310316,
+        0.8510026436446454, 0.85048235720692567, 0.84996134017422786, 0.84943959377255562,
+        0.84891711922962865, 0.84839391777487971, 0.84786999063945268, 0.84734533905619869,
+        0.84681996425967332, 0.84629386748613444, 0.8457670499735388, 0.84523951296153843,
+        0.84471125769147914, 0.8441822854063965, 0.84365259735101339, 0.84312219477173733,
+        0.8425910789166563, 0.84205925103553736, 0.84152671237982324, 0.84099346420262833,
+        0.84045950775873757, 0.83992484430460146, 0.83938947509833528, 0.8388534013997142,
+        0.83831662447017163, 0.83777914557279587, 0.83724096597232567, 0.83670208693515025,
+        0.83616250972930417, 0.83562223562446436, 0.83508126589194853, 0.83453960180470999,
+        0.83399724463733693, 0.83345419566604839, 0.83291045616869086, 0.83236602742473575,
+        0.8318209107152772, 0.83127510732302645, 0.83072861853231228, 0.83018144562907537,
+        0.82963358990086644, 0.82908505263684329, 0.82853583512776652, 0.82798593866599823,
+        0.82743536454549782, 0.8268841140618195, 0.82633218851210888, 0.82577958919510053,
+        0.82522631741111319, 0.82467237446204922, 0.82411776165138995, 0.82356248028419266,
+        0.82300653166708859, 0.82244991710827786, 0.82189263791752865, 0.82133469540617265,
+        0.82077609088710235, 0.82021682567476839, 0.81965690108517619, 0.81909631843588149,
+        0.81853507904598977, 0.81797318423615184, 0.81741063532856018, 0.81684743364694712,
+        0.81628358051658001, 0.81571907726425985, 0.81515392521831753, 0.81458812570861039,
+        0.81402168006651932, 0.81345458962494588, 0.8128868557183081, 0.8123184796825389,
+        0.8117494628550822, 0.81117980657488942, 0.81060951218241706, 0.81003858101962245,
+        0.80946701442996205, 0.80889481375838712, 0.80832198035134128, 0.80774851555675675,
+        0.80717442072405188, 0.80659969720412672, 0.80602434634936171, 0.80544836951361265,
+        0.80487176805220884, 0.8042945433219495, 0.80371669668109957, 0.8031382294893884,
+        0.80255914310800502, 0.80197943889959578, 0.80139911822826049, 0.80081818245955017,
+        0.80023663296046221, 0.7996544710994391, 0.7990716982463637, 0.79848831577255708,
+        0.7979043250507748, 0.79731972745520285, 0.79673452436145598, 0.79614871714657376,
+        0.79556230718901699, 0.79497529586866522, 0.79438768456681297, 0.79379947466616563,
+        0.79321066755083836, 0.79262126460635107, 0.79203126721962613, 0.79144067677898433,
+        0.79084949467414156, 0.79025772229620683, 0.78966536103767737, 0.78907241229243685,
+        0.78847887745575074, 0.78788475792426416, 0.78729005509599714, 0.78669477037034319,
+        0.7860989051480648, 0.78550246083129038, 0.78490543882351127, 0.78430784052957747,
+        0.78370966735569569, 0.78311092070942523, 0.78251160199967462, 0.7819117126366989,
+        0.781311254032096, 0.78071022759880215, 0.78010863475109116, 0.77950647690456898,
+        0.77890375547617119, 0.77830047188415996, 0.77769662754811919, 0.77709222388895316,
+        0.7764872623288821, 0.77588174429143897, 0.77527567120146634, 0.77466904448511298,
+        0.77406186556982948, 0.77345413588436673, 0.7728458568587715, 0.77223702992438303,
+        0.77162765651383036, 0.77101773806102714, 0.77040727600117087, 0.76979627177073773,
+        0.76918472680747962, 0.76857264255042101, 0.76796002043985556, 0.76734686191734169,
+        0.76673316842570083, 0.76611894140901304, 0.76550418231261397, 0.76488889258309134,
+        0.76427307366828079, 0.76365672701726384, 0.76303985408036401, 0.76242245630914263,
+        0.76180453515639646, 0.76118609207615384, 0.76056712852367059, 0.75994764595542796,
+        0.75932764582912826, 0.75870712960369169, 0.75808609873925326, 0.7574645546971579,
+        0.75684249893995903, 0.7562199329314141, 0.75559685813648092, 0.75497327602131459,
+        0.75434918805326467, 0.75372459570086958, 0.75309950043385587, 0.75247390372313294,
+        0.75184780704079035, 0.75122121186009461, 0.75059411965548373, 0.74996653190256679,
+        0.74933845007811828, 0.74870987566007541, 0.74808081012753458, 0.74745125496074805,
+        0.74682121164111925, 0.74619068165120128, 0.74555966647469218, 0.74492816759643166,
+        0.74429618650239771, 0.74366372467970243, 0.74303078361658981, 0.74239736480243135,
+        0.74176346972772278, 0.74112909988408027, 0.74049425676423786, 0.73985894186204182,
+        0.73922315667245009, 0.73858690269152638, 0.73795018141643798, 0.73731299434545183,
+        0.73667534297793003, 0.73603722881432798, 0.73539865335619015, 0.73475961810614621,
+        0.73412012456790787, 0.73348017424626544, 0.73283976864708322, 0.7321989092772978,
+        0.73155759764491313, 0.7309158352589975, 0.73027362362968018, 0.72963096426814633,
+        0.72898785868663596, 0.72834430839843867, 0.72770031491789022, 0.72705587976036967,
+        0.72641100444229556, 0.72576569048112116, 0.72511993939533259, 0.72447375270444492,
+        0.7238271319289975, 0.72318007859055222, 0.72253259421168703, 0.72188468031599573,
+        0.72123633842808221, 0.72058757007355778, 0.71993837677903672, 0.71928876007213427,
+        0.71863872148146024, 0.71798826253661896, 0.71733738476820275, 0.71668608970779013,
+        0.71603437888794164, 0.71538225384219489, 0.71472971610506364, 0.71407676721203228,
+        0.71342340869955245, 0.7127696421050399, 0.71211546896687095, 0.71146089082437747,
+        0.71080590921784537, 0.71015052568850978, 0.70949474177855132, 0.70883855903109283,
+        0.70818197899019619, 0.70752500320085687, 0.70686763320900281, 0.70620987056148898,
+        0.70555171680609452, 0.70489317349151914, 0.70423424216737796, 0.70357492438420066,
+        0.70291522169342568, 0.70225513564739694, 0.70159466779936075, 0.70093381970346225,
+        0.70027259291474009, 0.69961098898912499, 0.69894900948343497, 0.69828665595537176,
+        0.69762392996351763, 0.69696083306733014, 0.6962973668271405, 0.69563353280414897,
+        0.69496933256042115, 0.69430476765888449, 0.69363983966332454, 0.6929745501383805,
+        0.69230890064954331, 0.69164289276315027, 0.69097652804638254, 0.69030980806726094,
+        0.68964273439464119, 0.68897530859821243, 0.68830753224849217, 0.68763940691682257,
+        0.68697093417536714, 0.68630211559710719, 0.68563295275583647, 0.68496344722616043,
+        0.68429360058349009, 0.6836234144040394, 0.68295289026482164, 0.68228202974364383,
+        0.68161083441910619, 0.68093930587059615, 0.68026744567828512, 0.67959525542312516,
+        0.67892273668684511, 0.678249891051946, 0.67757672010169867, 0.6769032254201397,
+        0.67622940859206693, 0.67555527120303682, 0.67488081483935924, 0.67420604108809523,
+        0.67353095153705278, 0.67285554777478274, 0.67217983139057558, 0.6715038039744573,
+        0.67082746711718522, 0.67015082241024559, 0.66947387144584869, 0.66879661581692562,
+        0.66811905711712472, 0.66744119694080617, 0.66676303688304084, 0.66608457853960501,
+        0.66540582350697652, 0.66472677338233166, 0.66404742976354114, 0.6633677942491657,
+        0.6626878684384534, 0.66200765393133543, 0.66132715232842243, 0.66064636523100051,
+        0.65996529424102701, 0.65928394096112786, 0.65860230699459321, 0.65792039394537372,
+        0.65723820341807659, 0.65655573701796255, 0.65587299635093999, 0.65518998302356413,
+        0.65450669864303135, 0.65382314481717563, 0.65313932315446577, 0.65245523526399929,
+        0.65177088275550155, 0.65108626723931995, 0.65040139032642108, 0.64971625362838636,
+        0.64903085875740918, 0.64834520732628886, 0.64765930094843005, 0.64697314123783667,
+        0.64628672980910862, 0.64560006827743899, 0.64491315825860762, 0.64422600136898078,
+        0.64353859922550483, 0.64285095344570342, 0.64216306564767356, 0.64147493745008211,
+        0.64078657047216026, 0.64009796633370253, 0.639409126655061, 0.63872005305714186,
+        0.63803074716140229, 0.63734121058984494, 0.63665144496501613, 0.63596145191000131,
+        0.63527123304842048, 0.63458079000442558, 0.63389012440269599, 0.63319923786843391,
+        0.63250813202736245, 0.63181680850572031, 0.63112526893025866, 0.63043351492823718,
+        0.62974154812741923, 0.62904937015606976, 0.62835698264295059, 0.62766438721731632,
+        0.62697158550891074, 0.62627857914796392, 0.62558536976518564, 0.6248919589917652,
+        0.62419834845936484, 0.62350453980011744, 0.62281053464662206, 0.62211633463193905,
+        0.62142194138958862, 0.62072735655354494, 0.62003258175823339, 0.6193376186385261,
+        0.61864246882973883, 0.61794713396762546, 0.6172516156883765, 0.61655591562861356,
+        0.61586003542538614, 0.61516397671616796, 0.61446774113885172, 0.61377133033174713,
+        0.61307474593357636, 0.61237798958346956, 0.61168106292096192, 0.6109839675859895,
+        0.61028670521888417, 0.60958927746037206, 0.60889168595156795, 0.60819393233397212,
+        0.60749601824946664, 0.60679794534031006, 0.60609971524913564, 0.60540132961894622,
+        0.60470279009311068, 0.60400409831535995, 0.60330525592978379, 0.602606264580825,
+        0.60190712591327822, 0.60120784157228402, 0.60050841320332615, 0.59980884245222765,
+        0.59910913096514506, 0.59840928038856767, 0.59770929236931136, 0.59700916855451558,
+        0.59630891059163937, 0.59560852012845777, 0.59490799881305623, 0.5942073482938296,
+        0.59350657021947628, 0.59280566623899456, 0.59210463800167989, 0.59140348715711843,
+        0.59070221535518641, 0.59000082424604394, 0.58929931548013204, 0.58859769070816881,
+        0.58789595158114538, 0.58719409975032089, 0.5864921368672209, 0.58579006458363192,
+        0.58508788455159788, 0.58438559842341653, 0.58368320785163419, 0.58298071448904409,
+        0.58227811998868118, 0.58157542600381795, 0.5808726341879612, 0.58016974619484862,
+        0.57946676367844252, 0.57876368829292923, 0.57806052169271283, 0.57735726553241251,
+        0.57665392146685812, 0.57595049115108554, 0.57524697624033461, 0.57454337839004388,
+        0.57383969925584699, 0.57313594049356897, 0.5724321037592226, 0.57172819070900294,
+        0.57102420299928558, 0.57032014228662176, 0.56961601022773445, 0.5689118084795145,
+        0.56820753869901619, 0.56750320254345454, 0.56679880167020058, 0.56609433773677753,
+        0.56538981240085728, 0.56468522732025628, 0.56398058415293051, 0.56327588455697375,
+        0.56257113019061233, 0.56186632271220127, 0.56116146378022103, 0.56045655505327197,
+        0.55975159819007292, 0.5590465948494554, 0.55834154669036029, 0.55763645537183415,
+        0.55693132255302535, 0.55622614989317865, 0.5555209390516338, 0.55481569168782019,
+        0.55411040946125278, 0.55340509403152938, 0.55269974705832448, 0.55199437020138797,
+        0.55128896512053971, 0.55058353347566613, 0.54987807692671586, 0.54917259713369693,
+        0.54846709575667041, 0.54776157445574969, 0.54705603489109456, 0.54635047872290776,
+        0.54564490761143147, 0.54493932321694194, 0.54423372719974772, 0.54352812122018435,
+        0.54282250693861112, 0.54211688601540631, 0.54141126011096463, 0.54070563088569124,
+        0.54000000000000015, 0.53929436911430906, 0.53858873988903566, 0.53788311398459399,
+        0.53717749306138918, 0.53647187877981584, 0.53576627280025257, 0.53506067678305835,
+        0.53435509238856882, 0.53364952127709253, 0.53294396510890563, 0.53223842554425049,
+        0.53153290424332988, 0.53082740286630337, 0.53012192307328432, 0.52941646652433416,
+        0.52871103487946047, 0.52800562979861232, 0.52730025294167582, 0.52659490596847081,
+        0.5258895905387474, 0.5251843083121801, 0.52447906094836638, 0.52377385010682165,
+        0.52306867744697494, 0.52236354462816603, 0.52165845330963989, 0.52095340515054489,
+        0.52024840180992726, 0.51954344494672822, 0.51883853621977916, 0.51813367728779902,
+        0.51742886980938796, 0.51672411544302643, 0.51601941584706967, 0.5153147726797439,
+        0.5146101875991429, 0.51390566226322265, 0.51320119832979971, 0.51249679745654575,
+        0.5117924613009841, 0.51108819152048568, 0.51038398977226584, 0.50967985771337843,
+        0.5089757970007146, 0.50827180929099736, 0.50756789624077758, 0.50686405950643121,
+        0.50616030074415319, 0.5054566216099563, 0.50475302375966558, 0.50404950884891464,
+        0.50334607853314206, 0.50264273446758778, 0.50193947830728736, 0.50123631170707106,
+        0.50053323632155766, 0.49983025380515161, 0.49912736581203898, 0.49842457399618234,
+        0.49772188001131912, 0.49701928551095609, 0.49631679214836605, 0.49561440157658376,
+        0.49491211544840241, 0.49420993541636832, 0.49350786313277933, 0.49280590024967935,
+        0.49210404841885486, 0.49140230929183143, 0.49070068451986815, 0.48999917575395635,
+        0.48929778464481388, 0.48859651284288175, 0.48789536199832034, 0.48719433376100563,
+        0.48649342978052401, 0.48579265170617064, 0.48509200118694401, 0.48439147987154252,
+        0.48369108940836086, 0.48299083144548466, 0.48229070763068888, 0.48159071961143257,
+        0.48089086903485517, 0.48019115754777258, 0.47949158679667403, 0.47879215842771622,
+        0.47809287408672207, 0.47739373541917518, 0.47669474407021639, 0.47599590168464023,
+        0.47529720990688962, 0.47459867038105408, 0.47390028475086465, 0.47320205465969017,
+        0.47250398175053354, 0.47180606766602806, 0.47110831404843229, 0.47041072253962823,
+        0.46971329478111606, 0.46901603241401074, 0.46831893707903832, 0.46762201041653062,
+        0.46692525406642388, 0.4662286696682531, 0.46553225886114857, 0.46483602328383228,
+        0.46413996457461409, 0.46344408437138673, 0.46274838431162379, 0.46205286603237478,
+        0.4613575311702614, 0.46066238136147419, 0.4599674182417669, 0.4592726434464553,
+        0.45857805861041168, 0.45788366536806113, 0.45718946535337818, 0.4564954601998828,
+        0.45580165154063534, 0.4551080410082351, 0.4544146302348146, 0.45372142085203637,
+        0.45302841449108944, 0.45233561278268397, 0.45164301735704965, 0.45095062984393042,
+        0.45025845187258101, 0.44956648507176306, 0.44887473106974163, 0.44818319149427993,
+        0.44749186797263785, 0.44680076213156633, 0.4461098755973042, 0.44541920999557466,
+        0.4447287669515797, 0.44403854808999899, 0.44334855503498405, 0.44265878941015535,
+        0.44196925283859789, 0.44127994694285833, 0.44059087334493924, 0.43990203366629765,
+        0.43921342952783993, 0.43852506254991819, 0.43783693435232668, 0.43714904655429687,
+        0.43646140077449547, 0.43577399863101951, 0.43508684174139256, 0.43439993172256125,
+        0.43371327019089156, 0.43302685876216357, 0.43234069905157013, 0.43165479267371132,
+        0.43096914124259106, 0.43028374637161382, 0.42959860967357916, 0.42891373276068023,
+        0.42822911724449869, 0.42754476473600089, 0.42686067684553441, 0.42617685518282455,
+        0.42549330135696894, 0.42481001697643611, 0.42412700364906025, 0.42344426298203769,
+        0.42276179658192359, 0.42207960605462647, 0.42139769300540703, 0.42071605903887244,
+        0.42003470575897328, 0.41935363476899967, 0.41867284767157786, 0.41799234606866476,
+        0.41731213156154684, 0.41663220575083459, 0.41595257023645904, 0.41527322661766863,
+        0.41459417649302371, 0.41391542146039523, 0.41323696311695934, 0.41255880305919401,
+        0.41188094288287552, 0.41120338418307456, 0.41052612855415149, 0.4098491775897547,
+        0.40917253288281502, 0.40849619602554293, 0.40782016860942472, 0.40714445222521745,
+        0.40646904846294751, 0.40579395891190506, 0.40511918516064105, 0.40444472879696336,
+        0.40377059140793331, 0.40309677457986054, 0.40242327989830151, 0.4017501089480543,
+        0.40107726331315507, 0.40040474457687514, 0.39973255432171512, 0.39906069412940415,
+        0.39838916558089404, 0.39771797025635641, 0.39704710973517865, 0.39637658559596078,
+        0.39570639941651009, 0.39503655277383987, 0.39436704724416377, 0.39369788440289311,
+        0.39302906582463309, 0.39236059308317761, 0.39169246775150801, 0.39102469140178775,
+        0.39035726560535911, 0.38969019193273935, 0.38902347195361775, 0.38835710723684991,
+        0.38769109935045698, 0.38702544986161969, 0.38636016033667564, 0.38569523234111575,
+        0.38503066743957903, 0.38436646719585121, 0.38370263317285974, 0.38303916693267015,
+        0.38237607003648255, 0.38171334404462842, 0.38105099051656521, 0.38038901101087524,
+        0.37972740708526015, 0.37906618029653794, 0.37840533220063943, 0.37774486435260329,
+        0.37708477830657461, 0.37642507561579952, 0.37576575783262223, 0.37510682650848115,
+        0.37444828319390572, 0.3737901294385112, 0.37313236679099737, 0.37247499679914331,
+        0.37181802100980399, 0.37116144096890741, 0.37050525822144897, 0.36984947431149046,
+        0.36919409078215482, 0.36853910917562271, 0.36788453103312924, 0.36723035789496034,
+        0.36657659130044784, 0.36592323278796801, 0.36527028389493654, 0.36461774615780529,
+        0.36396562111205866, 0.36331391029221011, 0.36266261523179749, 0.36201173746338133,
+        0.36136127851853994, 0.36071123992786597, 0.36006162322096347, 0.35941242992644251,
+        0.35876366157191797, 0.35811531968400456, 0.35746740578831326, 0.35681992140944807,
+        0.35617286807100268, 0.35552624729555538, 0.35488006060466759, 0.35423430951887913,
+        0.35358899555770462, 0.35294412023963051, 0.35229968508211001, 0.35165569160156163,
+        0.35101214131336422, 0.35036903573185385, 0.34972637637032, 0.34908416474100268,
+        0.34844240235508706, 0.34780109072270243, 0.34716023135291701, 0.3465198257537348,
+        0.34587987543209242, 0.34524038189385403, 0.34460134664381009, 0.3439627711856722,
+        0.34332465702207027, 0.34268700565454835, 0.3420498185835622, 0.3414130973084738,
+        0.34077684332755021, 0.34014105813795836, 0.33950574323576244, 0.33887090011591997,
+        0.33823653027227751, 0.33760263519756883, 0.33696921638341037, 0.33633627532029775,
+        0.33570381349760248, 0.33507183240356864, 0.33444033352530805, 0.3338093183487989,
+        0.33317878835888098, 0.33254874503925214, 0.33191918987246566, 0.33129012433992483,
+        0.33066154992188196, 0.33003346809743345, 0.32940588034451646, 0.32877878813990563,
+        0.32815219295920983, 0.3275260962768673, 0.32690049956614442, 0.3262754042991306,
+        0.32565081194673551, 0.32502672397868559, 0.32440314186351937, 0.32378006706858614,
+        0.32315750106004115, 0.32253544530284228, 0.32191390126074693, 0.32129287039630849,
+        0.32067235417087198, 0.32005235404457233, 0.31943287147632965, 0.31881390792384634,
+        0.31819546484360384, 0.31757754369085756, 0.31696014591963617, 0.31634327298273635,
+        0.3157269263317195, 0.31511110741690884, 0.31449581768738633, 0.31388105859098714,
+        0.31326683157429946, 0.31265313808265854, 0.31203997956014462, 0.31142735744957917,
+        0.31081527319252056, 0.31020372822926245, 0.30959272399882931, 0.30898226193897305,
+        0.30837234348616982, 0.30776297007561715, 0.30715414314122869, 0.30654586411563356,
+        0.30593813443017082, 0.3053309555148872, 0.30472432879853389, 0.30411825570856121,
+        0.30351273767111808, 0.30290777611104708, 0.30230337245188099, 0.30169952811584022,
+        0.30109624452382899, 0.30049352309543131, 0.29989136524890914, 0.29928977240119803,
+        0.29868874596790429, 0.29808828736330129, 0.29748839800032556, 0.29688907929057506,
+        0.29629033264430449, 0.29569215947042271, 0.29509456117648891, 0.29449753916870985,
+        0.29390109485193544, 0.29330522962965705, 0.29270994490400309, 0.29211524207573614,
+        0.29152112254424956, 0.29092758770756338, 0.29033463896232281, 0.28974227770379346,
+        0.28915050532585868, 0.28855932322101591, 0.28796873278037416, 0.28737873539364911,
+        0.28678933244916188, 0.28620052533383461, 0.28561231543318727, 0.28502470413133496,
+        0.28443769281098319, 0.28385128285342648, 0.28326547563854426, 0.28268027254479738,
+        0.28209567494922533, 0.28151168422744305, 0.28092830175363642, 0.28034552890056114,
+        0.27976336703953797, 0.27918181754044996, 0.27860088177173975, 0.27802056110040452,
+        0.27744085689199521, 0.27686177051061184, 0.27628330331890061, 0.27570545667805069,
+        0.27512823194779135, 0.27455163048638759, 0.27397565365063853, 0.27340030279587341,
+        0.2728255792759483, 0.27225148444324349, 0.27167801964865895, 0.27110518624161306,
+        0.27053298557003819, 0.26996141898037773, 0.26939048781758312, 0.26882019342511082,
+        0.26825053714491803, 0.26768152031746129, 0.26711314428169214, 0.26654541037505436,
+        0.26597831993348087, 0.26541187429138979, 0.26484607478168271, 0.26428092273574039,
+        0.26371641948342028, 0.26315256635305312, 0.26258936467144001, 0.2620268157638484,
+        0.26146492095401036, 0.26090368156411875, 0.2603430989148241, 0.25978317432523179,
+        0.25922390911289783, 0.25866530459382764, 0.25810736208247159, 0.25755008289172232,
+        0.25699346833291159, 0.25643751971580753, 0.25588223834861035, 0.25532762553795096,
+        0.25477368258888705, 0.25422041080489971, 0.25366781148789125, 0.25311588593818068,
+        0.25256463545450242, 0.25201406133400206, 0.25146416487223372, 0.25091494736315695,
+        0.25036641009913374, 0.24981855437092487, 0.24927138146768796, 0.24872489267697373,
+        0.24817908928472304, 0.24763397257526443, 0.24708954383130943, 0.24654580433395185,
+        0.24600275536266325, 0.24546039819529025, 0.24491873410805171, 0.24437776437553588,
+        0.24383749027069607, 0.24329791306484988, 0.24275903402767451, 0.24222085442720442,
+        0.24168337552982849, 0.24114659860028592, 0.2406105249016649, 0.24007515569539867,
+        0.23954049224126273, 0.23900653579737174, 0.23847328762017711, 0.23794074896446282,
+        0.23740892108334388, 0.23687780522826285, 0.23634740264898657, 0.23581771459360384,
+        0.23528874230852115, 0.23476048703846181, 0.23423295002646144, 0.23370613251386557,
+        0.2331800357403267, 0.23265466094380166, 0.23213000936054756, 0.23160608222512047,
+        0.23108288077037159, 0.23056040622744445, 0.23003865982577243, 0.22951764279307463,
+        0.22899735635535479, 0.22847780173689708, 0.22795898016026372, 0.22744089284629204,
+        0.22692354101409179, 0.22640692588104128, 0.22589104866278598, 0.22537591057323492,
+        0.2248615128245578, 0.22434785662718248, 0.22383494318979097, 0.22332277371931852,
+        0.22281134942094927, 0.22230067149811406, 0.22179074115248743, 0.22128155958398482,
+        0.22077312799075927, 0.22026544756919969, 0.21975851951392711, 0.21925234501779217,
+        0.21874692527187273, 0.21824226146546966, 0.21773835478610587, 0.21723520641952254,
+        0.21673281754967638, 0.21623118935873692, 0.21573032302708395, 0.21523021973330386,
+        0.21473088065418822, 0.21423230696473017, 0.21373449983812182, 0.21323746044575159,
+        0.21274118995720059, 0.21224568954024164, 0.21175096036083502, 0.21125700358312621,
+        0.21076382036944336, 0.21027141188029441, 0.20977977927436353, 0.20928892370851004,
+        0.20879884633776452, 0.20830954831532622, 0.20782103079256115, 0.20733329491899755,
+        0.20684634184232537, 0.20636017270839213, 0.20587478866120085, 0.20539019084290711,
+        0.20490638039381659, 0.20442335845238152, 0.20394112615519944, 0.20345968463700947,
+        0.20297903503069009, 0.20249917846725651, 0.20202011607585696, 0.20154184898377187,
+        0.20106437831640994, 0.20058770519730568, 0.200111830748117, 0.19963675608862275,
+        0.19916248233671896, 0.19868901060841782, 0.1982163420178441, 0.19774447767723252,
+        0.19727341869692588, 0.19680316618537086, 0.19633372124911724, 0.19586508499281441,
+        0.19539725851920869, 0.19493024292914102, 0.19446403932154444, 0.19399864879344048,
+        0.19353407243993836, 0.19307031135423103, 0.1926073666275932, 0.19214523934937872,
+        0.19168393060701727, 0.19122344148601311, 0.19076377306994158, 0.19030492644044689,
+        0.18984690267723953, 0.18938970285809387, 0.18893332805884472, 0.18847777935338639,
+        0.18802305781366896, 0.18756916450969607, 0.18711610050952282, 0.18666386687925207,
+        0.18621246468303349, 0.18576189498306001, 0.18531215883956564, 0.18486325731082309,
+        0.18441519145314117, 0.18396796232086166, 0.18352157096635813, 0.18307601844003252,
+        0.18263130579031306, 0.18218743406365179, 0.18174440430452121, 0.18130221755541343,
+        0.18086087485683661, 0.18042037724731269, 0.17998072576337515, 0.1795419214395666,
+        0.17910396530843553, 0.17866685840053526, 0.17823060174442057, 0.17779519636664554,
+        0.17736064329176132, 0.1769269435423127, 0.17649409813883749, 0.17606210809986256,
+        0.17563097444190234, 0.17520069817945588, 0.17477128032500505, 0.17434272188901112,
+        0.1739150238799137, 0.17348818730412741, 0.17306221316604009, 0.17263710246801017,
+        0.17221285621036381, 0.17178947539139361, 0.17136696100735554, 0.17094531405246677,
+        0.17052453551890329, 0.17010462639679796, 0.16968558767423692, 0.169267420337259,
+        0.16885012536985239, 0.16843370375395245, 0.16801815646943968, 0.16760348449413653,
+        0.16718968880380647, 0.16677677037215077, 0.16636473017080622, 0.16595356916934334,
+        0.16554328833526388, 0.16513388863399786, 0.16472537102890256, 0.16431773648125925,
+        0.16391098595027154, 0.16350512039306281, 0.16310014076467355, 0.16269604801806015,
+        0.16229284310409192, 0.16189052697154893, 0.16148910056711985, 0.16108856483540013,
+        0.16068892071888846, 0.16029016915798644, 0.15989231109099483, 0.1594953474541122,
+        0.15909927918143257, 0.15870410720494227, 0.15830983245451952, 0.15791645585793079,
+        0.15752397834082921, 0.15713240082675234, 0.15674172423712013, 0.15635194949123177,
+        0.15596307750626526, 0.15557510919727385, 0.15518804547718451, 0.15480188725679567,
+        0.15441663544477463, 0.15403229094765625, 0.1536488546698403, 0.15326632751358932,
+        0.15288471037902673, 0.15250400416413468, 0.15212420976475122, 0.15174532807456953,
+        0.15136735998513479, 0.15099030638584243, 0.15061416816393625, 0.15023894620450529,
+        0.14986464139048333, 0.14949125460264584, 0.14911878671960788, 0.14874723861782241,
+        0.14837661117157819, 0.14800690525299698, 0.14763812173203278, 0.14727026147646882,
+        0.14690332535191575, 0.14653731422180999, 0.14617222894741067, 0.14580807038779892,
+        0.1454448393998749, 0.14508253683835637, 0.14472116355577613, 0.14436072040248066,
+        0.14400120822662715, 0.14364262787418269, 0.14328498018892138, 0.14292826601242292,
+        0.14257248618407031, 0.14221764154104743, 0.14186373291833831, 0.14151076114872407,
+        0.14115872706278138, 0.14080763148888048, 0.14045747525318336, 0.14010825917964098,
+        0.13975998408999279, 0.13941265080376375, 0.13906626013826251, 0.13872081290858007,
+        0.1383763099275867, 0.13803275200593135, 0.13769013995203905, 0.13734847457210902,
+        0.13700775667011295, 0.13666798704779309, 0.13632916650465987, 0.13599129583799102,
+        0.13565437584282863, 0.13531840731197814, 0.13498339103600621, 0.13464932780323802,
+        0.13431621839975677, 0.13398406360940118, 0.13365286421376349, 0.13332262099218789,
+        0.13299333472176877, 0.13266500617734817, 0.132337636131515, 0.13201122535460263,
+        0.13168577461468722, 0.13136128467758584, 0.13103775630685444, 0.13071519026378658,
+        0.13039358730741146, 0.13007294819449178, 0.12975327367952233, 0.1294345645147284,
+        0.12911682145006309, 0.12880004523320659, 0.12848423660956404, 0.12816939632226354,
+        0.12785552511215498, 0.12754262371780722, 0.1272306928755077, 0.12691973331925971,
+        0.12660974578078127, 0.1263007309895029, 0.12599268967256644, 0.12568562255482252,
+        0.12537953035882993, 0.12507441380485318, 0.12477027361086096, 0.12446711049252468,
+        0.1241649251632162, 0.12386371833400683, 0.1235634907136654, 0.12326424300865652,
+        0.1229659759231389, 0.12266869015896403, 0.12237238641567366, 0.12207706539049923,
+        0.12178272777835975, 0.12148937427186002, 0.12119700556128926, 0.12090562233461899,
+        0.1206152252775024, 0.12032581507327161, 0.12003739240293687, 0.11974995794518462,
+        0.11946351237637598, 0.11917805637054485, 0.11889359059939686, 0.11861011573230745,
+        0.11832763243632038, 0.11804614137614627, 0.1177656432141605, 0.11748613861040241,
+        0.11720762822257347, 0.11693011270603543, 0.11665359271380915, 0.11637806889657298,
+        0.11610354190266081, 0.11583001237806134, 0.11555748096641588, 0.11528594830901728,
+        0.11501541504480822, 0.11474588181037926, 0.11447734923996838, 0.11420981796545859,
+        0.11394328861637676, 0.11367776181989236, 0.11341323820081561, 0.11314971838159588,
+        0.11288720298232091, 0.11262569262071476, 0.11236518791213662, 0.11210568946957922,
+        0.11184719790366759, 0.11158971382265709, 0.11133323783243271, 0.11107777053650736,
+        0.11082331253602012, 0.11056986442973549, 0.110317426814041, 0.11006600028294689,
+        0.10981558542808417, 0.10956618283870306, 0.10931779310167195, 0.10907041680147617,
+        0.1088240545202156, 0.10857870683760473, 0.10833437433097032, 0.10809105757525028,
+        0.10784875714299275, 0.10760747360435363, 0.10736720752709666, 0.10712795947659098,
+        0.10688973001581042, 0.10665251970533202, 0.10641632910333448, 0.10618115876559708,
+        0.10594700924549827, 0.10571388109401458, 0.1054817748597191, 0.10525069108878021,
+        0.10502063032496028, 0.1047915931096145, 0.10456357998168958, 0.10433659147772251,
+        0.10411062813183908, 0.10388569047575302, 0.10366177903876417, 0.10343889434775777,
+        0.10321703692720313, 0.10299620729915221, 0.10277640598323856, 0.10255763349667552,
+        0.10233989035425617, 0.10212317706835117, 0.10190749414890771, 0.10169284210344859,
+        0.10147922143707094, 0.10126663265244451, 0.10105507624981147, 0.10084455272698439,
+        0.10063506257934546, 0.1004266062998454, 0.10021918437900174, 0.10001279730489832,
+        0.099807445563183939, 0.099603129637071131, 0.099399850007334867, 0.099197607152311962,
+        0.098996401547899127, 0.098796233667552746, 0.09859710398228716, 0.09839901296067366,
+        0.098201961068839827, 0.098005948770467421, 0.097810976526792548, 0.097617044796603658,
+        0.097424154036240884, 0.097232304699594818, 0.097041497238105456, 0.096851732100761201,
+        0.096663009734097693, 0.096475330582196983, 0.096288695086686138, 0.096103103686736691,
+        0.095918556819062917, 0.095735054917921558, 0.095552598415110268, 0.095371187739966778,
+        0.095190823319368012, 0.095011505577728972, 0.094833234937001354, 0.094656011816673324,
+        0.094479836633768077, 0.094304709802842723, 0.094130631735987791, 0.093957602842825561,
+        0.093785623530509787, 0.093614694203724536, 0.093444815264682846, 0.093275987113126402,
+        0.093108210146324255, 0.092941484759071546, 0.092775811343689341, 0.092611190290023182,
+        0.092447621985442319, 0.092285106814838869, 0.092123645160626544, 0.091963237402740317,
+        0.091803883918635143, 0.09164558508328513, 0.091488341269182649, 0.091332152846337833,
+        0.091177020182276913, 0.091022943642042053, 0.090869923588190293, 0.090717960380792551,
+        0.09056705437743312, 0.090417205933208011, 0.090268415400725444, 0.090120683130103796,
+        0.089974009468971272, 0.089828394762465347, 0.089683839353231432, 0.089540343581422266,
+        0.089397907784697361, 0.089256532298221891, 0.089116217454666025, 0.08897696358420415,
+        0.088838771014514095, 0.088701640070776189, 0.088565571075672922, 0.088430564349387786,
+        0.088296620209604548, 0.088163738971506977, 0.08803192094777712, 0.08790116644859558,
+        0.087771475781640518, 0.087642849252086485, 0.08751528716260415, 0.087388789813359347,
+        0.08726335750201264, 0.087138990523718374, 0.087015689171124067, 0.086893453734369686,
+        0.086772284501087094, 0.086652181756399105, 0.086533145782919041, 0.08641517686075012,
+        0.086298275267484625, 0.086182441278203403, 0.0860676751654747, 0.085953977199354548,
+        0.085841347647385213, 0.085729786774594752, 0.08561929484349684, 0.085509872114089613,
+        0.085401518843855273, 0.08529423528775959, 0.085188021698251071, 0.085082878325260625,
+        0.084978805416200787, 0.084875803215965107, 0.08477387196692765, 0.084673011908942553,
+        0.084573223279343357, 0.084474506312942232, 0.08437686124202981, 0.084280288296374295,
+        0.084184787703221187, 0.084090359687292671, 0.083997004470786896, 0.083904722273377808,
+        0.083813513312214261, 0.083723377801919741, 0.083634315954591865, 0.083546327979801605,
+        0.083459414084593453, 0.08337357447348398, 0.083288809348462112, 0.083205118908988351,
+        0.083122503351994559, 0.083040962871882895, 0.082960497660526156, 0.082881107907266716,
+        0.082802793798916252, 0.082725555519755523, 0.082649393251533587, 0.082574307173467643,
+        0.082500297462242522, 0.082427364292010197, 0.082355507834389441, 0.082284728258465445,
+        0.082215025730789426, 0.08214640041537824, 0.082078852473713604, 0.08201238206474265,
+        0.081946989344876486, 0.081882674467990635, 0.081819437585424093, 0.081757278845979442,
+        0.081696198395922126, 0.081636196378980397, 0.081577272936344813, 0.081519428206667854,
+        0.081462662326063806, 0.081406975428108264, 0.081352367643837853, 0.081298839101750009,
+        0.081246389927802531, 0.081195020245413363, 0.081144730175460422, 0.081095519836280994,
+        0.081047389343671838, 0.081000338810888639, 0.080954368348645833, 0.080909478065116391,
+        0.080865668065931373, 0.080822938454180038, 0.080781289330409345, 0.080740720792623566,
+        0.080701232936284395, 0.080662825854310727, 0.080625499637078046, 0.080589254372418484,
+        0.080554090145620705, 0.080520007039429575, 0.08048700513404583, 0.080455084507126295,
+        0.080424245233783165, 0.080394487386584224, 0.080365811035552626, 0.080338216248166561,
+        0.080311703089359254, 0.08028627162151869, 0.08026192190448761, 0.080238653995563236,
+        0.080216467949497161, 0.080195363818495402, 0.080175341652217846, 0.080156401497778751,
+        0.080138543399746076, 0.080121767400141652, 0.080106073538441014, 0.080091461851573231,
+        0.080077932373921246, 0.080065485137321035, 0.080054120171062226, 0.080043837501887705,
+        0.08003463715399356, 0.08002651914902903, 0.080019483506096611, 0.080013530241751896,
+        0.08000865937000351, 0.080004870902312952, 0.080002164847594981, 0.080000541212217169,
+        0.080000000000000016,
+    },
+    /* blackman */
+    {
+        -1.3877787807814457e-17, 2.1177891514068126e-07, 8.471178199742635e-07, 1.9060231929018956e-06,
+        3.3885058309951477e-06, 5.2945808499266223e-06, 7.624267683914443e-06, 1.037759008525041e-05,
+        1.3554576124077955e-05, 1.7155258187823152e-05, 2.1179672981153086e-05, 2.5627861524990525e-05,
+        3.0499869156250248e-05, 3.579574552696474e-05, 4.1515544603978882e-05, 4.7659324667700953e-05,
+        5.4227148311658535e-05, 6.1219082441596462e-05, 6.8635198274255571e-05, 7.6475571336803716e-05,
+        8.4740281465350842e-05, 9.3429412804199585e-05, 0.0001025430538044575, 0.00011208129722284355,
+        0.00012204424012042525, 0.00013243198386141131, 0.00014324463411129196, 0.00015448230083592307,
+        0.0001661450982995416, 0.00017823314506346111, 0.00019074656398433698, 0.00020368548221236238,
+        0.00021705003118953348, 0.00023084034664797026, 0.00024505656860777936, 0.00025969884137536092,
+        0.0002747673135410772, 0.00029026213797753164, 0.00030618347183709871, 0.00032253147655010583,
+        0.00033930631782219667, 0.00035650816563220777, 0.00037413719422994818, 0.00039219358213339606,
+        0.00041067751212657544, 0.00042958917125678064, 0.00044892875083202277, 0.0004686964464184068,
+        0.0004888924578373699, 0.00050951698916279486, 0.00053057024871845659, 0.00055205244907467754,
+        0.00057396380704582972, 0.00059630454368679586, 0.00061907488429045754, 0.00064227505838407306,
+        0.00066590529972627988, 0.00068996584630383329, 0.00071445694032833129, 0.00073937882823255086,
+        0.00076473176066738091, 0.00079051599249813087, 0.00081673178280093628, 0.0008433793948592061,
+        0.00087045909615995898, 0.00089797115839006236, 0.00092591585743241611, 0.00095429347336210835,
+        0.00098310429044248804, 0.0010123485971212376, 0.0010420266860263899, 0.0010721388539619986,
+        0.0011026854019042381, 0.001133666634997213, 0.0011650828625484055, 0.0011969343980246239,
+        0.0012292215590475469, 0.0012619446673891865, 0.0012951040489675714, 0.0013287000338420007,
+        0.0013627329562085205, 0.0013972031543951907, 0.0014321109708574781, 0.0014674567521733572,
+        0.0015032408490383842, 0.0015394636162610331, 0.0015761254127574092, 0.0016132266015465579,
+        0.0016507675497451635, 0.0016887486285623726, 0.0017271702132947708, 0.001766032683321081,
+        0.0018053364220966817, 0.0018450818171484862, 0.0018852692600692667, 0.0019258991465124359,
+        0.001966971876186191, 0.0020084878528481981, 0.0020504474842997639, 0.0020928511823801454,
+        0.0021356993629607635, 0.0021789924459394983, 0.0022227308552345698, 0.0022669150187789033,
+        0.0023115453685137038, 0.002356622340382919, 0.0024021463743265081, 0.0024481179142749609,
+        0.0024945374081423582, 0.0025414053078206822, 0.0025887220691730856, 0.0026364881520277023,
+        0.0026847040201710415, 0.0027333701413415346, 0.0027824869872230817, 0.0028320550334381689,
+        0.0028820747595414697, 0.0029325466490127822, 0.0029834711892506721, 0.0030348488715651184,
+        0.0030866801911709624, 0.0031389656471808164, 0.0031917057425980694, 0.0032449009843098092,
+        0.0032985518830796062, 0.0033526589535405188, 0.0034072227141876132, 0.0034622436873708445,
+        0.0035177223992877149, 0.0035736593799755856, 0.0036300551633046269, 0.0036869102869700188,
+        0.0037442252924843461, 0.0038020007251702154, 0.0038602371341523029, 0.0039189350723498051,
+        0.0039780950964686118, 0.0040377177669932707, 0.00409780364817941, 0.0041583533080453844,
+        0.0042193673183645725, 0.0042808462546573695, 0.0043427906961826385, 0.0044052012259299805,
+        0.004468078430611172, 0.0045314229006521989, 0.0045952352301846938, 0.0046595160170374711,
+        0.0047242658627283662, 0.0047894853724555347, 0.00485517515508882, 0.0049213358231614823,
+        0.0049879679928611226, 0.0050550722840213003, 0.0051226493201124851, 0.0051906997282334527,
+        0.0052592241391024031, 0.0053282231870478841, 0.0053976975099998409, 0.0054676477494807613,
+        0.0055380745505964057, 0.0056089785620266203, 0.005680360436016399, 0.0057522208283664611,
+        0.0058245603984238281, 0.0058973798090728585, 0.0059706797267254363, 0.0060444608213118117,
+        0.0061187237662708727, 0.0061934692385406942, 0.0062686979185491432, 0.0063444104902036641,
+        0.006420607640882231, 0.0064972900614230777, 0.0065744584461149974, 0.0066521134926877529,
+        0.0067302559023018349, 0.0068088863795385257, 0.0068880056323900873, 0.0069676143722494921,
+        0.0070477133139004167, 0.0071283031755069171, 0.0072093846786034504, 0.0072909585480843281,
+        0.0073730255121936678, 0.0074555863025146385, 0.0075386416539596074, 0.0076221923047589957,
+        0.0077062389964512312, 0.0077907824738721043, 0.007875823485143929, 0.0079613627816651072,
+        0.0080474011180991928, 0.0081339392523642751, 0.0082209779456222515, 0.008308517962267517,
+        0.0083965600699166115, 0.0084851050393969368, 0.0085741536447355299, 0.008663706663148571,
+        0.0087537648750297542, 0.0088443290639393241, 0.0089354000165929176, 0.0090269785228501292,
+        0.0091190653757033946, 0.0092116613712664441, 0.0093047673087630761, 0.0093983839905155825,
+        0.0094925122219332442, 0.0095871528115009236, 0.0096823065707672545, 0.0097779743143331654,
+        0.0098741568598401247, 0.0099708550279583447, 0.010068069642375208, 0.010165801529783067,
+        0.010264051519867853, 0.010362820445296544, 0.01046210914170588, 0.010561918447689708,
+        0.010662249204787352, 0.010763102257471319, 0.010864478453135151, 0.010966378642081241,
+        0.011068803677508544, 0.011171754415500459, 0.011275231715012213, 0.011379236437858598,
+        0.01148376944870174, 0.011588831615038188, 0.011694423807186896, 0.011800546898276087,
+        0.011907201764231275, 0.012014389283762132, 0.01212211033834986, 0.012230365812234717,
+        0.012339156592402929, 0.012448483568574004, 0.012558347633187777, 0.012668749681391638,
+        0.012779690611027239, 0.012891171322618016, 0.013003192719355502, 0.013115755707086854,
+        0.013228861194301153, 0.013342510092116656, 0.013456703314267342, 0.013571441777089736,
+        0.013686726399509554, 0.013802558103028273, 0.013918937811709962, 0.014035866452167645,
+        0.014153344953549786, 0.01427137424752712, 0.014389955268278506, 0.01450908895247794,
+        0.014628776239280425, 0.014749018070308567, 0.014869815389638698, 0.014991169143787272,
+        0.015113080281696813, 0.015235549754722265, 0.015358578516617011, 0.015482167523518928,
+        0.015606317733936455, 0.015731030108734591, 0.015856305611120766, 0.015982145206630882,
+        0.016108549863114885, 0.016235520550723054, 0.016363058241891354, 0.016491163911327378,
+        0.016619838535996106, 0.016749083095105463, 0.01687889857009188, 0.017009285944606205,
+        0.017140246204498791, 0.017271780337805444, 0.01740388933473265, 0.017536574187643109,
+        0.017669835891040937, 0.017803675441557407, 0.017938093837935862, 0.018073092081017386,
+        0.018208671173725641, 0.01834483212105241, 0.018481575930042633, 0.018618903609779601,
+        0.018756816171369955, 0.018895314627928803, 0.019034399994564744, 0.019174073288364929,
+        0.01931433552837989, 0.019455187735608503, 0.019596630932982979, 0.019738666145353516,
+        0.019881294399473226, 0.020024516723982824, 0.020168334149395582, 0.020312747708081808,
+        0.020457758434253417, 0.020603367363949056, 0.020749575535018154, 0.020896383987105749,
+        0.021043793761637002, 0.021191805901801683, 0.021340421452538567, 0.021489641460520022,
+        0.021639466974136157, 0.021789899043479458, 0.021940938720328859, 0.022092587058134258,
+        0.022244845112000644, 0.022397713938672272, 0.022551194596517055, 0.022705288145510531,
+        0.022859995647220147, 0.023015318164789217, 0.023171256762921082, 0.023327812507863081,
+        0.023484986467390646, 0.023642779710791144, 0.023801193308847994, 0.023960228333824295,
+        0.024119885859446938, 0.024280166960890477, 0.024441072714760745, 0.024602604199078802,
+        0.024764762493264467, 0.02492754867812038, 0.025090963835815515, 0.025255009049868667,
+        0.025419685405132446, 0.025584993987776569, 0.025750935885271657, 0.025917512186372497,
+        0.026084723981101988, 0.026252572360734208, 0.026421058417778094, 0.026590183245960762,
+        0.026759947940211068, 0.02693035359664276, 0.027101401312537993, 0.027273092186330596,
+        0.02744542731758931, 0.027618407807001193, 0.027792034756354562, 0.027966309268522622,
+        0.028141232447446159, 0.028316805398117158, 0.02849302922656153, 0.02866990503982262,
+        0.028847433945943753, 0.02902561705395184, 0.029204455473840041, 0.029383950316550791,
+        0.02956410269395892, 0.02974491371885446, 0.029926384504925678, 0.030108516166741754,
+        0.030291309819735913, 0.03047476658018819, 0.03065888756520805, 0.030843673892717506,
+        0.031029126681433587, 0.031215247050851262, 0.031402036121226086, 0.03158949501355706,
+        0.031777624849569003, 0.031966426751695483, 0.032155901843061253, 0.03234605124746498,
+        0.032536876089361746, 0.03272837749384571, 0.032920556586632538, 0.033113414494041912,
+        0.033306952342980131, 0.033501171260922502, 0.033696072375895725, 0.033891656816460516,
+        0.034087925711693827, 0.034284880191171235, 0.034482521384949498, 0.034680850423548668,
+        0.034879868437934558, 0.035079576559500919, 0.035279975920051929, 0.035481067651784187,
+        0.035682852887269093, 0.035885332759435201, 0.036088508401550132, 0.036292380947202989,
+        0.036496951530286398, 0.036702221284978673, 0.03690819134572601, 0.037114862847224581,
+        0.037322236924402424, 0.037530314712401772, 0.037739097346561085, 0.037948585962396808,
+        0.038158781695585731, 0.038369685681946819, 0.038581299057423205, 0.038793622958064086,
+        0.039006658520006815, 0.03922040687945879, 0.039434869172679299, 0.039650046535961388,
+        0.039865940105613923, 0.040082551017943273, 0.040299880409235295, 0.040517929415737002,
+        0.040736699173638577, 0.040956190819055084, 0.041176405488008078, 0.041397344316407778,
+        0.041619008440034501, 0.041841398994520489, 0.042064517115331615, 0.042288363937749221,
+        0.04251294059685172, 0.042738248227496237, 0.042964287964300324, 0.043191060941623782,
+        0.043418568293550078, 0.043646811153867995, 0.043875790656053446, 0.044105507933250881,
+        0.04433596411825496, 0.044567160343492236, 0.044799097741002589, 0.045031777442420727,
+        0.045265200578957936, 0.045499368281383595, 0.045734281680006483, 0.045969941904656496,
+        0.046206350084666066, 0.046443507348851748, 0.046681414825495537, 0.04692007364232658,
+        0.047159484926502321, 0.047399649804590271, 0.047640569402549307, 0.047882244845710992,
+        0.048124677258761253, 0.048367867765721502, 0.048611817489930376, 0.048856527554024837,
+        0.049101999079921757, 0.049348233188799114, 0.049595231001077579, 0.049842993636401767,
+        0.050091522213621419, 0.05034081785077324, 0.05059088166506169, 0.050841714772840635,
+        0.051093318289594611, 0.051345693329920145, 0.05159884100750696, 0.051852762435119486,
+        0.052107458724578004, 0.052362930986739997, 0.05261918033148142, 0.052876207867678077,
+        0.053134014703186641, 0.053392601944826285, 0.053651970698359648, 0.053912122068474295,
+        0.054173057158763818, 0.054434777071709239, 0.054697282908660202, 0.054960575769816146,
+        0.055224656754207603, 0.055489526959677488, 0.05575518748286231, 0.056021639419173243,
+        0.056288883862777611, 0.05655692190658005, 0.056825754642203505, 0.057095383159970682,
+        0.057365808548885296, 0.057637031896613011, 0.057909054289463045, 0.058181876812368971,
+        0.058455500548870221, 0.058729926581093252, 0.059005155989732647, 0.059281189854032329,
+        0.059558029251766974, 0.059835675259222787, 0.060114128951179319, 0.060393391400890069,
+        0.060673463680064078, 0.060954346858846958, 0.061236042005802183, 0.061518550187892262,
+        0.061801872470459936, 0.062086009917209424, 0.062370963590187588, 0.062656734549765114,
+        0.062943323854617872, 0.063230732561707956, 0.063518961726265061, 0.063808012401767478,
+        0.064097885639923663, 0.064388582490653004, 0.064680104002067557, 0.064972451220452879,
+        0.065265625190249366, 0.06555962695403357, 0.065854457552499496, 0.066150118024439569,
+        0.066446609406726198, 0.066743932734292827, 0.067042089040115133, 0.067341079355192734,
+        0.06764090470852975, 0.067941566127116659, 0.068243064635911385, 0.068545401257820548,
+        0.068848577013680551, 0.069152592922239409, 0.069457450000137574, 0.06976314926188934,
+        0.070069691719864269, 0.070377078384268432, 0.070685310263125842, 0.070994388362259464,
+        0.071304313685273069, 0.071615087233532049, 0.071926710006145214, 0.072239182999945792,
+        0.072552507209473122, 0.072866683626953643, 0.073181713242282828, 0.073497597043005958,
+        0.073814336014300028, 0.074131931138954929, 0.074450383397354797, 0.074769693767459705,
+        0.075089863224786793, 0.075410892742392002, 0.075732783290851299, 0.076055535838242386,
+        0.076379151350125962, 0.076703630789527216, 0.077028975116917614, 0.077355185290195999,
+        0.077682262264670607, 0.078010206993039982, 0.078339020425375147, 0.07866870350910074,
+        0.078999257188976796, 0.079330682407080161, 0.079662980102786302, 0.07999615121275068,
+        0.080330196670890572, 0.080665117408366571, 0.081000914353564324, 0.081337588432076155,
+        0.08167514056668268, 0.082013571677334515, 0.082352882681134026, 0.082693074492317165,
+        0.083034148022234799, 0.083376104179335012, 0.083718943869144191, 0.084062667994249482,
+        0.08440727745428013, 0.084752773145889457, 0.085099155962736497, 0.085446426795468197,
+        0.085794586531700842, 0.086143636056002185, 0.086493576249873388, 0.086844407991730488,
+        0.087196132156886985, 0.087548749617535102, 0.087902261242728111, 0.088256667898362395,
+        0.088611970447158961, 0.088968169748646062, 0.08932526665914059, 0.089683262031730659,
+        0.090042156716257177, 0.090401951559296381, 0.090762647404141528, 0.091124245090785302,
+        0.091486745455901686, 0.091850149332828354, 0.092214457551548612, 0.09257967093867385,
+        0.092945790317425461, 0.093312816507617177, 0.093680750325637524, 0.094049592584431629,
+        0.094419344093484084, 0.094790005658800677, 0.09516157808289108, 0.095534062164751229,
+        0.095907458699845349, 0.096281768480088736, 0.09665699229382993, 0.097033130925833322,
+        0.09741018515726127, 0.097788155765657081, 0.098167043524927056, 0.098546849205323375,
+        0.09892757357342627, 0.09930921739212703, 0.099691781420610179, 0.10007526641433626,
+        0.1004596731250246, 0.10084500230063584, 0.10123125468535453, 0.10161843101957203,
+        0.10200653203986924, 0.10239555847899906, 0.10278551106586958, 0.10317639052552663,
+        0.10356819757913668, 0.10396093294396971, 0.10435459733338208, 0.10474919145679945,
+        0.10514471601969971, 0.10554117172359595, 0.10593855926601928, 0.10633687934050234,
+        0.10673613263656155, 0.107136319839681, 0.107537441631295, 0.10793949868877126,
+        0.10834249168539431, 0.10874642129034846, 0.10915128816870104, 0.10955709298138547,
+        0.10996383638518498, 0.11037151903271529, 0.11078014157240848, 0.11118970464849585,
+        0.11160020890099166, 0.11201165496567642, 0.1124240434740801, 0.11283737505346594,
+        0.11325165032681374, 0.11366686991280328, 0.11408303442579815, 0.11450014447582908,
+        0.11491820066857758, 0.11533720360535973, 0.11575715388310967, 0.11617805209436345,
+        0.11659989882724255, 0.11702269466543785, 0.11744644018819325, 0.1178711359702897,
+        0.1182967825820288, 0.11872338058921689, 0.11915093055314882, 0.11957943303059206,
+        0.12000888857377037, 0.12043929773034839, 0.12087066104341496, 0.1213029790514677,
+        0.12173625228839702, 0.12217048128347011, 0.12260566656131529, 0.1230418086419062,
+        0.12347890804054601, 0.12391696526785151, 0.1243559808297377, 0.12479595522740219,
+        0.12523688895730933, 0.12567878251117445, 0.12612163637594898, 0.1265654510338044,
+        0.12701022696211667, 0.12745596463345127, 0.12790266451554741, 0.12835032707130295,
+        0.12879895275875847, 0.12924854203108274, 0.12969909533655699, 0.13015061311855977,
+        0.13060309581555166, 0.13105654386106025, 0.13151095768366516, 0.13196633770698249,
+        0.13242268434965021, 0.13287999802531297, 0.13333827914260726, 0.13379752810514603,
+        0.13425774531150447, 0.13471893115520464, 0.13518108602470086, 0.13564421030336477,
+        0.1361083043694708, 0.13657336859618138, 0.13703940335153206, 0.13750640899841715,
+        0.13797438589457517, 0.13844333439257403, 0.13891325483979661, 0.13938414757842635,
+        0.13985601294543293, 0.14032885127255768, 0.14080266288629914, 0.141277448107899,
+        0.14175320725332785, 0.14222994063327055, 0.14270764855311246, 0.14318633131292521,
+        0.14366598920745235, 0.14414662252609547, 0.14462823155290019, 0.14511081656654218,
+        0.14559437784031296, 0.1460789156421064, 0.14656443023440457, 0.14705092187426408,
+        0.147538390813302, 0.14802683729768262, 0.14851626156810332, 0.14900666385978126,
+        0.14949804440243933, 0.14999040342029304, 0.15048374113203691, 0.15097805775083056,
+        0.15147335348428598, 0.15196962853445359, 0.15246688309780912, 0.15296511736524013,
+        0.15346433152203309, 0.15396452574785979, 0.15446570021676451, 0.1549678550971505,
+        0.15547099055176725, 0.15597510673769743, 0.15648020380634353, 0.15698628190341529,
+        0.15749334116891678, 0.15800138173713341, 0.15851040373661901, 0.15902040729018332,
+        0.15953139251487919, 0.16004335952198995, 0.1605563084170164, 0.16107023929966485,
+        0.16158515226383427, 0.16210104739760359, 0.16261792478321963, 0.16313578449708455,
+        0.16365462660974359, 0.16417445118587243, 0.16469525828426546, 0.16521704795782319,
+        0.16573982025354034, 0.16626357521249335, 0.16678831286982876, 0.16731403325475111,
+        0.16784073639051059, 0.16836842229439161, 0.1688970909777007, 0.16942674244575473,
+        0.16995737669786901, 0.17048899372734577, 0.17102159352146246, 0.17155517606146006,
+        0.17208974132253127, 0.17262528927380949, 0.1731618198783571, 0.17369933309315369,
+        0.17423782886908534, 0.17477730715093279, 0.17531776787736045, 0.17585921098090485,
+        0.17640163638796386, 0.17694504401878519, 0.1774894337874558, 0.17803480560189017,
+        0.17858115936381999, 0.17912849496878297, 0.17967681230611177, 0.18022611125892363,
+        0.18077639170410914, 0.18132765351232197, 0.18187989654796768, 0.18243312066919359,
+        0.18298732572787799, 0.1835425115696197, 0.18409867803372743, 0.18465582495320956,
+        0.18521395215476397, 0.1857730594587671, 0.18633314667926448, 0.18689421362396003,
+        0.18745626009420607, 0.18801928588499317, 0.18858329078494013, 0.18914827457628425,
+        0.18971423703487098, 0.19028117793014426, 0.19084909702513664, 0.19141799407645979,
+        0.1919878688342942, 0.19255872104238014, 0.19313055043800764, 0.1937033567520072,
+        0.19427713970874003, 0.19485189902608871, 0.195427634415448, 0.19600434558171542,
+        0.19658203222328141, 0.19716069403202119, 0.19774033069328464, 0.19832094188588756,
+        0.19890252728210264, 0.1994850865476504, 0.20006861934169029, 0.20065312531681162,
+        0.20123860411902489, 0.20182505538775314, 0.20241247875582291, 0.20300087384945559,
+        0.2035902402882592, 0.20418057768521952, 0.20477188564669141, 0.2053641637723907,
+        0.20595741165538597, 0.20655162888208972, 0.20714681503225016, 0.20774296967894346,
+        0.20834009238856516, 0.20893818272082221, 0.20953724022872483, 0.21013726445857867,
+        0.210738254949977, 0.21134021123579236, 0.21194313284216912, 0.21254701928851566,
+        0.21315187008749686, 0.21375768474502582, 0.21436446276025706, 0.21497220362557859,
+        0.2155809068266043, 0.21619057184216686, 0.21680119814431034, 0.21741278519828283,
+        0.21802533246252903, 0.21863883938868334, 0.21925330542156285, 0.21986872999915991,
+        0.22048511255263525, 0.22110245250631128, 0.22172074927766505, 0.22234000227732126,
+        0.22296021090904578, 0.22358137456973878, 0.22420349264942829, 0.22482656453126326,
+        0.22545058959150732, 0.22607556719953237, 0.22670149671781203, 0.22732837750191504,
+        0.22795620890049961, 0.22858499025530682, 0.22921472090115419, 0.22984540016593025,
+        0.23047702737058801, 0.23110960182913909, 0.23174312284864762, 0.2323775897292249,
+        0.23301300176402312, 0.23364935823922992, 0.23428665843406227, 0.23492490162076149,
+        0.23556408706458729, 0.23620421402381214, 0.23684528174971642, 0.23748728948658246,
+        0.2381302364716896, 0.23877412193530867, 0.23941894510069694, 0.24006470518409323,
+        0.24071140139471248, 0.24135903293474081, 0.24200759899933072, 0.24265709877659639,
+        0.24330753144760825, 0.24395889618638888, 0.24461119215990806, 0.24526441852807818,
+        0.24591857444374937, 0.24657365905270562, 0.24722967149365976, 0.24788661089824957,
+        0.24854447639103289, 0.2492032670894839, 0.24986298210398886, 0.2505236205378415,
+        0.25118518148723962, 0.25184766404128062, 0.25251106728195793, 0.25317539028415675,
+        0.25384063211565033, 0.25450679183709674, 0.25517386850203438, 0.25584186115687896,
+        0.25651076884091961, 0.2571805905863157, 0.25785132541809286, 0.25852297235414046,
+        0.25919553040520765, 0.25986899857490026, 0.26054337585967752, 0.26121866124884952,
+        0.26189485372457322, 0.26257195226185071, 0.26324995582852473, 0.26392886338527738,
+        0.26460867388562637, 0.2652893862759223, 0.26597099949534669, 0.26665351247590857,
+        0.26733692414244276, 0.26802123341260642, 0.26870643919687753, 0.2693925403985522,
+        0.27007953591374234, 0.2707674246313736, 0.271456205433183, 0.27214587719371719,
+        0.27283643878033009, 0.27352788905318115, 0.27422022686523356, 0.27491345106225218,
+        0.27560756048280166, 0.27630255395824538, 0.27699843031274318, 0.27769518836325036,
+        0.27839282691951517, 0.27909134478407893, 0.27979074075227345, 0.28049101361222001,
+        0.28119216214482828, 0.28189418512379533, 0.28259708131560413, 0.28330084947952261,
+        0.28400548836760275, 0.28471099672467992, 0.28541737328837175, 0.28612461678907714,
+        0.28683272594997611, 0.28754169948702896, 0.28825153610897519, 0.28896223451733383,
+        0.28967379340640242, 0.29038621146325683, 0.29109948736775082, 0.29181361979251585,
+        0.29252860740296116, 0.2932444488572733, 0.293961142806416, 0.29467868789413071,
+        0.29539708275693632, 0.29611632602412907, 0.29683641631778329, 0.29755735225275154,
+        0.29827913243666476, 0.29900175546993257, 0.29972521994574419, 0.30044952445006895,
+        0.30117466756165623, 0.30190064785203702, 0.30262746388552425, 0.30335511421921341,
+        0.30408359740298374, 0.30481291197949922, 0.30554305648420921, 0.30627402944535004,
+        0.30700582938394549, 0.30773845481380879, 0.3084719042415433, 0.30920617616654394,
+        0.30994126908099884, 0.31067718146989076, 0.31141391181099859, 0.31215145857489845,
+        0.31288982022496648, 0.31362899521737964, 0.3143689820011179, 0.31510977901796589,
+        0.31585138470251517, 0.31659379748216621, 0.31733701577712986, 0.31808103800043042,
+        0.31882586255790729, 0.31957148784821726, 0.32031791226283679, 0.32106513418606492,
+        0.3218131519950253, 0.32256196405966875, 0.32331156874277583, 0.32406196439995993,
+        0.32481314937966976, 0.32556512202319166, 0.32631788066465345, 0.3270714236310267,
+        0.32782574924213004, 0.32858085581063173, 0.32933674164205357, 0.33009340503477358,
+        0.33085084428002959, 0.33160905766192217, 0.33236804345741844, 0.33312779993635555,
+        0.33388832536144369, 0.33464961798827048, 0.33541167606530414, 0.33617449783389747,
+        0.33693808152829119, 0.33770242537561856, 0.33846752759590881, 0.3392333864020915,
+        0.33999999999999991, 0.3407673665883762, 0.34153548435887493, 0.34230435149606714,
+        0.34307396617744562, 0.34384432657342845, 0.34461543084736401, 0.34538727715553497,
+        0.34615986364716356, 0.34693318846441579, 0.34770724974240658, 0.34848204560920387,
+        0.34925757418583436, 0.35003383358628809, 0.35081082191752311, 0.35158853727947104,
+        0.35236697776504228, 0.35314614146013068, 0.35392602644361926, 0.3547066307873854,
+        0.35548795255630627, 0.35626998980826458, 0.35705274059415337, 0.3578362029578826,
+        0.35862037493638421, 0.35940525455961764, 0.36019083985057659, 0.36097712882529387,
+        0.36176411949284815, 0.36255180985536917, 0.36334019790804445, 0.36412928163912539,
+        0.36491905902993321, 0.36570952805486512, 0.36650068668140112, 0.36729253287011021,
+        0.36808506457465645, 0.3688782797418062, 0.36967217631143423, 0.37046675221653075,
+        0.37126200538320747, 0.37205793373070528, 0.37285453517140066, 0.37365180761081268,
+        0.37444974894760957, 0.3752483570736167, 0.37604762987382317, 0.37684756522638857,
+        0.37764816100265119, 0.37844941506713464, 0.37925132527755578, 0.38005388948483132,
+        0.38085710553308633, 0.38166097125966125, 0.38246548449511991, 0.38327064306325653,
+        0.38407644478110459, 0.38488288745894372, 0.38568996890030793, 0.38649768690199399,
+        0.38730603925406898, 0.38811502373987861, 0.38892463813605505, 0.38973488021252584,
+        0.39054574773252188, 0.39135723845258524, 0.39216935012257864, 0.39298208048569305,
+        0.39379542727845707, 0.39460938823074448, 0.39542396106578404, 0.39623914350016753,
+        0.39705493324385926, 0.39787132800020375, 0.39868832546593602, 0.39950592333119012,
+        0.40032411927950756, 0.40114291098784749, 0.40196229612659545, 0.40278227235957248,
+        0.40360283734404451, 0.40442398873073215, 0.4052457241638196, 0.40606804128096485,
+        0.40689093771330836, 0.40771441108548356, 0.40853845901562641, 0.4093630791153845,
+        0.41018826898992783, 0.4110140262379583, 0.41184034845171968, 0.41266723321700738,
+        0.4134946781131793, 0.41432268071316514, 0.41515123858347747, 0.41598034928422106,
+        0.41681001036910403, 0.41764021938544832, 0.41847097387419907, 0.41930227136993659,
+        0.42013410940088614, 0.42096648548892879, 0.42179939714961195, 0.42263284189216055,
+        0.42346681721948765, 0.42430132062820569, 0.42513634960863655, 0.42597190164482385,
+        0.42680797421454325, 0.42764456478931367, 0.42848167083440869, 0.42931928980886813,
+        0.43015741916550887, 0.43099605635093652, 0.43183519880555665, 0.43267484396358696,
+        0.43351498925306842, 0.43435563209587652, 0.43519676990773387, 0.43603840009822181,
+        0.43688052007079126, 0.43772312722277634, 0.43856621894540448, 0.4394097926238103,
+        0.44025384563704584, 0.44109837535809421, 0.44194337915388116, 0.44278885438528753,
+        0.44363479840716119, 0.44448120856832973, 0.44532808221161346, 0.44617541667383664,
+        0.44702320928584127, 0.44787145737249917, 0.44872015825272504, 0.44956930923948818,
+        0.45041890763982673, 0.45126895075485973, 0.45211943587980041, 0.45297036030396842,
+        0.45382172131080378, 0.4546735161778801, 0.45552574217691649, 0.45637839657379226,
+        0.45723147662855934, 0.45808497959545613, 0.45893890272291998, 0.4597932432536021,
+        0.46064799842437992, 0.46150316546637155, 0.462358741604948, 0.46321472405974873,
+        0.46407111004469437, 0.46492789676800017, 0.46578508143219099, 0.46664266123411446,
+        0.46750063336495529, 0.46835899501024869, 0.46921774334989563, 0.47007687555817607,
+        0.47093638880376354, 0.47179628024973919, 0.47265654705360649, 0.47351718636730578,
+        0.47437819533722747, 0.47523957110422849, 0.47610131080364515, 0.47696341156530903,
+        0.47782587051356035, 0.47868868476726406, 0.47955185143982393, 0.48041536763919757,
+        0.48127923046791077, 0.48214343702307344, 0.48300798439639431, 0.48387286967419518,
+        0.4847380899374274, 0.4856036422616859, 0.4864695237172254, 0.48733573136897479,
+        0.48820226227655322, 0.48906911349428484, 0.48993628207121526, 0.49080376505112572,
+        0.49167155947254987, 0.49253966236878904, 0.49340807076792709, 0.49427678169284767,
+        0.49514579216124877, 0.49601509918565934, 0.49688469977345434, 0.49775459092687169,
+        0.49862476964302743, 0.49949523291393277, 0.50036597772650881, 0.50123700106260394,
+        0.50210829989900985, 0.50297987120747689, 0.50385171195473177, 0.50472381910249287,
+        0.50559618960748731, 0.5064688204214669, 0.50734170849122517, 0.50821485075861406,
+        0.50908824416055976, 0.50996188562908029, 0.51083577209130171, 0.5117099004694754,
+        0.51258426768099408, 0.51345887063840989, 0.51433370624945041, 0.51520877141703614,
+        0.5160840630392971, 0.51695957800959058, 0.51783531321651788, 0.51871126554394165,
+        0.51958743187100298, 0.52046380907213896, 0.52134039401710019, 0.52221718357096769,
+        0.52309417459417062, 0.52397136394250388, 0.52484874846714613, 0.52572632501467587,
+        0.526604090427091, 0.52748204154182543, 0.52836017519176703, 0.52923848820527553,
+        0.53011697740620045, 0.53099563961389895, 0.53187447164325352, 0.53275347030469078,
+        0.53363263240419834, 0.53451195474334456, 0.53539143411929446, 0.53627106732483032,
+        0.53715085114836847, 0.5380307823739775, 0.53891085778139769, 0.53979107414605842,
+        0.54067142823909731, 0.54155191682737791, 0.54243253667350888, 0.5433132845358627,
+        0.54419415716859387, 0.5450751513216574, 0.54595626374082806, 0.5468374911677194,
+        0.5477188303398014, 0.54860027799042055, 0.54948183084881841, 0.55036348564015003,
+        0.5512452390855036, 0.55212708790191922, 0.55300902880240821, 0.55389105849597187,
+        0.55477317368762102, 0.55565537107839513, 0.55653764736538147, 0.55741999924173435,
+        0.55830242339669522, 0.55918491651561109, 0.5600674752799546, 0.56095009636734305,
+        0.5618327764515586, 0.56271551220256733, 0.56359830028653912, 0.56448113736586691,
+        0.56536402009918707, 0.56624694514139884, 0.56712990914368389, 0.5680129087535265,
+        0.56889594061473336, 0.56977900136745363, 0.57066208764819826, 0.5715451960898611,
+        0.5724283233217381, 0.57331146596954774, 0.5741946206554509, 0.57507778399807152,
+        0.57596095261251634, 0.57684412311039557, 0.57772729209984297, 0.57861045618553586,
+        0.57949361196871652, 0.58037675604721117, 0.58125988501545223, 0.58214299546449699,
+        0.58302608398204925, 0.58390914715247999, 0.5847921815568472, 0.58567518377291694,
+        0.58655815037518499, 0.58744107793489597, 0.58832396302006451, 0.58920680219549781,
+        0.59008959202281352, 0.59097232906046371, 0.59185500986375361, 0.59273763098486287,
+        0.5936201889728685, 0.59450268037376297, 0.59538510173047743, 0.59626744958290256,
+        0.5971497204679086, 0.5980319109193678, 0.59891401746817552, 0.59979603664227021,
+        0.60067796496665671, 0.60155979896342604, 0.60244153515177734, 0.60332317004803948,
+        0.60420470016569239, 0.60508612201538781, 0.60596743210497261, 0.60684862693950847,
+        0.60772970302129392, 0.60861065684988747, 0.6094914849221269, 0.61037218373215318,
+        0.61125274977143074, 0.612133179528769, 0.61301346949034652, 0.61389361613973004,
+        0.61477361595789715, 0.61565346542326016, 0.61653316101168509, 0.6174126991965152,
+        0.61829207644859363, 0.61917128923628328, 0.62005033402549192, 0.62092920727969114,
+        0.62180790545994025, 0.62268642502490912, 0.62356476243089853, 0.62444291413186281,
+        0.62532087657943425, 0.6261986462229423, 0.62707621950943759, 0.62795359288371477,
+        0.62883076278833328, 0.62970772566364164, 0.63058447794779782, 0.6314610160767935,
+        0.63233733648447599, 0.6332134356025706, 0.63408930986070255, 0.63496495568642208,
+        0.63584036950522371, 0.63671554774057104, 0.63759048681391939, 0.63846518314473732,
+        0.63933963315053099, 0.64021383324686532, 0.64108777984738752, 0.64196146936385079,
+        0.6428348982061356, 0.64370806278227322, 0.64458095949846961, 0.64545358475912662,
+        0.64632593496686574, 0.64719800652255233, 0.6480697958253161, 0.64894129927257682,
+        0.64981251326006517, 0.65068343418184693, 0.65155405843034686, 0.65242438239636991,
+        0.65329440246912596, 0.65416411503625282, 0.65503351648383878, 0.65590260319644611,
+        0.65677137155713539, 0.65763981794748683, 0.65850793874762559, 0.65937573033624364,
+        0.66024318909062385, 0.66111031138666387, 0.66197709359889834, 0.66284353210052294,
+        0.66370962326341854, 0.66457536345817336, 0.66544074905410755, 0.66630577641929645,
+        0.66717044192059383, 0.66803474192365586, 0.66889867279296467, 0.66976223089185116,
+        0.67062541258252095, 0.67148821422607496, 0.67235063218253499, 0.67321266281086789,
+        0.67407430246900757, 0.67493554751387974, 0.67579639430142646, 0.67665683918662833,
+        0.67751687852352882, 0.67837650866525934, 0.67923572596406145, 0.68009452677131177,
+        0.68095290743754511, 0.68181086431247884, 0.68266839374503763, 0.68352549208337543,
+        0.68438215567490113, 0.68523838086630207, 0.68609416400356793, 0.68694950143201428,
+        0.68780438949630818, 0.68865882454048988, 0.68951280290799977, 0.69036632094169981,
+        0.69121937498389874, 0.69207196137637716, 0.6929240764604101, 0.69377571657679138,
+        0.69462687806585965, 0.69547755726752003, 0.69632775052126938, 0.69717745416622157,
+        0.69802666454113005, 0.69887537798441324, 0.69972359083417823, 0.7005712994282447,
+        0.70141850010417084, 0.70226518919927572, 0.70311136305066457, 0.7039570179952539,
+        0.70480215036979366, 0.70564675651089348, 0.7064908327550472, 0.7073343754386554,
+        0.70817738089805216, 0.70901984546952745, 0.70986176548935254, 0.71070313729380463,
+        0.71154395721919084, 0.71238422160187287, 0.71322392677829149, 0.71406306908499106,
+        0.71490164485864349, 0.71573965043607413, 0.71657708215428462, 0.71741393635047879,
+        0.71825020936208606, 0.71908589752678687, 0.7199209971825371, 0.72075550466759242,
+        0.72158941632053242, 0.72242272848028666, 0.72325543748615762, 0.72408753967784611,
+        0.72491903139547653, 0.72574990897961966, 0.72658016877131959, 0.72740980711211634,
+        0.7282388203440715, 0.72906720480979348, 0.72989495685246064, 0.73072207281584689,
+        0.73154854904434718, 0.73237438188300041, 0.73319956767751493, 0.73402410277429397,
+        0.73484798352045921, 0.73567120626387672, 0.73649376735317973, 0.73731566313779551,
+        0.73813688996796922, 0.73895744419478804, 0.73977732217020664, 0.74059652024707234,
+        0.74141503477914861, 0.74223286212114048, 0.74304999862872001, 0.74386644065854957,
+        0.74468218456830804, 0.74549722671671459, 0.74631156346355354, 0.74712519116970022,
+        0.74793810619714429, 0.74875030490901517, 0.74956178366960735, 0.75037253884440414,
+        0.75118256680010265, 0.75199186390464012, 0.75280042652721624, 0.75360825103831985,
+        0.75441533380975301, 0.75522167121465567, 0.75602725962753081, 0.7568320954242691,
+        0.75763617498217339, 0.75843949467998439, 0.75924205089790431, 0.76004384001762249,
+        0.76084485842234006, 0.76164510249679396, 0.7624445686272836, 0.76324325320169328,
+        0.7640411526095181, 0.76483826324189019, 0.76563458149160057, 0.76643010375312592,
+        0.76722482642265344, 0.76801874589810448, 0.76881185857915968, 0.76960416086728511,
+        0.77039564916575498, 0.77118631987967767, 0.7719761694160201, 0.77276519418363243,
+        0.77355339059327366, 0.774340755057635, 0.7751272839913651, 0.77591297381109592,
+        0.77669782093546591, 0.77748182178514513, 0.77826497278286122, 0.77904727035342192,
+        0.77982871092374229, 0.78060929092286713, 0.78138900678199663, 0.78216785493451235,
+        0.78294583181599964, 0.78372293386427305, 0.78449915751940291, 0.78527449922373693,
+        0.78604895542192676, 0.78682252256095309, 0.78759519709014802, 0.78836697546122259,
+        0.7891378541282893, 0.78990782954788696, 0.79067689817900688, 0.79144505648311536,
+        0.7922123009241796, 0.79297862796869267, 0.79374403408569616, 0.79450851574680659,
+        0.79527206942624007, 0.79603469160083473, 0.79679637875007803, 0.79755712735612927,
+        0.79831693390384428, 0.79907579488080172, 0.79983370677732524, 0.8005906660865092,
+        0.8013466693042437, 0.80210171292923704, 0.80285579346304237, 0.80360890741008106,
+        0.80436105127766677, 0.80511222157603113, 0.80586241481834664, 0.80661162752075188,
+        0.80735985620237627, 0.80810709738536346, 0.80885334759489613, 0.80959860335922074,
+        0.81034286120967125, 0.81108611768069327, 0.81182836930986957, 0.81256961263794225,
+        0.81330984420883967, 0.81404906056969839, 0.81478725827088805, 0.81552443386603679,
+        0.81626058391205358, 0.81699570496915341, 0.81772979360088194, 0.81846284637413858,
+        0.81919485985920093, 0.81992583062974955, 0.82065575526289125, 0.82138463033918352,
+        0.82211245244265874, 0.8228392181608476, 0.8235649240848042, 0.82428956680912924,
+        0.82501314293199357, 0.82573564905516406, 0.82645708178402533, 0.82717743772760477,
+        0.82789671349859684, 0.82861490571338581, 0.82933201099207121, 0.83004802595848992,
+        0.83076294724024113, 0.83147677146871046, 0.83218949527909225, 0.83290111531041489,
+        0.83361162820556423, 0.83432103061130647, 0.83502931917831258, 0.83573649056118249,
+        0.83644254141846719, 0.8371474684126945, 0.83785126821039058, 0.83855393748210494,
+        0.83925547290243352, 0.83995587115004267, 0.84065512890769134, 0.84135324286225699,
+        0.84205020970475686, 0.84274602613037186, 0.8434406888384719, 0.84413419453263605,
+        0.84482653992067935, 0.84551772171467343, 0.8462077366309716, 0.84689658139023138,
+        0.84758425271743798, 0.84827074734192731, 0.84895606199741036, 0.8496401934219947,
+        0.85032313835820861, 0.85100489355302511, 0.85168545575788313, 0.8523648217287122,
+        0.85304298822595526, 0.8537199520145905, 0.85439570986415692, 0.85507025854877472,
+        0.85574359484716933, 0.85641571554269547, 0.85708661742335812, 0.85775629728183633,
+        0.85842475191550704, 0.85909197812646598, 0.8597579727215523, 0.86042273251237011,
+        0.86108625431531149, 0.86174853495158055, 0.86240957124721362, 0.86306936003310419,
+        0.86372789814502471, 0.86438518242364903, 0.86504120971457488, 0.86569597686834732,
+        0.86634948074047979, 0.86700171819147831, 0.86765268608686275, 0.86830238129718929,
+        0.86895080069807373, 0.86959794117021305, 0.87024379959940767, 0.87088837287658438,
+        0.87153165789781828, 0.87217365156435456, 0.87281435078263203, 0.87345375246430379,
+        0.87409185352626007, 0.87472865089065088, 0.8753641414849066, 0.87599832224176188,
+        0.87663119009927604, 0.87726274200085608, 0.87789297489527807, 0.87852188573670964,
+        0.87914947148473077, 0.87977572910435708, 0.88040065556606051, 0.88102424784579147,
+        0.88164650292500113, 0.88226741779066142, 0.88288698943528932, 0.88350521485696598,
+        0.88412209105935935, 0.88473761505174675, 0.88535178384903457, 0.88596459447178055,
+        0.88657604394621581, 0.88718612930426533, 0.88779484758356997, 0.88840219582750735,
+        0.88900817108521335, 0.88961277041160391, 0.89021599086739522, 0.89081782951912525,
+        0.89141828343917606, 0.89201734970579305, 0.89261502540310689, 0.89321130762115575,
+        0.89380619345590384, 0.89439968000926395, 0.89499176438911898, 0.89558244370934081,
+        0.89617171508981341, 0.89675957565645148, 0.89734602254122253, 0.89793105288216801,
+        0.8985146638234226, 0.89909685251523552, 0.89967761611399166, 0.90025695178223131,
+        0.90083485668867092, 0.90141132800822443, 0.90198636292202194, 0.90255995861743199,
+        0.90313211228808044, 0.90370282113387168, 0.90427208236100876, 0.90483989318201319,
+        0.90540625081574555, 0.90597115248742588, 0.90653459542865278, 0.90709657687742418,
+        0.90765709407815798, 0.90821614428171038, 0.90877372474539764, 0.90932983273301438,
+        0.90988446551485458, 0.91043762036773057, 0.91098929457499345, 0.91153948542655217,
+        0.91208819021889398, 0.91263540625510331, 0.91318113084488128, 0.91372536130456627,
+        0.91426809495715222, 0.91480932913230895, 0.9153490611664008, 0.91588728840250644,
+        0.91642400819043845, 0.91695921788676205, 0.91749291485481377, 0.91802509646472275,
+        0.9185557600934271, 0.91908490312469493, 0.9196125229491432, 0.92013861696425525,
+        0.92066318257440183, 0.92118621719085814, 0.92170771823182351, 0.92222768312244063,
+        0.92274610929481327, 0.92326299418802571, 0.92377833524816144, 0.92429212992832077,
+        0.92480437568864104, 0.92531506999631319, 0.92582421032560192, 0.92633179415786349,
+        0.92683781898156326, 0.92734228229229521, 0.92784518159279983, 0.92834651439298177,
+        0.9288462782099286, 0.92934447056792902, 0.92984108899849005, 0.93033613104035628,
+        0.93082959423952683, 0.93132147614927341, 0.93181177433015905, 0.9323004863500548,
+        0.93278760978415742, 0.93327314221500879, 0.93375708123251122, 0.9342394244339467,
+        0.93472016942399416, 0.9351993138147463, 0.93567685522572763, 0.93615279128391171,
+        0.93662711962373857, 0.93709983788713247, 0.93757094372351724, 0.93804043478983612,
+        0.93850830875056723, 0.93897456327774054, 0.93943919605095605, 0.93990220475739983,
+        0.94036358709186108, 0.94082334075674934, 0.94128146346211106, 0.9417379529256461,
+        0.94219280687272511, 0.94264602303640543, 0.94309759915744862, 0.94354753298433569,
+        0.94399582227328482, 0.9444424647882671, 0.94488745830102361, 0.94533080059108054,
+        0.94577248944576608, 0.94621252266022782, 0.94665089803744651, 0.94708761338825476,
+        0.94752266653135064, 0.94795605529331495, 0.94838777750862802, 0.94881783101968376,
+        0.94924621367680617, 0.94967292333826592, 0.95009795787029505, 0.9505213151471027,
+        0.95094299305089158, 0.95136298947187259, 0.95178130230828051, 0.9521979294663897,
+        0.9526128688605292, 0.95302611841309848, 0.95343767605458207, 0.95384753972356462,
+        0.9542557073667477, 0.95466217693896238, 0.95506694640318601, 0.95547001373055718,
+        0.95587137690038904, 0.95627103390018653, 0.95666898272565881, 0.95706522138073558,
+        0.95745974787758115, 0.95785256023660936, 0.95824365648649756, 0.95863303466420147,
+        0.95902069281497004, 0.95940662899235862, 0.95979084125824476, 0.96017332768284147,
+        0.96055408634471173, 0.96093311533078252, 0.96131041273635875, 0.961685976665138,
+        0.96205980522922363, 0.96243189654913874, 0.96280224875384102, 0.96317085998073526,
+        0.96353772837568741, 0.96390285209303861, 0.96426622929561856, 0.96462785815475927,
+        0.96498773685030803, 0.96534586357064089, 0.96570223651267684, 0.96605685388188978,
+        0.96640971389232277, 0.96676081476660081, 0.96711015473594408, 0.96745773204018048,
+        0.96780354492775933, 0.96814759165576392, 0.96848987048992408, 0.96883037970462949,
+        0.96916911758294189, 0.96950608241660863, 0.96984127250607399, 0.97017468616049241,
+        0.97050632169774165, 0.97083617744443362, 0.97116425173592758, 0.97149054291634329,
+        0.97181504933857155, 0.97213776936428731, 0.97245870136396162, 0.9727778437168737,
+        0.97309519481112294, 0.97341075304364044, 0.97372451682020089, 0.97403648455543523,
+        0.97434665467284121, 0.97465502560479533, 0.97496159579256492, 0.97526636368631903,
+        0.97556932774514038, 0.97587048643703622, 0.9761698382389502, 0.97646738163677305,
+        0.97676311512535419, 0.97705703720851278, 0.97734914639904868, 0.97763944121875357,
+        0.97792792019842123, 0.9782145818778597, 0.97849942480590069, 0.97878244754041133,
+        0.9790636486483042, 0.97934302670554807, 0.97962058029717869, 0.9798963080173092,
+        0.9801702084691396, 0.98044228026496905, 0.98071252202620385, 0.98098093238336914,
+        0.98124750997611898, 0.98151225345324533, 0.98177516147268928, 0.98203623270155038,
+        0.98229546581609617, 0.98255285950177296, 0.98280841245321449, 0.98306212337425214,
+        0.98331399097792482, 0.98356401398648763, 0.98381219113142193, 0.98405852115344505,
+        0.98430300280251803, 0.9845456348378574, 0.98478641602794226, 0.98502534515052365,
+        0.98526242099263484, 0.98549764235059922, 0.98573100803003932, 0.98596251684588609,
+        0.98619216762238726, 0.9864199591931162, 0.98664589040098094, 0.98686996009823169,
+        0.98709216714647052, 0.98731251041665902, 0.98753098878912726, 0.9877476011535814,
+        0.98796234640911229, 0.98817522346420372, 0.98838623123674052, 0.98859536865401609,
+        0.98880263465274099, 0.98900802817905031, 0.98921154818851198, 0.98941319364613389,
+        0.98961296352637218, 0.98981085681313818, 0.99000687249980679, 0.99020100958922308,
+        0.99039326709371012, 0.9905836440350767, 0.9907721394446235, 0.99095875236315112,
+        0.99114348184096723, 0.9913263269378928, 0.99150728672327015, 0.99168636027596901,
+        0.9918635466843938, 0.9920388450464902, 0.99221225446975181, 0.99238377407122702,
+        0.99255340297752515, 0.9927211403248235, 0.99288698525887287, 0.9930509369350049,
+        0.99321299451813794, 0.99337315718278274, 0.99353142411304918, 0.99368779450265243,
+        0.99384226755491845, 0.99399484248279002, 0.9941455185088327, 0.99429429486524057,
+        0.99444117079384209, 0.99458614554610536, 0.99472921838314365, 0.99487038857572185,
+        0.99500965540426034, 0.99514701815884132, 0.99528247613921428, 0.99541602865480039,
+        0.99554767502469788, 0.99567741457768777, 0.99580524665223813, 0.99593117059650871,
+        0.99605518576835683, 0.9961772915353414, 0.99629748727472789, 0.99641577237349244,
+        0.9965321462283272, 0.99664660824564422, 0.99675915784158031, 0.99686979444200086,
+        0.99697851748250432, 0.99708532640842662, 0.99719022067484531, 0.99729319974658293,
+        0.99739426309821144, 0.9974934102140568, 0.99759064058820135, 0.99768595372448887,
+        0.99777934913652766, 0.99787082634769364, 0.99796038489113548, 0.99804802430977624,
+        0.99813374415631817, 0.99821754399324514, 0.99829942339282596, 0.9983793819371185,
+        0.99845741921797138, 0.99853353483702834, 0.99860772840572998, 0.99867999954531772,
+        0.99875034788683581, 0.99881877307113465, 0.99888527474887301, 0.99894985258052083,
+        0.99901250623636195, 0.99907323539649595, 0.99913203975084119, 0.99918891899913687,
+        0.99924387285094496, 0.99929690102565283, 0.99934800325247508, 0.99939717927045579,
+        0.99944442882846996, 0.99948975168522569, 0.99953314760926626, 0.99957461637897116,
+        0.99961415778255847, 0.99965177161808605, 0.99968745769345291, 0.99972121582640072,
+        0.99975304584451585, 0.99978294758522945, 0.99981092089581924, 0.99983696563341118,
+        0.99986108166497967, 0.99988326886734891, 0.99990352712719366, 0.99992185634104069,
+        0.99993825641526857, 0.99995272726610918, 0.99996526881964787, 0.99997588101182411,
+        0.99998456378843215, 0.99999131710512135, 0.99999614092739619, 0.99999903523061706,
+        0.99999999999999989, 0.99999903523061706, 0.99999614092739619, 0.99999131710512135,
+        0.99998456378843215, 0.99997588101182411, 0.99996526881964787, 0.99995272726610918,
+        0.99993825641526857, 0.99992185634104069, 0.99990352712719366, 0.99988326886734891,
+        0.99986108166497967, 0.99983696563341118, 0.99981092089581924, 0.99978294758522945,
+        0.99975304584451585, 0.99972121582640072, 0.99968745769345291, 0.99965177161808605,
+        0.99961415778255847, 0.99957461637897116, 0.99953314760926626, 0.99948975168522569,
+        0.99944442882846996, 0.99939717927045579, 0.99934800325247508, 0.99929690102565283,
+        0.99924387285094496, 0.99918891899913687, 0.99913203975084119, 0.99907323539649595,
+        0.99901250623636195, 0.99894985258052083, 0.99888527474887301, 0.99881877307113465,
+        0.99875034788683581, 0.99867999954531772, 0.99860772840572998, 0.99853353483702834,
+        0.99845741921797138, 0.9983793819371185, 0.99829942339282596, 0.99821754399324514,
+        0.99813374415631817, 0.99804802430977624, 0.99796038489113548, 0.99787082634769375,
+        0.99777934913652766, 0.99768595372448887, 0.99759064058820135, 0.9974934102140568,
+        0.99739426309821155, 0.99729319974658293, 0.99719022067484531, 0.99708532640842662,
+        0.99697851748250432, 0.99686979444200086, 0.99675915784158031, 0.99664660824564422,
+        0.99653214622832731, 0.99641577237349244, 0.99629748727472789, 0.9961772915353414,
+        0.99605518576835694, 0.99593117059650871, 0.99580524665223813, 0.99567741457768777,
+        0.99554767502469799, 0.99541602865480039, 0.99528247613921428, 0.99514701815884132,
+        0.99500965540426034, 0.99487038857572185, 0.99472921838314365, 0.99458614554610536,
+        0.9944411707938422, 0.99429429486524057, 0.9941455185088327, 0.99399484248279002,
+        0.99384226755491856, 0.99368779450265254, 0.99353142411304918, 0.99337315718278274,
+        0.99321299451813805, 0.99305093693500501, 0.99288698525887287, 0.9927211403248235,
+        0.99255340297752515, 0.99238377407122702, 0.99221225446975181, 0.9920388450464902,
+        0.9918635466843938, 0.99168636027596901, 0.99150728672327015, 0.9913263269378928,
+        0.99114348184096723, 0.99095875236315112, 0.9907721394446235, 0.99058364403507682,
+        0.99039326709371012, 0.99020100958922308, 0.99000687249980679, 0.98981085681313818,
+        0.98961296352637218, 0.98941319364613389, 0.98921154818851198, 0.98900802817905054,
+        0.98880263465274099, 0.98859536865401609, 0.98838623123674052, 0.98817522346420372,
+        0.9879623464091124, 0.9877476011535814, 0.98753098878912726, 0.98731251041665902,
+        0.98709216714647052, 0.98686996009823169, 0.98664589040098094, 0.9864199591931162,
+        0.98619216762238726, 0.98596251684588621, 0.98573100803003932, 0.98549764235059922,
+        0.98526242099263484, 0.98502534515052365, 0.98478641602794226, 0.98454563483785751,
+        0.98430300280251815, 0.98405852115344505, 0.98381219113142204, 0.98356401398648774,
+        0.98331399097792482, 0.98306212337425214, 0.98280841245321449, 0.98255285950177307,
+        0.98229546581609628, 0.98203623270155038, 0.98177516147268939, 0.98151225345324533,
+        0.98124750997611898, 0.98098093238336914, 0.98071252202620396, 0.98044228026496905,
+        0.98017020846913971, 0.97989630801730931, 0.9796205802971788, 0.97934302670554818,
+        0.9790636486483042, 0.97878244754041133, 0.97849942480590069, 0.9782145818778597,
+        0.97792792019842134, 0.97763944121875357, 0.9773491463990488, 0.97705703720851289,
+        0.9767631151253543, 0.97646738163677305, 0.9761698382389502, 0.97587048643703622,
+        0.97556932774514038, 0.97526636368631914, 0.97496159579256492, 0.97465502560479533,
+        0.97434665467284121, 0.97403648455543534, 0.97372451682020089, 0.97341075304364044,
+        0.97309519481112305, 0.97277784371687392, 0.97245870136396173, 0.97213776936428742,
+        0.97181504933857155, 0.9714905429163434, 0.9711642517359278, 0.97083617744443362,
+        0.97050632169774165, 0.97017468616049252, 0.9698412725060741, 0.96950608241660863,
+        0.96916911758294189, 0.96883037970462949, 0.96848987048992419, 0.96814759165576403,
+        0.96780354492775955, 0.96745773204018071, 0.96711015473594431, 0.96676081476660092,
+        0.96640971389232289, 0.96605685388188978, 0.96570223651267684, 0.96534586357064089,
+        0.96498773685030814, 0.96462785815475938, 0.96426622929561856, 0.96390285209303861,
+        0.96353772837568741, 0.96317085998073537, 0.96280224875384124, 0.96243189654913897,
+        0.96205980522922374, 0.961685976665138, 0.96131041273635887, 0.96093311533078252,
+        0.96055408634471184, 0.96017332768284147, 0.95979084125824476, 0.95940662899235862,
+        0.95902069281497004, 0.95863303466420158, 0.95824365648649756, 0.95785256023660947,
+        0.95745974787758126, 0.95706522138073558, 0.95666898272565881, 0.95627103390018653,
+        0.95587137690038915, 0.95547001373055718, 0.95506694640318612, 0.95466217693896249,
+        0.95425570736674781, 0.95384753972356484, 0.95343767605458207, 0.95302611841309859,
+        0.95261286886052932, 0.95219792946638981, 0.95178130230828062, 0.95136298947187259,
+        0.95094299305089169, 0.95052131514710281, 0.95009795787029516, 0.94967292333826592,
+        0.94924621367680628, 0.94881783101968387, 0.94838777750862802, 0.94795605529331506,
+        0.94752266653135064, 0.94708761338825487, 0.94665089803744673, 0.94621252266022782,
+        0.9457724894457662, 0.94533080059108054, 0.94488745830102372, 0.94444246478826732,
+        0.94399582227328493, 0.94354753298433569, 0.94309759915744862, 0.94264602303640566,
+        0.94219280687272511, 0.9417379529256461, 0.94128146346211106, 0.94082334075674945,
+        0.9403635870918613, 0.93990220475739983, 0.93943919605095616, 0.93897456327774054,
+        0.93850830875056723, 0.93804043478983612, 0.93757094372351735, 0.93709983788713247,
+        0.93662711962373879, 0.93615279128391182, 0.93567685522572763, 0.9351993138147463,
+        0.93472016942399427, 0.93423942443394681, 0.93375708123251133, 0.93327314221500879,
+        0.93278760978415753, 0.93230048635005491, 0.93181177433015916, 0.93132147614927352,
+        0.93082959423952694, 0.93033613104035628, 0.92984108899849016, 0.92934447056792902,
+        0.92884627820992871, 0.92834651439298188, 0.92784518159279994, 0.92734228229229532,
+        0.92683781898156337, 0.9263317941578636, 0.92582421032560203, 0.9253150699963133,
+        0.92480437568864104, 0.92429212992832099, 0.92377833524816144, 0.92326299418802593,
+        0.92274610929481338, 0.92222768312244074, 0.92170771823182351, 0.92118621719085825,
+        0.92066318257440194, 0.92013861696425536, 0.9196125229491432, 0.91908490312469504,
+        0.91855576009342721, 0.91802509646472275, 0.91749291485481388, 0.91695921788676216,
+        0.91642400819043868, 0.91588728840250655, 0.91534906116640102, 0.91480932913230895,
+        0.91426809495715233, 0.91372536130456639, 0.91318113084488128, 0.91263540625510331,
+        0.91208819021889409, 0.91153948542655228, 0.91098929457499345, 0.91043762036773068,
+        0.90988446551485458, 0.9093298327330146, 0.90877372474539775, 0.90821614428171049,
+        0.90765709407815798, 0.90709657687742418, 0.90653459542865289, 0.90597115248742599,
+        0.90540625081574566, 0.90483989318201341, 0.90427208236100887, 0.90370282113387168,
+        0.90313211228808055, 0.9025599586174321, 0.90198636292202206, 0.90141132800822454,
+        0.90083485668867103, 0.90025695178223142, 0.89967761611399166, 0.89909685251523552,
+        0.89851466382342271, 0.89793105288216812, 0.89734602254122253, 0.89675957565645148,
+        0.89617171508981353, 0.89558244370934093, 0.89499176438911898, 0.89439968000926406,
+        0.89380619345590384, 0.89321130762115586, 0.89261502540310711, 0.89201734970579305,
+        0.89141828343917617, 0.89081782951912536, 0.89021599086739522, 0.88961277041160391,
+        0.88900817108521346, 0.88840219582750735, 0.88779484758357008, 0.88718612930426555,
+        0.88657604394621592, 0.88596459447178066, 0.88535178384903468, 0.88473761505174686,
+        0.88412209105935946, 0.88350521485696598, 0.88288698943528943, 0.88226741779066153,
+        0.88164650292500124, 0.8810242478457917, 0.88040065556606073, 0.8797757291043572,
+        0.87914947148473077, 0.87852188573670964, 0.87789297489527818, 0.87726274200085608,
+        0.87663119009927626, 0.875998322241762, 0.87536414148490671, 0.87472865089065088,
+        0.87409185352626018, 0.87345375246430379, 0.87281435078263203, 0.87217365156435467,
+        0.87153165789781839, 0.87088837287658449, 0.87024379959940767, 0.86959794117021316,
+        0.86895080069807396, 0.8683023812971894, 0.86765268608686275, 0.86700171819147831,
+        0.8663494807404799, 0.86569597686834732, 0.86504120971457499, 0.86438518242364926,
+        0.86372789814502493, 0.8630693600331043, 0.86240957124721385, 0.86174853495158055,
+        0.86108625431531172, 0.86042273251237023, 0.85975797272155241, 0.85909197812646609,
+        0.85842475191550716, 0.85775629728183655, 0.85708661742335812, 0.85641571554269558,
+        0.85574359484716955, 0.85507025854877483, 0.85439570986415703, 0.85371995201459072,
+        0.85304298822595526, 0.85236482172871242, 0.85168545575788324, 0.85100489355302522,
+        0.85032313835820861, 0.8496401934219947, 0.84895606199741036, 0.84827074734192742,
+        0.84758425271743798, 0.84689658139023138, 0.84620773663097171, 0.84551772171467376,
+        0.84482653992067946, 0.84413419453263616, 0.8434406888384719, 0.84274602613037208,
+        0.84205020970475686, 0.8413532428622571, 0.84065512890769145, 0.83995587115004267,
+        0.83925547290243374, 0.83855393748210494, 0.8378512682103908, 0.83714746841269461,
+        0.8364425414184673, 0.8357364905611826, 0.83502931917831269, 0.83432103061130658,
+        0.83361162820556423, 0.832901115310415, 0.83218949527909236, 0.83147677146871046,
+        0.83076294724024136, 0.83004802595849014, 0.82933201099207132, 0.82861490571338592,
+        0.82789671349859695, 0.82717743772760477, 0.82645708178402544, 0.82573564905516417,
+        0.82501314293199368, 0.82428956680912924, 0.82356492408480431, 0.82283921816084771,
+        0.82211245244265885, 0.82138463033918363, 0.82065575526289136, 0.81992583062974989,
+        0.81919485985920115, 0.81846284637413891, 0.81772979360088227, 0.81699570496915352,
+        0.81626058391205358, 0.8155244338660369, 0.81478725827088816, 0.8140490605696985,
+        0.81330984420883989, 0.81256961263794236, 0.81182836930986957, 0.81108611768069339,
+        0.81034286120967136, 0.80959860335922085, 0.80885334759489624, 0.80810709738536357,
+        0.80735985620237638, 0.80661162752075188, 0.80586241481834675, 0.80511222157603124,
+        0.80436105127766688, 0.80360890741008117, 0.80285579346304248, 0.80210171292923715,
+        0.8013466693042437, 0.80059066608650931, 0.79983370677732535, 0.79907579488080172,
+        0.79831693390384439, 0.79755712735612927, 0.79679637875007825, 0.79603469160083495,
+        0.79527206942624029, 0.79450851574680692, 0.79374403408569627, 0.79297862796869267,
+        0.79221230092417982, 0.79144505648311547, 0.79067689817900699, 0.78990782954788707,
+        0.78913785412828941, 0.78836697546122281, 0.78759519709014814, 0.78682252256095309,
+        0.78604895542192699, 0.78527449922373704, 0.78449915751940291, 0.78372293386427327,
+        0.78294583181599964, 0.78216785493451246, 0.78138900678199674, 0.78060929092286713,
+        0.77982871092374229, 0.77904727035342203, 0.77826497278286133, 0.77748182178514524,
+        0.77669782093546591, 0.77591297381109603, 0.7751272839913651, 0.77434075505763511,
+        0.77355339059327388, 0.77276519418363254, 0.77197616941602021, 0.77118631987967767,
+        0.77039564916575498, 0.76960416086728534, 0.76881185857915979, 0.76801874589810448,
+        0.76722482642265355, 0.76643010375312604, 0.76563458149160069, 0.7648382632418903,
+        0.76404115260951833, 0.76324325320169328, 0.7624445686272836, 0.76164510249679418,
+        0.76084485842234006, 0.7600438400176226, 0.75924205089790464, 0.7584394946799845,
+        0.75763617498217339, 0.75683209542426921, 0.75602725962753103, 0.75522167121465578,
+        0.75441533380975334, 0.75360825103832008, 0.75280042652721624, 0.75199186390464035,
+        0.75118256680010287, 0.75037253884440425, 0.74956178366960757, 0.7487503049090154,
+        0.74793810619714463, 0.74712519116970033, 0.74631156346355365, 0.74549722671671459,
+        0.74468218456830815, 0.74386644065854968, 0.74304999862872012, 0.74223286212114059,
+        0.74141503477914872, 0.74059652024707245, 0.73977732217020686, 0.73895744419478815,
+        0.73813688996796922, 0.73731566313779562, 0.73649376735317984, 0.73567120626387672,
+        0.73484798352045955, 0.7340241027742942, 0.73319956767751493, 0.7323743818830003,
+        0.73154854904434718, 0.73072207281584733, 0.72989495685246075, 0.72906720480979359,
+        0.72823882034407161, 0.72740980711211634, 0.72658016877131992, 0.72574990897962,
+        0.72491903139547675, 0.72408753967784645, 0.72325543748615762, 0.72242272848028655,
+        0.72158941632053286, 0.72075550466759242, 0.71992099718253721, 0.71908589752678687,
+        0.71825020936208583, 0.71741393635047912, 0.71657708215428495, 0.71573965043607435,
+        0.7149016448586436, 0.71406306908499106, 0.71322392677829149, 0.7123842216018732,
+        0.71154395721919117, 0.71070313729380474, 0.70986176548935254, 0.70901984546952745,
+        0.7081773808980526, 0.70733437543865585, 0.70649083275504743, 0.7056467565108937,
+        0.70480215036979355, 0.70395701799525368, 0.70311136305066502, 0.70226518919927594,
+        0.70141850010417095, 0.70057129942824481, 0.69972359083417801, 0.69887537798441368,
+        0.69802666454113049, 0.69717745416622179, 0.69632775052126938, 0.6954775572675197,
+        0.69462687806585954, 0.69377571657679171, 0.6929240764604101, 0.69207196137637728,
+        0.69121937498389885, 0.6903663209416997, 0.6895128029080001, 0.68865882454049032,
+        0.68780438949630818, 0.68694950143201439, 0.68609416400356782, 0.68523838086630207,
+        0.68438215567490146, 0.68352549208337565, 0.68266839374503774, 0.68181086431247906,
+        0.680952907437545, 0.6800945267713121, 0.67923572596406179, 0.67837650866525956,
+        0.67751687852352882, 0.67665683918662822, 0.67579639430142635, 0.67493554751388019,
+        0.67407430246900768, 0.673212662810868, 0.67235063218253521, 0.67148821422607474,
+        0.67062541258252129, 0.66976223089185161, 0.66889867279296467, 0.66803474192365597,
+        0.66717044192059383, 0.66630577641929645, 0.66544074905410799, 0.66457536345817358,
+        0.66370962326341865, 0.66284353210052305, 0.66197709359889823, 0.66111031138666432,
+        0.66024318909062418, 0.65937573033624375, 0.6585079387476257, 0.65763981794748694,
+        0.65677137155713539, 0.65590260319644655, 0.6550335164838389, 0.65416411503625294,
+        0.65329440246912607, 0.65242438239636968, 0.65155405843034719, 0.65068343418184738,
+        0.64981251326006517, 0.64894129927257693, 0.64806979582531632, 0.64719800652255233,
+        0.64632593496686619, 0.64545358475912673, 0.64458095949846972, 0.64370806278227344,
+        0.64283489820613549, 0.64196146936385123, 0.64108777984738785, 0.64021383324686543,
+        0.63933963315053111, 0.63846518314473744, 0.63759048681391928, 0.63671554774057149,
+        0.63584036950522393, 0.63496495568642219, 0.63408930986070289, 0.63321343560257026,
+        0.63233733648447632, 0.63146101607679384, 0.63058447794779804, 0.62970772566364175,
+        0.6288307627883335, 0.62795359288371477, 0.62707621950943804, 0.62619864622294241,
+        0.62532087657943436, 0.62444291413186293, 0.62356476243089831, 0.62268642502490956,
+        0.62180790545994069, 0.62092920727969114, 0.62005033402549203, 0.61917128923628351,
+        0.61829207644859341, 0.61741269919651565, 0.61653316101168532, 0.61565346542326038,
+        0.61477361595789737, 0.61389361613972981, 0.61301346949034696, 0.61213317952876944,
+        0.61125274977143074, 0.61037218373215341, 0.60949148492212712, 0.60861065684988735,
+        0.60772970302129425, 0.60684862693950858, 0.60596743210497284, 0.60508612201538803,
+        0.60420470016569228, 0.60332317004803993, 0.60244153515177779, 0.60155979896342626,
+        0.60067796496665693, 0.59979603664227021, 0.59891401746817541, 0.59803191091936825,
+        0.59714972046790893, 0.59626744958290268, 0.59538510173047765, 0.59450268037376286,
+        0.59362018897286895, 0.59273763098486332, 0.59185500986375372, 0.59097232906046393,
+        0.59008959202281364, 0.58920680219549759, 0.58832396302006496, 0.58744107793489608,
+        0.58655815037518522, 0.58567518377291705, 0.58479218155684709, 0.58390914715248032,
+        0.58302608398204958, 0.58214299546449733, 0.58125988501545245, 0.5803767560472114,
+        0.5794936119687164, 0.5786104561855363, 0.57772729209984319, 0.57684412311039579,
+        0.57596095261251645, 0.57507778399807152, 0.57419462065545135, 0.57331146596954807,
+        0.57242832332173843, 0.57154519608986121, 0.57066208764819826, 0.56977900136745341,
+        0.5688959406147337, 0.56801290875352684, 0.56712990914368411, 0.56624694514139884,
+        0.56536402009918707, 0.56448113736586736, 0.56359830028653934, 0.56271551220256755,
+        0.56183277645155882, 0.56095009636734305, 0.56006747527995449, 0.55918491651561142,
+        0.55830242339669556, 0.55741999924173447, 0.55653764736538147, 0.55565537107839513,
+        0.55477317368762147, 0.55389105849597209, 0.55300902880240843, 0.55212708790191933,
+        0.5512452390855036, 0.55036348564014992, 0.54948183084881874, 0.54860027799042077,
+        0.54771883033980151, 0.5468374911677194, 0.54595626374082817, 0.54507515132165718,
+        0.54419415716859421, 0.54331328453586303, 0.5424325366735091, 0.54155191682737791,
+        0.5406714282390972, 0.53979107414605887, 0.53891085778139802, 0.53803078237397761,
+        0.53715085114836847, 0.53627106732483032, 0.53539143411929435, 0.53451195474334479,
+        0.53363263240419867, 0.53275347030469078, 0.53187447164325352, 0.53099563961389873,
+        0.53011697740620078, 0.52923848820527575, 0.52836017519176715, 0.52748204154182543,
+        0.526604090427091, 0.52572632501467575, 0.52484874846714635, 0.52397136394250421,
+        0.52309417459417074, 0.52221718357096769, 0.52134039401710019, 0.52046380907213929,
+        0.5195874318710032, 0.51871126554394165, 0.51783531321651799, 0.51695957800959058,
+        0.51608406303929699, 0.51520877141703636, 0.51433370624945074, 0.51345887063841,
+        0.51258426768099419, 0.51170990046947529, 0.51083577209130204, 0.50996188562908062,
+        0.50908824416055998, 0.50821485075861417, 0.50734170849122529, 0.50646882042146679,
+        0.50559618960748764, 0.5047238191024932, 0.50385171195473188, 0.50297987120747689,
+        0.50210829989900985, 0.50123700106260438, 0.50036597772650904, 0.49949523291393289,
+        0.4986247696430276, 0.49775459092687169, 0.49688469977345417, 0.49601509918565961,
+        0.49514579216124899, 0.49427678169284783, 0.49340807076792709, 0.49253966236878877,
+        0.49167155947255026, 0.490803765051126, 0.48993628207121537, 0.48906911349428495,
+        0.48820226227655322, 0.48733573136897479, 0.48646952371722568, 0.48560364226168617,
+        0.48473808993742751, 0.48387286967419518, 0.4830079843963942, 0.48214343702307383,
+        0.48127923046791099, 0.48041536763919768, 0.47955185143982404, 0.47868868476726406,
+        0.47782587051356024, 0.4769634115653093, 0.47610131080364537, 0.4752395711042286,
+        0.47437819533722758, 0.47351718636730566, 0.47265654705360693, 0.47179628024973946,
+        0.47093638880376365, 0.47007687555817618, 0.46921774334989563, 0.46835899501024858,
+        0.46750063336495551, 0.46664266123411469, 0.46578508143219111, 0.46492789676800017,
+        0.46407111004469426, 0.46321472405974906, 0.46235874160494828, 0.46150316546637171,
+        0.4606479984243802, 0.4597932432536021, 0.45893890272291982, 0.45808497959545635,
+        0.45723147662855956, 0.45637839657379237, 0.45552574217691649, 0.45467351617787999,
+        0.45382172131080417, 0.45297036030396864, 0.45211943587980052, 0.45126895075485984,
+        0.45041890763982673, 0.44956930923948801, 0.44872015825272527, 0.44787145737249945,
+        0.44702320928584138, 0.44617541667383664, 0.44532808221161335, 0.44448120856833012,
+        0.44363479840716147, 0.4427888543852877, 0.44194337915388127, 0.44109837535809421,
+        0.44025384563704573, 0.43940979262381052, 0.43856621894540476, 0.43772312722277645,
+        0.43688052007079137, 0.43603840009822165, 0.43519676990773426, 0.43435563209587674,
+        0.43351498925306853, 0.43267484396358713, 0.43183519880555665, 0.43099605635093635,
+        0.43015741916550915, 0.42931928980886835, 0.4284816708344088, 0.42764456478931367,
+        0.42680797421454314, 0.42597190164482424, 0.42513634960863678, 0.4243013206282058,
+        0.42346681721948781, 0.42263284189216055, 0.42179939714961179, 0.42096648548892901,
+        0.42013410940088636, 0.41930227136993675, 0.41847097387419907, 0.41764021938544826,
+        0.41681001036910442, 0.41598034928422128, 0.41515123858347763, 0.4143226807131653,
+        0.4134946781131793, 0.41266723321700732, 0.41184034845171991, 0.41101402623795857,
+        0.410188268989928, 0.4093630791153845, 0.4085384590156263, 0.40771441108548401,
+        0.40689093771330864, 0.40606804128096502, 0.40524572416381976, 0.40442398873073215,
+        0.40360283734404445, 0.40278227235957276, 0.40196229612659573, 0.4011429109878476,
+        0.40032411927950756, 0.39950592333118995, 0.39868832546593636, 0.39787132800020397,
+        0.39705493324385938, 0.3962391435001677, 0.39542396106578404, 0.39460938823074437,
+        0.39379542727845734, 0.39298208048569327, 0.39216935012257875, 0.39135723845258524,
+        0.39054574773252176, 0.38973488021252622, 0.38892463813605527, 0.38811502373987872,
+        0.38730603925406909, 0.38649768690199399, 0.38568996890030782, 0.38488288745894395,
+        0.38407644478110481, 0.38327064306325676, 0.38246548449511991, 0.38166097125966125,
+        0.38085710553308666, 0.38005388948483154, 0.3792513252775559, 0.37844941506713475,
+        0.37764816100265119, 0.37684756522638846, 0.3760476298738234, 0.37524835707361692,
+        0.37444974894760968, 0.37365180761081268, 0.37285453517140066, 0.37205793373070561,
+        0.37126200538320769, 0.37046675221653086, 0.36967217631143434, 0.3688782797418062,
+        0.36808506457465634, 0.36729253287011049, 0.36650068668140134, 0.36570952805486523,
+        0.36491905902993321, 0.36412928163912539, 0.36334019790804484, 0.36255180985536939,
+        0.36176411949284831, 0.36097712882529404, 0.36019083985057659, 0.35940525455961758,
+        0.35862037493638443, 0.35783620295788282, 0.35705274059415348, 0.35626998980826458,
+        0.35548795255630627, 0.35470663078738573, 0.35392602644361948, 0.3531461414601309,
+        0.35236697776504239, 0.35158853727947109, 0.350810821917523, 0.35003383358628831,
+        0.34925757418583459, 0.34848204560920398, 0.34770724974240658, 0.34693318846441579,
+        0.34615986364716389, 0.34538727715553519, 0.34461543084736412, 0.34384432657342856,
+        0.34307396617744562, 0.34230435149606703, 0.34153548435887515, 0.34076736658837647,
+        0.34000000000000008, 0.33923338640209155, 0.33846752759590881, 0.3377024253756189,
+        0.33693808152829141, 0.33617449783389758, 0.33541167606530425, 0.33464961798827048,
+        0.33388832536144358, 0.33312779993635577, 0.33236804345741866, 0.33160905766192228,
+        0.33085084428002959, 0.33009340503477358, 0.3293367416420539, 0.32858085581063196,
+        0.32782574924213015, 0.32707142363102687, 0.3263178806646535, 0.32556512202319154,
+        0.32481314937966999, 0.32406196439996016, 0.32331156874277595, 0.32256196405966875,
+        0.3218131519950253, 0.3210651341860653, 0.32031791226283701, 0.31957148784821737,
+        0.3188258625579074, 0.31808103800043042, 0.31733701577712981, 0.31659379748216643,
+        0.31585138470251539, 0.315109779017966, 0.3143689820011179, 0.31362899521737964,
+        0.31288982022496681, 0.31215145857489868, 0.31141391181099864, 0.31067718146989093,
+        0.30994126908099889, 0.30920617616654383, 0.30847190424154353, 0.30773845481380901,
+        0.30700582938394561, 0.30627402944535004, 0.30554305648420921, 0.30481291197949956,
+        0.30408359740298396, 0.30335511421921357, 0.30262746388552431, 0.30190064785203707,
+        0.30117466756165612, 0.30044952445006917, 0.29972521994574441, 0.29900175546993268,
+        0.29827913243666476, 0.29755735225275154, 0.29683641631778362, 0.29611632602412929,
+        0.29539708275693644, 0.29467868789413088, 0.293961142806416, 0.29324444885727319,
+        0.29252860740296149, 0.29181361979251608, 0.29109948736775093, 0.29038621146325688,
+        0.28967379340640242, 0.28896223451733416, 0.28825153610897541, 0.28754169948702907,
+        0.28683272594997627, 0.28612461678907714, 0.28541737328837163, 0.2847109967246802,
+        0.28400548836760298, 0.28330084947952272, 0.28259708131560424, 0.28189418512379538,
+        0.28119216214482867, 0.28049101361222017, 0.27979074075227361, 0.27909134478407904,
+        0.27839282691951517, 0.27769518836325024, 0.27699843031274352, 0.2763025539582456,
+        0.27560756048280177, 0.27491345106225218, 0.27422022686523356, 0.27352788905318148,
+        0.27283643878033026, 0.2721458771937173, 0.27145620543318311, 0.2707674246313736,
+        0.27007953591374234, 0.26939254039855248, 0.2687064391968777, 0.26802123341260647,
+        0.26733692414244276, 0.26665351247590857, 0.26597099949534697, 0.26528938627592258,
+        0.26460867388562648, 0.26392886338527749, 0.26324995582852473, 0.26257195226185059,
+        0.26189485372457355, 0.26121866124884968, 0.26054337585967763, 0.25986899857490026,
+        0.25919553040520765, 0.25852297235414079, 0.25785132541809308, 0.25718059058631576,
+        0.25651076884091972, 0.25584186115687896, 0.25517386850203438, 0.25450679183709701,
+        0.25384063211565056, 0.25317539028415681, 0.25251106728195793, 0.25184766404128062,
+        0.25118518148723989, 0.25052362053784172, 0.24986298210398894, 0.24920326708948398,
+        0.24854447639103289, 0.24788661089824954, 0.24722967149366004, 0.24657365905270578,
+        0.24591857444374948, 0.24526441852807818, 0.24461119215990812, 0.24395889618638916,
+        0.24330753144760847, 0.24265709877659647, 0.24200759899933083, 0.24135903293474081,
+        0.24071140139471242, 0.24006470518409351, 0.23941894510069717, 0.23877412193530875,
+        0.23813023647168965, 0.23748728948658246, 0.2368452817497167, 0.23620421402381236,
+        0.23556408706458737, 0.23492490162076157, 0.23428665843406227, 0.23364935823922983,
+        0.23301300176402345, 0.23237758972922509, 0.2317431228486477, 0.23110960182913909,
+        0.23047702737058801, 0.22984540016593052, 0.22921472090115441, 0.22858499025530693,
+        0.22795620890049972, 0.22732837750191504, 0.22670149671781192, 0.22607556719953267,
+        0.22545058959150752, 0.22482656453126335, 0.22420349264942829, 0.22358137456973876,
+        0.22296021090904605, 0.22234000227732142, 0.22172074927766516, 0.22110245250631139,
+        0.22048511255263531, 0.21986872999915982, 0.21925330542156313, 0.2186388393886835,
+        0.21802533246252909, 0.21741278519828283, 0.21680119814431034, 0.21619057184216714,
+        0.2155809068266045, 0.21497220362557867, 0.21436446276025714, 0.21375768474502582,
+        0.21315187008749675, 0.21254701928851594, 0.21194313284216931, 0.21134021123579244,
+        0.21073825494997706, 0.21013726445857872, 0.20953724022872511, 0.20893818272082237,
+        0.20834009238856532, 0.20774296967894357, 0.20714681503225016, 0.20655162888208967,
+        0.20595741165538622, 0.20536416377239089, 0.20477188564669149, 0.20418057768521952,
+        0.20359024028825926, 0.20300087384945587, 0.20241247875582311, 0.2018250553877533,
+        0.20123860411902497, 0.20065312531681162, 0.20006861934169023, 0.19948508654765068,
+        0.19890252728210281, 0.1983209418858877, 0.1977403306932847, 0.19716069403202119,
+        0.19658203222328166, 0.19600434558171559, 0.19542763441544819, 0.19485189902608879,
+        0.19427713970874003, 0.19370335675200717, 0.19313055043800792, 0.19255872104238034,
+        0.19198786883429431, 0.19141799407645979, 0.19084909702513664, 0.19028117793014446,
+        0.18971423703487114, 0.18914827457628441, 0.18858329078494024, 0.18801928588499314,
+        0.18745626009420602, 0.18689421362396025, 0.18633314667926465, 0.18577305945876718,
+        0.18521395215476394, 0.18465582495320956, 0.18409867803372765, 0.18354251156961987,
+        0.18298732572787818, 0.18243312066919368, 0.18187989654796768, 0.18132765351232191,
+        0.18077639170410939, 0.18022611125892379, 0.17967681230611188, 0.17912849496878297,
+        0.17858115936381999, 0.17803480560189042, 0.17748943378745596, 0.17694504401878536,
+        0.17640163638796391, 0.17585921098090485, 0.17531776787736039, 0.17477730715093304,
+        0.17423782886908551, 0.1736993330931538, 0.1731618198783571, 0.17262528927380952,
+        0.17208974132253121, 0.17155517606146026, 0.17102159352146262, 0.17048899372734586,
+        0.16995737669786901, 0.16942674244575465, 0.16889709097770092, 0.16836842229439175,
+        0.16784073639051067, 0.16731403325475111, 0.16678831286982876, 0.16626357521249324,
+        0.16573982025354048, 0.16521704795782335, 0.16469525828426554, 0.16417445118587243,
+        0.16365462660974353, 0.1631357844970848, 0.16261792478321979, 0.16210104739760367,
+        0.1615851522638343, 0.16107023929966488, 0.16055630841701632, 0.16004335952199011,
+        0.15953139251487936, 0.15902040729018341, 0.15851040373661901, 0.15800138173713335,
+        0.157493341168917, 0.15698628190341546, 0.15648020380634359, 0.15597510673769746,
+        0.15547099055176727, 0.15496785509715044, 0.15446570021676467, 0.15396452574785993,
+        0.15346433152203315, 0.15296511736524013, 0.15246688309780904, 0.15196962853445381,
+        0.15147335348428614, 0.15097805775083067, 0.15048374113203691, 0.14999040342029307,
+        0.14949804440243927, 0.14900666385978142, 0.14851626156810349, 0.14802683729768268,
+        0.147538390813302, 0.147050921874264, 0.14656443023440477, 0.14607891564210657,
+        0.14559437784031304, 0.14511081656654218, 0.14462823155290019, 0.14414662252609539,
+        0.14366598920745252, 0.14318633131292535, 0.14270764855311255, 0.14222994063327055,
+        0.1417532072533278, 0.14127744810789922, 0.14080266288629928, 0.14032885127255776,
+        0.13985601294543298, 0.13938414757842638, 0.1389132548397965, 0.13844333439257417,
+        0.13797438589457528, 0.13750640899841723, 0.13703940335153206, 0.13657336859618133,
+        0.13610830436947102, 0.1356442103033649, 0.13518108602470091, 0.13471893115520472,
+        0.13425774531150447, 0.13379752810514597, 0.1333382791426074, 0.13287999802531311,
+        0.13242268434965029, 0.13196633770698249, 0.13151095768366511, 0.13105654386106047,
+        0.1306030958155518, 0.13015061311855985, 0.12969909533655705, 0.12924854203108274,
+        0.12879895275875838, 0.12835032707130306, 0.12790266451554755, 0.12745596463345135,
+        0.12701022696211667, 0.12656545103380429, 0.1261216363759492, 0.12567878251117462,
+        0.12523688895730936, 0.12479595522740228, 0.1243559808297377, 0.12391696526785143,
+        0.12347890804054612, 0.12304180864190634, 0.12260566656131536, 0.12217048128347011,
+        0.12173625228839693, 0.12130297905146786, 0.12087066104341511, 0.12043929773034848,
+        0.12000888857377046, 0.11957943303059206, 0.11915093055314879, 0.11872338058921704,
+        0.1182967825820289, 0.11787113597028978, 0.11744644018819325, 0.11702269466543783,
+        0.11659989882724273, 0.1161780520943636, 0.1157571538831098, 0.11533720360535976,
+        0.11491820066857758, 0.114500144475829, 0.11408303442579829, 0.11366686991280339,
+        0.11325165032681375, 0.11283737505346594, 0.11242404347408005, 0.11201165496567655,
+        0.11160020890099182, 0.11118970464849591, 0.11078014157240851, 0.11037151903271529,
+        0.10996383638518489, 0.10955709298138561, 0.10915128816870109, 0.10874642129034855,
+        0.10834249168539437, 0.1079394986887712, 0.10753744163129514, 0.10713631983968114,
+        0.10673613263656166, 0.10633687934050237, 0.10593855926601933, 0.10554117172359587,
+        0.10514471601969985, 0.10474919145679956, 0.10435459733338216, 0.1039609329439697,
+        0.10356819757913666, 0.10317639052552675, 0.10278551106586968, 0.10239555847899912,
+        0.10200653203986927, 0.10161843101957203, 0.1012312546853545, 0.10084500230063596,
+        0.10045967312502471, 0.10007526641433633, 0.099691781420610179, 0.099309217392127044,
+        0.09892757357342645, 0.098546849205323472, 0.098167043524927167, 0.097788155765657109,
+        0.097410185157261256, 0.097033130925833239, 0.096656992293830069, 0.096281768480088847,
+        0.095907458699845419, 0.095534062164751229, 0.095161578082891093, 0.094790005658800844,
+        0.094419344093484181, 0.09404959258443174, 0.093680750325637552, 0.093312816507617177,
+        0.092945790317425392, 0.092579670938673975, 0.092214457551548723, 0.091850149332828368,
+        0.091486745455901741, 0.091124245090785316, 0.090762647404141694, 0.090401951559296534,
+        0.090042156716257288, 0.089683262031730701, 0.08932526665914059, 0.088968169748646034,
+        0.0886119704471591, 0.088256667898362451, 0.08790226124272818, 0.087548749617535088,
+        0.087196132156886944, 0.086844407991730654, 0.086493576249873486, 0.086143636056002296,
+        0.085794586531700884, 0.085446426795468197, 0.085099155962736484, 0.084752773145889582,
+        0.084407277454280241, 0.084062667994249551, 0.083718943869144247, 0.08337610417933497,
+        0.08303414802223498, 0.082693074492317262, 0.082352882681134137, 0.082013571677334487,
+        0.08167514056668268, 0.081337588432076127, 0.081000914353564449, 0.080665117408366682,
+        0.0803301966708906, 0.079996151212750666, 0.079662980102786246, 0.079330682407080327,
+        0.078999257188976893, 0.078668703509100851, 0.078339020425375189, 0.078010206993039982,
+        0.077682262264670524, 0.077355185290196138, 0.07702897511691767, 0.076703630789527244,
+        0.076379151350125962, 0.0760555358382424, 0.075732783290851466, 0.075410892742392099,
+        0.07508986322478689, 0.074769693767459747, 0.074450383397354852, 0.074131931138954901,
+        0.073814336014300166, 0.073497597043006069, 0.073181713242282842, 0.072866683626953671,
+        0.07255250720947308, 0.072239182999945958, 0.071926710006145297, 0.07161508723353216,
+        0.07130431368527311, 0.070994388362259464, 0.070685310263125814, 0.070377078384268571,
+        0.070069691719864324, 0.069763149261889354, 0.069457450000137602, 0.069152592922239436,
+        0.068848577013680717, 0.068545401257820632, 0.068243064635911496, 0.067941566127116687,
+        0.06764090470852975, 0.067341079355192707, 0.067042089040115271, 0.066743932734292882,
+        0.066446609406726281, 0.066150118024439611, 0.06585445755249951, 0.065559626954033737,
+        0.065265625190249449, 0.064972451220452934, 0.064680104002067584, 0.064388582490653004,
+        0.064097885639923594, 0.063808012401767616, 0.063518961726265116, 0.063230732561708025,
+        0.062943323854617914, 0.062656734549765072, 0.062370963590187699, 0.062086009917209514,
+        0.06180187247046004, 0.061518550187892297, 0.061236042005802183, 0.060954346858846938,
+        0.060673463680064155, 0.060393391400890124, 0.060114128951179388, 0.059835675259222829,
+        0.059558029251766932, 0.059281189854032496, 0.059005155989732737, 0.058729926581093307,
+        0.058455500548870255, 0.058181876812368964, 0.057909054289463018, 0.057637031896613136,
+        0.05736580854888533, 0.057095383159970751, 0.05682575464220354, 0.056556921906580064,
+        0.056288883862777778, 0.056021639419173333, 0.055755187482862359, 0.055489526959677522,
+        0.055224656754207596, 0.054960575769816118, 0.054697282908660334, 0.054434777071709337,
+        0.054173057158763895, 0.05391212206847433, 0.053651970698359669, 0.053392601944826396,
+        0.053134014703186738, 0.052876207867678132, 0.052619180331481455, 0.052362930986739997,
+        0.052107458724577983, 0.051852762435119562, 0.051598841007506994, 0.051345693329920158,
+        0.051093318289594652, 0.050841714772840649, 0.050590881665061808, 0.05034081785077333,
+        0.050091522213621474, 0.049842993636401746, 0.049595231001077572, 0.049348233188799093,
+        0.049101999079921826, 0.048856527554024927, 0.048611817489930445, 0.048367867765721537,
+        0.048124677258761205, 0.047882244845711103, 0.047640569402549397, 0.047399649804590327,
+        0.047159484926502356, 0.046920073642326574, 0.046681414825495517, 0.046443507348851824,
+        0.046206350084666101, 0.045969941904656517, 0.045734281680006469, 0.045499368281383602,
+        0.045265200578958054, 0.045031777442420762, 0.044799097741002644, 0.044567160343492271,
+        0.044335964118254953, 0.044105507933250854, 0.043875790656053522, 0.043646811153868093,
+        0.043418568293550147, 0.043191060941623824, 0.042964287964300338, 0.042738248227496292,
+        0.042512940596851762, 0.042288363937749276, 0.042064517115331643, 0.041841398994520489,
+        0.041619008440034466, 0.041397344316407909, 0.041176405488008168, 0.040956190819055105,
+        0.040736699173638605, 0.040517929415737008, 0.040299880409235357, 0.040082551017943314,
+        0.039865940105613923, 0.039650046535961422, 0.039434869172679299, 0.039220406879458804,
+        0.039006658520006898, 0.038793622958064128, 0.038581299057423225, 0.038369685681946861,
+        0.038158781695585745, 0.037948585962396877, 0.037739097346561126, 0.037530314712401827,
+        0.037322236924402459, 0.037114862847224581, 0.036908191345726024, 0.036702221284978756,
+        0.036496951530286439, 0.036292380947203065, 0.036088508401550173, 0.035885332759435215,
+        0.035682852887269217, 0.035481067651784229, 0.035279975920051984, 0.035079576559500954,
+        0.034879868437934551, 0.034680850423548681, 0.034482521384949574, 0.034284880191171284,
+        0.034087925711693848, 0.033891656816460551, 0.033696072375895739, 0.033501171260922565,
+        0.033306952342980228, 0.033113414494041968, 0.032920556586632573, 0.03272837749384571,
+        0.03253687608936176, 0.032346051247465063, 0.032155901843061295, 0.031966426751695504,
+        0.031777624849569037, 0.031589495013557074, 0.031402036121226211, 0.031215247050851304,
+        0.031029126681433587, 0.030843673892717548, 0.030658887565208105, 0.030474766580188203,
+        0.030291309819736004, 0.030108516166741796, 0.029926384504925699, 0.029744913718854502,
+        0.029564102693958934, 0.029383950316550861, 0.029204455473840082, 0.029025617053951902,
+        0.028847433945943773, 0.02866990503982262, 0.028493029226561543, 0.028316805398117185,
+        0.028141232447446207, 0.027966309268522643, 0.027792034756354597, 0.027618407807001207,
+        0.027445427317589435, 0.027273092186330637, 0.027101401312538055, 0.026930353596642781,
+        0.026759947940211068, 0.026590183245960769, 0.026421058417778191, 0.026252572360734243,
+        0.026084723981102016, 0.025917512186372532, 0.025750935885271622, 0.025584993987776632,
+        0.025419685405132494, 0.025255009049868729, 0.025090963835815536, 0.024927548678120373,
+        0.024764762493264425, 0.02460260419907883, 0.024441072714760793, 0.024280166960890547,
+        0.024119885859446979, 0.023960228333824253, 0.02380119330884807, 0.023642779710791241,
+        0.023484986467390702, 0.023327812507863109, 0.023171256762921082, 0.023015318164789182,
+        0.022859995647220237, 0.022705288145510587, 0.022551194596517068, 0.022397713938672313,
+        0.022244845112000651, 0.022092587058134334, 0.021940938720328908, 0.021789899043479471,
+        0.021639466974136184, 0.021489641460520015, 0.021340421452538526, 0.021191805901801718,
+        0.02104379376163705, 0.02089638398710577, 0.020749575535018196, 0.020603367363949056,
+        0.020457758434253501, 0.020312747708081849, 0.020168334149395652, 0.020024516723982852,
+        0.019881294399473226, 0.019738666145353537, 0.01959663093298307, 0.019455187735608559,
+        0.019314335528379911, 0.019174073288364915, 0.019034399994564744, 0.018895314627928823,
+        0.018756816171370004, 0.018618903609779677, 0.018481575930042675, 0.01834483212105241,
+        0.018208671173725599, 0.018073092081017428, 0.01793809383793591, 0.017803675441557421,
+        0.01766983589104093, 0.017536574187643109, 0.01740388933473274, 0.017271780337805492,
+        0.017140246204498853, 0.017009285944606232, 0.016878898570091935, 0.016749083095105421,
+        0.016619838535996155, 0.016491163911327433, 0.016363058241891375, 0.016235520550723088,
+        0.016108549863114885, 0.01598214520663091, 0.015856305611120822, 0.015731030108734605,
+        0.015606317733936483, 0.015482167523518928, 0.015358578516617025, 0.015235549754722355,
+        0.015113080281696868, 0.014991169143787342, 0.014869815389638739, 0.014749018070308567,
+        0.014628776239280453, 0.014509088952477933, 0.014389955268278527, 0.014271374247527092,
+        0.014153344953549786, 0.01403586645216761, 0.013918937811709997, 0.013802558103028328,
+        0.013686726399509574, 0.013571441777089778, 0.013456703314267349, 0.013342510092116622,
+        0.013228861194301215, 0.013115755707086861, 0.01300319271935553, 0.012891171322618016,
+        0.012779690611027246, 0.012668749681391686, 0.01255834763318784, 0.012448483568574031,
+        0.012339156592402971, 0.012230365812234717, 0.012122110338349819, 0.012014389283762132,
+        0.011907201764231289, 0.011800546898276115, 0.011694423807186896, 0.011588831615038209,
+        0.011483769448701789, 0.01137923643785866, 0.011275231715012234, 0.011171754415500446,
+        0.011068803677508544, 0.010966378642081206, 0.010864478453135151, 0.010763102257471339,
+        0.010662249204787387, 0.010561918447689708, 0.01046210914170588, 0.0103628204452966,
+        0.010264051519867853, 0.010165801529783094, 0.010068069642375194, 0.0099708550279583447,
+        0.0098741568598400831, 0.0097779743143331654, 0.0096823065707672684, 0.0095871528115009097,
+        0.0094925122219332303, 0.009398383990515527, 0.0093047673087631316, 0.009211661371266458,
+        0.0091190653757033668, 0.0090269785228501709, 0.0089354000165929176, 0.0088443290639393518,
+        0.0087537648750298097, 0.0086637066631485987, 0.0085741536447355576, 0.008485105039396923,
+        0.0083965600699166254, 0.0083085179622675587, 0.0082209779456222515, 0.0081339392523643028,
+        0.0080474011180991789, 0.0079613627816651072, 0.0078758234851439568, 0.0077907824738721737,
+        0.007706238996451259, 0.0076221923047589818, 0.0075386416539595935, 0.0074555863025146524,
+        0.0073730255121936678, 0.007290958548084342, 0.0072093846786034782, 0.0071283031755069032,
+        0.0070477133139004167, 0.006967614372249506, 0.0068880056323901012, 0.0068088863795385535,
+        0.006730255902301821, 0.0066521134926877945, 0.0065744584461149974, 0.0064972900614230777,
+        0.0064206076408822449, 0.0063444104902037057, 0.0062686979185491432, 0.0061934692385406942,
+        0.0061187237662708172, 0.0060444608213118256, 0.0059706797267254641, 0.0058973798090728863,
+        0.0058245603984238836, 0.0057522208283664611, 0.0056803604360164545, 0.005608978562026648,
+        0.005538074550596378, 0.0054676477494808029, 0.0053976975099998409, 0.0053282231870478564,
+        0.0052592241391024308, 0.0051906997282334805, 0.0051226493201124573, 0.0050550722840213003,
+        0.0049879679928611365, 0.0049213358231614962, 0.0048551751550888339, 0.004789485372455507,
+        0.0047242658627283524, 0.0046595160170374711, 0.0045952352301846383, 0.0045314229006522266,
+        0.0044680784306111998, 0.0044052012259299667, 0.0043427906961826385, 0.0042808462546573695,
+        0.0042193673183646419, 0.0041583533080453566, 0.0040978036481793961, 0.0040377177669933262,
+        0.0039780950964686118, 0.003918935072349819, 0.0038602371341523306, 0.0038020007251701876,
+        0.0037442252924843322, 0.0036869102869700049, 0.0036300551633046269, 0.0035736593799755995,
+        0.0035177223992877427, 0.0034622436873708723, 0.0034072227141876132, 0.0033526589535405188,
+        0.0032985518830795646, 0.0032449009843098231, 0.0031917057425980971, 0.0031389656471808025,
+        0.0030866801911709485, 0.0030348488715651184, 0.002983471189250686, 0.0029325466490128099,
+        0.0028820747595414559, 0.0028320550334381689, 0.0027824869872230817, 0.0027333701413415346,
+        0.0026847040201710554, 0.0026364881520277439, 0.0025887220691731133, 0.0025414053078206822,
+        0.0024945374081423582, 0.0024481179142749887, 0.0024021463743265498, 0.0023566223403829051,
+        0.0023115453685137455, 0.0022669150187789033, 0.0022227308552345698, 0.0021789924459394705,
+        0.0021356993629607496, 0.0020928511823801316, 0.00205044748429975, 0.002008487852848212,
+        0.0019669718761862187, 0.0019258991465124636, 0.0018852692600693083, 0.0018450818171484723,
+        0.0018053364220966817, 0.0017660326833210949, 0.0017271702132947986, 0.0016887486285623587,
+        0.0016507675497451635, 0.0016132266015466135, 0.0015761254127574092, 0.0015394636162610192,
+        0.0015032408490384258, 0.0014674567521733434, 0.0014321109708575197, 0.0013972031543951907,
+        0.0013627329562085344, 0.0013287000338420285, 0.001295104048967613, 0.0012619446673891727,
+        0.0012292215590475469, 0.0011969343980246239, 0.0011650828625483778, 0.0011336666349971991,
+        0.0011026854019042381, 0.0010721388539619986, 0.0010420266860263899, 0.0010123485971212376,
+        0.00098310429044247416, 0.00095429347336210835, 0.00092591585743241611, 0.00089797115839006236,
+        0.00087045909615995898, 0.00084337939485924773, 0.0008167317828009224, 0.00079051599249811699,
+        0.00076473176066738091, 0.00073937882823255086, 0.00071445694032833129, 0.00068996584630387492,
+        0.00066590529972627988, 0.00064227505838405918, 0.00061907488429045754, 0.00059630454368679586,
+        0.00057396380704581584, 0.00055205244907471918, 0.00053057024871845659, 0.0005095169891628365,
+        0.0004888924578373699, 0.0004686964464184068, 0.00044892875083200889, 0.00042958917125676677,
+        0.00041067751212657544, 0.00039219358213339606, 0.00037413719422994818, 0.00035650816563224941,
+        0.00033930631782218279, 0.00032253147655009196, 0.00030618347183715422, 0.00029026213797753164,
+        0.0002747673135410772, 0.00025969884137534704, 0.00024505656860783487, 0.00023084034664797026,
+        0.00021705003118953348, 0.00020368548221236238, 0.0001907465639843231, 0.00017823314506350274,
+        0.0001661450982995416, 0.00015448230083592307, 0.00014324463411129196, 0.00013243198386141131,
+        0.00012204424012048076, 0.00011208129722284355, 0.00010254305380444362, 9.3429412804199585e-05,
+        8.4740281465350842e-05, 7.6475571336803716e-05, 6.8635198274241693e-05, 6.1219082441582584e-05,
+        5.4227148311658535e-05, 4.7659324667700953e-05, 4.1515544603978882e-05, 3.579574552696474e-05,
+        3.049986915623637e-05, 2.5627861524990525e-05, 2.1179672981153086e-05, 1.7155258187823152e-05,
+        1.3554576124064077e-05, 1.037759008525041e-05, 7.624267683914443e-06, 5.2945808499266223e-06,
+        3.3885058309951477e-06, 1.9060231929018956e-06, 8.471178199742635e-07, 2.1177891514068126e-07,
+        -1.3877787807814457e-17,
+    }
+};
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "xhu_debug.h"
+#include "xhu_wavetables.h"
+
+#define XHU_WAVETABLE_ORC_LINE_SIZE (64)
+
+// Defined in the generated xhu_wavetable_data.c
+extern const xhu_audio_data_t xhu_wavetable_data[XHU_WAVETABLE_LAST][XHU_WAVETABLE_SIZE + 1];
+
+const xhu_audio_data_t *xhu_get_wavetable(xhu_s32_t number)
+{
+    if (number < XHU_WAVETABLE_SINE || number > XHU_WAVETABLE_LAST) {
+        return NULL;
+    }
+    
+    return xhu_wavetable_data[number - 1];
+}
+
+bool xhu_register_wavetables(CSOUND *csound)
+{
+    char orchestra[XHU_WAVETABLE_LAST * XHU_WAVETABLE_ORC_LINE_SIZE];
+    bool created[XHU_WAVETABLE_LAST + 1] = { false };
+    xhu_mem_size_t length = 0;
+    MYFLT *table = NULL;
+    
+    // One orchestra compile creates every missing table empty, GEN02 of a single zero costs no more than a memset
+    for (xhu_s32_t number = XHU_WAVETABLE_SINE; number <= XHU_WAVETABLE_LAST; ++number) {
+        if (csoundGetTable(csound, &table, number) > 0) {
+            XHU_LOG_WARN("Table %d is defined by the orchestra, the built-in table is not registered.", number)
+            continue;
+        }
+        
+        length += snprintf(orchestra + length, sizeof(orchestra) - length,
+                           "giXhuWavetable ftgen %d, 0, %d, -2, 0\n", number, XHU_WAVETABLE_SIZE);
+        created[number] = true;
+    }
+    
+    if (length > 0 && csoundCompileOrc(csound, orchestra) != CSOUND_SUCCESS) {
+        XHU_LOG_ERROR("Could not create the built-in tables")
+        return false;
+    }
+    
+    for (xhu_s32_t number = XHU_WAVETABLE_SINE; number <= XHU_WAVETABLE_LAST; ++number) {
+        if (!created[number]) {
+            continue;
+        }
+        
+        if (csoundGetTable(csound, &table, number) != XHU_WAVETABLE_SIZE) {
+            XHU_LOG_ERROR("Could not create built-in table %d.", number)
+            return false;
+        }
+        
+        // The guard point is part of the generated samples
+        memcpy(table, xhu_wavetable_data[number - 1], (XHU_WAVETABLE_SIZE + 1) * sizeof(xhu_audio_data_t));
+    }
+    
+    return true;
+}
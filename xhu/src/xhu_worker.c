@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2019 by Martin Dejean
+ *
+ * This file is part of Xhu.
+ * Xhu is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Xhu is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Xhu.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "xhu_debug.h"
+#include "xhu_worker.h"
+
+typedef struct xhu_job_s {
+    xhu_job_function_t function;
+    void *data;
+    struct xhu_job_s *next;
+} xhu_job_t;
+
+struct xhu_worker_pool_s {
+    pthread_mutex_t mutex;
+    pthread_cond_t jobs_available;
+    xhu_job_t *head;
+    xhu_job_t *tail;
+    bool stopping;
+    xhu_u32_t thread_count;
+    pthread_t *threads;
+};
+
+static void *xhu_worker_thread(void *data)
+{
+    xhu_worker_pool_t *pool = (xhu_worker_pool_t *)data;
+    
+    pthread_mutex_lock(&pool->mutex);
+    
+    while (true) {
+        while (pool->head == NULL && !pool->stopping) {
+            pthread_cond_wait(&pool->jobs_available, &pool->mutex);
+        }
+        
+        // Stopping only ends the thread once the queue is empty
+        if (pool->head == NULL) {
+            break;
+        }
+        
+        xhu_job_t *job = pool->head;
+        pool->head = job->next;
+        
+        if (pool->head == NULL) {
+            pool->tail = NULL;
+        }
+        
+        pthread_mutex_unlock(&pool->mutex);
+        job->function(job->data);
+        free(job);
+        pthread_mutex_lock(&pool->mutex);
+    }
+    
+    pthread_mutex_unlock(&pool->mutex);
+    
+    return NULL;
+}
+
+xhu_worker_pool_t *xhu_create_worker_pool(xhu_u32_t thread_count)
+{
+    xhu_worker_pool_t *pool = (xhu_worker_pool_t *)calloc(1, sizeof(xhu_worker_pool_t));
+    
+    if (pool == NULL) {
+        return NULL;
+    }
+    
+    pool->threads = (pthread_t *)calloc(thread_count, sizeof(pthread_t));
+    
+    if (pool->threads == NULL) {
+        free(pool);
+        
+        return NULL;
+    }
+    
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->jobs_available, NULL);
+    
+    for (xhu_u32_t i = 0; i < thread_count; ++i) {
+        if (pthread_create(&pool->threads[i], NULL, xhu_worker_thread, pool) != 0) {
+            XHU_LOG_ERROR("Could not create worker thread %u", i)
+            break;
+        }
+        
+        pool->thread_count++;
+    }
+    
+    if (pool->thread_count == 0) {
+        xhu_destroy_worker_pool(pool);
+        
+        return NULL;
+    }
+    
+    XHU_LOG_DEBUG("Created %u worker threads", pool->thread_count)
+    
+    return pool;
+}
+
+void xhu_destroy_worker_pool(xhu_worker_pool_t *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    
+    pthread_mutex_lock(&pool->mutex);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->jobs_available);
+    pthread_mutex_unlock(&pool->mutex);
+    
+    for (xhu_u32_t i = 0; i < pool->thread_count; ++i) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    
+    pthread_cond_destroy(&pool->jobs_available);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->threads);
+    free(pool);
+}
+
+bool xhu_submit_job(xhu_worker_pool_t *pool, xhu_job_function_t function, void *data)
+{
+    xhu_job_t *job = (xhu_job_t *)malloc(sizeof(xhu_job_t));
+    
+    if (job == NULL) {
+        XHU_LOG_ERROR("Could not allocate worker job.")
+        
+        return false;
+    }
+    
+    job->function = function;
+    job->data = data;
+    job->next = NULL;
+    
+    pthread_mutex_lock(&pool->mutex);
+    
+    if (pool->stopping) {
+        pthread_mutex_unlock(&pool->mutex);
+        free(job);
+        XHU_LOG_ERROR("Could not submit job. Worker pool is stopping.")
+        
+        return false;
+    }
+    
+    if (pool->tail == NULL) {
+        pool->head = job;
+    } else {
+        pool->tail->next = job;
+    }
+    
+    pool->tail = job;
+    pthread_cond_signal(&pool->jobs_available);
+    pthread_mutex_unlock(&pool->mutex);
+    
+    return true;
+}